@@ -1,5 +1,7 @@
 #version 330 core
 
+#define RANGE_FOLDED 1u
+
 // Lower the default precision to medium
 precision mediump float;
 
@@ -7,6 +9,8 @@ uniform sampler1D uTexture;
 uniform uint uDataMomentOffset;
 uniform float uDataMomentScale;
 
+uniform uint uDataMomentThreshold;
+uniform bool uRangeFoldedEnabled;
 uniform bool uCFPEnabled;
 
 flat in uint dataMoment;
@@ -16,6 +20,14 @@ layout (location = 0) out vec4 fragColor;
 
 void main()
 {
+   // Bins below the display threshold are discarded, except for range folded
+   // bins, which are displayed independently of the threshold
+   if (dataMoment == RANGE_FOLDED ? !uRangeFoldedEnabled :
+                                    dataMoment < uDataMomentThreshold)
+   {
+      discard;
+   }
+
    float texCoord = float(dataMoment - uDataMomentOffset) / uDataMomentScale;
 
    if (uCFPEnabled && cfpMoment > 8u)
@@ -0,0 +1,27 @@
+#version 330 core
+
+// Lower the default precision to medium
+precision mediump float;
+
+uniform sampler1D  uTexture;
+uniform usampler2D uDataTexture;
+uniform uint       uDataMomentOffset;
+uniform float      uDataMomentScale;
+
+smooth in vec2 texCoord;
+
+layout (location = 0) out vec4 fragColor;
+
+void main()
+{
+   // Bins which are not displayed are stored as 0
+   uint dataMoment = texture(uDataTexture, texCoord).r;
+   if (dataMoment == 0u)
+   {
+      discard;
+   }
+
+   float lutCoord = float(dataMoment - uDataMomentOffset) / uDataMomentScale;
+
+   fragColor = texture(uTexture, lutCoord);
+}
@@ -0,0 +1,16 @@
+#version 330 core
+
+// Lower the default precision to medium
+precision mediump float;
+
+uniform sampler2D uTexture;
+
+smooth in vec3 texCoord;
+smooth in vec4 color;
+
+layout (location = 0) out vec4 fragColor;
+
+void main()
+{
+   fragColor = texture(uTexture, texCoord.st) * color;
+}
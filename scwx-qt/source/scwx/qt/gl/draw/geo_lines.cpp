@@ -1,7 +1,9 @@
 #include <scwx/qt/gl/draw/geo_lines.hpp>
+#include <scwx/qt/gl/draw/geo_tile_index.hpp>
 #include <scwx/qt/util/geographic_lib.hpp>
 #include <scwx/qt/util/maplibre.hpp>
 #include <scwx/qt/util/tooltip.hpp>
+#include <scwx/util/clock.hpp>
 #include <scwx/util/logger.hpp>
 
 #include <execution>
@@ -91,6 +93,7 @@ public:
                            std::vector<float>&                     linesBuffer,
                            std::vector<GLint>&          integerBuffer,
                            std::vector<LineHoverEntry>& hoverLines);
+   void UpdateTileIndex();
 
    std::shared_ptr<GlContext> context_;
 
@@ -115,6 +118,10 @@ public:
    std::vector<LineHoverEntry> currentHoverLines_ {};
    std::vector<LineHoverEntry> newHoverLines_ {};
 
+   GeoTileIndex         tileIndex_ {};
+   std::vector<GLint>   drawFirst_ {};
+   std::vector<GLsizei> drawCount_ {};
+
    std::shared_ptr<ShaderProgram> shaderProgram_;
    GLint                          uMVPMatrixLocation_;
    GLint                          uMapMatrixLocation_;
@@ -262,23 +269,23 @@ void GeoLines::Render(const QMapLibre::CustomLayerRenderParameters& params)
       UseMapProjection(
          params, p->uMapMatrixLocation_, p->uMapScreenCoordLocation_);
 
+      // If thresholding is disabled, set the map distance to 0
+      float mapDistance = 0.0f;
+
       if (p->thresholded_)
       {
          // If thresholding is enabled, set the map distance
-         units::length::nautical_miles<float> mapDistance =
+         units::length::nautical_miles<float> mapDistanceNmi =
             util::maplibre::GetMapDistance(params);
-         gl.glUniform1f(p->uMapDistanceLocation_, mapDistance.value());
-      }
-      else
-      {
-         // If thresholding is disabled, set the map distance to 0
-         gl.glUniform1f(p->uMapDistanceLocation_, 0.0f);
+         mapDistance = mapDistanceNmi.value();
       }
 
+      gl.glUniform1f(p->uMapDistanceLocation_, mapDistance);
+
       // Selected time
       std::chrono::system_clock::time_point selectedTime =
          (p->selectedTime_ == std::chrono::system_clock::time_point {}) ?
-            std::chrono::system_clock::now() :
+            scwx::util::CurrentTime() :
             p->selectedTime_;
       gl.glUniform1i(
          p->uSelectedTimeLocation_,
@@ -286,11 +293,17 @@ void GeoLines::Render(const QMapLibre::CustomLayerRenderParameters& params)
                                selectedTime.time_since_epoch())
                                .count()));
 
-      // Draw icons
-      gl.glDrawArrays(GL_TRIANGLES,
-                      0,
-                      static_cast<GLsizei>(p->currentLineList_.size() *
-                                           kVerticesPerRectangle));
+      // Draw lines in visible tiles
+      p->tileIndex_.GetDrawRanges(
+         params, mapDistance, p->drawFirst_, p->drawCount_);
+
+      if (!p->drawFirst_.empty())
+      {
+         gl.glMultiDrawArrays(GL_TRIANGLES,
+                              p->drawFirst_.data(),
+                              p->drawCount_.data(),
+                              static_cast<GLsizei>(p->drawFirst_.size()));
+      }
    }
 }
 
@@ -306,6 +319,7 @@ void GeoLines::Deinitialize()
    p->currentLinesBuffer_.clear();
    p->currentIntegerBuffer_.clear();
    p->currentHoverLines_.clear();
+   p->tileIndex_.Clear();
 }
 
 void GeoLines::SetVisible(bool visible)
@@ -324,6 +338,9 @@ void GeoLines::StartLines()
 
 std::shared_ptr<GeoLineDrawItem> GeoLines::AddLine()
 {
+   // Lines may be removed from a background thread
+   std::unique_lock lock {p->lineMutex_};
+
    return p->newLineList_.emplace_back(std::make_shared<GeoLineDrawItem>());
 }
 
@@ -456,6 +473,67 @@ void GeoLines::FinishLines()
    p->dirty_ = true;
 }
 
+void GeoLines::RemoveLines(
+   const std::vector<std::shared_ptr<GeoLineDrawItem>>& lines)
+{
+   if (lines.empty())
+   {
+      return;
+   }
+
+   const boost::unordered_flat_set<std::shared_ptr<GeoLineDrawItem>>
+      removedLines {lines.cbegin(), lines.cend()};
+
+   std::unique_lock lock {p->lineMutex_};
+
+   // Shift retained lines down over removed lines. The current line list and
+   // buffers are kept in sync by FinishLines() and Update().
+   std::size_t lineCount = 0;
+   for (std::size_t i = 0; i < p->currentLineList_.size(); ++i)
+   {
+      if (removedLines.contains(p->currentLineList_[i]))
+      {
+         continue;
+      }
+
+      if (lineCount != i)
+      {
+         p->currentLineList_[lineCount] = std::move(p->currentLineList_[i]);
+
+         std::copy_n(p->currentLinesBuffer_.cbegin() + i * kLineBufferLength_,
+                     kLineBufferLength_,
+                     p->currentLinesBuffer_.begin() +
+                        lineCount * kLineBufferLength_);
+         std::copy_n(p->currentIntegerBuffer_.cbegin() +
+                        i * kIntegerBufferLength_,
+                     kIntegerBufferLength_,
+                     p->currentIntegerBuffer_.begin() +
+                        lineCount * kIntegerBufferLength_);
+      }
+
+      ++lineCount;
+   }
+
+   p->currentLineList_.resize(lineCount);
+   p->currentLinesBuffer_.resize(lineCount * kLineBufferLength_);
+   p->currentIntegerBuffer_.resize(lineCount * kIntegerBufferLength_);
+
+   // Release the memory held by removed lines
+   p->currentLineList_.shrink_to_fit();
+   p->currentLinesBuffer_.shrink_to_fit();
+   p->currentIntegerBuffer_.shrink_to_fit();
+
+   std::erase_if(p->newLineList_,
+                 [&removedLines](const auto& di)
+                 { return removedLines.contains(di); });
+   std::erase_if(p->currentHoverLines_,
+                 [&removedLines](const auto& entry)
+                 { return removedLines.contains(entry.di_); });
+
+   // Upload the compacted buffers and rebuild the tile index on next render
+   p->dirty_ = true;
+}
+
 void GeoLines::Impl::UpdateBuffers()
 {
    newLinesBuffer_.clear();
@@ -686,11 +764,42 @@ void GeoLines::Impl::Update()
                       sizeof(GLint) * currentIntegerBuffer_.size(),
                       currentIntegerBuffer_.data(),
                       GL_DYNAMIC_DRAW);
+
+      UpdateTileIndex();
    }
 
    dirty_ = false;
 }
 
+void GeoLines::Impl::UpdateTileIndex()
+{
+   tileIndex_.Clear();
+
+   for (std::size_t i = 0; i < currentLineList_.size(); ++i)
+   {
+      auto& di = currentLineList_[i];
+
+      // Hidden lines are discarded by the shader, and do not need to be drawn
+      if (!di->visible_)
+      {
+         continue;
+      }
+
+      GeoTileIndex::Bounds bounds {};
+      bounds.Extend(di->latitude1_, di->longitude1_);
+      bounds.Extend(di->latitude2_, di->longitude2_);
+
+      units::length::nautical_miles<double> threshold = di->threshold_;
+
+      tileIndex_.AddRange(
+         static_cast<GLint>(i * kVerticesPerRectangle),
+         static_cast<GLsizei>(kVerticesPerRectangle),
+         bounds,
+         di->width_,
+         static_cast<GLint>(std::round(threshold.value())));
+   }
+}
+
 bool GeoLines::RunMousePicking(
    const QMapLibre::CustomLayerRenderParameters& params,
    const QPointF& /* mouseLocalPos */,
@@ -721,7 +830,7 @@ bool GeoLines::RunMousePicking(
    // If no time has been selected, use the current time
    std::chrono::system_clock::time_point selectedTime =
       (p->selectedTime_ == std::chrono::system_clock::time_point {}) ?
-         std::chrono::system_clock::now() :
+         scwx::util::CurrentTime() :
          p->selectedTime_;
 
    // For each pickable line
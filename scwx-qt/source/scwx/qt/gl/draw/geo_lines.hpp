@@ -159,6 +159,15 @@ public:
     */
    void FinishLines();
 
+   /**
+    * Removes geo lines from the draw list. The remaining lines are compacted
+    * into the space occupied by the removed lines, without rebuilding their
+    * buffers. This may be called from a background thread.
+    *
+    * @param [in] lines Geo line draw items to remove
+    */
+   void RemoveLines(const std::vector<std::shared_ptr<GeoLineDrawItem>>& lines);
+
    /**
     * Registers an event handler for a geo line.
     *
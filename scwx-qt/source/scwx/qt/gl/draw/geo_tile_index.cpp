@@ -0,0 +1,211 @@
+#include <scwx/qt/gl/draw/geo_tile_index.hpp>
+#include <scwx/qt/util/maplibre.hpp>
+#include <scwx/util/logger.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include <boost/unordered/unordered_flat_map.hpp>
+#include <mbgl/util/constants.hpp>
+
+namespace scwx
+{
+namespace qt
+{
+namespace gl
+{
+namespace draw
+{
+
+static const std::string logPrefix_ = "scwx::qt::gl::draw::geo_tile_index";
+static const auto        logger_    = scwx::util::Logger::Create(logPrefix_);
+
+// Tile size in map screen coordinates (approximately 2 degrees of longitude)
+static constexpr float kTileSize_ = 2.0f;
+
+// Thresholds which are always displayed
+static constexpr GLint kNoThreshold_    = std::numeric_limits<GLint>::max();
+static constexpr GLint kMaxThreshold_   = 999;
+static constexpr GLint kUnsetThreshold_ = 0;
+
+struct GeoTile
+{
+   GeoTileIndex::Bounds                   bounds_ {};
+   float                                  pixelExtent_ {0.0f};
+   GLint                                  threshold_ {0};
+   std::vector<std::pair<GLint, GLsizei>> ranges_ {};
+};
+
+class GeoTileIndex::Impl
+{
+public:
+   explicit Impl() = default;
+   ~Impl()         = default;
+
+   static std::uint64_t GetTileKey(const glm::vec2& screenCoordinate);
+
+   boost::unordered_flat_map<std::uint64_t, std::size_t> tileMap_ {};
+   std::vector<GeoTile>                                  tiles_ {};
+
+   std::vector<std::pair<GLint, GLsizei>> drawRanges_ {};
+};
+
+GeoTileIndex::GeoTileIndex() : p(std::make_unique<Impl>()) {}
+GeoTileIndex::~GeoTileIndex() = default;
+
+GeoTileIndex::GeoTileIndex(GeoTileIndex&&) noexcept            = default;
+GeoTileIndex& GeoTileIndex::operator=(GeoTileIndex&&) noexcept = default;
+
+void GeoTileIndex::Bounds::Extend(const glm::vec2& screenCoordinate)
+{
+   min_ = glm::min(min_, screenCoordinate);
+   max_ = glm::max(max_, screenCoordinate);
+}
+
+void GeoTileIndex::Bounds::Extend(double latitude, double longitude)
+{
+   Extend(util::maplibre::LatLongToScreenCoordinate({latitude, longitude}));
+}
+
+void GeoTileIndex::Clear()
+{
+   p->tileMap_.clear();
+   p->tiles_.clear();
+}
+
+std::uint64_t GeoTileIndex::Impl::GetTileKey(const glm::vec2& screenCoordinate)
+{
+   const auto x = static_cast<std::int32_t>(
+      std::floor(screenCoordinate.x / kTileSize_));
+   const auto y = static_cast<std::int32_t>(
+      std::floor(screenCoordinate.y / kTileSize_));
+
+   return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(x)) << 32) |
+          static_cast<std::uint64_t>(static_cast<std::uint32_t>(y));
+}
+
+void GeoTileIndex::AddRange(GLint         first,
+                            GLsizei       count,
+                            const Bounds& bounds,
+                            float         pixelExtent,
+                            GLint         threshold)
+{
+   if (count <= 0 || bounds.empty())
+   {
+      return;
+   }
+
+   // Thresholds of 0 and 999 (or greater) are always displayed
+   if (threshold <= kUnsetThreshold_ || threshold >= kMaxThreshold_)
+   {
+      threshold = kNoThreshold_;
+   }
+
+   const std::uint64_t key =
+      Impl::GetTileKey((bounds.min_ + bounds.max_) * 0.5f);
+
+   auto [it, inserted] = p->tileMap_.try_emplace(key, p->tiles_.size());
+   if (inserted)
+   {
+      p->tiles_.emplace_back();
+   }
+
+   GeoTile& tile = p->tiles_[it->second];
+
+   tile.bounds_.Extend(bounds.min_);
+   tile.bounds_.Extend(bounds.max_);
+   tile.pixelExtent_ = std::max(tile.pixelExtent_, pixelExtent);
+   tile.threshold_   = std::max(tile.threshold_, threshold);
+
+   // Coalesce with the previous range in the tile if contiguous
+   if (!tile.ranges_.empty() &&
+       tile.ranges_.back().first + tile.ranges_.back().second == first)
+   {
+      tile.ranges_.back().second += count;
+   }
+   else
+   {
+      tile.ranges_.emplace_back(first, count);
+   }
+}
+
+void GeoTileIndex::GetDrawRanges(
+   const QMapLibre::CustomLayerRenderParameters& params,
+   float                                         mapDistance,
+   std::vector<GLint>&                           first,
+   std::vector<GLsizei>&                         count) const
+{
+   first.clear();
+   count.clear();
+   p->drawRanges_.clear();
+
+   // Screen coordinate units to pixels
+   const float pixelsPerUnit =
+      static_cast<float>(std::pow(2.0, params.zoom) * mbgl::util::tileSize_D /
+                         mbgl::util::DEGREES_MAX);
+
+   // The viewport circumscribes the map at any bearing. A pitched map may show
+   // beyond this extent, so no tiles are culled.
+   const bool cullViewport = (params.pitch == 0.0);
+
+   const glm::vec2 center = util::maplibre::LatLongToScreenCoordinate(
+      {params.latitude, params.longitude});
+   const float viewportExtent =
+      static_cast<float>(0.5 * std::hypot(params.width, params.height)) /
+      pixelsPerUnit;
+
+   for (auto& tile : p->tiles_)
+   {
+      // Skip tiles where every range is beyond its threshold
+      if (mapDistance > 0.0f &&
+          static_cast<float>(tile.threshold_) < mapDistance)
+      {
+         continue;
+      }
+
+      if (cullViewport)
+      {
+         const float extent =
+            viewportExtent + tile.pixelExtent_ / pixelsPerUnit;
+
+         if (tile.bounds_.max_.x < center.x - extent ||
+             tile.bounds_.min_.x > center.x + extent ||
+             tile.bounds_.max_.y < center.y - extent ||
+             tile.bounds_.min_.y > center.y + extent)
+         {
+            continue;
+         }
+      }
+
+      p->drawRanges_.insert(
+         p->drawRanges_.end(), tile.ranges_.cbegin(), tile.ranges_.cend());
+   }
+
+   // Restore draw order
+   std::sort(p->drawRanges_.begin(), p->drawRanges_.end());
+
+   for (auto& range : p->drawRanges_)
+   {
+      // Merge adjacent ranges
+      if (!first.empty() && first.back() + count.back() == range.first)
+      {
+         count.back() += range.second;
+      }
+      else
+      {
+         first.push_back(range.first);
+         count.push_back(range.second);
+      }
+   }
+}
+
+void GeoTileIndex::swap(GeoTileIndex& other) noexcept
+{
+   p.swap(other.p);
+}
+
+} // namespace draw
+} // namespace gl
+} // namespace qt
+} // namespace scwx
@@ -0,0 +1,110 @@
+#pragma once
+
+#include <scwx/qt/gl/gl.hpp>
+
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include <QMapLibre/Types>
+#include <glm/glm.hpp>
+
+namespace scwx
+{
+namespace qt
+{
+namespace gl
+{
+namespace draw
+{
+
+/**
+ * Buckets ranges of a vertex buffer into geographic tiles, so that a draw item
+ * only needs to issue draw calls for the tiles intersecting the viewport.
+ *
+ * Each range is assigned to the tile containing the center of its bounds. A
+ * tile keeps the union of the bounds of its ranges, so a range may extend
+ * beyond its tile without being culled.
+ */
+class GeoTileIndex
+{
+public:
+   /**
+    * Bounding box in map screen coordinates, as returned by
+    * util::maplibre::LatLongToScreenCoordinate.
+    */
+   struct Bounds
+   {
+      glm::vec2 min_ {std::numeric_limits<float>::max()};
+      glm::vec2 max_ {std::numeric_limits<float>::lowest()};
+
+      bool empty() const { return min_.x > max_.x || min_.y > max_.y; }
+
+      void Extend(const glm::vec2& screenCoordinate);
+      void Extend(double latitude, double longitude);
+   };
+
+   explicit GeoTileIndex();
+   ~GeoTileIndex();
+
+   GeoTileIndex(const GeoTileIndex&)            = delete;
+   GeoTileIndex& operator=(const GeoTileIndex&) = delete;
+
+   GeoTileIndex(GeoTileIndex&&) noexcept;
+   GeoTileIndex& operator=(GeoTileIndex&&) noexcept;
+
+   /**
+    * Removes all ranges from the index.
+    */
+   void Clear();
+
+   /**
+    * Adds a range of vertices to the index. Ranges must be added in the order
+    * they are to be drawn.
+    *
+    * @param [in] first First vertex of the range
+    * @param [in] count Number of vertices in the range
+    * @param [in] bounds Bounds of the range in map screen coordinates
+    * @param [in] pixelExtent Maximum pixel offset of any vertex from its
+    * geographic location
+    * @param [in] threshold Threshold of the range in nautical miles, or 0 if
+    * there is no threshold
+    */
+   void AddRange(GLint         first,
+                 GLsizei       count,
+                 const Bounds& bounds,
+                 float         pixelExtent,
+                 GLint         threshold);
+
+   /**
+    * Gets the vertex ranges to draw for the current viewport, in draw order.
+    * Adjacent ranges are merged.
+    *
+    * @param [in] params Map render parameters
+    * @param [in] mapDistance Current map distance in nautical miles, or 0 if
+    * thresholding is disabled
+    * @param [out] first First vertex of each range
+    * @param [out] count Number of vertices in each range
+    */
+   void GetDrawRanges(const QMapLibre::CustomLayerRenderParameters& params,
+                      float                 mapDistance,
+                      std::vector<GLint>&   first,
+                      std::vector<GLsizei>& count) const;
+
+   /**
+    * Swaps the contents of two indices.
+    *
+    * @param [in] other Index to swap with
+    */
+   void swap(GeoTileIndex& other) noexcept;
+
+private:
+   class Impl;
+
+   std::unique_ptr<Impl> p;
+};
+
+} // namespace draw
+} // namespace gl
+} // namespace qt
+} // namespace scwx
@@ -1,7 +1,9 @@
 #include <scwx/qt/gl/draw/placefile_icons.hpp>
+#include <scwx/qt/gl/draw/geo_tile_index.hpp>
 #include <scwx/qt/util/maplibre.hpp>
 #include <scwx/qt/util/texture_atlas.hpp>
 #include <scwx/qt/util/tooltip.hpp>
+#include <scwx/util/clock.hpp>
 #include <scwx/util/logger.hpp>
 
 #include <execution>
@@ -126,6 +128,12 @@ public:
    std::vector<IconHoverEntry> currentHoverIcons_ {};
    std::vector<IconHoverEntry> newHoverIcons_ {};
 
+   GeoTileIndex currentTileIndex_ {};
+   GeoTileIndex newTileIndex_ {};
+
+   std::vector<GLint>   drawFirst_ {};
+   std::vector<GLsizei> drawCount_ {};
+
    std::shared_ptr<ShaderProgram> shaderProgram_;
    GLint                          uMVPMatrixLocation_;
    GLint                          uMapMatrixLocation_;
@@ -276,23 +284,23 @@ void PlacefileIcons::Render(
       UseMapProjection(
          params, p->uMapMatrixLocation_, p->uMapScreenCoordLocation_);
 
+      // If thresholding is disabled, set the map distance to 0
+      float mapDistance = 0.0f;
+
       if (p->thresholded_)
       {
          // If thresholding is enabled, set the map distance
-         units::length::nautical_miles<float> mapDistance =
+         units::length::nautical_miles<float> mapDistanceNmi =
             util::maplibre::GetMapDistance(params);
-         gl.glUniform1f(p->uMapDistanceLocation_, mapDistance.value());
-      }
-      else
-      {
-         // If thresholding is disabled, set the map distance to 0
-         gl.glUniform1f(p->uMapDistanceLocation_, 0.0f);
+         mapDistance = mapDistanceNmi.value();
       }
 
+      gl.glUniform1f(p->uMapDistanceLocation_, mapDistance);
+
       // Selected time
       std::chrono::system_clock::time_point selectedTime =
          (p->selectedTime_ == std::chrono::system_clock::time_point {}) ?
-            std::chrono::system_clock::now() :
+            scwx::util::CurrentTime() :
             p->selectedTime_;
       gl.glUniform1i(
          p->uSelectedTimeLocation_,
@@ -304,8 +312,17 @@ void PlacefileIcons::Render(
       gl.glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
       gl.glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
 
-      // Draw icons
-      gl.glDrawArrays(GL_TRIANGLES, 0, p->numVertices_);
+      // Draw icons in visible tiles
+      p->currentTileIndex_.GetDrawRanges(
+         params, mapDistance, p->drawFirst_, p->drawCount_);
+
+      if (!p->drawFirst_.empty())
+      {
+         gl.glMultiDrawArrays(GL_TRIANGLES,
+                              p->drawFirst_.data(),
+                              p->drawCount_.data(),
+                              static_cast<GLsizei>(p->drawFirst_.size()));
+      }
    }
 }
 
@@ -323,6 +340,7 @@ void PlacefileIcons::Deinitialize()
    p->currentHoverIcons_.clear();
    p->currentIconBuffer_.clear();
    p->currentIntegerBuffer_.clear();
+   p->currentTileIndex_.Clear();
    p->textureBuffer_.clear();
 }
 
@@ -366,6 +384,7 @@ void PlacefileIcons::StartIcons()
    p->newIconBuffer_.clear();
    p->newIntegerBuffer_.clear();
    p->newHoverIcons_.clear();
+   p->newTileIndex_.Clear();
 }
 
 void PlacefileIcons::SetIconFiles(
@@ -410,6 +429,7 @@ void PlacefileIcons::FinishIcons()
    p->currentIconBuffer_.swap(p->newIconBuffer_);
    p->currentIntegerBuffer_.swap(p->newIntegerBuffer_);
    p->currentHoverIcons_.swap(p->newHoverIcons_);
+   p->currentTileIndex_.swap(p->newTileIndex_);
 
    // Clear the new buffers
    p->newIconList_.clear();
@@ -418,6 +438,7 @@ void PlacefileIcons::FinishIcons()
    p->newIconBuffer_.clear();
    p->newIntegerBuffer_.clear();
    p->newHoverIcons_.clear();
+   p->newTileIndex_.Clear();
 
    // Mark the draw item dirty
    p->dirty_ = true;
@@ -430,6 +451,7 @@ void PlacefileIcons::Impl::UpdateBuffers()
    newIntegerBuffer_.clear();
    newIntegerBuffer_.reserve(newIconList_.size() * kVerticesPerRectangle *
                              kIntegersPerVertex_);
+   newTileIndex_.Clear();
 
    for (auto& di : newIconList_)
    {
@@ -494,6 +516,17 @@ void PlacefileIcons::Impl::UpdateBuffers()
       units::angle::degrees<float> angle = di->angle_;
       const float                  a     = angle.value();
 
+      // Add icon to tile index, allowing for any rotation of the offsets
+      GeoTileIndex::Bounds bounds {};
+      bounds.Extend(lat, lon);
+      newTileIndex_.AddRange(
+         static_cast<GLint>(newIconBuffer_.size() / kPointsPerVertex),
+         static_cast<GLsizei>(kVerticesPerRectangle),
+         bounds,
+         std::hypot(std::max(std::abs(lx), std::abs(rx)),
+                    std::max(std::abs(ty), std::abs(by))),
+         thresholdValue);
+
       // Modulate color
       const float mc0 = di->modulate_[0] / 255.0f;
       const float mc1 = di->modulate_[1] / 255.0f;
@@ -718,7 +751,7 @@ bool PlacefileIcons::RunMousePicking(
    // If no time has been selected, use the current time
    std::chrono::system_clock::time_point selectedTime =
       (p->selectedTime_ == std::chrono::system_clock::time_point {}) ?
-         std::chrono::system_clock::now() :
+         scwx::util::CurrentTime() :
          p->selectedTime_;
 
    // For each pickable icon
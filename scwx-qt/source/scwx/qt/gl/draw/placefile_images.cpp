@@ -1,6 +1,7 @@
 #include <scwx/qt/gl/draw/placefile_images.hpp>
 #include <scwx/qt/util/maplibre.hpp>
 #include <scwx/qt/util/texture_atlas.hpp>
+#include <scwx/util/clock.hpp>
 #include <scwx/util/logger.hpp>
 
 #include <QDir>
@@ -261,7 +262,7 @@ void PlacefileImages::Render(
       // Selected time
       std::chrono::system_clock::time_point selectedTime =
          (p->selectedTime_ == std::chrono::system_clock::time_point {}) ?
-            std::chrono::system_clock::now() :
+            scwx::util::CurrentTime() :
             p->selectedTime_;
       gl.glUniform1i(
          p->uSelectedTimeLocation_,
@@ -1,7 +1,9 @@
 #include <scwx/qt/gl/draw/placefile_lines.hpp>
+#include <scwx/qt/gl/draw/geo_tile_index.hpp>
 #include <scwx/qt/util/geographic_lib.hpp>
 #include <scwx/qt/util/maplibre.hpp>
 #include <scwx/qt/util/tooltip.hpp>
+#include <scwx/util/clock.hpp>
 #include <scwx/util/logger.hpp>
 
 #include <execution>
@@ -96,6 +98,12 @@ public:
    std::vector<LineHoverEntry> currentHoverLines_ {};
    std::vector<LineHoverEntry> newHoverLines_ {};
 
+   GeoTileIndex currentTileIndex_ {};
+   GeoTileIndex newTileIndex_ {};
+
+   std::vector<GLint>   drawFirst_ {};
+   std::vector<GLsizei> drawCount_ {};
+
    std::shared_ptr<ShaderProgram> shaderProgram_;
    GLint                          uMVPMatrixLocation_;
    GLint                          uMapMatrixLocation_;
@@ -233,23 +241,23 @@ void PlacefileLines::Render(
       UseMapProjection(
          params, p->uMapMatrixLocation_, p->uMapScreenCoordLocation_);
 
+      // If thresholding is disabled, set the map distance to 0
+      float mapDistance = 0.0f;
+
       if (p->thresholded_)
       {
          // If thresholding is enabled, set the map distance
-         units::length::nautical_miles<float> mapDistance =
+         units::length::nautical_miles<float> mapDistanceNmi =
             util::maplibre::GetMapDistance(params);
-         gl.glUniform1f(p->uMapDistanceLocation_, mapDistance.value());
-      }
-      else
-      {
-         // If thresholding is disabled, set the map distance to 0
-         gl.glUniform1f(p->uMapDistanceLocation_, 0.0f);
+         mapDistance = mapDistanceNmi.value();
       }
 
+      gl.glUniform1f(p->uMapDistanceLocation_, mapDistance);
+
       // Selected time
       std::chrono::system_clock::time_point selectedTime =
          (p->selectedTime_ == std::chrono::system_clock::time_point {}) ?
-            std::chrono::system_clock::now() :
+            scwx::util::CurrentTime() :
             p->selectedTime_;
       gl.glUniform1i(
          p->uSelectedTimeLocation_,
@@ -257,8 +265,17 @@ void PlacefileLines::Render(
                                selectedTime.time_since_epoch())
                                .count()));
 
-      // Draw icons
-      gl.glDrawArrays(GL_TRIANGLES, 0, p->numVertices_);
+      // Draw lines in visible tiles
+      p->currentTileIndex_.GetDrawRanges(
+         params, mapDistance, p->drawFirst_, p->drawCount_);
+
+      if (!p->drawFirst_.empty())
+      {
+         gl.glMultiDrawArrays(GL_TRIANGLES,
+                              p->drawFirst_.data(),
+                              p->drawCount_.data(),
+                              static_cast<GLsizei>(p->drawFirst_.size()));
+      }
    }
 }
 
@@ -274,6 +291,7 @@ void PlacefileLines::Deinitialize()
    p->currentLinesBuffer_.clear();
    p->currentIntegerBuffer_.clear();
    p->currentHoverLines_.clear();
+   p->currentTileIndex_.Clear();
 }
 
 void PlacefileLines::StartLines()
@@ -282,6 +300,7 @@ void PlacefileLines::StartLines()
    p->newLinesBuffer_.clear();
    p->newIntegerBuffer_.clear();
    p->newHoverLines_.clear();
+   p->newTileIndex_.Clear();
 
    p->newNumLines_ = 0u;
 }
@@ -304,11 +323,13 @@ void PlacefileLines::FinishLines()
    p->currentLinesBuffer_.swap(p->newLinesBuffer_);
    p->currentIntegerBuffer_.swap(p->newIntegerBuffer_);
    p->currentHoverLines_.swap(p->newHoverLines_);
+   p->currentTileIndex_.swap(p->newTileIndex_);
 
    // Clear the new buffers
    p->newLinesBuffer_.clear();
    p->newIntegerBuffer_.clear();
    p->newHoverLines_.clear();
+   p->newTileIndex_.Clear();
 
    // Update the number of lines
    p->currentNumLines_ = p->newNumLines_;
@@ -339,6 +360,10 @@ void PlacefileLines::Impl::UpdateBuffers(
    std::vector<units::angle::degrees<double>> angles {};
    angles.reserve(di->elements_.size() - 1);
 
+   // Tile index range
+   const std::size_t    firstVertex = newLinesBuffer_.size() / kPointsPerVertex;
+   GeoTileIndex::Bounds bounds {};
+
    // For each element pair inside a Line statement, render a black line
    for (std::size_t i = 0; i < di->elements_.size() - 1; ++i)
    {
@@ -353,6 +378,9 @@ void PlacefileLines::Impl::UpdateBuffers(
          util::GeographicLib::GetAngle(lat1, lon1, lat2, lon2);
       angles.push_back(angle);
 
+      bounds.Extend(lat1, lon1);
+      bounds.Extend(lat2, lon2);
+
       // Buffer line with hover text
       BufferLine(di,
                  di->elements_[i],
@@ -379,6 +407,16 @@ void PlacefileLines::Impl::UpdateBuffers(
                  startTime,
                  endTime);
    }
+
+   // The rotated outline extends at most its full width from each vertex
+   const std::size_t vertexCount =
+      newLinesBuffer_.size() / kPointsPerVertex - firstVertex;
+
+   newTileIndex_.AddRange(static_cast<GLint>(firstVertex),
+                          static_cast<GLsizei>(vertexCount),
+                          bounds,
+                          static_cast<float>(di->width_ + 2),
+                          thresholdValue);
 }
 
 void PlacefileLines::Impl::BufferLine(
@@ -529,7 +567,7 @@ bool PlacefileLines::RunMousePicking(
    // If no time has been selected, use the current time
    std::chrono::system_clock::time_point selectedTime =
       (p->selectedTime_ == std::chrono::system_clock::time_point {}) ?
-         std::chrono::system_clock::now() :
+         scwx::util::CurrentTime() :
          p->selectedTime_;
 
    // For each pickable line
@@ -1,11 +1,17 @@
 #include <scwx/qt/gl/draw/placefile_polygons.hpp>
+#include <scwx/qt/gl/draw/geo_tile_index.hpp>
 #include <scwx/qt/util/maplibre.hpp>
+#include <scwx/util/clock.hpp>
 #include <scwx/util/logger.hpp>
 
+#include <algorithm>
+#include <execution>
 #include <mutex>
+#include <unordered_map>
 
 #include <GL/glu.h>
 #include <boost/container/stable_vector.hpp>
+#include <boost/container_hash/hash.hpp>
 
 #if defined(_WIN32)
 typedef void (*_GLUfuncptr)(void);
@@ -42,20 +48,30 @@ static constexpr std::size_t kTessVertexSize_    = kTessVertexA_ + 1;
 
 typedef std::array<GLdouble, kTessVertexSize_> TessVertexArray;
 
-class PlacefilePolygons::Impl
+struct TessellatedPolygon
+{
+   std::vector<GLfloat> buffer_ {};
+   std::vector<GLint>   integerBuffer_ {};
+
+   GeoTileIndex::Bounds bounds_ {};
+   float                pixelExtent_ {0.0f};
+   GLint                threshold_ {0};
+};
+
+struct TessellationCacheEntry
+{
+   std::shared_ptr<const gr::Placefile::PolygonDrawItem> drawItem_ {};
+   std::shared_ptr<const TessellatedPolygon>              polygon_ {};
+};
+
+/**
+ * Wraps a GLU tessellator. GLU tessellators are not thread-safe, so each
+ * thread tessellating polygons uses its own instance.
+ */
+class Tessellator
 {
 public:
-   explicit Impl(const std::shared_ptr<GlContext>& context) :
-       context_ {context},
-       shaderProgram_ {nullptr},
-       uMVPMatrixLocation_(GL_INVALID_INDEX),
-       uMapMatrixLocation_(GL_INVALID_INDEX),
-       uMapScreenCoordLocation_(GL_INVALID_INDEX),
-       uMapDistanceLocation_(GL_INVALID_INDEX),
-       uSelectedTimeLocation_(GL_INVALID_INDEX),
-       vao_ {GL_INVALID_INDEX},
-       vbo_ {GL_INVALID_INDEX},
-       numVertices_ {0}
+   explicit Tessellator()
    {
       tessellator_ = gluNewTess();
 
@@ -75,13 +91,17 @@ public:
                       GLU_TESS_ERROR,
                       (_GLUfuncptr) &TessellateErrorCallback);
    }
+   ~Tessellator() { gluDeleteTess(tessellator_); }
 
-   ~Impl() { gluDeleteTess(tessellator_); }
+   Tessellator(const Tessellator&)            = delete;
+   Tessellator& operator=(const Tessellator&) = delete;
 
-   void Update();
+   static Tessellator& Instance();
 
-   void Tessellate(const std::shared_ptr<gr::Placefile::PolygonDrawItem>& di);
+   std::shared_ptr<const TessellatedPolygon>
+   Tessellate(const gr::Placefile::PolygonDrawItem& di);
 
+private:
    static void TessellateCombineCallback(GLdouble coords[3],
                                          void*    vertexData[4],
                                          GLfloat  weight[4],
@@ -90,6 +110,42 @@ public:
    static void TessellateVertexCallback(void* vertexData, void* polygonData);
    static void TessellateErrorCallback(GLenum errorCode);
 
+   GLUtesselator* tessellator_;
+
+   boost::container::stable_vector<TessVertexArray> tessCombineBuffer_ {};
+
+   TessellatedPolygon* currentPolygon_ {nullptr};
+
+   GLint currentThreshold_ {};
+   GLint currentStartTime_ {};
+   GLint currentEndTime_ {};
+};
+
+class PlacefilePolygons::Impl
+{
+public:
+   explicit Impl(const std::shared_ptr<GlContext>& context) :
+       context_ {context},
+       shaderProgram_ {nullptr},
+       uMVPMatrixLocation_(GL_INVALID_INDEX),
+       uMapMatrixLocation_(GL_INVALID_INDEX),
+       uMapScreenCoordLocation_(GL_INVALID_INDEX),
+       uMapDistanceLocation_(GL_INVALID_INDEX),
+       uSelectedTimeLocation_(GL_INVALID_INDEX),
+       vao_ {GL_INVALID_INDEX},
+       vbo_ {GL_INVALID_INDEX},
+       numVertices_ {0}
+   {
+   }
+
+   ~Impl() = default;
+
+   void Update();
+
+   static std::size_t Hash(const gr::Placefile::PolygonDrawItem& di);
+   static bool        Equal(const gr::Placefile::PolygonDrawItem& a,
+                            const gr::Placefile::PolygonDrawItem& b);
+
    std::shared_ptr<GlContext> context_;
 
    bool dirty_ {false};
@@ -97,7 +153,13 @@ public:
 
    std::chrono::system_clock::time_point selectedTime_ {};
 
-   boost::container::stable_vector<TessVertexArray> tessCombineBuffer_ {};
+   // Polygons added since StartPolygons, tessellated in FinishPolygons
+   std::vector<std::shared_ptr<gr::Placefile::PolygonDrawItem>> newPolygons_ {};
+
+   // Tessellation results from the previous set of polygons, keyed by polygon
+   // hash. The source polygon is kept to resolve hash collisions.
+   std::unordered_multimap<std::size_t, TessellationCacheEntry>
+      tessellationCache_ {};
 
    std::mutex           bufferMutex_ {};
    std::vector<GLfloat> currentBuffer_ {};
@@ -105,7 +167,11 @@ public:
    std::vector<GLfloat> newBuffer_ {};
    std::vector<GLint>   newIntegerBuffer_ {};
 
-   GLUtesselator* tessellator_;
+   GeoTileIndex currentTileIndex_ {};
+   GeoTileIndex newTileIndex_ {};
+
+   std::vector<GLint>   drawFirst_ {};
+   std::vector<GLsizei> drawCount_ {};
 
    std::shared_ptr<ShaderProgram> shaderProgram_;
    GLint                          uMVPMatrixLocation_;
@@ -118,10 +184,6 @@ public:
    std::array<GLuint, 2> vbo_;
 
    GLsizei numVertices_;
-
-   GLint currentThreshold_ {};
-   GLint currentStartTime_ {};
-   GLint currentEndTime_ {};
 };
 
 PlacefilePolygons::PlacefilePolygons(
@@ -223,6 +285,8 @@ void PlacefilePolygons::Initialize()
 void PlacefilePolygons::Render(
    const QMapLibre::CustomLayerRenderParameters& params)
 {
+   std::unique_lock lock {p->bufferMutex_};
+
    if (!p->currentBuffer_.empty())
    {
       gl::OpenGLFunctions& gl = p->context_->gl();
@@ -235,23 +299,23 @@ void PlacefilePolygons::Render(
       UseMapProjection(
          params, p->uMapMatrixLocation_, p->uMapScreenCoordLocation_);
 
+      // If thresholding is disabled, set the map distance to 0
+      float mapDistance = 0.0f;
+
       if (p->thresholded_)
       {
          // If thresholding is enabled, set the map distance
-         units::length::nautical_miles<float> mapDistance =
+         units::length::nautical_miles<float> mapDistanceNmi =
             util::maplibre::GetMapDistance(params);
-         gl.glUniform1f(p->uMapDistanceLocation_, mapDistance.value());
-      }
-      else
-      {
-         // If thresholding is disabled, set the map distance to 0
-         gl.glUniform1f(p->uMapDistanceLocation_, 0.0f);
+         mapDistance = mapDistanceNmi.value();
       }
 
+      gl.glUniform1f(p->uMapDistanceLocation_, mapDistance);
+
       // Selected time
       std::chrono::system_clock::time_point selectedTime =
          (p->selectedTime_ == std::chrono::system_clock::time_point {}) ?
-            std::chrono::system_clock::now() :
+            scwx::util::CurrentTime() :
             p->selectedTime_;
       gl.glUniform1i(
          p->uSelectedTimeLocation_,
@@ -259,8 +323,17 @@ void PlacefilePolygons::Render(
                                selectedTime.time_since_epoch())
                                .count()));
 
-      // Draw icons
-      gl.glDrawArrays(GL_TRIANGLES, 0, p->numVertices_);
+      // Draw polygons in visible tiles
+      p->currentTileIndex_.GetDrawRanges(
+         params, mapDistance, p->drawFirst_, p->drawCount_);
+
+      if (!p->drawFirst_.empty())
+      {
+         gl.glMultiDrawArrays(GL_TRIANGLES,
+                              p->drawFirst_.data(),
+                              p->drawCount_.data(),
+                              static_cast<GLsizei>(p->drawFirst_.size()));
+      }
    }
 }
 
@@ -276,6 +349,7 @@ void PlacefilePolygons::Deinitialize()
    // Clear the current buffers
    p->currentBuffer_.clear();
    p->currentIntegerBuffer_.clear();
+   p->currentTileIndex_.Clear();
 }
 
 void PlacefilePolygons::StartPolygons()
@@ -283,6 +357,8 @@ void PlacefilePolygons::StartPolygons()
    // Clear the new buffers
    p->newBuffer_.clear();
    p->newIntegerBuffer_.clear();
+   p->newTileIndex_.Clear();
+   p->newPolygons_.clear();
 }
 
 void PlacefilePolygons::AddPolygon(
@@ -290,21 +366,92 @@ void PlacefilePolygons::AddPolygon(
 {
    if (di != nullptr)
    {
-      p->Tessellate(di);
+      p->newPolygons_.push_back(di);
    }
 }
 
 void PlacefilePolygons::FinishPolygons()
 {
+   typedef std::pair<std::size_t, TessellationCacheEntry> TessellationResult;
+
+   std::vector<TessellationResult> results(p->newPolygons_.size());
+
+   // Tessellate each polygon in parallel, reusing the previous result for any
+   // polygon that has not changed. The cache is not modified until all polygons
+   // have been processed.
+   std::transform(std::execution::par,
+                  p->newPolygons_.cbegin(),
+                  p->newPolygons_.cend(),
+                  results.begin(),
+                  [this](const auto& di)
+                  {
+                     std::size_t hash = Impl::Hash(*di);
+
+                     auto [first, last] =
+                        p->tessellationCache_.equal_range(hash);
+                     auto it = std::find_if(
+                        first,
+                        last,
+                        [&di](const auto& entry)
+                        { return Impl::Equal(*entry.second.drawItem_, *di); });
+                     if (it != last)
+                     {
+                        return TessellationResult {
+                           hash, {di, it->second.polygon_}};
+                     }
+
+                     return TessellationResult {
+                        hash, {di, Tessellator::Instance().Tessellate(*di)}};
+                  });
+
+   // Replace the cache with the current set of polygons, and concatenate the
+   // tessellated polygons into the new buffers
+   std::size_t bufferSize        = 0u;
+   std::size_t integerBufferSize = 0u;
+
+   p->tessellationCache_.clear();
+   for (auto& result : results)
+   {
+      bufferSize += result.second.polygon_->buffer_.size();
+      integerBufferSize += result.second.polygon_->integerBuffer_.size();
+      p->tessellationCache_.insert(result);
+   }
+
+   p->newBuffer_.reserve(bufferSize);
+   p->newIntegerBuffer_.reserve(integerBufferSize);
+
+   for (auto& result : results)
+   {
+      auto& polygon = *result.second.polygon_;
+
+      p->newTileIndex_.AddRange(
+         static_cast<GLint>(p->newBuffer_.size() / kPointsPerVertex),
+         static_cast<GLsizei>(polygon.buffer_.size() / kPointsPerVertex),
+         polygon.bounds_,
+         polygon.pixelExtent_,
+         polygon.threshold_);
+
+      p->newBuffer_.insert(p->newBuffer_.end(),
+                           polygon.buffer_.cbegin(),
+                           polygon.buffer_.cend());
+      p->newIntegerBuffer_.insert(p->newIntegerBuffer_.end(),
+                                  polygon.integerBuffer_.cbegin(),
+                                  polygon.integerBuffer_.cend());
+   }
+
+   p->newPolygons_.clear();
+
    std::unique_lock lock {p->bufferMutex_};
 
    // Swap buffers
    p->currentBuffer_.swap(p->newBuffer_);
    p->currentIntegerBuffer_.swap(p->newIntegerBuffer_);
+   p->currentTileIndex_.swap(p->newTileIndex_);
 
    // Clear the new buffers
    p->newBuffer_.clear();
    p->newIntegerBuffer_.clear();
+   p->newTileIndex_.Clear();
 
    // Mark the draw item dirty
    p->dirty_ = true;
@@ -316,8 +463,6 @@ void PlacefilePolygons::Impl::Update()
    {
       gl::OpenGLFunctions& gl = context_->gl();
 
-      std::unique_lock lock {bufferMutex_};
-
       // Buffer vertex data
       gl.glBindBuffer(GL_ARRAY_BUFFER, vbo_[0]);
       gl.glBufferData(GL_ARRAY_BUFFER,
@@ -339,32 +484,112 @@ void PlacefilePolygons::Impl::Update()
    }
 }
 
-void PlacefilePolygons::Impl::Tessellate(
-   const std::shared_ptr<gr::Placefile::PolygonDrawItem>& di)
+std::size_t
+PlacefilePolygons::Impl::Hash(const gr::Placefile::PolygonDrawItem& di)
 {
+   std::size_t seed = 0;
+
+   boost::hash_combine(seed, di.threshold_.value());
+   boost::hash_combine(seed, di.startTime_.time_since_epoch().count());
+   boost::hash_combine(seed, di.endTime_.time_since_epoch().count());
+   boost::hash_combine(seed, di.color_[0]);
+   boost::hash_combine(seed, di.color_[1]);
+   boost::hash_combine(seed, di.color_[2]);
+   boost::hash_combine(seed, di.color_[3]);
+
+   for (auto& contour : di.contours_)
+   {
+      boost::hash_combine(seed, contour.size());
+
+      for (auto& element : contour)
+      {
+         boost::hash_combine(seed, element.latitude_);
+         boost::hash_combine(seed, element.longitude_);
+         boost::hash_combine(seed, element.x_);
+         boost::hash_combine(seed, element.y_);
+         boost::hash_combine(seed, element.color_.has_value());
+
+         if (element.color_.has_value())
+         {
+            auto& color = element.color_.value();
+            boost::hash_combine(seed, color[0]);
+            boost::hash_combine(seed, color[1]);
+            boost::hash_combine(seed, color[2]);
+            boost::hash_combine(seed, color[3]);
+         }
+      }
+   }
+
+   return seed;
+}
+
+bool PlacefilePolygons::Impl::Equal(const gr::Placefile::PolygonDrawItem& a,
+                                    const gr::Placefile::PolygonDrawItem& b)
+{
+   if (a.threshold_ != b.threshold_ || a.startTime_ != b.startTime_ ||
+       a.endTime_ != b.endTime_ || a.color_ != b.color_ ||
+       a.contours_.size() != b.contours_.size())
+   {
+      return false;
+   }
+
+   for (std::size_t i = 0; i < a.contours_.size(); ++i)
+   {
+      if (!std::equal(a.contours_[i].cbegin(),
+                      a.contours_[i].cend(),
+                      b.contours_[i].cbegin(),
+                      b.contours_[i].cend(),
+                      [](const auto& lhs, const auto& rhs)
+                      {
+                         return lhs.latitude_ == rhs.latitude_ &&
+                                lhs.longitude_ == rhs.longitude_ &&
+                                lhs.x_ == rhs.x_ && lhs.y_ == rhs.y_ &&
+                                lhs.color_ == rhs.color_;
+                      }))
+      {
+         return false;
+      }
+   }
+
+   return true;
+}
+
+Tessellator& Tessellator::Instance()
+{
+   thread_local Tessellator tessellator_ {};
+   return tessellator_;
+}
+
+std::shared_ptr<const TessellatedPolygon>
+Tessellator::Tessellate(const gr::Placefile::PolygonDrawItem& di)
+{
+   auto polygon    = std::make_shared<TessellatedPolygon>();
+   currentPolygon_ = polygon.get();
+
    // Vertex storage
    boost::container::stable_vector<TessVertexArray> vertices {};
 
    // Default color to "Color" statement
-   boost::gil::rgba8_pixel_t lastColor = di->color_;
+   boost::gil::rgba8_pixel_t lastColor = di.color_;
 
    // Current threshold
-   units::length::nautical_miles<double> threshold = di->threshold_;
-   currentThreshold_ = static_cast<GLint>(std::round(threshold.value()));
+   units::length::nautical_miles<double> threshold = di.threshold_;
+   currentThreshold_   = static_cast<GLint>(std::round(threshold.value()));
+   polygon->threshold_ = currentThreshold_;
 
    // Start and end time
    currentStartTime_ =
       static_cast<GLint>(std::chrono::duration_cast<std::chrono::minutes>(
-                            di->startTime_.time_since_epoch())
+                            di.startTime_.time_since_epoch())
                             .count());
    currentEndTime_ =
       static_cast<GLint>(std::chrono::duration_cast<std::chrono::minutes>(
-                            di->endTime_.time_since_epoch())
+                            di.endTime_.time_since_epoch())
                             .count());
 
    gluTessBeginPolygon(tessellator_, this);
 
-   for (auto& contour : di->contours_)
+   for (auto& contour : di.contours_)
    {
       gluTessBeginContour(tessellator_);
 
@@ -374,6 +599,13 @@ void PlacefilePolygons::Impl::Tessellate(
          auto screenCoordinate = util::maplibre::LatLongToScreenCoordinate(
             {element.latitude_, element.longitude_});
 
+         // Extend polygon bounds
+         polygon->bounds_.Extend(screenCoordinate);
+         polygon->pixelExtent_ =
+            std::max({polygon->pixelExtent_,
+                      static_cast<float>(std::abs(element.x_)),
+                      static_cast<float>(std::abs(element.y_))});
+
          // Update the most recent color if specified
          if (element.color_.has_value())
          {
@@ -405,23 +637,26 @@ void PlacefilePolygons::Impl::Tessellate(
    tessCombineBuffer_.clear();
 
    // Remove extra vertices that don't correspond to a full triangle
-   while (newBuffer_.size() % kVerticesPerTriangle != 0)
-   {
-      newBuffer_.pop_back();
-      newIntegerBuffer_.pop_back();
-   }
+   std::size_t numVertices = polygon->buffer_.size() / kPointsPerVertex;
+   numVertices -= numVertices % kVerticesPerTriangle;
+   polygon->buffer_.resize(numVertices * kPointsPerVertex);
+   polygon->integerBuffer_.resize(numVertices * kIntegersPerVertex_);
+
+   currentPolygon_ = nullptr;
+
+   return polygon;
 }
 
-void PlacefilePolygons::Impl::TessellateCombineCallback(GLdouble coords[3],
-                                                        void*    vertexData[4],
-                                                        GLfloat  w[4],
-                                                        void**   outData,
-                                                        void*    polygonData)
+void Tessellator::TessellateCombineCallback(GLdouble coords[3],
+                                            void*    vertexData[4],
+                                            GLfloat  w[4],
+                                            void**   outData,
+                                            void*    polygonData)
 {
    static constexpr std::size_t r = kTessVertexR_;
    static constexpr std::size_t a = kTessVertexA_;
 
-   Impl* self = static_cast<Impl*>(polygonData);
+   Tessellator* self = static_cast<Tessellator*>(polygonData);
 
    // Create new vertex data with given coordinates and interpolated color
    auto& newVertexData = self->tessCombineBuffer_.emplace_back( //
@@ -453,29 +688,31 @@ void PlacefilePolygons::Impl::TessellateCombineCallback(GLdouble coords[3],
    *outData = &newVertexData;
 }
 
-void PlacefilePolygons::Impl::TessellateVertexCallback(void* vertexData,
-                                                       void* polygonData)
+void Tessellator::TessellateVertexCallback(void* vertexData,
+                                           void* polygonData)
 {
-   Impl*     self = static_cast<Impl*>(polygonData);
-   GLdouble* data = static_cast<GLdouble*>(vertexData);
+   Tessellator* self    = static_cast<Tessellator*>(polygonData);
+   GLdouble*    data    = static_cast<GLdouble*>(vertexData);
+   auto&        buffer  = self->currentPolygon_->buffer_;
+   auto&        integer = self->currentPolygon_->integerBuffer_;
 
    // Buffer vertex
-   self->newBuffer_.insert(self->newBuffer_.end(),
-                           {static_cast<float>(data[kTessVertexScreenX_]),
-                            static_cast<float>(data[kTessVertexScreenY_]),
-                            static_cast<float>(data[kTessVertexXOffset_]),
-                            static_cast<float>(data[kTessVertexYOffset_]),
-                            static_cast<float>(data[kTessVertexR_]),
-                            static_cast<float>(data[kTessVertexG_]),
-                            static_cast<float>(data[kTessVertexB_]),
-                            static_cast<float>(data[kTessVertexA_])});
-   self->newIntegerBuffer_.insert(self->newIntegerBuffer_.end(),
-                                  {self->currentThreshold_,
-                                   self->currentStartTime_,
-                                   self->currentEndTime_});
+   buffer.insert(buffer.end(),
+                 {static_cast<float>(data[kTessVertexScreenX_]),
+                  static_cast<float>(data[kTessVertexScreenY_]),
+                  static_cast<float>(data[kTessVertexXOffset_]),
+                  static_cast<float>(data[kTessVertexYOffset_]),
+                  static_cast<float>(data[kTessVertexR_]),
+                  static_cast<float>(data[kTessVertexG_]),
+                  static_cast<float>(data[kTessVertexB_]),
+                  static_cast<float>(data[kTessVertexA_])});
+   integer.insert(integer.end(),
+                  {self->currentThreshold_,
+                   self->currentStartTime_,
+                   self->currentEndTime_});
 }
 
-void PlacefilePolygons::Impl::TessellateErrorCallback(GLenum errorCode)
+void Tessellator::TessellateErrorCallback(GLenum errorCode)
 {
    logger_->error("GL Error: {}", errorCode);
 }
@@ -1,12 +1,17 @@
 #include <scwx/qt/gl/draw/placefile_text.hpp>
 #include <scwx/qt/manager/font_manager.hpp>
-#include <scwx/qt/manager/placefile_manager.hpp>
 #include <scwx/qt/settings/text_settings.hpp>
 #include <scwx/qt/util/maplibre.hpp>
 #include <scwx/qt/util/tooltip.hpp>
+#include <scwx/util/clock.hpp>
 #include <scwx/util/logger.hpp>
 
-#include <fmt/format.h>
+#include <cfloat>
+#include <cstdint>
+
+#include <QString>
+#include <boost/geometry.hpp>
+#include <boost/geometry/index/rtree.hpp>
 #include <imgui.h>
 #include <mbgl/util/constants.hpp>
 
@@ -22,52 +27,114 @@ namespace draw
 static const std::string logPrefix_ = "scwx::qt::gl::draw::placefile_text";
 static const auto        logger_    = scwx::util::Logger::Create(logPrefix_);
 
+namespace bg  = boost::geometry;
+namespace bgi = boost::geometry::index;
+
+static constexpr std::size_t kVerticesPerTriangle  = 3;
+static constexpr std::size_t kVerticesPerRectangle = kVerticesPerTriangle * 2;
+static constexpr std::size_t kPointsPerVertex      = 12;
+
+// Threshold, start time, end time
+static constexpr std::size_t kIntegersPerVertex_ = 3;
+
+typedef bg::model::point<float, 2, bg::cs::cartesian> HoverPoint;
+typedef bg::model::box<HoverPoint>                    HoverBox;
+typedef std::pair<HoverPoint, std::size_t>            HoverValue;
+typedef bgi::rtree<HoverValue, bgi::rstar<16>>        HoverIndex;
+
+struct TextHoverEntry
+{
+   std::shared_ptr<const gr::Placefile::TextDrawItem> di_;
+
+   glm::vec2 p_;  // Map screen coordinate of the text anchor
+   glm::vec2 tl_; // Top left pixel offset of the text block
+   glm::vec2 br_; // Bottom right pixel offset of the text block
+};
+
+struct TextLayout
+{
+   bool                         valid_ {false};
+   bool                         dropShadow_ {false};
+   std::shared_ptr<ImFontAtlas> fontAtlas_ {};
+
+   std::vector<float> textBuffer_ {};
+   std::vector<GLint> integerBuffer_ {};
+
+   std::vector<TextHoverEntry> hoverEntries_ {};
+   HoverIndex                  hoverIndex_ {};
+   float                       maxHoverExtent_ {};
+};
+
 class PlacefileText::Impl
 {
 public:
    explicit Impl(const std::shared_ptr<GlContext>& context,
                  const std::string&                placefileName) :
-       context_ {context}, placefileName_ {placefileName}
+       context_ {context},
+       placefileName_ {placefileName},
+       shaderProgram_ {nullptr},
+       uMVPMatrixLocation_(GL_INVALID_INDEX),
+       uMapMatrixLocation_(GL_INVALID_INDEX),
+       uMapScreenCoordLocation_(GL_INVALID_INDEX),
+       uMapDistanceLocation_(GL_INVALID_INDEX),
+       uSelectedTimeLocation_(GL_INVALID_INDEX),
+       vao_ {GL_INVALID_INDEX},
+       vbo_ {GL_INVALID_INDEX},
+       numVertices_ {0}
    {
    }
 
    ~Impl() {}
 
-   void RenderTextDrawItem(
-      const QMapLibre::CustomLayerRenderParameters&             params,
-      const std::shared_ptr<const gr::Placefile::TextDrawItem>& di);
-   void RenderText(const QMapLibre::CustomLayerRenderParameters& params,
-                   const std::string&                            text,
-                   const std::string&                            hoverText,
-                   boost::gil::rgba8_pixel_t                     color,
-                   float                                         x,
-                   float                                         y);
+   void Update();
+
+   static TextLayout LayoutText(
+      const std::vector<std::shared_ptr<const gr::Placefile::TextDrawItem>>&
+                                                            textList,
+      const std::vector<std::shared_ptr<types::ImGuiFont>>& fonts,
+      bool                                                  dropShadow,
+      const std::shared_ptr<ImFontAtlas>&                   fontAtlas);
+   static void AddGlyphs(TextLayout&                      layout,
+                         ImFont*                          font,
+                         const std::string&               text,
+                         float                            latitude,
+                         float                            longitude,
+                         float                            left,
+                         float                            top,
+                         const boost::gil::rgba8_pixel_t& color,
+                         GLint                            threshold,
+                         GLint                            startTime,
+                         GLint                            endTime);
 
    std::shared_ptr<GlContext> context_;
 
    std::string placefileName_;
 
+   bool dirty_ {false};
    bool thresholded_ {false};
 
    std::chrono::system_clock::time_point selectedTime_ {};
 
-   std::uint32_t textId_ {};
-   glm::vec2     mapScreenCoordLocation_ {};
-   float         mapScale_ {1.0f};
-   float         mapBearingCos_ {1.0f};
-   float         mapBearingSin_ {0.0f};
-   float         halfWidth_ {};
-   float         halfHeight_ {};
-   std::string   hoverText_ {};
-
-   units::length::nautical_miles<double> mapDistance_ {};
-
    std::mutex listMutex_ {};
    std::vector<std::shared_ptr<const gr::Placefile::TextDrawItem>> textList_ {};
    std::vector<std::shared_ptr<const gr::Placefile::TextDrawItem>> newList_ {};
 
    std::vector<std::shared_ptr<types::ImGuiFont>> fonts_ {};
    std::vector<std::shared_ptr<types::ImGuiFont>> newFonts_ {};
+
+   TextLayout layout_ {};
+
+   std::shared_ptr<ShaderProgram> shaderProgram_;
+   GLint                          uMVPMatrixLocation_;
+   GLint                          uMapMatrixLocation_;
+   GLint                          uMapScreenCoordLocation_;
+   GLint                          uMapDistanceLocation_;
+   GLint                          uSelectedTimeLocation_;
+
+   GLuint                vao_;
+   std::array<GLuint, 2> vbo_;
+
+   GLsizei numVertices_;
 };
 
 PlacefileText::PlacefileText(const std::shared_ptr<GlContext>& context,
@@ -96,161 +163,526 @@ void PlacefileText::set_thresholded(bool thresholded)
    p->thresholded_ = thresholded;
 }
 
-void PlacefileText::Initialize() {}
+void PlacefileText::Initialize()
+{
+   gl::OpenGLFunctions& gl   = p->context_->gl();
+   auto&                gl30 = p->context_->gl30();
+
+   p->shaderProgram_ = p->context_->GetShaderProgram(
+      {{GL_VERTEX_SHADER, ":/gl/geo_texture2d.vert"},
+       {GL_GEOMETRY_SHADER, ":/gl/threshold.geom"},
+       {GL_FRAGMENT_SHADER, ":/gl/text.frag"}});
+
+   p->uMVPMatrixLocation_ = p->shaderProgram_->GetUniformLocation("uMVPMatrix");
+   p->uMapMatrixLocation_ = p->shaderProgram_->GetUniformLocation("uMapMatrix");
+   p->uMapScreenCoordLocation_ =
+      p->shaderProgram_->GetUniformLocation("uMapScreenCoord");
+   p->uMapDistanceLocation_ =
+      p->shaderProgram_->GetUniformLocation("uMapDistance");
+   p->uSelectedTimeLocation_ =
+      p->shaderProgram_->GetUniformLocation("uSelectedTime");
+
+   gl.glGenVertexArrays(1, &p->vao_);
+   gl.glGenBuffers(static_cast<GLsizei>(p->vbo_.size()), p->vbo_.data());
+
+   gl.glBindVertexArray(p->vao_);
+   gl.glBindBuffer(GL_ARRAY_BUFFER, p->vbo_[0]);
+   gl.glBufferData(GL_ARRAY_BUFFER, 0u, nullptr, GL_DYNAMIC_DRAW);
+
+   // aLatLong
+   gl.glVertexAttribPointer(0,
+                            2,
+                            GL_FLOAT,
+                            GL_FALSE,
+                            kPointsPerVertex * sizeof(float),
+                            static_cast<void*>(0));
+   gl.glEnableVertexAttribArray(0);
+
+   // aXYOffset
+   gl.glVertexAttribPointer(1,
+                            2,
+                            GL_FLOAT,
+                            GL_FALSE,
+                            kPointsPerVertex * sizeof(float),
+                            reinterpret_cast<void*>(2 * sizeof(float)));
+   gl.glEnableVertexAttribArray(1);
+
+   // aTexCoord
+   gl.glVertexAttribPointer(2,
+                            3,
+                            GL_FLOAT,
+                            GL_FALSE,
+                            kPointsPerVertex * sizeof(float),
+                            reinterpret_cast<void*>(4 * sizeof(float)));
+   gl.glEnableVertexAttribArray(2);
+
+   // aModulate
+   gl.glVertexAttribPointer(3,
+                            4,
+                            GL_FLOAT,
+                            GL_FALSE,
+                            kPointsPerVertex * sizeof(float),
+                            reinterpret_cast<void*>(7 * sizeof(float)));
+   gl.glEnableVertexAttribArray(3);
+
+   // aAngle
+   gl.glVertexAttribPointer(4,
+                            1,
+                            GL_FLOAT,
+                            GL_FALSE,
+                            kPointsPerVertex * sizeof(float),
+                            reinterpret_cast<void*>(11 * sizeof(float)));
+   gl.glEnableVertexAttribArray(4);
+
+   gl.glBindBuffer(GL_ARRAY_BUFFER, p->vbo_[1]);
+   gl.glBufferData(GL_ARRAY_BUFFER, 0u, nullptr, GL_DYNAMIC_DRAW);
+
+   // aThreshold
+   gl.glVertexAttribIPointer(5, //
+                             1,
+                             GL_INT,
+                             kIntegersPerVertex_ * sizeof(GLint),
+                             static_cast<void*>(0));
+   gl.glEnableVertexAttribArray(5);
+
+   // aTimeRange
+   gl.glVertexAttribIPointer(6, //
+                             2,
+                             GL_INT,
+                             kIntegersPerVertex_ * sizeof(GLint),
+                             reinterpret_cast<void*>(1 * sizeof(GLint)));
+   gl.glEnableVertexAttribArray(6);
+
+   // aDisplayed
+   gl30.glVertexAttribI1i(7, 1);
+
+   p->dirty_ = true;
+}
 
 void PlacefileText::Render(const QMapLibre::CustomLayerRenderParameters& params)
 {
    std::unique_lock lock {p->listMutex_};
 
-   if (!p->textList_.empty())
+   if (p->textList_.empty())
+   {
+      return;
+   }
+
+   // Text is laid out with the glyphs of the font atlas selected for the
+   // current ImGui frame. If a different atlas was selected since the text was
+   // laid out, or the drop shadow setting changed, the glyph quads must be
+   // regenerated.
+   const ImFontAtlas* frameFontAtlas = ImGui::GetIO().Fonts;
+
+   const bool dropShadow = settings::TextSettings::Instance()
+                              .placefile_text_drop_shadow_enabled()
+                              .GetValue();
+
+   if (!p->layout_.valid_ || p->layout_.fontAtlas_.get() != frameFontAtlas ||
+       p->layout_.dropShadow_ != dropShadow)
    {
-      // Reset text ID per frame
-      p->textId_ = 0;
-      p->hoverText_.clear();
-
-      // Update map screen coordinate and scale information
-      p->mapScreenCoordLocation_ = util::maplibre::LatLongToScreenCoordinate(
-         {params.latitude, params.longitude});
-      p->mapScale_ = std::pow(2.0, params.zoom) * mbgl::util::tileSize_D /
-                     mbgl::util::DEGREES_MAX;
-      p->mapBearingCos_ = cosf(params.bearing * common::kDegreesToRadians);
-      p->mapBearingSin_ = sinf(params.bearing * common::kDegreesToRadians);
-      p->halfWidth_     = params.width * 0.5f;
-      p->halfHeight_    = params.height * 0.5f;
-      p->mapDistance_   = util::maplibre::GetMapDistance(params);
-
-      for (auto& di : p->textList_)
+      auto fontAtlas = manager::FontManager::Instance().imgui_font_atlas();
+      if (fontAtlas.get() != frameFontAtlas)
       {
-         p->RenderTextDrawItem(params, di);
+         // A newer font atlas was built during the frame, and is selected
+         // starting with the next frame
+         return;
       }
+
+      p->layout_ =
+         Impl::LayoutText(p->textList_, p->fonts_, dropShadow, fontAtlas);
+      p->dirty_ = true;
+   }
+
+   gl::OpenGLFunctions& gl = p->context_->gl();
+
+   gl.glBindVertexArray(p->vao_);
+
+   p->Update();
+   p->shaderProgram_->Use();
+   UseDefaultProjection(params, p->uMVPMatrixLocation_);
+   UseMapProjection(
+      params, p->uMapMatrixLocation_, p->uMapScreenCoordLocation_);
+
+   if (p->thresholded_)
+   {
+      // If thresholding is enabled, set the map distance
+      units::length::nautical_miles<float> mapDistance =
+         util::maplibre::GetMapDistance(params);
+      gl.glUniform1f(p->uMapDistanceLocation_, mapDistance.value());
    }
+   else
+   {
+      // If thresholding is disabled, set the map distance to 0
+      gl.glUniform1f(p->uMapDistanceLocation_, 0.0f);
+   }
+
+   // Selected time
+   std::chrono::system_clock::time_point selectedTime =
+      (p->selectedTime_ == std::chrono::system_clock::time_point {}) ?
+         scwx::util::CurrentTime() :
+         p->selectedTime_;
+   gl.glUniform1i(
+      p->uSelectedTimeLocation_,
+      static_cast<GLint>(std::chrono::duration_cast<std::chrono::minutes>(
+                            selectedTime.time_since_epoch())
+                            .count()));
+
+   // Bind the ImGui font atlas texture. OpenGL contexts are shared, so the
+   // texture uploaded for the font atlas is valid in this context.
+   gl.glActiveTexture(GL_TEXTURE0);
+   gl.glBindTexture(GL_TEXTURE_2D,
+                    (GLuint)(std::intptr_t)ImGui::GetIO().Fonts->TexID);
+
+   // Draw text
+   gl.glDrawArrays(GL_TRIANGLES, 0, p->numVertices_);
 }
 
-void PlacefileText::Impl::RenderTextDrawItem(
-   const QMapLibre::CustomLayerRenderParameters&             params,
-   const std::shared_ptr<const gr::Placefile::TextDrawItem>& di)
+void PlacefileText::Deinitialize()
 {
-   // If no time has been selected, use the current time
-   std::chrono::system_clock::time_point selectedTime =
-      (selectedTime_ == std::chrono::system_clock::time_point {}) ?
-         std::chrono::system_clock::now() :
-         selectedTime_;
+   gl::OpenGLFunctions& gl = p->context_->gl();
 
-   if ((!thresholded_ || mapDistance_ <= di->threshold_) &&
-       (di->startTime_ == std::chrono::system_clock::time_point {} ||
-        (di->startTime_ <= selectedTime && selectedTime < di->endTime_)))
+   gl.glDeleteVertexArrays(1, &p->vao_);
+   gl.glDeleteBuffers(static_cast<GLsizei>(p->vbo_.size()), p->vbo_.data());
+
+   std::unique_lock lock {p->listMutex_};
+
+   // Clear the text list
+   p->textList_.clear();
+   p->layout_ = {};
+}
+
+void PlacefileText::Impl::Update()
+{
+   gl::OpenGLFunctions& gl = context_->gl();
+
+   // If buffers need updating
+   if (dirty_)
    {
-      const auto screenCoordinates = (util::maplibre::LatLongToScreenCoordinate(
-                                         {di->latitude_, di->longitude_}) -
-                                      mapScreenCoordLocation_) *
-                                     mapScale_;
-
-      // Rotate text according to map rotation
-      float rotatedX = screenCoordinates.x;
-      float rotatedY = screenCoordinates.y;
-      if (params.bearing != 0.0)
-      {
-         rotatedX = screenCoordinates.x * mapBearingCos_ -
-                    screenCoordinates.y * mapBearingSin_;
-         rotatedY = screenCoordinates.x * mapBearingSin_ +
-                    screenCoordinates.y * mapBearingCos_;
-      }
+      // Buffer vertex data
+      gl.glBindBuffer(GL_ARRAY_BUFFER, vbo_[0]);
+      gl.glBufferData(GL_ARRAY_BUFFER,
+                      sizeof(float) * layout_.textBuffer_.size(),
+                      layout_.textBuffer_.data(),
+                      GL_DYNAMIC_DRAW);
+
+      // Buffer threshold data
+      gl.glBindBuffer(GL_ARRAY_BUFFER, vbo_[1]);
+      gl.glBufferData(GL_ARRAY_BUFFER,
+                      sizeof(GLint) * layout_.integerBuffer_.size(),
+                      layout_.integerBuffer_.data(),
+                      GL_DYNAMIC_DRAW);
+
+      numVertices_ =
+         static_cast<GLsizei>(layout_.textBuffer_.size() / kPointsPerVertex);
+   }
 
+   dirty_ = false;
+}
+
+TextLayout PlacefileText::Impl::LayoutText(
+   const std::vector<std::shared_ptr<const gr::Placefile::TextDrawItem>>&
+                                                         textList,
+   const std::vector<std::shared_ptr<types::ImGuiFont>>& fonts,
+   bool                                                  dropShadow,
+   const std::shared_ptr<ImFontAtlas>&                   fontAtlas)
+{
+   TextLayout layout {};
+   layout.valid_      = true;
+   layout.dropShadow_ = dropShadow;
+   layout.fontAtlas_  = fontAtlas;
+
+   std::vector<HoverValue> hoverValues {};
+
+   for (auto& di : textList)
+   {
       // Clamp font number to 0-8
       std::size_t fontNumber = std::clamp<std::size_t>(di->fontNumber_, 0, 8);
 
-      // Set the font for the drop shadow and text
-      ImGui::PushFont(fonts_[fontNumber]->font());
+      ImFont* font =
+         (fontNumber < fonts.size() && fonts[fontNumber] != nullptr) ?
+            fonts[fontNumber]->font(fontAtlas.get()) :
+            nullptr;
+      if (font == nullptr || di->text_.empty())
+      {
+         continue;
+      }
 
-      if (settings::TextSettings::Instance()
-             .placefile_text_drop_shadow_enabled()
-             .GetValue())
+      // Threshold value
+      units::length::nautical_miles<double> threshold = di->threshold_;
+      GLint thresholdValue = static_cast<GLint>(std::round(threshold.value()));
+
+      // Start and end time
+      GLint startTime =
+         static_cast<GLint>(std::chrono::duration_cast<std::chrono::minutes>(
+                               di->startTime_.time_since_epoch())
+                               .count());
+      GLint endTime =
+         static_cast<GLint>(std::chrono::duration_cast<std::chrono::minutes>(
+                               di->endTime_.time_since_epoch())
+                               .count());
+
+      // Latitude and longitude coordinates in degrees
+      const float lat = static_cast<float>(di->latitude_);
+      const float lon = static_cast<float>(di->longitude_);
+
+      // Center the text block on the offset, aligned to whole pixels
+      const ImVec2 textSize =
+         font->CalcTextSizeA(font->FontSize,
+                             FLT_MAX,
+                             0.0f,
+                             di->text_.c_str(),
+                             di->text_.c_str() + di->text_.size());
+      const float left =
+         std::roundf(static_cast<float>(di->x_) - textSize.x * 0.5f);
+      const float top =
+         std::roundf(static_cast<float>(di->y_) + textSize.y * 0.5f);
+
+      if (dropShadow)
       {
          // Draw a drop shadow 1 pixel to the lower right, in black, with the
          // original transparency level
-         RenderText(params,
-                    di->text_,
-                    {},
-                    boost::gil::rgba8_pixel_t {0, 0, 0, di->color_[3]},
-                    rotatedX + di->x_ + halfWidth_ + 1.0f,
-                    rotatedY + di->y_ + halfHeight_ - 1.0f);
+         AddGlyphs(layout,
+                   font,
+                   di->text_,
+                   lat,
+                   lon,
+                   left + 1.0f,
+                   top - 1.0f,
+                   boost::gil::rgba8_pixel_t {0, 0, 0, di->color_[3]},
+                   thresholdValue,
+                   startTime,
+                   endTime);
       }
 
-      // Draw the text
-      RenderText(params,
-                 di->text_,
-                 di->hoverText_,
-                 di->color_,
-                 rotatedX + di->x_ + halfWidth_,
-                 rotatedY + di->y_ + halfHeight_);
-
-      // Reset the font
-      ImGui::PopFont();
+      AddGlyphs(layout,
+                font,
+                di->text_,
+                lat,
+                lon,
+                left,
+                top,
+                di->color_,
+                thresholdValue,
+                startTime,
+                endTime);
+
+      if (!di->hoverText_.empty())
+      {
+         const auto sc = util::maplibre::LatLongToScreenCoordinate(
+            {di->latitude_, di->longitude_});
+
+         const glm::vec2 tl {left, top};
+         const glm::vec2 br {left + textSize.x, top - textSize.y};
+
+         // The text block may rotate about the anchor relative to the map, so
+         // the search extent is the furthest corner from the anchor
+         layout.maxHoverExtent_ =
+            std::max({layout.maxHoverExtent_,
+                      glm::length(tl),
+                      glm::length(br),
+                      glm::length(glm::vec2 {tl.x, br.y}),
+                      glm::length(glm::vec2 {br.x, tl.y})});
+
+         hoverValues.emplace_back(HoverPoint {sc.x, sc.y},
+                                  layout.hoverEntries_.size());
+         layout.hoverEntries_.emplace_back(TextHoverEntry {di, sc, tl, br});
+      }
    }
+
+   // Bulk load the hover index
+   layout.hoverIndex_ = HoverIndex(hoverValues.cbegin(), hoverValues.cend());
+
+   return layout;
 }
 
-void PlacefileText::Impl::RenderText(
-   const QMapLibre::CustomLayerRenderParameters& params,
-   const std::string&                            text,
-   const std::string&                            hoverText,
-   boost::gil::rgba8_pixel_t                     color,
-   float                                         x,
-   float                                         y)
+void PlacefileText::Impl::AddGlyphs(TextLayout&                      layout,
+                                    ImFont*                          font,
+                                    const std::string&               text,
+                                    float                            latitude,
+                                    float                            longitude,
+                                    float                            left,
+                                    float                            top,
+                                    const boost::gil::rgba8_pixel_t& color,
+                                    GLint                            threshold,
+                                    GLint                            startTime,
+                                    GLint                            endTime)
 {
-   const std::string windowName {
-      fmt::format("PlacefileText-{}-{}", placefileName_, ++textId_)};
-
-   // Convert screen to ImGui coordinates
-   y = params.height - y;
-
-   // Setup "window" to hold text
-   ImGui::SetNextWindowPos(
-      ImVec2 {x, y}, ImGuiCond_Always, ImVec2 {0.5f, 0.5f});
-   ImGui::Begin(windowName.c_str(),
-                nullptr,
-                ImGuiWindowFlags_AlwaysAutoResize |
-                   ImGuiWindowFlags_NoDecoration | ImGuiWindowFlags_NoNav |
-                   ImGuiWindowFlags_NoBackground);
-
-   // Render text
-   ImGui::PushStyleColor(ImGuiCol_Text,
-                         IM_COL32(color[0], color[1], color[2], color[3]));
-   ImGui::TextUnformatted(text.c_str());
-   ImGui::PopStyleColor();
-
-   // Store hover text for mouse picking pass
-   if (!hoverText.empty() && ImGui::IsItemHovered())
+   // Modulate color
+   const float mc0 = color[0] / 255.0f;
+   const float mc1 = color[1] / 255.0f;
+   const float mc2 = color[2] / 255.0f;
+   const float mc3 = color[3] / 255.0f;
+
+   const float lat = latitude;
+   const float lon = longitude;
+
+   float penX = 0.0f;
+   float penY = 0.0f;
+
+   for (char32_t c : QString::fromStdString(text).toStdU32String())
    {
-      hoverText_ = hoverText;
-   }
+      if (c == '\n')
+      {
+         penX = 0.0f;
+         penY += font->FontSize;
+         continue;
+      }
+      else if (c == '\r')
+      {
+         continue;
+      }
 
-   // End window
-   ImGui::End();
-}
+      const ImFontGlyph* glyph = font->FindGlyph(static_cast<ImWchar>(c));
+      if (glyph == nullptr)
+      {
+         continue;
+      }
 
-void PlacefileText::Deinitialize()
-{
-   std::unique_lock lock {p->listMutex_};
+      if (glyph->Visible)
+      {
+         // Pixel offsets, ImGui glyph coordinates increase downward
+         const float lx = left + penX + glyph->X0;
+         const float rx = left + penX + glyph->X1;
+         const float ty = top - (penY + glyph->Y0);
+         const float by = top - (penY + glyph->Y1);
+
+         // Texture coordinates
+         const float ls = glyph->U0;
+         const float rs = glyph->U1;
+         const float tt = glyph->V0;
+         const float bt = glyph->V1;
+
+         // clang-format off
+         layout.textBuffer_.insert(
+            layout.textBuffer_.end(),
+            {
+               lat, lon, lx, by, ls, bt, 0.0f, mc0, mc1, mc2, mc3, 0.0f, // BL
+               lat, lon, lx, ty, ls, tt, 0.0f, mc0, mc1, mc2, mc3, 0.0f, // TL
+               lat, lon, rx, by, rs, bt, 0.0f, mc0, mc1, mc2, mc3, 0.0f, // BR
+               lat, lon, rx, by, rs, bt, 0.0f, mc0, mc1, mc2, mc3, 0.0f, // BR
+               lat, lon, rx, ty, rs, tt, 0.0f, mc0, mc1, mc2, mc3, 0.0f, // TR
+               lat, lon, lx, ty, ls, tt, 0.0f, mc0, mc1, mc2, mc3, 0.0f  // TL
+            });
+         // clang-format on
+
+         for (std::size_t i = 0; i < kVerticesPerRectangle; ++i)
+         {
+            layout.integerBuffer_.insert(layout.integerBuffer_.end(),
+                                         {threshold, startTime, endTime});
+         }
+      }
 
-   // Clear the text list
-   p->textList_.clear();
+      penX += glyph->AdvanceX;
+   }
 }
 
 bool PlacefileText::RunMousePicking(
-   const QMapLibre::CustomLayerRenderParameters& /* params */,
+   const QMapLibre::CustomLayerRenderParameters& params,
    const QPointF& /* mouseLocalPos */,
-   const QPointF& mouseGlobalPos,
-   const glm::vec2& /* mouseCoords */,
+   const QPointF&   mouseGlobalPos,
+   const glm::vec2& mouseCoords,
    const common::Coordinate& /* mouseGeoCoords */,
    std::shared_ptr<types::EventHandler>& /* eventHandler */)
 {
+   std::unique_lock lock {p->listMutex_};
+
+   const TextLayout& layout = p->layout_;
+
+   if (layout.hoverEntries_.empty())
+   {
+      return false;
+   }
+
+   // Map scale in pixels per map screen coordinate
+   const float mapScale = static_cast<float>(
+      std::pow(2.0, params.zoom) * mbgl::util::tileSize_D /
+      mbgl::util::DEGREES_MAX);
+   const float mapBearingCos =
+      cosf(static_cast<float>(params.bearing * common::kDegreesToRadians));
+   const float mapBearingSin =
+      sinf(static_cast<float>(params.bearing * common::kDegreesToRadians));
+
+   units::length::meters<double> mapDistance =
+      (p->thresholded_) ? util::maplibre::GetMapDistance(params) :
+                          units::length::meters<double> {0.0};
+
+   // If no time has been selected, use the current time
+   std::chrono::system_clock::time_point selectedTime =
+      (p->selectedTime_ == std::chrono::system_clock::time_point {}) ?
+         scwx::util::CurrentTime() :
+         p->selectedTime_;
+
+   // Find text anchors close enough to the mouse cursor to be hovered
+   const float             extent = layout.maxHoverExtent_ / mapScale;
+   std::vector<HoverValue> candidates {};
+   layout.hoverIndex_.query(
+      bgi::intersects(
+         HoverBox {HoverPoint {mouseCoords.x - extent, mouseCoords.y - extent},
+                   HoverPoint {mouseCoords.x + extent,
+                               mouseCoords.y + extent}}),
+      std::back_inserter(candidates));
+
+   // Text drawn last is on top, search in reverse draw order
+   std::sort(candidates.begin(),
+             candidates.end(),
+             [](const HoverValue& a, const HoverValue& b)
+             { return a.second > b.second; });
+
+   auto it = std::find_if(
+      candidates.cbegin(),
+      candidates.cend(),
+      [&](const HoverValue& value)
+      {
+         const TextHoverEntry& text = layout.hoverEntries_[value.second];
+
+         if ((
+                // Placefile is thresholded
+                mapDistance > units::length::meters<double> {0.0} &&
+
+                // Placefile threshold is > 0 and < 999 nmi
+                text.di_->threshold_ >
+                   units::length::nautical_miles<double> {0.0} &&
+                static_cast<int>(std::round(
+                   units::length::nautical_miles<double> {text.di_->threshold_}
+                      .value())) < 999 &&
+
+                // Map distance is beyond the threshold
+                text.di_->threshold_ < mapDistance) ||
+
+             (
+                // Text has a start time
+                text.di_->startTime_ !=
+                   std::chrono::system_clock::time_point {} &&
+
+                // The time range has not yet started
+                (selectedTime < text.di_->startTime_ ||
+
+                 // The time range has ended
+                 text.di_->endTime_ <= selectedTime)))
+         {
+            // Text is not pickable
+            return false;
+         }
+
+         // Mouse offset from the text anchor in screen pixels, rotated
+         // according to map rotation
+         const glm::vec2 offset = (mouseCoords - text.p_) * mapScale;
+         const float     x = offset.x * mapBearingCos - offset.y * mapBearingSin;
+         const float     y = offset.x * mapBearingSin + offset.y * mapBearingCos;
+
+         return (text.tl_.x <= x && x <= text.br_.x && //
+                 text.br_.y <= y && y <= text.tl_.y);
+      });
+
    bool itemPicked = false;
 
    // Create tooltip for hover text
-   if (!p->hoverText_.empty())
+   if (it != candidates.cend())
    {
       itemPicked = true;
-      util::tooltip::Show(p->hoverText_, mouseGlobalPos);
+      util::tooltip::Show(layout.hoverEntries_[it->second].di_->hoverText_,
+                          mouseGlobalPos);
    }
 
    return itemPicked;
@@ -295,15 +727,42 @@ void PlacefileText::AddText(
 
 void PlacefileText::FinishText()
 {
+   auto& fontManager = manager::FontManager::Instance();
+
+   // Lay out the glyph quads outside of the render thread if a font atlas is
+   // built. A built font atlas is immutable, so no lock is required. Otherwise,
+   // layout is deferred to the next render.
+   TextLayout newLayout {};
+   auto       fontAtlas = fontManager.imgui_font_atlas();
+
+   if (fontAtlas != nullptr)
+   {
+      newLayout = Impl::LayoutText(p->newList_,
+                                   p->newFonts_,
+                                   settings::TextSettings::Instance()
+                                      .placefile_text_drop_shadow_enabled()
+                                      .GetValue(),
+                                   fontAtlas);
+   }
+   else
+   {
+      logger_->trace("Font atlas not built, deferring text layout: {}",
+                     p->placefileName_);
+   }
+
    std::unique_lock lock {p->listMutex_};
 
    // Swap text lists
    p->textList_.swap(p->newList_);
    p->fonts_.swap(p->newFonts_);
+   p->layout_ = std::move(newLayout);
 
    // Clear the new list
    p->newList_.clear();
    p->newFonts_.clear();
+
+   // Mark the draw item dirty
+   p->dirty_ = true;
 }
 
 } // namespace draw
@@ -1,7 +1,10 @@
 #include <scwx/qt/gl/draw/placefile_triangles.hpp>
+#include <scwx/qt/gl/draw/geo_tile_index.hpp>
 #include <scwx/qt/util/maplibre.hpp>
+#include <scwx/util/clock.hpp>
 #include <scwx/util/logger.hpp>
 
+#include <algorithm>
 #include <mutex>
 
 namespace scwx
@@ -59,6 +62,12 @@ public:
    std::vector<GLfloat> newBuffer_ {};
    std::vector<GLint>   newIntegerBuffer_ {};
 
+   GeoTileIndex currentTileIndex_ {};
+   GeoTileIndex newTileIndex_ {};
+
+   std::vector<GLint>   drawFirst_ {};
+   std::vector<GLsizei> drawCount_ {};
+
    std::shared_ptr<ShaderProgram> shaderProgram_;
    GLint                          uMVPMatrixLocation_;
    GLint                          uMapMatrixLocation_;
@@ -171,6 +180,8 @@ void PlacefileTriangles::Initialize()
 void PlacefileTriangles::Render(
    const QMapLibre::CustomLayerRenderParameters& params)
 {
+   std::unique_lock lock {p->bufferMutex_};
+
    if (!p->currentBuffer_.empty())
    {
       gl::OpenGLFunctions& gl = p->context_->gl();
@@ -183,23 +194,23 @@ void PlacefileTriangles::Render(
       UseMapProjection(
          params, p->uMapMatrixLocation_, p->uMapScreenCoordLocation_);
 
+      // If thresholding is disabled, set the map distance to 0
+      float mapDistance = 0.0f;
+
       if (p->thresholded_)
       {
          // If thresholding is enabled, set the map distance
-         units::length::nautical_miles<float> mapDistance =
+         units::length::nautical_miles<float> mapDistanceNmi =
             util::maplibre::GetMapDistance(params);
-         gl.glUniform1f(p->uMapDistanceLocation_, mapDistance.value());
-      }
-      else
-      {
-         // If thresholding is disabled, set the map distance to 0
-         gl.glUniform1f(p->uMapDistanceLocation_, 0.0f);
+         mapDistance = mapDistanceNmi.value();
       }
 
+      gl.glUniform1f(p->uMapDistanceLocation_, mapDistance);
+
       // Selected time
       std::chrono::system_clock::time_point selectedTime =
          (p->selectedTime_ == std::chrono::system_clock::time_point {}) ?
-            std::chrono::system_clock::now() :
+            scwx::util::CurrentTime() :
             p->selectedTime_;
       gl.glUniform1i(
          p->uSelectedTimeLocation_,
@@ -207,8 +218,17 @@ void PlacefileTriangles::Render(
                                selectedTime.time_since_epoch())
                                .count()));
 
-      // Draw icons
-      gl.glDrawArrays(GL_TRIANGLES, 0, p->numVertices_);
+      // Draw triangles in visible tiles
+      p->currentTileIndex_.GetDrawRanges(
+         params, mapDistance, p->drawFirst_, p->drawCount_);
+
+      if (!p->drawFirst_.empty())
+      {
+         gl.glMultiDrawArrays(GL_TRIANGLES,
+                              p->drawFirst_.data(),
+                              p->drawCount_.data(),
+                              static_cast<GLsizei>(p->drawFirst_.size()));
+      }
    }
 }
 
@@ -224,6 +244,7 @@ void PlacefileTriangles::Deinitialize()
    // Clear the current buffers
    p->currentBuffer_.clear();
    p->currentIntegerBuffer_.clear();
+   p->currentTileIndex_.Clear();
 }
 
 void PlacefileTriangles::StartTriangles()
@@ -231,6 +252,7 @@ void PlacefileTriangles::StartTriangles()
    // Clear the new buffers
    p->newBuffer_.clear();
    p->newIntegerBuffer_.clear();
+   p->newTileIndex_.Clear();
 }
 
 void PlacefileTriangles::AddTriangles(
@@ -249,10 +271,12 @@ void PlacefileTriangles::FinishTriangles()
    // Swap buffers
    p->currentBuffer_.swap(p->newBuffer_);
    p->currentIntegerBuffer_.swap(p->newIntegerBuffer_);
+   p->currentTileIndex_.swap(p->newTileIndex_);
 
    // Clear the new buffers
    p->newBuffer_.clear();
    p->newIntegerBuffer_.clear();
+   p->newTileIndex_.Clear();
 
    // Mark the draw item dirty
    p->dirty_ = true;
@@ -278,6 +302,11 @@ void PlacefileTriangles::Impl::UpdateBuffers(
    // Default color to "Color" statement
    boost::gil::rgba8_pixel_t lastColor = di->color_;
 
+   // Tile index range
+   const std::size_t    firstVertex = newBuffer_.size() / kPointsPerVertex;
+   GeoTileIndex::Bounds bounds {};
+   float                pixelExtent = 0.0f;
+
    // For each element inside a Triangles statement, add a vertex
    for (auto& element : di->elements_)
    {
@@ -289,6 +318,9 @@ void PlacefileTriangles::Impl::UpdateBuffers(
       const float x = static_cast<float>(element.x_);
       const float y = static_cast<float>(element.y_);
 
+      bounds.Extend(screenCoordinate);
+      pixelExtent = std::max({pixelExtent, std::abs(x), std::abs(y)});
+
       // Update the most recent color if specified
       if (element.color_.has_value())
       {
@@ -309,11 +341,17 @@ void PlacefileTriangles::Impl::UpdateBuffers(
    }
 
    // Remove extra vertices that don't correspond to a full triangle
-   while (newBuffer_.size() % kVerticesPerTriangle != 0)
-   {
-      newBuffer_.pop_back();
-      newIntegerBuffer_.pop_back();
-   }
+   std::size_t vertexCount = newBuffer_.size() / kPointsPerVertex - firstVertex;
+   vertexCount -= vertexCount % kVerticesPerTriangle;
+
+   newBuffer_.resize((firstVertex + vertexCount) * kPointsPerVertex);
+   newIntegerBuffer_.resize((firstVertex + vertexCount) * kIntegersPerVertex_);
+
+   newTileIndex_.AddRange(static_cast<GLint>(firstVertex),
+                          static_cast<GLsizei>(vertexCount),
+                          bounds,
+                          pixelExtent,
+                          thresholdValue);
 }
 
 void PlacefileTriangles::Impl::Update()
@@ -322,8 +360,6 @@ void PlacefileTriangles::Impl::Update()
    {
       gl::OpenGLFunctions& gl = context_->gl();
 
-      std::unique_lock lock {bufferMutex_};
-
       // Buffer vertex data
       gl.glBindBuffer(GL_ARRAY_BUFFER, vbo_[0]);
       gl.glBufferData(GL_ARRAY_BUFFER,
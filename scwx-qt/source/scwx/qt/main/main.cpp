@@ -13,10 +13,14 @@
 #include <scwx/qt/types/qt_types.hpp>
 #include <scwx/qt/ui/setup/setup_wizard.hpp>
 #include <scwx/network/cpr.hpp>
+#include <scwx/provider/nexrad_data_provider_factory.hpp>
+#include <scwx/util/clock.hpp>
 #include <scwx/util/environment.hpp>
 #include <scwx/util/logger.hpp>
 #include <scwx/util/threads.hpp>
+#include <scwx/util/time.hpp>
 
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -30,6 +34,8 @@
 static const std::string logPrefix_ = "scwx::main";
 static const auto        logger_    = scwx::util::Logger::Create(logPrefix_);
 
+static void LoadEventPack(const std::vector<std::string>& args);
+static void StartReplay(const std::vector<std::string>& args);
 static void OverrideDefaultStyle(const std::vector<std::string>& args);
 
 int main(int argc, char* argv[])
@@ -97,6 +103,8 @@ int main(int argc, char* argv[])
 
    // Initialize application
    logManager.InitializeLogFile();
+   LoadEventPack(args);
+   StartReplay(args);
    scwx::qt::config::RadarSite::Initialize();
    scwx::qt::config::CountyDatabase::Initialize();
    scwx::qt::manager::SettingsManager::Instance().Initialize();
@@ -152,6 +160,63 @@ int main(int argc, char* argv[])
    return result;
 }
 
+static void LoadEventPack(const std::vector<std::string>& args)
+{
+   // Serve radar data and text products from an event pack if one is supplied
+   for (std::size_t i = 1; i + 1 < args.size(); ++i)
+   {
+      if (args.at(i) == "-event-pack")
+      {
+         auto eventPack = std::make_shared<scwx::provider::EventPack>();
+         if (eventPack->LoadFile(args.at(i + 1)))
+         {
+            logger_->info("Using event pack: {}", args.at(i + 1));
+            scwx::provider::NexradDataProviderFactory::SetEventPack(eventPack);
+         }
+         break;
+      }
+   }
+}
+
+static void StartReplay(const std::vector<std::string>& args)
+{
+   // Run the application clock from a time in the past, e.g.:
+   // -replay 2021-05-27T17:00:00Z -replay-speed 4
+   std::optional<std::chrono::sys_time<std::chrono::seconds>> startTime {};
+   double                                                     speed {1.0};
+
+   for (std::size_t i = 1; i + 1 < args.size(); ++i)
+   {
+      if (args.at(i) == "-replay")
+      {
+         startTime = scwx::util::TryParseDateTime<std::chrono::seconds>(
+            "%Y-%m-%dT%H:%M:%SZ", args.at(i + 1));
+
+         if (!startTime.has_value())
+         {
+            logger_->warn("Invalid replay time: {}", args.at(i + 1));
+         }
+      }
+      else if (args.at(i) == "-replay-speed")
+      {
+         try
+         {
+            speed = std::stod(args.at(i + 1));
+         }
+         catch (const std::exception&)
+         {
+            logger_->warn("Invalid replay speed: {}", args.at(i + 1));
+         }
+      }
+   }
+
+   if (startTime.has_value())
+   {
+      scwx::util::SetClock(
+         std::make_shared<scwx::util::ReplayClock>(*startTime, speed));
+   }
+}
+
 static void
 OverrideDefaultStyle([[maybe_unused]] const std::vector<std::string>& args)
 {
@@ -22,6 +22,7 @@
 #include <scwx/qt/ui/alert_dock_widget.hpp>
 #include <scwx/qt/ui/animation_dock_widget.hpp>
 #include <scwx/qt/ui/collapsible_group.hpp>
+#include <scwx/qt/ui/cross_section_dock_widget.hpp>
 #include <scwx/qt/ui/flow_layout.hpp>
 #include <scwx/qt/ui/gps_info_dialog.hpp>
 #include <scwx/qt/ui/imgui_debug_dialog.hpp>
@@ -36,6 +37,7 @@
 #include <scwx/common/characters.hpp>
 #include <scwx/common/products.hpp>
 #include <scwx/common/vcp.hpp>
+#include <scwx/util/clock.hpp>
 #include <scwx/util/logger.hpp>
 #include <scwx/util/time.hpp>
 
@@ -85,6 +87,7 @@ public:
        level3ProductsWidget_ {nullptr},
        alertDockWidget_ {nullptr},
        animationDockWidget_ {nullptr},
+       crossSectionDockWidget_ {nullptr},
        aboutDialog_ {nullptr},
        gpsInfoDialog_ {nullptr},
        imGuiDebugDialog_ {nullptr},
@@ -200,16 +203,17 @@ public:
    QLabel* coordinateLabel_ {nullptr};
    QLabel* timeLabel_ {nullptr};
 
-   ui::AlertDockWidget*     alertDockWidget_;
-   ui::AnimationDockWidget* animationDockWidget_;
-   ui::AboutDialog*         aboutDialog_;
-   ui::GpsInfoDialog*       gpsInfoDialog_;
-   ui::ImGuiDebugDialog*    imGuiDebugDialog_;
-   ui::LayerDialog*         layerDialog_;
-   ui::PlacefileDialog*     placefileDialog_;
-   ui::RadarSiteDialog*     radarSiteDialog_;
-   ui::SettingsDialog*      settingsDialog_;
-   ui::UpdateDialog*        updateDialog_;
+   ui::AlertDockWidget*        alertDockWidget_;
+   ui::AnimationDockWidget*    animationDockWidget_;
+   ui::CrossSectionDockWidget* crossSectionDockWidget_;
+   ui::AboutDialog*            aboutDialog_;
+   ui::GpsInfoDialog*          gpsInfoDialog_;
+   ui::ImGuiDebugDialog*       imGuiDebugDialog_;
+   ui::LayerDialog*            layerDialog_;
+   ui::PlacefileDialog*        placefileDialog_;
+   ui::RadarSiteDialog*        radarSiteDialog_;
+   ui::SettingsDialog*         settingsDialog_;
+   ui::UpdateDialog*           updateDialog_;
 
    QTimer clockTimer_ {};
 
@@ -282,6 +286,17 @@ MainWindow::MainWindow(QWidget* parent) :
    p->alertDockWidget_->setVisible(false);
    addDockWidget(Qt::BottomDockWidgetArea, p->alertDockWidget_);
 
+   // Configure Cross Section Dock
+   p->crossSectionDockWidget_ = new ui::CrossSectionDockWidget(this);
+   p->crossSectionDockWidget_->setVisible(false);
+   addDockWidget(Qt::BottomDockWidgetArea, p->crossSectionDockWidget_);
+
+   if (p->activeMap_ != nullptr)
+   {
+      p->crossSectionDockWidget_->SetCrossSectionView(
+         p->activeMap_->GetCrossSectionView());
+   }
+
    // GPS Info Dialog
    p->gpsInfoDialog_ = new ui::GpsInfoDialog(this);
 
@@ -296,6 +311,11 @@ MainWindow::MainWindow(QWidget* parent) :
    p->alertDockWidget_->toggleViewAction()->setText(tr("&Alerts"));
    ui->actionAlerts->setVisible(false);
 
+   ui->menuView->insertAction(ui->actionGpsInfo,
+                              p->crossSectionDockWidget_->toggleViewAction());
+   p->crossSectionDockWidget_->toggleViewAction()->setText(
+      tr("Cross &Section"));
+
    ui->menuDebug->menuAction()->setVisible(
       settings::GeneralSettings::Instance().debug_enabled().GetValue());
 
@@ -834,6 +854,16 @@ void MainWindowImpl::ConnectMapSignals()
               &map::MapWidget::AlertSelected,
               alertDockWidget_,
               &ui::AlertDockWidget::SelectAlert);
+      connect(mapWidget,
+              &map::MapWidget::CrossSectionSelected,
+              this,
+              [this, mapWidget]()
+              {
+                 // Display the cross section drawn on the map
+                 crossSectionDockWidget_->SetCrossSectionView(
+                    mapWidget->GetCrossSectionView());
+                 crossSectionDockWidget_->setVisible(true);
+              });
       connect(mapWidget,
               &map::MapWidget::MapParametersChanged,
               this,
@@ -1088,6 +1118,16 @@ void MainWindowImpl::ConnectOtherSignals()
            &ui::Level2SettingsWidget::ElevationSelected,
            mainWindow_,
            [&](float elevation) { SelectElevation(activeMap_, elevation); });
+   connect(level2SettingsWidget_,
+           &ui::Level2SettingsWidget::StormMotionSelected,
+           mainWindow_,
+           [&](std::optional<types::StormMotion> stormMotion)
+           {
+              for (auto& map : maps_)
+              {
+                 map->SetStormMotion(stormMotion);
+              }
+           });
    connect(mainWindow_,
            &MainWindow::ActiveMapMoved,
            alertDockWidget_,
@@ -1195,7 +1235,7 @@ void MainWindowImpl::ConnectOtherSignals()
            [this]()
            {
               timeLabel_->setText(QString::fromStdString(
-                 util::TimeString(std::chrono::system_clock::now())));
+                 util::TimeString(util::CurrentTime())));
               timeLabel_->setVisible(true);
            });
    clockTimer_.start(1000);
@@ -1379,6 +1419,12 @@ void MainWindowImpl::SetActiveMap(map::MapWidget* mapWidget)
    {
       widget->SetActive(mapWidget == widget);
    }
+
+   if (crossSectionDockWidget_ != nullptr && mapWidget != nullptr)
+   {
+      crossSectionDockWidget_->SetCrossSectionView(
+         mapWidget->GetCrossSectionView());
+   }
 }
 
 void MainWindowImpl::UpdateAvailableLevel3Products()
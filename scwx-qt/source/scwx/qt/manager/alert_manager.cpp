@@ -1,14 +1,19 @@
 #include <scwx/qt/manager/alert_manager.hpp>
+#include <scwx/qt/manager/alert_scheduler.hpp>
 #include <scwx/qt/manager/media_manager.hpp>
 #include <scwx/qt/manager/position_manager.hpp>
 #include <scwx/qt/manager/text_event_manager.hpp>
 #include <scwx/qt/settings/audio_settings.hpp>
 #include <scwx/qt/types/location_types.hpp>
 #include <scwx/qt/util/geographic_lib.hpp>
+#include <scwx/util/clock.hpp>
 #include <scwx/util/logger.hpp>
 #include <scwx/qt/config/radar_site.hpp>
 #include <scwx/qt/settings/general_settings.hpp>
 
+#include <optional>
+#include <vector>
+
 #include <boost/asio/post.hpp>
 #include <boost/asio/thread_pool.hpp>
 #include <boost/uuid/random_generator.hpp>
@@ -56,13 +61,39 @@ public:
                                  }
                               });
          });
+      QObject::connect(
+         alertScheduler_.get(),
+         &manager::AlertScheduler::AlertsTransitioned,
+         self_,
+         [this](const std::vector<types::TextEventKey>& keys,
+                std::chrono::system_clock::time_point   transitionTime)
+         {
+            boost::asio::post(threadPool_,
+                              [=, this]()
+                              {
+                                 try
+                                 {
+                                    HandleTransitions(keys, transitionTime);
+                                 }
+                                 catch (const std::exception& ex)
+                                 {
+                                    logger_->error(ex.what());
+                                 }
+                              });
+         });
    }
 
    ~Impl() { threadPool_.join(); }
 
    common::Coordinate
         CurrentCoordinate(types::LocationMethod locationMethod) const;
-   void HandleAlert(const types::TextEventKey& key, size_t messageIndex) const;
+   void HandleAlert(const types::TextEventKey& key,
+                    size_t                     messageIndex,
+                    std::optional<std::chrono::system_clock::time_point>
+                       activationTime = std::nullopt) const;
+   void HandleTransitions(
+      const std::vector<types::TextEventKey>& keys,
+      std::chrono::system_clock::time_point   transitionTime) const;
    void UpdateLocationTracking(const std::string& value) const;
 
    boost::asio::thread_pool threadPool_ {1u};
@@ -76,6 +107,8 @@ public:
       PositionManager::Instance()};
    std::shared_ptr<TextEventManager> textEventManager_ {
       TextEventManager::Instance()};
+   std::shared_ptr<AlertScheduler> alertScheduler_ {
+      AlertScheduler::Instance()};
 
    std::shared_ptr<config::RadarSite> radarSite_ {};
 };
@@ -135,8 +168,26 @@ common::Coordinate AlertManager::Impl::CurrentCoordinate(
    return coordinate;
 }
 
-void AlertManager::Impl::HandleAlert(const types::TextEventKey& key,
-                                     size_t messageIndex) const
+void AlertManager::Impl::HandleTransitions(
+   const std::vector<types::TextEventKey>& keys,
+   std::chrono::system_clock::time_point   transitionTime) const
+{
+   for (auto& key : keys)
+   {
+      const std::size_t messageCount = textEventManager_->message_count(key);
+
+      // Evaluate segments of the latest message which start at this time
+      if (messageCount > 0)
+      {
+         HandleAlert(key, messageCount - 1, transitionTime);
+      }
+   }
+}
+
+void AlertManager::Impl::HandleAlert(
+   const types::TextEventKey&                           key,
+   size_t                                               messageIndex,
+   std::optional<std::chrono::system_clock::time_point> activationTime) const
 {
    // Skip alert if there are more messages to be processed
    if (messageIndex + 1 < textEventManager_->message_count(key))
@@ -165,17 +216,28 @@ void AlertManager::Impl::HandleAlert(const types::TextEventKey& key,
       auto&             vtec       = segment->header_->vtecString_.front();
       auto              action     = vtec.pVtec_.action();
       awips::Phenomenon phenomenon = vtec.pVtec_.phenomenon();
+      auto              eventBegin = segment->event_begin();
       auto              eventEnd   = vtec.pVtec_.event_end();
       bool alertActive             = (action != awips::PVtec::Action::Canceled);
+      auto now                     = scwx::util::CurrentTime();
 
       // If the event has ended or is inactive, or if the alert is not enabled,
       // skip it
-      if (eventEnd < std::chrono::system_clock::now() || !alertActive ||
+      if (eventEnd <= now || !alertActive ||
           !audioSettings.alert_enabled(phenomenon).GetValue())
       {
          continue;
       }
 
+      // If the event has not yet started, it is evaluated by the alert
+      // scheduler when it starts. When evaluating an activation, skip segments
+      // which started at a different time, to avoid repeating the alert.
+      if ((activationTime.has_value() && eventBegin != *activationTime) ||
+          (!activationTime.has_value() && eventBegin > now))
+      {
+         continue;
+      }
+
       bool activeAtLocation = (locationMethod == types::LocationMethod::All);
 
       if (locationMethod == types::LocationMethod::Fixed ||
@@ -0,0 +1,304 @@
+#include <scwx/qt/manager/alert_scheduler.hpp>
+#include <scwx/qt/manager/text_event_manager.hpp>
+#include <scwx/util/clock.hpp>
+#include <scwx/util/logger.hpp>
+
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <queue>
+#include <unordered_map>
+#include <unordered_set>
+
+#include <boost/asio/steady_timer.hpp>
+#include <boost/asio/thread_pool.hpp>
+
+namespace scwx
+{
+namespace qt
+{
+namespace manager
+{
+
+static const std::string logPrefix_ = "scwx::qt::manager::alert_scheduler";
+static const auto        logger_    = scwx::util::Logger::Create(logPrefix_);
+
+class AlertScheduler::Impl
+{
+public:
+   struct Transition
+   {
+      std::chrono::system_clock::time_point time_;
+      types::TextEventKey                   key_;
+      std::uint64_t                         generation_;
+   };
+
+   // Transitions of an event are current if scheduled by the latest
+   // generation. Superseded transitions remain in the queue, and are
+   // discarded when they are due.
+   struct EventSchedule
+   {
+      std::uint64_t generation_;
+      std::size_t   pending_;
+   };
+
+   struct TransitionLater
+   {
+      bool operator()(const Transition& lhs, const Transition& rhs) const
+      {
+         return lhs.time_ > rhs.time_;
+      }
+   };
+
+   explicit Impl(AlertScheduler*                   self,
+                 std::shared_ptr<TextEventManager> textEventManager) :
+       self_ {self}, textEventManager_ {std::move(textEventManager)}
+   {
+      if (textEventManager_ == nullptr)
+      {
+         return;
+      }
+
+      QObject::connect(
+         textEventManager_.get(),
+         &TextEventManager::AlertUpdated,
+         self_,
+         [this](const types::TextEventKey& key, std::size_t messageIndex)
+         { HandleAlert(key, messageIndex); });
+
+      // Cancel transitions as soon as events are removed, from the thread
+      // removing the events
+      QObject::connect(
+         textEventManager_.get(),
+         &TextEventManager::AlertsRemoved,
+         self_,
+         [this](const std::vector<types::TextEventKey>& keys)
+         { self_->CancelTransitions(keys); },
+         Qt::DirectConnection);
+   }
+
+   ~Impl()
+   {
+      std::unique_lock lock(transitionMutex_);
+      transitionTimer_.cancel();
+      lock.unlock();
+
+      threadPool_.join();
+   }
+
+   void HandleAlert(const types::TextEventKey& key, std::size_t messageIndex);
+   void HandleTransitions();
+   void ScheduleTimer();
+
+   boost::asio::thread_pool threadPool_ {1u};
+
+   AlertScheduler* self_;
+
+   boost::asio::steady_timer transitionTimer_ {threadPool_};
+   std::mutex                transitionMutex_ {};
+
+   std::priority_queue<Transition, std::vector<Transition>, TransitionLater>
+      transitions_ {};
+   std::chrono::system_clock::time_point scheduledTime_ {
+      std::chrono::system_clock::time_point::max()};
+
+   std::unordered_map<types::TextEventKey,
+                      EventSchedule,
+                      types::TextEventHash<types::TextEventKey>>
+                 eventSchedules_ {};
+   std::uint64_t nextGeneration_ {0u};
+
+   std::shared_ptr<TextEventManager> textEventManager_;
+};
+
+AlertScheduler::AlertScheduler(
+   std::shared_ptr<TextEventManager> textEventManager) :
+    p(std::make_unique<Impl>(this, std::move(textEventManager)))
+{
+}
+AlertScheduler::~AlertScheduler() = default;
+
+void AlertScheduler::Impl::HandleAlert(const types::TextEventKey& key,
+                                       std::size_t                messageIndex)
+{
+   auto messageList = textEventManager_->message_list(key);
+   if (messageIndex >= messageList.size())
+   {
+      // The event has been removed
+      return;
+   }
+
+   std::vector<std::chrono::system_clock::time_point> times {};
+
+   for (auto& segment : messageList[messageIndex]->segments())
+   {
+      times.push_back(segment->event_begin());
+      times.push_back(segment->event_end());
+   }
+
+   // Transitions which have already occurred are handled by the consumers of
+   // the updated alert
+   self_->ScheduleTransitions(key, times);
+}
+
+void AlertScheduler::ScheduleTransitions(
+   const types::TextEventKey&                                key,
+   const std::vector<std::chrono::system_clock::time_point>& times)
+{
+   const auto now = scwx::util::CurrentTime();
+
+   std::unique_lock lock(p->transitionMutex_);
+
+   // Supersede any transitions from a previous update of the event
+   const std::uint64_t generation = ++p->nextGeneration_;
+   std::size_t         pending    = 0u;
+
+   for (auto time : times)
+   {
+      if (time > now)
+      {
+         p->transitions_.push({time, key, generation});
+         ++pending;
+      }
+   }
+
+   if (pending > 0u)
+   {
+      p->eventSchedules_.insert_or_assign(
+         key, Impl::EventSchedule {generation, pending});
+   }
+   else
+   {
+      p->eventSchedules_.erase(key);
+   }
+
+   // Wake earlier if a new transition precedes the scheduled time
+   if (!p->transitions_.empty() &&
+       p->transitions_.top().time_ < p->scheduledTime_)
+   {
+      p->ScheduleTimer();
+   }
+}
+
+void AlertScheduler::CancelTransitions(
+   const std::vector<types::TextEventKey>& keys)
+{
+   std::unique_lock lock(p->transitionMutex_);
+
+   for (auto& key : keys)
+   {
+      p->eventSchedules_.erase(key);
+   }
+}
+
+void AlertScheduler::Impl::ScheduleTimer()
+{
+   // The transition mutex must be held
+
+   if (transitions_.empty())
+   {
+      scheduledTime_ = std::chrono::system_clock::time_point::max();
+      return;
+   }
+
+   scheduledTime_ = transitions_.top().time_;
+
+   // Setting the expiry cancels any outstanding wait. The wait is converted
+   // to real time, in case the clock is not running at real time.
+   transitionTimer_.expires_after(scwx::util::RealDuration(
+      std::chrono::duration_cast<std::chrono::milliseconds>(
+         scheduledTime_ - scwx::util::CurrentTime())));
+   transitionTimer_.async_wait(
+      [this](const boost::system::error_code& e)
+      {
+         if (e == boost::asio::error::operation_aborted)
+         {
+            logger_->trace("Transition timer cancelled");
+         }
+         else if (e != boost::system::errc::success)
+         {
+            logger_->warn("Transition timer error: {}", e.message());
+         }
+         else
+         {
+            try
+            {
+               HandleTransitions();
+            }
+            catch (const std::exception& ex)
+            {
+               logger_->error(ex.what());
+            }
+         }
+      });
+}
+
+void AlertScheduler::Impl::HandleTransitions()
+{
+   std::map<std::chrono::system_clock::time_point,
+            std::unordered_set<types::TextEventKey,
+                               types::TextEventHash<types::TextEventKey>>>
+      transitionsByTime {};
+
+   const auto now = scwx::util::CurrentTime();
+
+   std::unique_lock lock(transitionMutex_);
+
+   // Collect all current transitions which are due, grouping simultaneous
+   // transitions
+   while (!transitions_.empty() && transitions_.top().time_ <= now)
+   {
+      const Transition& transition = transitions_.top();
+
+      auto it = eventSchedules_.find(transition.key_);
+      if (it != eventSchedules_.end() &&
+          it->second.generation_ == transition.generation_)
+      {
+         transitionsByTime[transition.time_].insert(transition.key_);
+
+         if (--it->second.pending_ == 0u)
+         {
+            eventSchedules_.erase(it);
+         }
+      }
+
+      transitions_.pop();
+   }
+
+   ScheduleTimer();
+
+   lock.unlock();
+
+   for (auto& [time, keySet] : transitionsByTime)
+   {
+      std::vector<types::TextEventKey> keys {keySet.cbegin(), keySet.cend()};
+
+      logger_->trace("{} alerts transitioned", keys.size());
+
+      Q_EMIT self_->AlertsTransitioned(keys, time);
+   }
+}
+
+std::shared_ptr<AlertScheduler> AlertScheduler::Instance()
+{
+   static std::weak_ptr<AlertScheduler> alertSchedulerReference_ {};
+   static std::mutex                    instanceMutex_ {};
+
+   std::unique_lock lock(instanceMutex_);
+
+   std::shared_ptr<AlertScheduler> alertScheduler =
+      alertSchedulerReference_.lock();
+
+   if (alertScheduler == nullptr)
+   {
+      alertScheduler =
+         std::make_shared<AlertScheduler>(TextEventManager::Instance());
+      alertSchedulerReference_ = alertScheduler;
+   }
+
+   return alertScheduler;
+}
+
+} // namespace manager
+} // namespace qt
+} // namespace scwx
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <scwx/qt/types/text_event_key.hpp>
+
+#include <chrono>
+#include <memory>
+#include <vector>
+
+#include <QObject>
+
+namespace scwx
+{
+namespace qt
+{
+namespace manager
+{
+
+class TextEventManager;
+
+/**
+ * Tracks the upcoming start and end times of text event segments, and signals
+ * when events become active or expire. Consumers no longer need to poll for
+ * time-based state changes.
+ */
+class AlertScheduler : public QObject
+{
+   Q_OBJECT
+   Q_DISABLE_COPY_MOVE(AlertScheduler)
+
+public:
+   /**
+    * Creates an alert scheduler. If a text event manager is given, the
+    * segments of its alerts are scheduled as they are updated, and cancelled
+    * as they are removed.
+    *
+    * @param [in] textEventManager Text event manager, or nullptr
+    */
+   explicit AlertScheduler(
+      std::shared_ptr<TextEventManager> textEventManager = nullptr);
+   ~AlertScheduler();
+
+   /**
+    * Schedules the segment start and end times of a text event. Transitions
+    * previously scheduled for the event are cancelled, and times which are
+    * not in the future are ignored.
+    *
+    * @param [in] key Text event key
+    * @param [in] times Segment start and end times
+    */
+   void ScheduleTransitions(
+      const types::TextEventKey&                                key,
+      const std::vector<std::chrono::system_clock::time_point>& times);
+
+   /**
+    * Cancels the scheduled transitions of text events.
+    *
+    * @param [in] keys Text event keys
+    */
+   void CancelTransitions(const std::vector<types::TextEventKey>& keys);
+
+   static std::shared_ptr<AlertScheduler> Instance();
+
+signals:
+   /**
+    * Emitted when text event segments start or end. Events transitioning at
+    * the same time are reported together.
+    *
+    * @param [in] keys Text event keys
+    * @param [in] transitionTime Segment start or end time
+    */
+   void
+   AlertsTransitioned(const std::vector<types::TextEventKey>& keys,
+                      std::chrono::system_clock::time_point   transitionTime);
+
+private:
+   class Impl;
+   std::unique_ptr<Impl> p;
+};
+
+} // namespace manager
+} // namespace qt
+} // namespace scwx
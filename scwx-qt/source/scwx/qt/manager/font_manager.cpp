@@ -6,16 +6,21 @@
 
 #include <filesystem>
 #include <fstream>
+#include <mutex>
+#include <shared_mutex>
 
 #include <QFile>
 #include <QFileInfo>
 #include <QFontDatabase>
 #include <QGuiApplication>
 #include <QStandardPaths>
+#include <boost/asio/post.hpp>
+#include <boost/asio/thread_pool.hpp>
 #include <boost/container_hash/hash.hpp>
 #include <boost/unordered/unordered_flat_map.hpp>
 #include <boost/unordered/unordered_flat_set.hpp>
 #include <fontconfig/fontconfig.h>
+#include <imgui.h>
 
 namespace scwx
 {
@@ -57,13 +62,18 @@ public:
       InitializeFontconfig();
       ConnectSignals();
    }
-   ~Impl() { FinalizeFontconfig(); }
+   ~Impl()
+   {
+      threadPool_.join();
+      FinalizeFontconfig();
+   }
 
    void ConnectSignals();
    void FinalizeFontconfig();
    void InitializeEnvironment();
    void InitializeFontCache();
    void InitializeFontconfig();
+   void BuildImGuiFontAtlas();
    void UpdateImGuiFont(types::FontCategory fontCategory);
    void UpdateQFont(types::FontCategory fontCategory);
 
@@ -76,9 +86,12 @@ public:
 
    std::string fontCachePath_ {};
 
-   std::shared_mutex imguiFontAtlasMutex_ {};
+   boost::asio::thread_pool threadPool_ {1u};
 
-   std::uint64_t imguiFontsBuildCount_ {};
+   std::shared_ptr<ImFontAtlas> imguiFontAtlas_ {};
+   mutable std::mutex           imguiFontAtlasMutex_ {};
+   std::mutex                   imguiFontAtlasBuildMutex_ {};
+   std::size_t                  imguiFontAtlasFontCount_ {};
 
    boost::unordered_flat_map<FontRecordPair,
                              std::shared_ptr<types::ImGuiFont>,
@@ -86,6 +99,9 @@ public:
                      imguiFonts_ {};
    std::shared_mutex imguiFontsMutex_ {};
 
+   // ImGui fonts in the order they were loaded, and are added to each atlas
+   std::vector<std::shared_ptr<types::ImGuiFont>> imguiFontList_ {};
+
    boost::unordered_flat_map<std::string, std::vector<char>> rawFontData_ {};
    std::mutex rawFontDataMutex_ {};
 
@@ -161,6 +177,51 @@ void FontManager::InitializeFonts()
       p->UpdateImGuiFont(fontCategory);
       p->UpdateQFont(fontCategory);
    }
+
+   // Build the initial font atlas before any ImGui frame needs it
+   p->BuildImGuiFontAtlas();
+}
+
+void FontManager::Impl::BuildImGuiFontAtlas()
+{
+   // Builds are serialized, and never block an ImGui frame. A build includes
+   // every font loaded so far, so queued builds with no new fonts are skipped.
+   std::unique_lock buildLock {imguiFontAtlasBuildMutex_};
+
+   std::vector<std::shared_ptr<types::ImGuiFont>> fonts;
+   {
+      std::shared_lock imguiFontsLock {imguiFontsMutex_};
+      fonts = imguiFontList_;
+   }
+
+   if (fonts.empty() || fonts.size() == imguiFontAtlasFontCount_)
+   {
+      return;
+   }
+
+   logger_->debug("Building font atlas: {} fonts", fonts.size());
+
+   auto fontAtlas = std::make_shared<ImFontAtlas>();
+   for (auto& font : fonts)
+   {
+      font->AddToAtlas(*fontAtlas);
+   }
+
+   // Rasterize the glyphs and convert the texture data now, so the atlas is
+   // not modified when uploaded by an ImGui frame
+   unsigned char* pixels;
+   int            width;
+   int            height;
+   fontAtlas->GetTexDataAsRGBA32(&pixels, &width, &height);
+
+   logger_->debug("Font atlas built: {}x{}", width, height);
+
+   {
+      std::unique_lock atlasLock {imguiFontAtlasMutex_};
+      imguiFontAtlas_ = std::move(fontAtlas);
+   }
+
+   imguiFontAtlasFontCount_ = fonts.size();
 }
 
 void FontManager::Impl::UpdateImGuiFont(types::FontCategory fontCategory)
@@ -193,14 +254,10 @@ void FontManager::Impl::UpdateQFont(types::FontCategory fontCategory)
    fontCategoryQFontMap_.insert_or_assign(fontCategory, font);
 }
 
-std::shared_mutex& FontManager::imgui_font_atlas_mutex()
+std::shared_ptr<ImFontAtlas> FontManager::imgui_font_atlas() const
 {
-   return p->imguiFontAtlasMutex_;
-}
-
-std::uint64_t FontManager::imgui_fonts_build_count() const
-{
-   return p->imguiFontsBuildCount_;
+   std::unique_lock lock {p->imguiFontAtlasMutex_};
+   return p->imguiFontAtlas_;
 }
 
 int FontManager::GetFontId(types::Font font) const
@@ -283,9 +340,6 @@ FontManager::LoadImGuiFont(const std::string&               family,
    // Get raw font data
    const auto& rawFontData = p->GetRawFontData(fontRecord.filename_);
 
-   // The font atlas mutex might already be locked within an ImGui render frame.
-   // Lock the font atlas mutex before the fonts mutex to prevent deadlock.
-   std::unique_lock imguiFontAtlasLock {p->imguiFontAtlasMutex_};
    std::unique_lock imguiFontsLock {p->imguiFontsMutex_};
 
    // Search for the associated ImGui font again, to prevent loading the same
@@ -313,13 +367,32 @@ FontManager::LoadImGuiFont(const std::string&               family,
 
    // Create an ImGui font
    std::shared_ptr<types::ImGuiFont> imguiFont =
-      std::make_shared<types::ImGuiFont>(fontName, rawFontData, imFontSize);
+      std::make_shared<types::ImGuiFont>(
+         fontName,
+         rawFontData,
+         imFontSize,
+         static_cast<int>(p->imguiFontList_.size()));
 
    // Store the ImGui font
    p->imguiFonts_.insert_or_assign(imguiFontKey, imguiFont);
-
-   // Increment ImGui font build count
-   ++p->imguiFontsBuildCount_;
+   p->imguiFontList_.push_back(imguiFont);
+
+   imguiFontsLock.unlock();
+
+   // Build a font atlas including the new font in the background. Until the
+   // build is complete, ImGui frames continue to use the current font atlas.
+   boost::asio::post(p->threadPool_,
+                     [this]()
+                     {
+                        try
+                        {
+                           p->BuildImGuiFontAtlas();
+                        }
+                        catch (const std::exception& ex)
+                        {
+                           logger_->error(ex.what());
+                        }
+                     });
 
    // Return the ImGui font
    return imguiFont;
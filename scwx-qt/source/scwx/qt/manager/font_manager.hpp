@@ -4,11 +4,13 @@
 #include <scwx/qt/types/font_types.hpp>
 #include <scwx/qt/types/text_types.hpp>
 
-#include <shared_mutex>
+#include <memory>
 
 #include <QFont>
 #include <QObject>
 
+struct ImFontAtlas;
+
 namespace scwx
 {
 namespace qt
@@ -25,8 +27,14 @@ public:
    explicit FontManager();
    ~FontManager();
 
-   std::shared_mutex& imgui_font_atlas_mutex();
-   std::uint64_t      imgui_fonts_build_count() const;
+   /**
+    * Get the most recently built ImGui font atlas. A font atlas is immutable
+    * once built. Loading a font builds a new font atlas in the background,
+    * which is used by each ImGui context starting with its next frame.
+    *
+    * @return ImGui font atlas, or nullptr if no font atlas has been built
+    */
+   std::shared_ptr<ImFontAtlas> imgui_font_atlas() const;
 
    int GetFontId(types::Font font) const;
    std::shared_ptr<types::ImGuiFont>
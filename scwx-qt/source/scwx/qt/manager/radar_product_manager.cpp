@@ -5,9 +5,11 @@
 #include <scwx/qt/util/geographic_lib.hpp>
 #include <scwx/common/constants.hpp>
 #include <scwx/provider/nexrad_data_provider_factory.hpp>
+#include <scwx/util/clock.hpp>
 #include <scwx/util/logger.hpp>
 #include <scwx/util/map.hpp>
 #include <scwx/util/threads.hpp>
+#include <scwx/util/trace.hpp>
 #include <scwx/wsr88d/nexrad_file_factory.hpp>
 
 #include <deque>
@@ -452,47 +454,35 @@ void RadarProductManager::Initialize()
 
    boost::timer::cpu_timer timer;
 
-   const GeographicLib::Geodesic& geodesic(
-      util::GeographicLib::DefaultGeodesic());
-
    const QMapLibre::Coordinate radar(p->radarSite_->latitude(),
                                      p->radarSite_->longitude());
 
    const float gateSize = gate_size();
 
+   std::vector<float> ranges(common::MAX_DATA_MOMENT_GATES);
+   for (std::size_t gate = 0; gate < ranges.size(); ++gate)
+   {
+      ranges[gate] = (gate + 1) * gateSize;
+   }
+
    // Calculate half degree azimuth coordinates
    timer.start();
    std::vector<float>& coordinates0_5Degree = p->coordinates0_5Degree_;
 
    coordinates0_5Degree.resize(NUM_COORIDNATES_0_5_DEGREE);
 
-   auto radialGates0_5Degree =
-      boost::irange<uint32_t>(0, NUM_RADIAL_GATES_0_5_DEGREE);
-
-   std::for_each(
-      std::execution::par_unseq,
-      radialGates0_5Degree.begin(),
-      radialGates0_5Degree.end(),
-      [&](uint32_t radialGate)
-      {
-         const uint16_t gate =
-            static_cast<uint16_t>(radialGate % common::MAX_DATA_MOMENT_GATES);
-         const uint16_t radial =
-            static_cast<uint16_t>(radialGate / common::MAX_DATA_MOMENT_GATES);
-
-         const float  angle  = radial * 0.5f; // 0.5 degree radial
-         const float  range  = (gate + 1) * gateSize;
-         const size_t offset = radialGate * 2;
-
-         double latitude;
-         double longitude;
-
-         geodesic.Direct(
-            radar.first, radar.second, angle, range, latitude, longitude);
+   std::vector<float> azimuths0_5Degree(common::MAX_0_5_DEGREE_RADIALS);
+   for (std::size_t radial = 0; radial < azimuths0_5Degree.size(); ++radial)
+   {
+      azimuths0_5Degree[radial] = radial * 0.5f; // 0.5 degree radial
+   }
 
-         coordinates0_5Degree[offset]     = latitude;
-         coordinates0_5Degree[offset + 1] = longitude;
-      });
+   util::GeographicLib::GetCoordinates(radar.first,
+                                       radar.second,
+                                       azimuths0_5Degree,
+                                       ranges,
+                                       coordinates0_5Degree,
+                                       common::MAX_DATA_MOMENT_GATES * 2);
    timer.stop();
    logger_->debug("Coordinates (0.5 degree) calculated in {}",
                   timer.format(6, "%ws"));
@@ -503,33 +493,18 @@ void RadarProductManager::Initialize()
 
    coordinates1Degree.resize(NUM_COORIDNATES_1_DEGREE);
 
-   auto radialGates1Degree =
-      boost::irange<uint32_t>(0, NUM_RADIAL_GATES_1_DEGREE);
-
-   std::for_each(
-      std::execution::par_unseq,
-      radialGates1Degree.begin(),
-      radialGates1Degree.end(),
-      [&](uint32_t radialGate)
-      {
-         const uint16_t gate =
-            static_cast<uint16_t>(radialGate % common::MAX_DATA_MOMENT_GATES);
-         const uint16_t radial =
-            static_cast<uint16_t>(radialGate / common::MAX_DATA_MOMENT_GATES);
-
-         const float  angle  = radial * 1.0f; // 1 degree radial
-         const float  range  = (gate + 1) * gateSize;
-         const size_t offset = radialGate * 2;
-
-         double latitude;
-         double longitude;
-
-         geodesic.Direct(
-            radar.first, radar.second, angle, range, latitude, longitude);
+   std::vector<float> azimuths1Degree(common::MAX_1_DEGREE_RADIALS);
+   for (std::size_t radial = 0; radial < azimuths1Degree.size(); ++radial)
+   {
+      azimuths1Degree[radial] = radial * 1.0f; // 1 degree radial
+   }
 
-         coordinates1Degree[offset]     = latitude;
-         coordinates1Degree[offset + 1] = longitude;
-      });
+   util::GeographicLib::GetCoordinates(radar.first,
+                                       radar.second,
+                                       azimuths1Degree,
+                                       ranges,
+                                       coordinates1Degree,
+                                       common::MAX_DATA_MOMENT_GATES * 2);
    timer.stop();
    logger_->debug("Coordinates (1 degree) calculated in {}",
                   timer.format(6, "%ws"));
@@ -704,7 +679,7 @@ void RadarProductManagerImpl::RefreshDataSync(
 
       auto updatePeriod      = providerManager->provider_->update_period();
       auto lastModified      = providerManager->provider_->last_modified();
-      auto sinceLastModified = std::chrono::system_clock::now() - lastModified;
+      auto sinceLastModified = scwx::util::CurrentTime() - lastModified;
 
       // For the default interval, assume products are updated at a
       // constant rate. Expect the next product at a time based on the
@@ -726,6 +701,9 @@ void RadarProductManagerImpl::RefreshDataSync(
 
       if (newObjects > 0)
       {
+         scwx::util::Tracer::Instance().MarkArrival(providerManager->radarId_,
+                                                    latestTime);
+
          Q_EMIT providerManager->NewDataAvailable(
             providerManager->group_, providerManager->product_, latestTime);
       }
@@ -748,7 +726,8 @@ void RadarProductManagerImpl::RefreshDataSync(
          std::chrono::duration_cast<std::chrono::seconds>(interval));
 
       {
-         providerManager->refreshTimer_.expires_after(interval);
+         providerManager->refreshTimer_.expires_after(
+            scwx::util::RealDuration(interval));
          providerManager->refreshTimer_.async_wait(
             [=, this](const boost::system::error_code& e)
             {
@@ -819,7 +798,7 @@ RadarProductManager::GetActiveVolumeTimes(
                        [&](const auto& date)
                        {
                           // Don't query for a time point in the future
-                          if (date > std::chrono::system_clock::now())
+                          if (date > scwx::util::CurrentTime())
                           {
                              return;
                           }
@@ -845,6 +824,22 @@ RadarProductManager::GetActiveVolumeTimes(
    return volumeTimes;
 }
 
+bool RadarProductManager::IsProductActive(common::RadarProductGroup group,
+                                          const std::string&        product)
+{
+   std::shared_lock refreshLock {p->refreshMapMutex_};
+
+   return std::any_of(
+      p->refreshMap_.cbegin(),
+      p->refreshMap_.cend(),
+      [&](const auto& refreshEntry)
+      {
+         return refreshEntry.second->group_ == group &&
+                (group == common::RadarProductGroup::Level2 ||
+                 refreshEntry.second->product_ == product);
+      });
+}
+
 void RadarProductManagerImpl::LoadProviderData(
    std::chrono::system_clock::time_point              time,
    std::shared_ptr<ProviderManager>                   providerManager,
@@ -1055,6 +1050,8 @@ void RadarProductManagerImpl::LoadNexradFile(
 
    if (fileValid)
    {
+      scwx::util::TraceSpan span {scwx::util::TraceStage::RecordStore};
+
       record = types::RadarProductRecord::Create(nexradFile);
 
       // If the time is already determined, override the time in the file.
@@ -1072,6 +1069,8 @@ void RadarProductManagerImpl::LoadNexradFile(
          recordRadarId = request->current_radar_site();
       }
 
+      span.set_tags({recordRadarId, record->radar_product(), record->time()});
+
       manager = RadarProductManager::Instance(recordRadarId);
       manager->Initialize();
       record = manager->p->StoreRadarProductRecord(record);
@@ -1140,7 +1139,7 @@ void RadarProductManagerImpl::PopulateProductTimes(
                  [&](const auto& date)
                  {
                     // Don't query for a time point in the future
-                    if (date > std::chrono::system_clock::now())
+                    if (date > scwx::util::CurrentTime())
                     {
                        return;
                     }
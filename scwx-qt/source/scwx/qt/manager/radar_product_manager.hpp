@@ -78,6 +78,18 @@ public:
    std::set<std::chrono::system_clock::time_point>
    GetActiveVolumeTimes(std::chrono::system_clock::time_point time);
 
+   /**
+    * @brief Determines whether refresh is enabled for a product. Level 2
+    * refresh applies to all level 2 products.
+    *
+    * @param [in] group Radar product group
+    * @param [in] product Radar product name
+    *
+    * @return Whether the product is active
+    */
+   bool IsProductActive(common::RadarProductGroup group,
+                        const std::string&        product);
+
    /**
     * @brief Get level 2 radar data for a data block type, elevation, and time.
     *
@@ -2,9 +2,13 @@
 #include <scwx/qt/main/application.hpp>
 #include <scwx/qt/settings/general_settings.hpp>
 #include <scwx/awips/text_product_file.hpp>
-#include <scwx/provider/warnings_provider.hpp>
+#include <scwx/provider/event_pack_warnings_provider.hpp>
+#include <scwx/provider/nexrad_data_provider_factory.hpp>
+#include <scwx/util/clock.hpp>
 #include <scwx/util/logger.hpp>
 
+#include <algorithm>
+#include <chrono>
 #include <shared_mutex>
 #include <unordered_map>
 
@@ -25,6 +29,8 @@ static const auto        logger_    = scwx::util::Logger::Create(logPrefix_);
 static const std::string& kDefaultWarningsProviderUrl {
    "https://warnings.allisonhouse.com"};
 
+static constexpr std::chrono::minutes kPruneInterval_ {15};
+
 class TextEventManager::Impl
 {
 public:
@@ -32,29 +38,59 @@ public:
        self_ {self},
        refreshTimer_ {threadPool_},
        refreshMutex_ {},
+       pruneTimer_ {threadPool_},
        textEventMap_ {},
+       textEventUpdated_ {},
        textEventMutex_ {}
    {
       auto& generalSettings = settings::GeneralSettings::Instance();
 
-      warningsProvider_ = std::make_shared<provider::WarningsProvider>(
-         generalSettings.warnings_provider().GetValue());
+      // Text products are served from the event pack when one is loaded
+      auto eventPack = provider::NexradDataProviderFactory::event_pack();
+      if (eventPack != nullptr)
+      {
+         warningsProvider_ =
+            std::make_shared<provider::EventPackWarningsProvider>(eventPack);
+      }
+      else
+      {
+         warningsProvider_ = std::make_shared<provider::WarningsProvider>(
+            generalSettings.warnings_provider().GetValue());
+      }
 
       warningsProviderChangedCallbackUuid_ =
          generalSettings.warnings_provider().RegisterValueChangedCallback(
-            [this](const std::string& value) {
-               warningsProvider_ =
-                  std::make_shared<provider::WarningsProvider>(value);
+            [this, eventPack](const std::string& value)
+            {
+               if (eventPack == nullptr)
+               {
+                  warningsProvider_ =
+                     std::make_shared<provider::WarningsProvider>(value);
+               }
             });
 
+      // Live warnings do not correspond to the time of a replay
+      const bool refreshEnabled =
+         eventPack != nullptr || !scwx::util::IsReplayActive();
+
       boost::asio::post(threadPool_,
-                        [this]()
+                        [this, refreshEnabled]()
                         {
                            try
                            {
                               main::Application::WaitForInitialization();
-                              logger_->debug("Start Refresh");
-                              Refresh();
+                              SchedulePrune();
+
+                              if (refreshEnabled)
+                              {
+                                 logger_->debug("Start Refresh");
+                                 Refresh();
+                              }
+                              else
+                              {
+                                 logger_->info(
+                                    "Replay active, live warnings disabled");
+                              }
                            }
                            catch (const std::exception& ex)
                            {
@@ -71,14 +107,17 @@ public:
 
       std::unique_lock lock(refreshMutex_);
       refreshTimer_.cancel();
+      pruneTimer_.cancel();
       lock.unlock();
 
       threadPool_.join();
    }
 
    void HandleMessage(std::shared_ptr<awips::TextProductMessage> message);
+   void Prune();
    void RefreshAsync();
    void Refresh();
+   void SchedulePrune();
 
    boost::asio::thread_pool threadPool_ {1u};
 
@@ -86,11 +125,16 @@ public:
 
    boost::asio::steady_timer refreshTimer_;
    std::mutex                refreshMutex_;
+   boost::asio::steady_timer pruneTimer_;
 
    std::unordered_map<types::TextEventKey,
                       std::vector<std::shared_ptr<awips::TextProductMessage>>,
                       types::TextEventHash<types::TextEventKey>>
-                     textEventMap_;
+      textEventMap_;
+   std::unordered_map<types::TextEventKey,
+                      std::chrono::system_clock::time_point,
+                      types::TextEventHash<types::TextEventKey>>
+                     textEventUpdated_;
    std::shared_mutex textEventMutex_;
 
    std::shared_ptr<provider::WarningsProvider> warningsProvider_ {nullptr};
@@ -219,6 +263,13 @@ void TextEventManager::Impl::HandleMessage(
       updated = true;
    };
 
+   if (updated)
+   {
+      // Record the time the event was last updated, to prevent events loaded
+      // from an archive from being immediately evicted
+      textEventUpdated_.insert_or_assign(key, scwx::util::CurrentTime());
+   }
+
    lock.unlock();
 
    if (updated)
@@ -272,9 +323,9 @@ void TextEventManager::Impl::Refresh()
       }
    }
 
-   // Schedule another update in 15 seconds
+   // Schedule another update in 15 seconds of clock time
    using namespace std::chrono;
-   refreshTimer_.expires_after(15s);
+   refreshTimer_.expires_after(scwx::util::RealDuration(15s));
    refreshTimer_.async_wait(
       [this](const boost::system::error_code& e)
       {
@@ -293,6 +344,111 @@ void TextEventManager::Impl::Refresh()
       });
 }
 
+void TextEventManager::Impl::Prune()
+{
+   using namespace std::chrono;
+
+   const hours retention {settings::GeneralSettings::Instance()
+                             .alert_retention()
+                             .GetValue()};
+   const system_clock::time_point threshold =
+      scwx::util::CurrentTime() - retention;
+
+   std::vector<types::TextEventKey> removedKeys {};
+
+   std::unique_lock lock(textEventMutex_);
+
+   for (auto it = textEventMap_.begin(); it != textEventMap_.end();)
+   {
+      auto updatedIt = textEventUpdated_.find(it->first);
+      const system_clock::time_point lastUpdated =
+         (updatedIt != textEventUpdated_.cend()) ? updatedIt->second :
+                                                   system_clock::time_point {};
+
+      const bool expired = IsExpired(it->second, lastUpdated, threshold);
+
+      if (expired)
+      {
+         removedKeys.push_back(it->first);
+         textEventUpdated_.erase(it->first);
+         it = textEventMap_.erase(it);
+      }
+      else
+      {
+         ++it;
+      }
+   }
+
+   lock.unlock();
+
+   if (!removedKeys.empty())
+   {
+      logger_->debug("Evicted {} expired text events", removedKeys.size());
+
+      Q_EMIT self_->AlertsRemoved(removedKeys);
+   }
+}
+
+bool TextEventManager::IsExpired(
+   const std::vector<std::shared_ptr<awips::TextProductMessage>>& messages,
+   std::chrono::system_clock::time_point                          lastUpdated,
+   std::chrono::system_clock::time_point                          threshold)
+{
+   using namespace std::chrono;
+
+   if (lastUpdated >= threshold)
+   {
+      return false;
+   }
+
+   if (messages.empty())
+   {
+      return true;
+   }
+
+   // The event ends at the latest end time of its most recent message
+   system_clock::time_point eventEnd {};
+   for (auto& segment : messages.back()->segments())
+   {
+      eventEnd = std::max(eventEnd, segment->event_end());
+   }
+
+   // Events without an end time are retained until they are updated
+   return eventEnd != system_clock::time_point {} && eventEnd < threshold;
+}
+
+void TextEventManager::Impl::SchedulePrune()
+{
+   std::unique_lock lock(refreshMutex_);
+
+   pruneTimer_.expires_after(kPruneInterval_);
+   pruneTimer_.async_wait(
+      [this](const boost::system::error_code& e)
+      {
+         if (e == boost::asio::error::operation_aborted)
+         {
+            logger_->debug("Prune timer cancelled");
+         }
+         else if (e != boost::system::errc::success)
+         {
+            logger_->warn("Prune timer error: {}", e.message());
+         }
+         else
+         {
+            try
+            {
+               Prune();
+            }
+            catch (const std::exception& ex)
+            {
+               logger_->error(ex.what());
+            }
+
+            SchedulePrune();
+         }
+      });
+}
+
 std::shared_ptr<TextEventManager> TextEventManager::Instance()
 {
    static std::weak_ptr<TextEventManager> textEventManagerReference_ {};
@@ -3,8 +3,10 @@
 #include <scwx/awips/text_product_message.hpp>
 #include <scwx/qt/types/text_event_key.hpp>
 
+#include <chrono>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include <QObject>
 
@@ -31,9 +33,34 @@ public:
 
    static std::shared_ptr<TextEventManager> Instance();
 
+   /**
+    * Determines whether a text event is evicted by pruning. An event expires
+    * once both the latest end time of its most recent message and its last
+    * update are before the retention threshold. Events whose most recent
+    * message has no end time are retained until they are updated.
+    *
+    * @param [in] messages Messages of the text event, in order received
+    * @param [in] lastUpdated Time the text event was last updated
+    * @param [in] threshold Retention threshold
+    *
+    * @return true if the text event has expired
+    */
+   static bool IsExpired(
+      const std::vector<std::shared_ptr<awips::TextProductMessage>>& messages,
+      std::chrono::system_clock::time_point lastUpdated,
+      std::chrono::system_clock::time_point threshold);
+
 signals:
    void AlertUpdated(const types::TextEventKey& key, size_t messageIndex);
 
+   /**
+    * Emitted after expired text events have been evicted according to the
+    * alert retention setting. Messages for the keys are no longer available.
+    *
+    * @param [in] keys Evicted text event keys
+    */
+   void AlertsRemoved(const std::vector<types::TextEventKey>& keys);
+
 private:
    class Impl;
    std::unique_ptr<Impl> p;
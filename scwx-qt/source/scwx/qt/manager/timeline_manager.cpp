@@ -1,12 +1,15 @@
 #include <scwx/qt/manager/timeline_manager.hpp>
 #include <scwx/qt/manager/radar_product_manager.hpp>
 #include <scwx/qt/settings/general_settings.hpp>
+#include <scwx/util/clock.hpp>
 #include <scwx/util/logger.hpp>
 #include <scwx/util/map.hpp>
 #include <scwx/util/time.hpp>
 
+#include <algorithm>
 #include <condition_variable>
 #include <mutex>
+#include <set>
 
 #include <boost/asio/post.hpp>
 #include <boost/asio/steady_timer.hpp>
@@ -52,6 +55,13 @@ public:
       animationTimer_.cancel();
 
       std::unique_lock selectTimeLock {selectTimeMutex_};
+
+      std::unique_lock frameLock {frameMutex_};
+      if (frameRadarProductManager_ != nullptr)
+      {
+         QObject::disconnect(
+            frameRadarProductManager_.get(), nullptr, self_, nullptr);
+      }
    }
 
    TimelineManager* self_;
@@ -63,6 +73,10 @@ public:
       std::shared_ptr<manager::RadarProductManager> radarProductManager,
       const std::set<std::chrono::system_clock::time_point>& volumeTimes);
 
+   std::set<std::chrono::system_clock::time_point>
+        UpdateFrames(bool                                  rebuild,
+                     std::chrono::system_clock::time_point startTime,
+                     std::chrono::system_clock::time_point endTime);
    void RadarSweepMonitorDisable();
    void RadarSweepMonitorReset();
    void RadarSweepMonitorWait(std::unique_lock<std::mutex>& lock);
@@ -73,7 +87,9 @@ public:
    void
    SelectTimeAsync(std::chrono::system_clock::time_point selectedTime = {});
    std::pair<bool, bool>
-        SelectTime(std::chrono::system_clock::time_point selectedTime = {});
+   SelectTime(std::chrono::system_clock::time_point selectedTime = {},
+              const std::set<std::chrono::system_clock::time_point>*
+                 volumeTimes = nullptr);
    void StepAsync(Direction direction);
    void Step(Direction direction);
 
@@ -102,6 +118,12 @@ public:
    std::mutex                animationTimerMutex_ {};
 
    std::mutex selectTimeMutex_ {};
+
+   // Distinct volume times of the active products, used as animation frames
+   std::set<std::chrono::system_clock::time_point> frameTimes_ {};
+   std::string                                     frameRadarSite_ {};
+   std::shared_ptr<RadarProductManager> frameRadarProductManager_ {nullptr};
+   std::mutex                           frameMutex_ {};
 };
 
 TimelineManager::TimelineManager() : p(std::make_unique<Impl>(this)) {}
@@ -208,7 +230,7 @@ void TimelineManager::AnimationStepBegin()
        p->pinnedTime_ == std::chrono::system_clock::time_point {})
    {
       // If the selected view type is live, select the current products
-      p->SelectTimeAsync(std::chrono::system_clock::now() - p->loopTime_);
+      p->SelectTimeAsync(scwx::util::CurrentTime() - p->loopTime_);
    }
    else
    {
@@ -376,7 +398,7 @@ TimelineManager::Impl::GetLoopStartAndEndTimes()
        pinnedTime_ == std::chrono::system_clock::time_point {})
    {
       endTime = std::chrono::floor<std::chrono::minutes>(
-         std::chrono::system_clock::now());
+         scwx::util::CurrentTime());
    }
    else
    {
@@ -405,6 +427,83 @@ void TimelineManager::Impl::UpdateCacheLimit(
       static_cast<std::size_t>(numVolumeScans * 1.5), numVolumeScans + 5u));
 }
 
+std::set<std::chrono::system_clock::time_point>
+TimelineManager::Impl::UpdateFrames(
+   bool                                  rebuild,
+   std::chrono::system_clock::time_point startTime,
+   std::chrono::system_clock::time_point endTime)
+{
+   std::unique_lock frameLock {frameMutex_};
+
+   if (frameRadarSite_ != radarSite_ || frameRadarProductManager_ == nullptr)
+   {
+      if (frameRadarProductManager_ != nullptr)
+      {
+         QObject::disconnect(
+            frameRadarProductManager_.get(), nullptr, self_, nullptr);
+      }
+
+      frameRadarSite_ = radarSite_;
+      frameRadarProductManager_ =
+         manager::RadarProductManager::Instance(radarSite_);
+      rebuild = true;
+
+      // Add newly arrived volumes of active products to the frame list as they
+      // become available
+      QObject::connect(
+         frameRadarProductManager_.get(),
+         &RadarProductManager::NewDataAvailable,
+         self_,
+         [this, weakManager = std::weak_ptr {frameRadarProductManager_}](
+            common::RadarProductGroup             group,
+            const std::string&                    product,
+            std::chrono::system_clock::time_point latestTime)
+         {
+            auto radarProductManager = weakManager.lock();
+            if (radarProductManager == nullptr ||
+                !radarProductManager->IsProductActive(group, product))
+            {
+               return;
+            }
+
+            std::unique_lock lock {frameMutex_};
+            frameTimes_.insert(latestTime);
+         });
+   }
+
+   if (rebuild)
+   {
+      auto radarProductManager = frameRadarProductManager_;
+
+      // Query the merged volume times of all active products, without
+      // blocking newly arrived volumes
+      frameLock.unlock();
+      auto volumeTimes = radarProductManager->GetActiveVolumeTimes(endTime);
+      frameLock.lock();
+
+      // Keep volumes which arrived after the query was made
+      if (!volumeTimes.empty())
+      {
+         volumeTimes.insert(frameTimes_.upper_bound(*volumeTimes.crbegin()),
+                            frameTimes_.cend());
+      }
+
+      frameTimes_.swap(volumeTimes);
+   }
+   else if (!frameTimes_.empty())
+   {
+      // Discard frames which have left the loop, keeping the frame in effect
+      // at the start of the loop
+      auto it = frameTimes_.upper_bound(startTime);
+      if (it != frameTimes_.cbegin())
+      {
+         frameTimes_.erase(frameTimes_.cbegin(), std::prev(it));
+      }
+   }
+
+   return frameTimes_;
+}
+
 void TimelineManager::Impl::Play()
 {
    if (animationState_ != types::AnimationState::Play)
@@ -434,8 +533,6 @@ void TimelineManager::Impl::Play()
 
 void TimelineManager::Impl::PlaySync()
 {
-   using namespace std::chrono_literals;
-
    // Take a lock for time selection
    std::unique_lock lock {selectTimeMutex_};
 
@@ -443,7 +540,13 @@ void TimelineManager::Impl::PlaySync()
    std::chrono::system_clock::time_point currentTime = selectedTime_;
    std::chrono::system_clock::time_point newTime;
 
-   if (currentTime < startTime || currentTime >= endTime)
+   const bool loopStart = (currentTime < startTime || currentTime >= endTime);
+
+   // Rebuild the frame list at the start of each loop, picking up changes to
+   // the active products. Within the loop, frames are updated incrementally.
+   auto frameTimes = UpdateFrames(loopStart, startTime, endTime);
+
+   if (loopStart)
    {
       // If the currently selected time is out of the loop, select the
       // start time
@@ -451,8 +554,10 @@ void TimelineManager::Impl::PlaySync()
    }
    else
    {
-      // If the currently selected time is in the loop, increment
-      newTime = currentTime + 1min;
+      // If the currently selected time is in the loop, advance to the next
+      // frame where data changes, or to the end of the loop
+      auto it = frameTimes.upper_bound(currentTime);
+      newTime = (it != frameTimes.cend() && *it < endTime) ? *it : endTime;
    }
 
    // Unlock prior to selecting time
@@ -466,7 +571,8 @@ void TimelineManager::Impl::PlaySync()
 
    // Select the time
    auto selectTimeStart = std::chrono::steady_clock::now();
-   auto [volumeTimeUpdated, selectedTimeUpdated] = SelectTime(newTime);
+   auto [volumeTimeUpdated, selectedTimeUpdated] =
+      SelectTime(newTime, &frameTimes);
    auto selectTimeEnd = std::chrono::steady_clock::now();
    auto elapsedTime   = selectTimeEnd - selectTimeStart;
 
@@ -485,9 +591,20 @@ void TimelineManager::Impl::PlaySync()
    std::chrono::milliseconds interval;
    if (newTime != endTime)
    {
-      // Determine repeat interval (speed of 1.0 is 1 minute per second)
+      // Determine repeat interval (speed of 1.0 is 1 minute per second). The
+      // frame is displayed for the data time until the next frame, so that
+      // the loop speed is independent of the number of frames.
+      auto frameIt = frameTimes.upper_bound(newTime);
+      auto nextTime =
+         (frameIt != frameTimes.cend() && *frameIt < endTime) ? *frameIt :
+                                                                 endTime;
+      double frameMinutes =
+         std::chrono::duration<double, std::ratio<60>>(nextTime - newTime)
+            .count();
+
       interval = std::chrono::duration_cast<std::chrono::milliseconds>(
-         std::chrono::milliseconds(std::lroundl(1000.0 / loopSpeed_)) -
+         std::chrono::milliseconds(
+            std::lroundl(frameMinutes * 1000.0 / loopSpeed_)) -
          elapsedTime);
    }
    else
@@ -538,7 +655,8 @@ void TimelineManager::Impl::SelectTimeAsync(
 }
 
 std::pair<bool, bool> TimelineManager::Impl::SelectTime(
-   std::chrono::system_clock::time_point selectedTime)
+   std::chrono::system_clock::time_point                  selectedTime,
+   const std::set<std::chrono::system_clock::time_point>* volumeTimes)
 {
    bool volumeTimeUpdated   = false;
    bool selectedTimeUpdated = false;
@@ -570,16 +688,23 @@ std::pair<bool, bool> TimelineManager::Impl::SelectTime(
    // Take a lock for time selection
    std::unique_lock lock {selectTimeMutex_};
 
-   // Request active volume times
+   // Request active volume times, unless provided by the animation frames
    auto radarProductManager =
       manager::RadarProductManager::Instance(radarSite_);
-   auto volumeTimes = radarProductManager->GetActiveVolumeTimes(selectedTime);
+   std::set<std::chrono::system_clock::time_point> activeVolumeTimes {};
+   if (volumeTimes == nullptr)
+   {
+      activeVolumeTimes =
+         radarProductManager->GetActiveVolumeTimes(selectedTime);
+      volumeTimes = &activeVolumeTimes;
+   }
 
    // Dynamically update maximum cached volume scans
-   UpdateCacheLimit(radarProductManager, volumeTimes);
+   UpdateCacheLimit(radarProductManager, *volumeTimes);
 
    // Find the best match bounded time
-   auto elementPtr = util::GetBoundedElementPointer(volumeTimes, selectedTime);
+   auto elementPtr =
+      util::GetBoundedElementPointer(*volumeTimes, selectedTime);
 
    // The timeline is no longer live
    Q_EMIT self_->LiveStateUpdated(false);
@@ -643,7 +768,7 @@ void TimelineManager::Impl::Step(Direction direction)
    std::chrono::system_clock::time_point queryTime = adjustedTime_;
    if (queryTime == std::chrono::system_clock::time_point {})
    {
-      queryTime = std::chrono::system_clock::now();
+      queryTime = scwx::util::CurrentTime();
    }
 
    // Request active volume times
@@ -1,5 +1,6 @@
 #include <scwx/qt/map/alert_layer.hpp>
 #include <scwx/qt/gl/draw/geo_lines.hpp>
+#include <scwx/qt/manager/alert_scheduler.hpp>
 #include <scwx/qt/manager/text_event_manager.hpp>
 #include <scwx/qt/manager/timeline_manager.hpp>
 #include <scwx/qt/settings/palette_settings.hpp>
@@ -7,13 +8,14 @@
 #include <scwx/qt/util/tooltip.hpp>
 #include <scwx/util/logger.hpp>
 
+#include <algorithm>
 #include <chrono>
 #include <mutex>
 #include <unordered_map>
 #include <unordered_set>
 
 #include <boost/algorithm/string/join.hpp>
-#include <boost/asio/system_timer.hpp>
+#include <boost/asio/post.hpp>
 #include <boost/asio/thread_pool.hpp>
 #include <boost/container/stable_vector.hpp>
 #include <boost/container_hash/hash.hpp>
@@ -72,6 +74,11 @@ public:
               this,
               [this](const types::TextEventKey& key, std::size_t messageIndex)
               { HandleAlert(key, messageIndex); });
+      connect(textEventManager_.get(),
+              &manager::TextEventManager::AlertsRemoved,
+              this,
+              [this](const std::vector<types::TextEventKey>& keys)
+              { HandleAlertsRemoved(keys); });
    }
    ~AlertLayerHandler()
    {
@@ -93,6 +100,7 @@ public:
       segmentsByKey_ {};
 
    void HandleAlert(const types::TextEventKey& key, size_t messageIndex);
+   void HandleAlertsRemoved(const std::vector<types::TextEventKey>& keys);
 
    static AlertLayerHandler& Instance();
 
@@ -105,6 +113,8 @@ signals:
    void AlertAdded(const std::shared_ptr<SegmentRecord>& segmentRecord,
                    awips::Phenomenon                     phenomenon);
    void AlertUpdated(const std::shared_ptr<SegmentRecord>& segmentRecord);
+   void AlertsRemoved(
+      const std::vector<std::shared_ptr<SegmentRecord>>& segmentRecords);
    void AlertsUpdated(awips::Phenomenon phenomenon, bool alertActive);
 };
 
@@ -131,14 +141,9 @@ public:
       }
 
       ConnectSignals();
-      ScheduleRefresh();
    }
    ~Impl()
    {
-      std::unique_lock refreshLock(refreshMutex_);
-      refreshTimer_.cancel();
-      refreshLock.unlock();
-
       threadPool_.join();
 
       receiver_ = nullptr;
@@ -152,11 +157,13 @@ public:
       const std::shared_ptr<AlertLayerHandler::SegmentRecord>& segmentRecord);
    void ConnectAlertHandlerSignals();
    void ConnectSignals();
+   void RemoveAlerts(
+      const std::vector<std::shared_ptr<AlertLayerHandler::SegmentRecord>>&
+         segmentRecords);
    void HandleGeoLinesEvent(std::shared_ptr<gl::draw::GeoLineDrawItem>& di,
                             QEvent*                                     ev);
    void HandleGeoLinesHover(std::shared_ptr<gl::draw::GeoLineDrawItem>& di,
                             const QPointF& mouseGlobalPos);
-   void ScheduleRefresh();
 
    void AddLine(std::shared_ptr<gl::draw::GeoLines>&        geoLines,
                 std::shared_ptr<gl::draw::GeoLineDrawItem>& di,
@@ -181,11 +188,11 @@ public:
 
    AlertLayer* self_;
 
-   boost::asio::system_timer refreshTimer_ {threadPool_};
-   std::mutex                refreshMutex_;
-
    const awips::Phenomenon phenomenon_;
 
+   std::shared_ptr<manager::AlertScheduler> alertScheduler_ {
+      manager::AlertScheduler::Instance()};
+
    std::unique_ptr<QObject> receiver_ {std::make_unique<QObject>()};
 
    std::unordered_map<bool, std::shared_ptr<gl::draw::GeoLines>> geoLines_;
@@ -360,6 +367,53 @@ void AlertLayerHandler::HandleAlert(const types::TextEventKey& key,
    }
 }
 
+void AlertLayerHandler::HandleAlertsRemoved(
+   const std::vector<types::TextEventKey>& keys)
+{
+   logger_->trace("HandleAlertsRemoved: {}", keys.size());
+
+   std::vector<std::shared_ptr<SegmentRecord>> removedSegments {};
+
+   // Take a unique mutex before modifying segments
+   std::unique_lock lock {alertMutex_};
+
+   for (auto& key : keys)
+   {
+      auto it = segmentsByKey_.find(key);
+      if (it != segmentsByKey_.cend())
+      {
+         removedSegments.insert(
+            removedSegments.end(), it->second.cbegin(), it->second.cend());
+         segmentsByKey_.erase(it);
+      }
+   }
+
+   if (removedSegments.empty())
+   {
+      return;
+   }
+
+   std::unordered_set<std::shared_ptr<SegmentRecord>> removedSet {
+      removedSegments.cbegin(), removedSegments.cend()};
+
+   // Remove segments from each type in a single pass
+   for (auto& segmentsForType : segmentsByType_)
+   {
+      auto& segments = segmentsForType.second;
+      segments.erase(
+         std::remove_if(segments.begin(),
+                        segments.end(),
+                        [&removedSet](const auto& segmentRecord)
+                        { return removedSet.contains(segmentRecord); }),
+         segments.end());
+   }
+
+   // Release the lock after completing segment updates
+   lock.unlock();
+
+   Q_EMIT AlertsRemoved(removedSegments);
+}
+
 void AlertLayer::Impl::ConnectAlertHandlerSignals()
 {
    auto& alertLayerHandler = AlertLayerHandler::Instance();
@@ -375,6 +429,7 @@ void AlertLayer::Impl::ConnectAlertHandlerSignals()
          if (phenomenon == phenomenon_)
          {
             AddAlert(segmentRecord);
+            Q_EMIT self_->NeedsRendering();
          }
       });
    QObject::connect(
@@ -387,8 +442,90 @@ void AlertLayer::Impl::ConnectAlertHandlerSignals()
          if (segmentRecord->key_.phenomenon_ == phenomenon_)
          {
             UpdateAlert(segmentRecord);
+            Q_EMIT self_->NeedsRendering();
          }
       });
+   QObject::connect(
+      &alertLayerHandler,
+      &AlertLayerHandler::AlertsRemoved,
+      receiver_.get(),
+      [this](const std::vector<
+             std::shared_ptr<AlertLayerHandler::SegmentRecord>>& segmentRecords)
+      {
+         // Compact the line buffers in the background
+         boost::asio::post(threadPool_,
+                           [segmentRecords, this]()
+                           {
+                              try
+                              {
+                                 RemoveAlerts(segmentRecords);
+                              }
+                              catch (const std::exception& ex)
+                              {
+                                 logger_->error(ex.what());
+                              }
+                           });
+      });
+}
+
+void AlertLayer::Impl::RemoveAlerts(
+   const std::vector<std::shared_ptr<AlertLayerHandler::SegmentRecord>>&
+      segmentRecords)
+{
+   std::unordered_map<bool,
+                      std::vector<std::shared_ptr<gl::draw::GeoLineDrawItem>>>
+      removedLines {};
+
+   // Take a mutex before modifying lines by segment
+   std::unique_lock lock {linesMutex_};
+
+   for (auto& segmentRecord : segmentRecords)
+   {
+      if (segmentRecord->key_.phenomenon_ != phenomenon_)
+      {
+         continue;
+      }
+
+      auto it = linesBySegment_.find(segmentRecord);
+      if (it == linesBySegment_.cend())
+      {
+         continue;
+      }
+
+      auto& segment     = segmentRecord->segment_;
+      auto& vtec        = segment->header_->vtecString_.front();
+      auto  action      = vtec.pVtec_.action();
+      bool  alertActive = (action != awips::PVtec::Action::Canceled);
+
+      auto& lines = removedLines[alertActive];
+      for (auto& di : it->second)
+      {
+         segmentsByLine_.erase(di);
+         lines.push_back(di);
+      }
+
+      linesBySegment_.erase(it);
+   }
+
+   if (lastHoverDi_ != nullptr && !segmentsByLine_.contains(lastHoverDi_))
+   {
+      lastHoverDi_ = nullptr;
+      tooltip_.clear();
+   }
+
+   lock.unlock();
+
+   if (removedLines.empty())
+   {
+      return;
+   }
+
+   for (auto& [alertActive, lines] : removedLines)
+   {
+      geoLines_.at(alertActive)->RemoveLines(lines);
+   }
+
+   Q_EMIT self_->NeedsRendering();
 }
 
 void AlertLayer::Impl::ConnectSignals()
@@ -400,36 +537,20 @@ void AlertLayer::Impl::ConnectSignals()
                     receiver_.get(),
                     [this](std::chrono::system_clock::time_point dateTime)
                     { selectedTime_ = dateTime; });
-}
 
-void AlertLayer::Impl::ScheduleRefresh()
-{
-   using namespace std::chrono_literals;
-
-   // Take a unique lock before refreshing
-   std::unique_lock lock(refreshMutex_);
-
-   // Expires at the top of the next minute
-   std::chrono::system_clock::time_point now =
-      std::chrono::floor<std::chrono::minutes>(
-         std::chrono::system_clock::now());
-   refreshTimer_.expires_at(now + 1min);
-
-   refreshTimer_.async_wait(
-      [this](const boost::system::error_code& e)
+   // Redraw only when an alert of this phenomenon starts or ends
+   QObject::connect(
+      alertScheduler_.get(),
+      &manager::AlertScheduler::AlertsTransitioned,
+      receiver_.get(),
+      [this](const std::vector<types::TextEventKey>& keys)
       {
-         if (e == boost::asio::error::operation_aborted)
-         {
-            logger_->debug("Refresh timer cancelled");
-         }
-         else if (e != boost::system::errc::success)
-         {
-            logger_->warn("Refresh timer error: {}", e.message());
-         }
-         else
+         if (std::any_of(keys.cbegin(),
+                         keys.cend(),
+                         [this](const types::TextEventKey& key)
+                         { return key.phenomenon_ == phenomenon_; }))
          {
             Q_EMIT self_->NeedsRendering();
-            ScheduleRefresh();
          }
       });
 }
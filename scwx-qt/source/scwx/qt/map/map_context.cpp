@@ -1,6 +1,8 @@
 #include <scwx/qt/map/map_context.hpp>
 #include <scwx/qt/map/map_settings.hpp>
+#include <scwx/qt/view/cross_section_view.hpp>
 #include <scwx/qt/view/overlay_product_view.hpp>
+#include <scwx/qt/view/radar_mosaic_view.hpp>
 #include <scwx/qt/view/radar_product_view.hpp>
 
 namespace scwx
@@ -35,7 +37,9 @@ public:
    QMargins           colorTableMargins_ {};
    common::Coordinate mouseCoordinate_ {};
 
+   std::shared_ptr<view::CrossSectionView>   crossSectionView_ {nullptr};
    std::shared_ptr<view::OverlayProductView> overlayProductView_ {nullptr};
+   std::shared_ptr<view::RadarMosaicView>    radarMosaicView_ {nullptr};
    std::shared_ptr<view::RadarProductView>   radarProductView_;
 };
 
@@ -74,6 +78,11 @@ QMargins MapContext::color_table_margins() const
    return p->colorTableMargins_;
 }
 
+std::shared_ptr<view::CrossSectionView> MapContext::cross_section_view() const
+{
+   return p->crossSectionView_;
+}
+
 float MapContext::pixel_ratio() const
 {
    return p->pixelRatio_;
@@ -90,6 +99,11 @@ MapContext::overlay_product_view() const
    return p->overlayProductView_;
 }
 
+std::shared_ptr<view::RadarMosaicView> MapContext::radar_mosaic_view() const
+{
+   return p->radarMosaicView_;
+}
+
 std::shared_ptr<view::RadarProductView> MapContext::radar_product_view() const
 {
    return p->radarProductView_;
@@ -135,6 +149,12 @@ void MapContext::set_color_table_margins(const QMargins& margins)
    p->colorTableMargins_ = margins;
 }
 
+void MapContext::set_cross_section_view(
+   const std::shared_ptr<view::CrossSectionView>& crossSectionView)
+{
+   p->crossSectionView_ = crossSectionView;
+}
+
 void MapContext::set_mouse_coordinate(const common::Coordinate& coordinate)
 {
    p->mouseCoordinate_ = coordinate;
@@ -151,6 +171,12 @@ void MapContext::set_pixel_ratio(float pixelRatio)
    p->pixelRatio_ = pixelRatio;
 }
 
+void MapContext::set_radar_mosaic_view(
+   const std::shared_ptr<view::RadarMosaicView>& radarMosaicView)
+{
+   p->radarMosaicView_ = radarMosaicView;
+}
+
 void MapContext::set_radar_product_view(
    const std::shared_ptr<view::RadarProductView>& radarProductView)
 {
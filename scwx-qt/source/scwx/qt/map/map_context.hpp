@@ -15,7 +15,9 @@ namespace qt
 namespace view
 {
 
+class CrossSectionView;
 class OverlayProductView;
+class RadarMosaicView;
 class RadarProductView;
 
 } // namespace view
@@ -43,9 +45,11 @@ public:
    MapProvider                               map_provider() const;
    MapSettings&                              settings();
    QMargins                                  color_table_margins() const;
+   std::shared_ptr<view::CrossSectionView>   cross_section_view() const;
    float                                     pixel_ratio() const;
    common::Coordinate                        mouse_coordinate() const;
    std::shared_ptr<view::OverlayProductView> overlay_product_view() const;
+   std::shared_ptr<view::RadarMosaicView>    radar_mosaic_view() const;
    std::shared_ptr<view::RadarProductView>   radar_product_view() const;
    common::RadarProductGroup                 radar_product_group() const;
    std::string                               radar_product() const;
@@ -56,10 +60,14 @@ public:
    void set_map_copyrights(const std::string& copyrights);
    void set_map_provider(MapProvider provider);
    void set_color_table_margins(const QMargins& margins);
+   void set_cross_section_view(
+      const std::shared_ptr<view::CrossSectionView>& crossSectionView);
    void set_mouse_coordinate(const common::Coordinate& coordinate);
    void set_overlay_product_view(
       const std::shared_ptr<view::OverlayProductView>& overlayProductView);
    void set_pixel_ratio(float pixelRatio);
+   void set_radar_mosaic_view(
+      const std::shared_ptr<view::RadarMosaicView>& radarMosaicView);
    void set_radar_product_view(
       const std::shared_ptr<view::RadarProductView>& radarProductView);
    void set_radar_product_group(common::RadarProductGroup radarProductGroup);
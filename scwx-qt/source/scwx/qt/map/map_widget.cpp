@@ -12,6 +12,7 @@
 #include <scwx/qt/map/overlay_layer.hpp>
 #include <scwx/qt/map/overlay_product_layer.hpp>
 #include <scwx/qt/map/placefile_layer.hpp>
+#include <scwx/qt/map/radar_mosaic_layer.hpp>
 #include <scwx/qt/map/radar_product_layer.hpp>
 #include <scwx/qt/map/radar_range_layer.hpp>
 #include <scwx/qt/map/radar_site_layer.hpp>
@@ -20,13 +21,20 @@
 #include <scwx/qt/settings/general_settings.hpp>
 #include <scwx/qt/settings/palette_settings.hpp>
 #include <scwx/qt/util/file.hpp>
+#include <scwx/qt/util/imgui.hpp>
 #include <scwx/qt/util/maplibre.hpp>
 #include <scwx/qt/util/tooltip.hpp>
+#include <scwx/qt/view/cross_section_view.hpp>
+#include <scwx/qt/view/level2_product_view.hpp>
 #include <scwx/qt/view/overlay_product_view.hpp>
+#include <scwx/qt/view/radar_mosaic_view.hpp>
 #include <scwx/qt/view/radar_product_view_factory.hpp>
 #include <scwx/util/logger.hpp>
 #include <scwx/util/time.hpp>
+#include <scwx/util/trace.hpp>
+#include <scwx/wsr88d/rpg/storm_tracking_information_message.hpp>
 
+#include <numbers>
 #include <set>
 
 #include <backends/imgui_impl_opengl3.h>
@@ -99,6 +107,12 @@ public:
       overlayProductView->SetAutoRefresh(autoRefreshEnabled_);
       overlayProductView->SetAutoUpdate(autoUpdateEnabled_);
 
+      auto radarMosaicView = std::make_shared<view::RadarMosaicView>();
+      radarMosaicView->SetAutoRefresh(autoRefreshEnabled_);
+      radarMosaicView->SetAutoUpdate(autoUpdateEnabled_);
+
+      auto crossSectionView = std::make_shared<view::CrossSectionView>();
+
       // Initialize AlertLayerHandler
       map::AlertLayer::InitializeHandler();
 
@@ -107,7 +121,9 @@ public:
       // Initialize context
       context_->set_map_provider(
          GetMapProvider(generalSettings.map_provider().GetValue()));
+      context_->set_cross_section_view(crossSectionView);
       context_->set_overlay_product_view(overlayProductView);
+      context_->set_radar_mosaic_view(radarMosaicView);
 
       SetRadarSite(generalSettings.default_radar_site().GetValue());
 
@@ -135,6 +151,7 @@ public:
       // Shutdown ImGui Context
       if (imGuiRendererInitialized_)
       {
+         util::ImGui::Instance().ReleaseFontAtlas();
          ImGui_ImplOpenGL3_Shutdown();
       }
       ImGui_ImplQt_Shutdown();
@@ -173,6 +190,8 @@ public:
                                std::optional<std::string> type);
    void SetRadarSite(const std::string& radarSite);
    void UpdateLoadedStyle();
+   void UpdateNstStormMotion();
+   void UpdateStormMotion();
    bool UpdateStoredMapParameters();
 
    std::string FindMapSymbologyLayer();
@@ -208,7 +227,8 @@ public:
    ImGuiContext* imGuiContext_;
    std::string   imGuiContextName_;
    bool          imGuiRendererInitialized_;
-   std::uint64_t imGuiFontsBuildCount_ {};
+
+   std::shared_ptr<ImFontAtlas> imGuiFontAtlas_ {};
 
    std::shared_ptr<model::LayerModel> layerModel_ {
       model::LayerModel::Instance()};
@@ -220,6 +240,7 @@ public:
    std::shared_ptr<manager::RadarProductManager> radarProductManager_;
 
    std::shared_ptr<RadarProductLayer>   radarProductLayer_;
+   std::shared_ptr<RadarMosaicLayer>    radarMosaicLayer_ {nullptr};
    std::shared_ptr<OverlayLayer>        overlayLayer_;
    std::shared_ptr<OverlayProductLayer> overlayProductLayer_ {nullptr};
    std::shared_ptr<PlacefileLayer>      placefileLayer_;
@@ -233,6 +254,12 @@ public:
 
    common::Level2Product selectedLevel2Product_;
 
+   std::optional<types::StormMotion> userStormMotion_ {};
+   std::optional<types::StormMotion> nstStormMotion_ {};
+
+   bool               crossSectionDragging_ {false};
+   common::Coordinate crossSectionStart_ {};
+
    bool            hasMouse_ {false};
    bool            isPainting_ {false};
    bool            lastItemPicked_ {false};
@@ -356,6 +383,19 @@ void MapWidgetImpl::ConnectSignals()
            widget_,
            [this]() { widget_->update(); });
 
+   // Storm relative velocity uses the storm motion from the STI product
+   connect(context_->overlay_product_view().get(),
+           &view::OverlayProductView::ProductUpdated,
+           widget_,
+           [this](const std::string& product)
+           {
+              if (product == "NST")
+              {
+                 UpdateNstStormMotion();
+                 UpdateStormMotion();
+              }
+           });
+
    // When the layer model changes, update the layers
    connect(layerModel_.get(),
            &QAbstractItemModel::dataChanged,
@@ -572,6 +612,11 @@ common::Level3ProductCategoryMap MapWidget::GetAvailableLevel3Categories()
    }
 }
 
+std::shared_ptr<view::CrossSectionView> MapWidget::GetCrossSectionView() const
+{
+   return p->context_->cross_section_view();
+}
+
 float MapWidget::GetElevation() const
 {
    auto radarProductView = p->context_->radar_product_view();
@@ -733,6 +778,8 @@ void MapWidget::SelectElevation(float elevation)
       radarProductView->SelectElevation(elevation);
       radarProductView->Update();
    }
+
+   p->context_->radar_mosaic_view()->SelectElevation(elevation);
 }
 
 void MapWidget::SelectRadarProduct(common::RadarProductGroup group,
@@ -787,6 +834,20 @@ void MapWidget::SelectRadarProduct(common::RadarProductGroup group,
    p->context_->set_radar_product(productName);
    p->context_->set_radar_product_code(productCode);
 
+   // The mosaic is only composited for level 2 products
+   p->context_->radar_mosaic_view()->SelectProduct(
+      (group == common::RadarProductGroup::Level2) ?
+         p->selectedLevel2Product_ :
+         common::Level2Product::Unknown);
+   p->context_->radar_mosaic_view()->SelectTime(time);
+
+   // The cross section is only extracted from level 2 volumes
+   p->context_->cross_section_view()->SelectProduct(
+      (group == common::RadarProductGroup::Level2) ?
+         p->selectedLevel2Product_ :
+         common::Level2Product::Unknown);
+   p->context_->cross_section_view()->SelectTime(time);
+
    if (radarProductView != nullptr)
    {
       // Select the time associated with the request
@@ -794,6 +855,8 @@ void MapWidget::SelectRadarProduct(common::RadarProductGroup group,
 
       if (radarProductViewCreated)
       {
+         p->UpdateStormMotion();
+
          const std::string palette =
             (group == common::RadarProductGroup::Level2) ?
                common::GetLevel2Palette(common::GetLevel2Product(productName)) :
@@ -884,7 +947,9 @@ void MapWidget::SelectTime(std::chrono::system_clock::time_point time)
    auto radarProductView = p->context_->radar_product_view();
 
    // Update other views
+   p->context_->cross_section_view()->SelectTime(time);
    p->context_->overlay_product_view()->SelectTime(time);
+   p->context_->radar_mosaic_view()->SelectTime(time);
 
    // If there is an active radar product view
    if (radarProductView != nullptr)
@@ -921,6 +986,7 @@ void MapWidget::SetAutoRefresh(bool enabled)
       }
 
       p->context_->overlay_product_view()->SetAutoRefresh(enabled);
+      p->context_->radar_mosaic_view()->SetAutoRefresh(enabled);
    }
 }
 
@@ -929,6 +995,14 @@ void MapWidget::SetAutoUpdate(bool enabled)
    p->autoUpdateEnabled_ = enabled;
 
    p->context_->overlay_product_view()->SetAutoUpdate(enabled);
+   p->context_->radar_mosaic_view()->SetAutoUpdate(enabled);
+}
+
+void MapWidget::SetStormMotion(
+   const std::optional<types::StormMotion>& stormMotion)
+{
+   p->userStormMotion_ = stormMotion;
+   p->UpdateStormMotion();
 }
 
 void MapWidget::SetMapLocation(double latitude,
@@ -1125,6 +1199,7 @@ void MapWidgetImpl::AddLayers()
    layerList_.clear();
    genericLayers_.clear();
    placefileLayers_.clear();
+   radarMosaicLayer_ = nullptr;
 
    // Update custom layer list from model
    customLayers_ = model::LayerModel::Instance()->GetLayers();
@@ -1160,6 +1235,9 @@ void MapWidgetImpl::AddLayers()
          AddLayer(it->type_, it->description_, before);
       }
    }
+
+   // Only load mosaic data while the mosaic is displayed
+   context_->radar_mosaic_view()->SetEnabled(radarMosaicLayer_ != nullptr);
 }
 
 void MapWidgetImpl::AddLayer(types::LayerType        type,
@@ -1265,6 +1343,15 @@ void MapWidgetImpl::AddLayer(types::LayerType        type,
          }
          break;
 
+      // If there is a radar product view, create the radar mosaic layer
+      case types::DataLayer::RadarMosaic:
+         if (radarProductView != nullptr)
+         {
+            radarMosaicLayer_ = std::make_shared<RadarMosaicLayer>(context_);
+            AddLayer(layerName, radarMosaicLayer_, before);
+         }
+         break;
+
       default:
          break;
       }
@@ -1369,10 +1456,25 @@ void MapWidget::mousePressEvent(QMouseEvent* ev)
    p->lastPos_       = ev->position();
    p->lastGlobalPos_ = ev->globalPosition();
 
+   p->crossSectionDragging_ = false;
+
    if (ev->type() == QEvent::Type::MouseButtonPress)
    {
-      if (ev->buttons() ==
-          (Qt::MouseButton::LeftButton | Qt::MouseButton::RightButton))
+      if (ev->buttons() == Qt::MouseButton::LeftButton &&
+          ev->modifiers().testFlag(Qt::KeyboardModifier::ControlModifier))
+      {
+         // Start a cross section path on Ctrl+click
+         auto coordinate = p->map_->coordinateForPixel(p->lastPos_);
+
+         p->crossSectionDragging_ = true;
+         p->crossSectionStart_    = {coordinate.first, coordinate.second};
+         p->context_->cross_section_view()->SetEndpoints(
+            p->crossSectionStart_, p->crossSectionStart_);
+
+         Q_EMIT CrossSectionSelected();
+      }
+      else if (ev->buttons() ==
+               (Qt::MouseButton::LeftButton | Qt::MouseButton::RightButton))
       {
          changeStyle();
       }
@@ -1406,7 +1508,15 @@ void MapWidget::mouseMoveEvent(QMouseEvent* ev)
 
    if (!delta.isNull())
    {
-      if (ev->buttons() == Qt::MouseButton::LeftButton)
+      if (ev->buttons() == Qt::MouseButton::LeftButton &&
+          p->crossSectionDragging_)
+      {
+         // Drag the end of the cross section path
+         auto coordinate = p->map_->coordinateForPixel(ev->position());
+         p->context_->cross_section_view()->SetEndpoints(
+            p->crossSectionStart_, {coordinate.first, coordinate.second});
+      }
+      else if (ev->buttons() == Qt::MouseButton::LeftButton)
       {
          p->map_->moveBy(delta);
       }
@@ -1446,16 +1556,10 @@ void MapWidget::initializeGL()
    makeCurrent();
    p->context_->Initialize();
 
-   // Lock ImGui font atlas prior to new ImGui frame
-   std::shared_lock imguiFontAtlasLock {
-      manager::FontManager::Instance().imgui_font_atlas_mutex()};
-
    // Initialize ImGui OpenGL3 backend
    ImGui::SetCurrentContext(p->imGuiContext_);
    ImGui_ImplQt_RegisterWidget(this);
    ImGui_ImplOpenGL3_Init();
-   p->imGuiFontsBuildCount_ =
-      manager::FontManager::Instance().imgui_fonts_build_count();
    p->imGuiRendererInitialized_ = true;
 
    p->map_.reset(
@@ -1491,6 +1595,8 @@ void MapWidget::initializeGL()
 
 void MapWidget::paintGL()
 {
+   scwx::util::TraceSpan span {scwx::util::TraceStage::Render};
+
    p->isPainting_ = true;
 
    auto defaultFont = manager::FontManager::Instance().GetImGuiFont(
@@ -1506,10 +1612,6 @@ void MapWidget::paintGL()
    // Setup ImGui Frame
    ImGui::SetCurrentContext(p->imGuiContext_);
 
-   // Lock ImGui font atlas prior to new ImGui frame
-   std::shared_lock imguiFontAtlasLock {
-      manager::FontManager::Instance().imgui_font_atlas_mutex()};
-
    // Start ImGui Frame
    ImGui_ImplQt_NewFrame(this);
    ImGui_ImplOpenGL3_NewFrame();
@@ -1548,9 +1650,6 @@ void MapWidget::paintGL()
    ImGui::Render();
    ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
 
-   // Unlock ImGui font atlas after rendering
-   imguiFontAtlasLock.unlock();
-
    // Paint complete
    Q_EMIT WidgetPainted();
 
@@ -1559,18 +1658,9 @@ void MapWidget::paintGL()
 
 void MapWidgetImpl::ImGuiCheckFonts()
 {
-   // Update ImGui Fonts if required
-   std::uint64_t currentImGuiFontsBuildCount =
-      manager::FontManager::Instance().imgui_fonts_build_count();
-
-   if (imGuiFontsBuildCount_ != currentImGuiFontsBuildCount ||
-       !model::ImGuiContextModel::Instance().font_atlas()->IsBuilt())
-   {
-      ImGui_ImplOpenGL3_DestroyFontsTexture();
-      ImGui_ImplOpenGL3_CreateFontsTexture();
-   }
-
-   imGuiFontsBuildCount_ = currentImGuiFontsBuildCount;
+   // Switch to the most recently built font atlas, without rebuilding or
+   // uploading fonts when another map has already done so
+   util::ImGui::Instance().SelectFontAtlas(context_->gl(), imGuiFontAtlas_);
 }
 
 void MapWidgetImpl::RunMousePicking()
@@ -1820,7 +1910,20 @@ void MapWidgetImpl::RadarProductViewConnect()
          radarProductView.get(),
          &view::RadarProductView::ColorTableLutUpdated,
          this,
-         [this]() { widget_->update(); },
+         [this]()
+         {
+            auto radarProductView = context_->radar_product_view();
+            if (radarProductView != nullptr)
+            {
+               // Display the cross section using the same color table
+               context_->cross_section_view()->SetColorTable(
+                  radarProductView->color_table_lut(),
+                  radarProductView->color_table_min(),
+                  radarProductView->color_table_max());
+            }
+
+            widget_->update();
+         },
          Qt::QueuedConnection);
       connect(
          radarProductView.get(),
@@ -1894,6 +1997,10 @@ void MapWidgetImpl::SetRadarSite(const std::string& radarSite)
       // Update views
       context_->overlay_product_view()->set_radar_product_manager(
          radarProductManager_);
+      context_->radar_mosaic_view()->SetRadarSites(
+         view::RadarMosaicView::FindNearbyRadarSites(radarSite));
+      context_->cross_section_view()->set_radar_product_manager(
+         radarProductManager_);
 
       // Connect signals to new RadarProductManager
       RadarProductManagerConnect();
@@ -1913,6 +2020,77 @@ void MapWidgetImpl::Update()
    }
 }
 
+void MapWidgetImpl::UpdateNstStormMotion()
+{
+   auto sti =
+      std::dynamic_pointer_cast<wsr88d::rpg::StormTrackingInformationMessage>(
+         context_->overlay_product_view()->radar_product_message("NST"));
+
+   nstStormMotion_.reset();
+
+   if (sti == nullptr)
+   {
+      return;
+   }
+
+   constexpr double kDegreesToRadians = std::numbers::pi / 180.0;
+
+   // Compute the vector mean of the motion of each tracked storm
+   double      u     = 0.0;
+   double      v     = 0.0;
+   std::size_t count = 0u;
+
+   for (auto& record : sti->sti_records())
+   {
+      if (record->direction_.has_value() && record->speed_.has_value())
+      {
+         const double direction =
+            record->direction_->value() * kDegreesToRadians;
+         const double speed =
+            units::velocity::meters_per_second<double>(*record->speed_)
+               .value();
+
+         u += speed * std::sin(direction);
+         v += speed * std::cos(direction);
+         ++count;
+      }
+   }
+
+   if (count > 0u)
+   {
+      double direction = std::atan2(u, v) / kDegreesToRadians;
+      if (direction < 0.0)
+      {
+         direction += 360.0;
+      }
+
+      nstStormMotion_ = types::StormMotion {
+         units::angle::degrees<float> {static_cast<float>(direction)},
+         units::velocity::meters_per_second<float> {
+            static_cast<float>(std::hypot(u, v) / count)}};
+   }
+   else if (sti->default_direction().has_value() &&
+            sti->default_speed().has_value())
+   {
+      // Use the default storm motion if no storms are tracked
+      nstStormMotion_ = types::StormMotion {
+         units::angle::degrees<float> {*sti->default_direction()},
+         units::velocity::meters_per_second<float> {*sti->default_speed()}};
+   }
+}
+
+void MapWidgetImpl::UpdateStormMotion()
+{
+   auto level2ProductView = std::dynamic_pointer_cast<view::Level2ProductView>(
+      context_->radar_product_view());
+
+   if (level2ProductView != nullptr)
+   {
+      level2ProductView->SetStormMotion(
+         userStormMotion_.has_value() ? userStormMotion_ : nstStormMotion_);
+   }
+}
+
 bool MapWidgetImpl::UpdateStoredMapParameters()
 {
    bool changed = false;
@@ -5,10 +5,12 @@
 #include <scwx/qt/config/radar_site.hpp>
 #include <scwx/qt/types/map_types.hpp>
 #include <scwx/qt/types/radar_product_record.hpp>
+#include <scwx/qt/types/storm_motion.hpp>
 #include <scwx/qt/types/text_event_key.hpp>
 
 #include <chrono>
 #include <memory>
+#include <optional>
 
 #include <qmaplibre.hpp>
 
@@ -24,6 +26,13 @@ namespace scwx
 {
 namespace qt
 {
+namespace view
+{
+
+class CrossSectionView;
+
+} // namespace view
+
 namespace map
 {
 
@@ -39,16 +48,17 @@ public:
 
    void DumpLayerList() const;
 
-   common::Level3ProductCategoryMap      GetAvailableLevel3Categories();
-   float                                 GetElevation() const;
-   std::vector<float>                    GetElevationCuts() const;
-   std::vector<std::string>              GetLevel3Products();
-   std::string                           GetMapStyle() const;
-   common::RadarProductGroup             GetRadarProductGroup() const;
-   std::string                           GetRadarProductName() const;
-   std::shared_ptr<config::RadarSite>    GetRadarSite() const;
-   std::chrono::system_clock::time_point GetSelectedTime() const;
-   std::uint16_t                         GetVcp() const;
+   common::Level3ProductCategoryMap        GetAvailableLevel3Categories();
+   std::shared_ptr<view::CrossSectionView> GetCrossSectionView() const;
+   float                                   GetElevation() const;
+   std::vector<float>                      GetElevationCuts() const;
+   std::vector<std::string>                GetLevel3Products();
+   std::string                             GetMapStyle() const;
+   common::RadarProductGroup               GetRadarProductGroup() const;
+   std::string                             GetRadarProductName() const;
+   std::shared_ptr<config::RadarSite>      GetRadarSite() const;
+   std::chrono::system_clock::time_point   GetSelectedTime() const;
+   std::uint16_t                           GetVcp() const;
 
    void SelectElevation(float elevation);
 
@@ -118,6 +128,16 @@ public:
    void SetInitialMapStyle(const std::string& styleName);
    void SetMapStyle(const std::string& styleName);
 
+   /**
+    * Sets the storm motion used by the storm relative velocity product. If no
+    * storm motion is set, the mean storm motion from the Storm Tracking
+    * Information product is used.
+    *
+    * @param [in] stormMotion User storm motion, or std::nullopt to use the
+    * Storm Tracking Information storm motion
+    */
+   void SetStormMotion(const std::optional<types::StormMotion>& stormMotion);
+
    /**
     * Updates the coordinates associated with mouse movement from another map.
     *
@@ -152,6 +172,12 @@ private slots:
 
 signals:
    void AlertSelected(const types::TextEventKey& key);
+
+   /**
+    * This signal is emitted when the user starts drawing a cross section path
+    * on the map.
+    */
+   void CrossSectionSelected();
    void Level3ProductsChanged();
    void MapParametersChanged(double latitude,
                              double longitude,
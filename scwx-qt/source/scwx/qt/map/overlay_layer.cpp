@@ -1,5 +1,6 @@
 #include <scwx/qt/map/overlay_layer.hpp>
 #include <scwx/qt/gl/draw/geo_icons.hpp>
+#include <scwx/qt/gl/draw/geo_lines.hpp>
 #include <scwx/qt/gl/draw/icons.hpp>
 #include <scwx/qt/gl/draw/rectangle.hpp>
 #include <scwx/qt/manager/font_manager.hpp>
@@ -7,6 +8,7 @@
 #include <scwx/qt/map/map_settings.hpp>
 #include <scwx/qt/settings/general_settings.hpp>
 #include <scwx/qt/types/texture_types.hpp>
+#include <scwx/qt/view/cross_section_view.hpp>
 #include <scwx/qt/view/radar_product_view.hpp>
 #include <scwx/util/logger.hpp>
 #include <scwx/util/time.hpp>
@@ -46,9 +48,11 @@ public:
    explicit OverlayLayerImpl(OverlayLayer*               self,
                              std::shared_ptr<MapContext> context) :
        self_ {self},
+       context_ {context},
        activeBoxOuter_ {std::make_shared<gl::draw::Rectangle>(context)},
        activeBoxInner_ {std::make_shared<gl::draw::Rectangle>(context)},
        geoIcons_ {std::make_shared<gl::draw::GeoIcons>(context)},
+       geoLines_ {std::make_shared<gl::draw::GeoLines>(context)},
        icons_ {std::make_shared<gl::draw::Icons>(context)}
    {
       auto& generalSettings = settings::GeneralSettings::Instance();
@@ -94,7 +98,10 @@ public:
          showMapLogoCallbackUuid_);
    }
 
-   OverlayLayer* self_;
+   void UpdateCrossSectionLine();
+
+   OverlayLayer*               self_;
+   std::shared_ptr<MapContext> context_;
 
    boost::uuids::uuid clockFormatCallbackUuid_;
    boost::uuids::uuid defaultTimeZoneCallbackUuid_;
@@ -109,6 +116,7 @@ public:
    std::shared_ptr<gl::draw::Rectangle> activeBoxOuter_;
    std::shared_ptr<gl::draw::Rectangle> activeBoxInner_;
    std::shared_ptr<gl::draw::GeoIcons>  geoIcons_;
+   std::shared_ptr<gl::draw::GeoLines>  geoLines_;
    std::shared_ptr<gl::draw::Icons>     icons_;
 
    const std::string& locationIconName_ {
@@ -117,6 +125,8 @@ public:
 
    std::shared_ptr<gl::draw::GeoIconDrawItem> cursorIcon_ {};
 
+   std::shared_ptr<gl::draw::GeoLineDrawItem> crossSectionLine_ {};
+
    const std::string& cardinalPointIconName_ {
       types::GetTextureName(types::ImageTexture::CardinalPoint24)};
    const std::string& compassIconName_ {
@@ -153,6 +163,7 @@ OverlayLayer::OverlayLayer(std::shared_ptr<MapContext> context) :
 {
    AddDrawItem(p->activeBoxOuter_);
    AddDrawItem(p->activeBoxInner_);
+   AddDrawItem(p->geoLines_);
    AddDrawItem(p->geoIcons_);
    AddDrawItem(p->icons_);
 
@@ -200,6 +211,17 @@ void OverlayLayer::Initialize()
 
    p->geoIcons_->FinishIcons();
 
+   // Geo Lines
+   p->geoLines_->StartLines();
+
+   p->crossSectionLine_ = p->geoLines_->AddLine();
+   p->geoLines_->SetLineModulate(
+      p->crossSectionLine_, boost::gil::rgba8_pixel_t {255, 255, 255, 255});
+   p->geoLines_->SetLineWidth(p->crossSectionLine_, 3.0f);
+   p->UpdateCrossSectionLine();
+
+   p->geoLines_->FinishLines();
+
    // Icons
    p->icons_->StartIconSheets();
    p->icons_->AddIconSheet(p->cardinalPointIconName_);
@@ -289,6 +311,41 @@ void OverlayLayer::Initialize()
               }
               p->currentPosition_ = position;
            });
+
+   auto crossSectionView = context()->cross_section_view();
+
+   if (crossSectionView != nullptr)
+   {
+      connect(crossSectionView.get(),
+              &view::CrossSectionView::EndpointsChanged,
+              this,
+              [this]()
+              {
+                 p->UpdateCrossSectionLine();
+                 Q_EMIT NeedsRendering();
+              });
+   }
+}
+
+void OverlayLayerImpl::UpdateCrossSectionLine()
+{
+   auto crossSectionView = context_->cross_section_view();
+
+   if (crossSectionView == nullptr || crossSectionLine_ == nullptr)
+   {
+      return;
+   }
+
+   auto [start, end] = crossSectionView->endpoints();
+
+   // The path is drawn as a single segment, which closely follows the great
+   // circle over the distances covered by a single radar
+   geoLines_->SetLineLocation(crossSectionLine_,
+                              static_cast<float>(start.latitude_),
+                              static_cast<float>(start.longitude_),
+                              static_cast<float>(end.latitude_),
+                              static_cast<float>(end.longitude_));
+   geoLines_->SetLineVisible(crossSectionLine_, !(start == end));
 }
 
 void OverlayLayer::Render(const QMapLibre::CustomLayerRenderParameters& params)
@@ -525,7 +582,18 @@ void OverlayLayer::Deinitialize()
               this,
               nullptr);
 
-   p->locationIcon_ = nullptr;
+   auto crossSectionView = context()->cross_section_view();
+
+   if (crossSectionView != nullptr)
+   {
+      disconnect(crossSectionView.get(),
+                 &view::CrossSectionView::EndpointsChanged,
+                 this,
+                 nullptr);
+   }
+
+   p->crossSectionLine_ = nullptr;
+   p->locationIcon_     = nullptr;
 }
 
 bool OverlayLayer::RunMousePicking(
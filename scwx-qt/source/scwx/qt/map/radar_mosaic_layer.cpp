@@ -0,0 +1,421 @@
+#include <scwx/qt/map/radar_mosaic_layer.hpp>
+#include <scwx/qt/gl/shader_program.hpp>
+#include <scwx/qt/util/maplibre.hpp>
+#include <scwx/qt/view/radar_mosaic_view.hpp>
+#include <scwx/qt/view/radar_product_view.hpp>
+#include <scwx/common/color_table.hpp>
+#include <scwx/util/logger.hpp>
+
+#if defined(_MSC_VER)
+#   pragma warning(push, 0)
+#endif
+
+#include <boost/timer/timer.hpp>
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/type_ptr.hpp>
+#include <mbgl/util/constants.hpp>
+
+#if defined(_MSC_VER)
+#   pragma warning(pop)
+#endif
+
+namespace scwx
+{
+namespace qt
+{
+namespace map
+{
+
+static const std::string logPrefix_ = "scwx::qt::map::radar_mosaic_layer";
+static const auto        logger_    = scwx::util::Logger::Create(logPrefix_);
+
+// The mosaic grid is linear in latitude, and the map is not. Subdivide the
+// mesh in latitude so the texture follows the Mercator projection.
+static constexpr std::size_t kMeshRows_        = 64u;
+static constexpr std::size_t kVerticesPerCell_ = 6u;
+static constexpr std::size_t kValuesPerVertex_ = 2u;
+static constexpr std::size_t kNumMeshVertices_ = kMeshRows_ * kVerticesPerCell_;
+static constexpr std::size_t kNumMeshValues_ =
+   kNumMeshVertices_ * kValuesPerVertex_;
+
+// Mosaic data levels are 8-bit, and level 1 is range folded
+static constexpr std::uint16_t kColorTableMin_ = 1u;
+static constexpr std::uint16_t kColorTableMax_ = 255u;
+static constexpr std::uint16_t kRangeFolded_   = 1u;
+
+class RadarMosaicLayer::Impl
+{
+public:
+   explicit Impl() = default;
+   ~Impl()         = default;
+
+   void UpdateColorTable(gl::OpenGLFunctions&                           gl,
+                         const std::shared_ptr<view::RadarProductView>& view);
+   void UpdateMesh(gl::OpenGLFunctions&               gl,
+                   const view::RadarMosaicView::Grid& grid);
+   void UpdateMosaic(gl::OpenGLFunctions&                          gl,
+                     const std::shared_ptr<view::RadarMosaicView>& view);
+
+   std::shared_ptr<gl::ShaderProgram> shaderProgram_ {nullptr};
+
+   GLint uMVPMatrixLocation_ {static_cast<GLint>(GL_INVALID_INDEX)};
+   GLint uMapScreenCoordLocation_ {static_cast<GLint>(GL_INVALID_INDEX)};
+   GLint uDataMomentOffsetLocation_ {static_cast<GLint>(GL_INVALID_INDEX)};
+   GLint uDataMomentScaleLocation_ {static_cast<GLint>(GL_INVALID_INDEX)};
+
+   std::array<GLuint, 2> vbo_ {GL_INVALID_INDEX};
+   GLuint                vao_ {GL_INVALID_INDEX};
+   GLuint                texture_ {GL_INVALID_INDEX};
+   GLuint                mosaicTexture_ {GL_INVALID_INDEX};
+
+   GLsizei                          numVertices_ {0};
+   view::RadarMosaicView::Grid      meshGrid_ {};
+   view::RadarMosaicView::DataScale dataScale_ {};
+
+   bool colorTableNeedsUpdate_ {false};
+   bool mosaicNeedsUpdate_ {false};
+};
+
+RadarMosaicLayer::RadarMosaicLayer(std::shared_ptr<MapContext> context) :
+    GenericLayer(context), p(std::make_unique<Impl>())
+{
+   connect(context->radar_mosaic_view().get(),
+           &view::RadarMosaicView::MosaicUpdated,
+           this,
+           [this]()
+           {
+              p->mosaicNeedsUpdate_ = true;
+              Q_EMIT NeedsRendering();
+           });
+   connect(context->radar_product_view().get(),
+           &view::RadarProductView::ColorTableLutUpdated,
+           this,
+           [this]()
+           {
+              p->colorTableNeedsUpdate_ = true;
+              Q_EMIT NeedsRendering();
+           });
+}
+RadarMosaicLayer::~RadarMosaicLayer() = default;
+
+void RadarMosaicLayer::Initialize()
+{
+   logger_->debug("Initialize()");
+
+   gl::OpenGLFunctions& gl = context()->gl();
+
+   // The mosaic shares the raster texture shader with the radar product layer
+   p->shaderProgram_ = context()->GetShaderProgram(":/gl/radar_raster.vert",
+                                                   ":/gl/radar_raster.frag");
+
+   p->uMVPMatrixLocation_ = p->shaderProgram_->GetUniformLocation("uMVPMatrix");
+   p->uMapScreenCoordLocation_ =
+      p->shaderProgram_->GetUniformLocation("uMapScreenCoord");
+   p->uDataMomentOffsetLocation_ =
+      p->shaderProgram_->GetUniformLocation("uDataMomentOffset");
+   p->uDataMomentScaleLocation_ =
+      p->shaderProgram_->GetUniformLocation("uDataMomentScale");
+
+   // The color table is bound to texture unit 0, and the mosaic texture is
+   // bound to texture unit 1
+   p->shaderProgram_->Use();
+   gl.glUniform1i(p->shaderProgram_->GetUniformLocation("uTexture"), 0);
+   gl.glUniform1i(p->shaderProgram_->GetUniformLocation("uDataTexture"), 1);
+
+   gl.glGenVertexArrays(1, &p->vao_);
+   gl.glGenBuffers(static_cast<GLsizei>(p->vbo_.size()), p->vbo_.data());
+
+   gl.glBindVertexArray(p->vao_);
+
+   gl.glBindBuffer(GL_ARRAY_BUFFER, p->vbo_[0]);
+   gl.glBufferData(GL_ARRAY_BUFFER,
+                   kNumMeshValues_ * sizeof(GLfloat),
+                   nullptr,
+                   GL_DYNAMIC_DRAW);
+   gl.glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 0, static_cast<void*>(0));
+   gl.glEnableVertexAttribArray(0);
+
+   gl.glBindBuffer(GL_ARRAY_BUFFER, p->vbo_[1]);
+   gl.glBufferData(GL_ARRAY_BUFFER,
+                   kNumMeshValues_ * sizeof(GLfloat),
+                   nullptr,
+                   GL_DYNAMIC_DRAW);
+   gl.glVertexAttribPointer(3, 2, GL_FLOAT, GL_FALSE, 0, static_cast<void*>(0));
+   gl.glEnableVertexAttribArray(3);
+
+   gl.glGenTextures(1, &p->mosaicTexture_);
+   gl.glActiveTexture(GL_TEXTURE1);
+   gl.glBindTexture(GL_TEXTURE_2D, p->mosaicTexture_);
+   gl.glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+   gl.glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+   gl.glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+   gl.glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+
+   gl.glGenTextures(1, &p->texture_);
+   gl.glActiveTexture(GL_TEXTURE0);
+   gl.glBindTexture(GL_TEXTURE_1D, p->texture_);
+   gl.glTexParameteri(GL_TEXTURE_1D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+   gl.glTexParameteri(GL_TEXTURE_1D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+   gl.glTexParameteri(GL_TEXTURE_1D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+
+   p->colorTableNeedsUpdate_ = true;
+   p->mosaicNeedsUpdate_     = true;
+}
+
+void RadarMosaicLayer::Render(
+   const QMapLibre::CustomLayerRenderParameters& params)
+{
+   gl::OpenGLFunctions& gl = context()->gl();
+
+   auto radarProductView = context()->radar_product_view();
+
+   if (radarProductView == nullptr ||
+       radarProductView->GetRadarProductGroup() !=
+          common::RadarProductGroup::Level2)
+   {
+      // The mosaic is only available for Level 2 products
+      return;
+   }
+
+   // The color table depends on the data scale of the mosaic
+   if (p->mosaicNeedsUpdate_)
+   {
+      p->UpdateMosaic(gl, context()->radar_mosaic_view());
+   }
+
+   if (p->colorTableNeedsUpdate_)
+   {
+      p->UpdateColorTable(gl, radarProductView);
+   }
+
+   if (p->numVertices_ == 0)
+   {
+      return;
+   }
+
+   // Set OpenGL blend mode for transparency
+   gl.glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+
+   p->shaderProgram_->Use();
+
+   const float scale = std::pow(2.0, params.zoom) * 2.0f *
+                       mbgl::util::tileSize_D / mbgl::util::DEGREES_MAX;
+   const float xScale = scale / params.width;
+   const float yScale = scale / params.height;
+
+   glm::mat4 uMVPMatrix(1.0f);
+   uMVPMatrix = glm::scale(uMVPMatrix, glm::vec3(xScale, yScale, 1.0f));
+   uMVPMatrix = glm::rotate(uMVPMatrix,
+                            glm::radians<float>(params.bearing),
+                            glm::vec3(0.0f, 0.0f, 1.0f));
+
+   gl.glUniform2fv(p->uMapScreenCoordLocation_,
+                   1,
+                   glm::value_ptr(util::maplibre::LatLongToScreenCoordinate(
+                      {params.latitude, params.longitude})));
+
+   gl.glUniformMatrix4fv(
+      p->uMVPMatrixLocation_, 1, GL_FALSE, glm::value_ptr(uMVPMatrix));
+
+   gl.glActiveTexture(GL_TEXTURE1);
+   gl.glBindTexture(GL_TEXTURE_2D, p->mosaicTexture_);
+   gl.glActiveTexture(GL_TEXTURE0);
+   gl.glBindTexture(GL_TEXTURE_1D, p->texture_);
+   gl.glBindVertexArray(p->vao_);
+   gl.glDrawArrays(GL_TRIANGLES, 0, p->numVertices_);
+
+   SCWX_GL_CHECK_ERROR();
+}
+
+void RadarMosaicLayer::Deinitialize()
+{
+   logger_->debug("Deinitialize()");
+
+   gl::OpenGLFunctions& gl = context()->gl();
+
+   gl.glDeleteVertexArrays(1, &p->vao_);
+   gl.glDeleteBuffers(static_cast<GLsizei>(p->vbo_.size()), p->vbo_.data());
+   gl.glDeleteTextures(1, &p->texture_);
+   gl.glDeleteTextures(1, &p->mosaicTexture_);
+
+   p->uMVPMatrixLocation_        = GL_INVALID_INDEX;
+   p->uMapScreenCoordLocation_   = GL_INVALID_INDEX;
+   p->uDataMomentOffsetLocation_ = GL_INVALID_INDEX;
+   p->uDataMomentScaleLocation_  = GL_INVALID_INDEX;
+   p->vao_                       = GL_INVALID_INDEX;
+   p->vbo_                       = {GL_INVALID_INDEX};
+   p->texture_                   = GL_INVALID_INDEX;
+   p->mosaicTexture_             = GL_INVALID_INDEX;
+   p->numVertices_               = 0;
+   p->meshGrid_                  = {};
+}
+
+void RadarMosaicLayer::Impl::UpdateColorTable(
+   gl::OpenGLFunctions&                           gl,
+   const std::shared_ptr<view::RadarProductView>& view)
+{
+   logger_->debug("UpdateColorTable()");
+
+   // The mosaic is composited from the product selected in the radar product
+   // view, and shares its color table. The lookup table of the view is built
+   // for the data scale of its own site, so a lookup table is built for the
+   // common data scale of the mosaic.
+   std::shared_ptr<common::ColorTable> colorTable = view->color_table();
+   if (colorTable == nullptr || !colorTable->IsValid())
+   {
+      return;
+   }
+
+   colorTableNeedsUpdate_ = false;
+
+   std::vector<boost::gil::rgba8_pixel_t> lut(kColorTableMax_ -
+                                              kColorTableMin_ + 1u);
+
+   for (std::uint16_t i = kColorTableMin_; i <= kColorTableMax_; ++i)
+   {
+      if (i == kRangeFolded_)
+      {
+         lut[i - kColorTableMin_] = colorTable->rf_color();
+      }
+      else
+      {
+         lut[i - kColorTableMin_] =
+            colorTable->Color((i - dataScale_.offset_) / dataScale_.scale_);
+      }
+   }
+
+   const float scale = kColorTableMax_ - kColorTableMin_;
+
+   gl.glActiveTexture(GL_TEXTURE0);
+   gl.glBindTexture(GL_TEXTURE_1D, texture_);
+   gl.glTexImage1D(GL_TEXTURE_1D,
+                   0,
+                   GL_RGBA,
+                   (GLsizei) lut.size(),
+                   0,
+                   GL_RGBA,
+                   GL_UNSIGNED_BYTE,
+                   lut.data());
+   gl.glGenerateMipmap(GL_TEXTURE_1D);
+
+   shaderProgram_->Use();
+   gl.glUniform1ui(uDataMomentOffsetLocation_, kColorTableMin_);
+   gl.glUniform1f(uDataMomentScaleLocation_, scale);
+}
+
+void RadarMosaicLayer::Impl::UpdateMesh(gl::OpenGLFunctions&               gl,
+                                        const view::RadarMosaicView::Grid& grid)
+{
+   std::array<GLfloat, kNumMeshValues_> vertices {};
+   std::array<GLfloat, kNumMeshValues_> textureCoordinates {};
+
+   const double latitudeSpan = grid.resolution_ * grid.rows_;
+   const float  west         = static_cast<float>(grid.west_);
+   const float  east =
+      static_cast<float>(grid.west_ + grid.resolution_ * grid.columns_);
+
+   std::size_t v = 0;
+   std::size_t t = 0;
+
+   for (std::size_t row = 0; row < kMeshRows_; ++row)
+   {
+      const double t1 = static_cast<double>(row) / kMeshRows_;
+      const double t2 = static_cast<double>(row + 1) / kMeshRows_;
+
+      // Texture row 0 is the northern edge of the grid
+      const float lat1 = static_cast<float>(grid.north_ - t1 * latitudeSpan);
+      const float lat2 = static_cast<float>(grid.north_ - t2 * latitudeSpan);
+
+      const float tex1 = static_cast<float>(t1);
+      const float tex2 = static_cast<float>(t2);
+
+      const std::array<std::array<GLfloat, 4>, kVerticesPerCell_> cell {{
+         {lat1, west, 0.0f, tex1},
+         {lat1, east, 1.0f, tex1},
+         {lat2, west, 0.0f, tex2},
+         {lat2, west, 0.0f, tex2},
+         {lat1, east, 1.0f, tex1},
+         {lat2, east, 1.0f, tex2},
+      }};
+
+      for (auto& vertex : cell)
+      {
+         vertices[v++]           = vertex[0];
+         vertices[v++]           = vertex[1];
+         textureCoordinates[t++] = vertex[2];
+         textureCoordinates[t++] = vertex[3];
+      }
+   }
+
+   gl.glBindBuffer(GL_ARRAY_BUFFER, vbo_[0]);
+   gl.glBufferSubData(
+      GL_ARRAY_BUFFER, 0, vertices.size() * sizeof(GLfloat), vertices.data());
+
+   gl.glBindBuffer(GL_ARRAY_BUFFER, vbo_[1]);
+   gl.glBufferSubData(GL_ARRAY_BUFFER,
+                      0,
+                      textureCoordinates.size() * sizeof(GLfloat),
+                      textureCoordinates.data());
+
+   meshGrid_ = grid;
+}
+
+void RadarMosaicLayer::Impl::UpdateMosaic(
+   gl::OpenGLFunctions&                          gl,
+   const std::shared_ptr<view::RadarMosaicView>& view)
+{
+   std::unique_lock mosaicLock(view->mosaic_mutex(), std::try_to_lock);
+   if (!mosaicLock.owns_lock())
+   {
+      logger_->debug("Mosaic locked, deferring update");
+      return;
+   }
+
+   mosaicNeedsUpdate_ = false;
+
+   auto [data, width, height] = view->GetMosaicData();
+
+   if (data == nullptr)
+   {
+      numVertices_ = 0;
+      return;
+   }
+
+   if (view->grid() != meshGrid_)
+   {
+      UpdateMesh(gl, view->grid());
+   }
+
+   if (view->data_scale() != dataScale_)
+   {
+      dataScale_             = view->data_scale();
+      colorTableNeedsUpdate_ = true;
+   }
+
+   boost::timer::cpu_timer timer {};
+
+   gl.glActiveTexture(GL_TEXTURE1);
+   gl.glBindTexture(GL_TEXTURE_2D, mosaicTexture_);
+   gl.glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+   gl.glTexImage2D(GL_TEXTURE_2D,
+                   0,
+                   GL_R8UI,
+                   static_cast<GLsizei>(width),
+                   static_cast<GLsizei>(height),
+                   0,
+                   GL_RED_INTEGER,
+                   GL_UNSIGNED_BYTE,
+                   data);
+   gl.glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+   gl.glActiveTexture(GL_TEXTURE0);
+
+   timer.stop();
+   logger_->debug("Mosaic texture buffered in {}", timer.format(6, "%ws"));
+
+   numVertices_ = static_cast<GLsizei>(kNumMeshVertices_);
+}
+
+} // namespace map
+} // namespace qt
+} // namespace scwx
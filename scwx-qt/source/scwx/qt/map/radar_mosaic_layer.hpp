@@ -0,0 +1,29 @@
+#pragma once
+
+#include <scwx/qt/map/generic_layer.hpp>
+
+namespace scwx
+{
+namespace qt
+{
+namespace map
+{
+
+class RadarMosaicLayer : public GenericLayer
+{
+public:
+   explicit RadarMosaicLayer(std::shared_ptr<MapContext> context);
+   ~RadarMosaicLayer();
+
+   void Initialize() override final;
+   void Render(const QMapLibre::CustomLayerRenderParameters&) override final;
+   void Deinitialize() override final;
+
+private:
+   class Impl;
+   std::unique_ptr<Impl> p;
+};
+
+} // namespace map
+} // namespace qt
+} // namespace scwx
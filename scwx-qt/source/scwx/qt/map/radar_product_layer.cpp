@@ -1,11 +1,15 @@
 #include <scwx/qt/map/radar_product_layer.hpp>
 #include <scwx/qt/gl/shader_program.hpp>
+#include <scwx/qt/settings/product_settings.hpp>
 #include <scwx/qt/util/maplibre.hpp>
 #include <scwx/qt/util/tooltip.hpp>
 #include <scwx/qt/view/radar_product_view.hpp>
 #include <scwx/util/logger.hpp>
+#include <scwx/util/trace.hpp>
 
 #include <execution>
+#include <mutex>
+#include <unordered_map>
 
 #if defined(_MSC_VER)
 #   pragma warning(push, 0)
@@ -37,44 +41,108 @@ static constexpr uint32_t MAX_DATA_MOMENT_GATES = 1840;
 static const std::string logPrefix_ = "scwx::qt::map::radar_product_layer";
 static const auto        logger_    = scwx::util::Logger::Create(logPrefix_);
 
+// Vertex buffer of a sweep shared by multiple views. OpenGL contexts are
+// shared by each map, so the buffer is usable by each layer displaying the
+// sweep, and is deleted when released by the last of these layers.
+struct SharedVertexBuffer
+{
+   GLuint                                    vbo_ {GL_INVALID_INDEX};
+   std::shared_ptr<const std::vector<float>> vertices_ {};
+};
+
+static std::mutex sharedVertexBuffersMutex_ {};
+static std::unordered_map<const std::vector<float>*,
+                          std::weak_ptr<SharedVertexBuffer>>
+   sharedVertexBuffers_ {};
+
 class RadarProductLayerImpl
 {
 public:
    explicit RadarProductLayerImpl() :
        shaderProgram_(nullptr),
+       rasterShaderProgram_(nullptr),
        uMVPMatrixLocation_(GL_INVALID_INDEX),
        uMapScreenCoordLocation_(GL_INVALID_INDEX),
        uDataMomentOffsetLocation_(GL_INVALID_INDEX),
        uDataMomentScaleLocation_(GL_INVALID_INDEX),
+       uDataMomentThresholdLocation_(GL_INVALID_INDEX),
+       uRangeFoldedEnabledLocation_(GL_INVALID_INDEX),
        uCFPEnabledLocation_(GL_INVALID_INDEX),
+       uRasterMVPMatrixLocation_(GL_INVALID_INDEX),
+       uRasterMapScreenCoordLocation_(GL_INVALID_INDEX),
+       uRasterDataMomentOffsetLocation_(GL_INVALID_INDEX),
+       uRasterDataMomentScaleLocation_(GL_INVALID_INDEX),
        vbo_ {GL_INVALID_INDEX},
        vao_ {GL_INVALID_INDEX},
        texture_ {GL_INVALID_INDEX},
+       rasterTexture_ {GL_INVALID_INDEX},
        numVertices_ {0},
+       rasterMode_ {false},
        cfpEnabled_ {false},
+       dataThreshold_ {0u},
+       rangeFoldedEnabled_ {true},
        colorTableNeedsUpdate_ {false},
-       sweepNeedsUpdate_ {false}
+       displayThresholdNeedsUpdate_ {false},
+       momentDataNeedsUpdate_ {false},
+       sweepNeedsUpdate_ {false},
+       sweepTraceTags_ {},
+       sweepRendered_ {true}
    {
    }
    ~RadarProductLayerImpl() = default;
 
+   void BufferVertices(gl::OpenGLFunctions&                      gl,
+                       std::shared_ptr<const std::vector<float>> vertices);
+   void ReleaseSharedVertexBuffer(gl::OpenGLFunctions& gl);
+
    std::shared_ptr<gl::ShaderProgram> shaderProgram_;
+   std::shared_ptr<gl::ShaderProgram> rasterShaderProgram_;
 
    GLint                 uMVPMatrixLocation_;
    GLint                 uMapScreenCoordLocation_;
    GLint                 uDataMomentOffsetLocation_;
    GLint                 uDataMomentScaleLocation_;
+   GLint                 uDataMomentThresholdLocation_;
+   GLint                 uRangeFoldedEnabledLocation_;
    GLint                 uCFPEnabledLocation_;
-   std::array<GLuint, 3> vbo_;
+   GLint                 uRasterMVPMatrixLocation_;
+   GLint                 uRasterMapScreenCoordLocation_;
+   GLint                 uRasterDataMomentOffsetLocation_;
+   GLint                 uRasterDataMomentScaleLocation_;
+   std::array<GLuint, 4> vbo_;
    GLuint                vao_;
    GLuint                texture_;
+   GLuint                rasterTexture_;
+
+   std::shared_ptr<SharedVertexBuffer> sharedVertexBuffer_ {};
+
+   // Generation of the buffered published sweep, or 0 if the view does not
+   // publish sweeps
+   std::uint64_t publishedGeneration_ {0u};
 
    GLsizeiptr numVertices_;
 
-   bool cfpEnabled_;
+   // Products with a raster texture are drawn as a texture on a coarse mesh
+   bool rasterMode_;
+
+   // Display filters are applied by the shader, so they can change without
+   // recomputing or buffering the sweep
+   bool   cfpEnabled_;
+   GLuint dataThreshold_;
+   bool   rangeFoldedEnabled_;
+
+   boost::uuids::uuid cfpFilterEnabledCallbackUuid_ {};
+   boost::uuids::uuid rangeFoldedEnabledCallbackUuid_ {};
+   boost::uuids::uuid reflectivityThresholdCallbackUuid_ {};
 
    bool colorTableNeedsUpdate_;
+   bool displayThresholdNeedsUpdate_;
+   bool momentDataNeedsUpdate_;
    bool sweepNeedsUpdate_;
+
+   // The first frame of each sweep ends its end-to-end latency span
+   scwx::util::TraceTags sweepTraceTags_;
+   bool                  sweepRendered_;
 };
 
 RadarProductLayer::RadarProductLayer(std::shared_ptr<MapContext> context) :
@@ -85,12 +153,53 @@ RadarProductLayer::RadarProductLayer(std::shared_ptr<MapContext> context) :
            &view::RadarProductView::ColorTableLutUpdated,
            this,
            [this]() { p->colorTableNeedsUpdate_ = true; });
+   connect(radarProductView.get(),
+           &view::RadarProductView::MomentDataUpdated,
+           this,
+           [this]() { p->momentDataNeedsUpdate_ = true; });
    connect(radarProductView.get(),
            &view::RadarProductView::SweepComputed,
            this,
            [this]() { p->sweepNeedsUpdate_ = true; });
+
+   auto& productSettings = settings::ProductSettings::Instance();
+
+   p->cfpFilterEnabledCallbackUuid_ =
+      productSettings.l2_cfp_filter_enabled().RegisterValueStagedCallback(
+         [this](const bool& value)
+         {
+            p->cfpEnabled_ = value;
+            Q_EMIT NeedsRendering();
+         });
+   p->rangeFoldedEnabledCallbackUuid_ =
+      productSettings.l2_range_folded_enabled().RegisterValueStagedCallback(
+         [this](const bool&)
+         {
+            p->displayThresholdNeedsUpdate_ = true;
+            Q_EMIT NeedsRendering();
+         });
+   p->reflectivityThresholdCallbackUuid_ =
+      productSettings.l2_reflectivity_threshold().RegisterValueStagedCallback(
+         [this](const double&)
+         {
+            p->displayThresholdNeedsUpdate_ = true;
+            Q_EMIT NeedsRendering();
+         });
+
+   p->cfpEnabled_ = productSettings.l2_cfp_filter_enabled().GetStagedOrValue();
+}
+
+RadarProductLayer::~RadarProductLayer()
+{
+   auto& productSettings = settings::ProductSettings::Instance();
+
+   productSettings.l2_cfp_filter_enabled().UnregisterValueStagedCallback(
+      p->cfpFilterEnabledCallbackUuid_);
+   productSettings.l2_range_folded_enabled().UnregisterValueStagedCallback(
+      p->rangeFoldedEnabledCallbackUuid_);
+   productSettings.l2_reflectivity_threshold().UnregisterValueStagedCallback(
+      p->reflectivityThresholdCallbackUuid_);
 }
-RadarProductLayer::~RadarProductLayer() = default;
 
 void RadarProductLayer::Initialize()
 {
@@ -130,6 +239,20 @@ void RadarProductLayer::Initialize()
       logger_->warn("Could not find uDataMomentScale");
    }
 
+   p->uDataMomentThresholdLocation_ =
+      gl.glGetUniformLocation(p->shaderProgram_->id(), "uDataMomentThreshold");
+   if (p->uDataMomentThresholdLocation_ == -1)
+   {
+      logger_->warn("Could not find uDataMomentThreshold");
+   }
+
+   p->uRangeFoldedEnabledLocation_ =
+      gl.glGetUniformLocation(p->shaderProgram_->id(), "uRangeFoldedEnabled");
+   if (p->uRangeFoldedEnabledLocation_ == -1)
+   {
+      logger_->warn("Could not find uRangeFoldedEnabled");
+   }
+
    p->uCFPEnabledLocation_ =
       gl.glGetUniformLocation(p->shaderProgram_->id(), "uCFPEnabled");
    if (p->uCFPEnabledLocation_ == -1)
@@ -137,13 +260,36 @@ void RadarProductLayer::Initialize()
       logger_->warn("Could not find uCFPEnabled");
    }
 
+   // Load and configure raster texture shader
+   p->rasterShaderProgram_ = context()->GetShaderProgram(
+      ":/gl/radar_raster.vert", ":/gl/radar_raster.frag");
+
+   p->uRasterMVPMatrixLocation_ =
+      p->rasterShaderProgram_->GetUniformLocation("uMVPMatrix");
+   p->uRasterMapScreenCoordLocation_ =
+      p->rasterShaderProgram_->GetUniformLocation("uMapScreenCoord");
+   p->uRasterDataMomentOffsetLocation_ =
+      p->rasterShaderProgram_->GetUniformLocation("uDataMomentOffset");
+   p->uRasterDataMomentScaleLocation_ =
+      p->rasterShaderProgram_->GetUniformLocation("uDataMomentScale");
+
+   // The color table is bound to texture unit 0, and the raster texture is
+   // bound to texture unit 1
+   p->rasterShaderProgram_->Use();
+   gl.glUniform1i(p->rasterShaderProgram_->GetUniformLocation("uTexture"), 0);
+   gl.glUniform1i(
+      p->rasterShaderProgram_->GetUniformLocation("uDataTexture"), 1);
+
    p->shaderProgram_->Use();
 
    // Generate a vertex array object
    gl.glGenVertexArrays(1, &p->vao_);
 
    // Generate vertex buffer objects
-   gl.glGenBuffers(3, p->vbo_.data());
+   gl.glGenBuffers(4, p->vbo_.data());
+
+   // Generate raster texture
+   gl.glGenTextures(1, &p->rasterTexture_);
 
    // Update radar sweep
    p->sweepNeedsUpdate_ = true;
@@ -169,41 +315,143 @@ void RadarProductLayer::UpdateSweep()
    std::shared_ptr<view::RadarProductView> radarProductView =
       context()->radar_product_view();
 
+   // A published sweep is immutable, and is read without waiting for the
+   // computation of the next sweep
+   std::shared_ptr<const view::PublishedSweep> publishedSweep =
+      radarProductView->published_sweep();
+
    std::unique_lock sweepLock(radarProductView->sweep_mutex(),
-                              std::try_to_lock);
-   if (!sweepLock.owns_lock())
+                              std::defer_lock);
+   if (publishedSweep == nullptr && !sweepLock.try_lock())
    {
       logger_->debug("Sweep locked, deferring update");
       return;
    }
 
-   p->sweepNeedsUpdate_ = false;
+   p->publishedGeneration_ =
+      (publishedSweep != nullptr) ? publishedSweep->generation_ : 0u;
+
+   p->sweepNeedsUpdate_            = false;
+   p->momentDataNeedsUpdate_       = false;
+   p->displayThresholdNeedsUpdate_ = false;
 
-   const std::vector<float>& vertices = radarProductView->vertices();
+   std::tie(p->dataThreshold_, p->rangeFoldedEnabled_) =
+      radarProductView->GetDisplayThreshold();
+
+   auto radarProductManager = radarProductView->radar_product_manager();
+
+   p->sweepTraceTags_ = {
+      (radarProductManager != nullptr) ? radarProductManager->radar_id() : "",
+      radarProductView->GetRadarProductName(),
+      radarProductView->selected_time()};
+   p->sweepRendered_ = false;
+
+   scwx::util::TraceSpan span {scwx::util::TraceStage::UpdateSweep,
+                               p->sweepTraceTags_};
+
+   static const std::vector<float> kEmptyVertices_ {};
+
+   std::shared_ptr<const std::vector<float>> sharedVertices;
+   const std::vector<float>*                 vertices;
+
+   if (publishedSweep != nullptr)
+   {
+      sharedVertices = publishedSweep->vertices_;
+      vertices       = (sharedVertices != nullptr) ? sharedVertices.get() :
+                                                     &kEmptyVertices_;
+   }
+   else
+   {
+      sharedVertices = radarProductView->shared_vertices();
+      vertices       = &radarProductView->vertices();
+   }
 
    // Bind a vertex array object
    gl.glBindVertexArray(p->vao_);
 
    // Buffer vertices
-   gl.glBindBuffer(GL_ARRAY_BUFFER, p->vbo_[0]);
    timer.start();
-   gl.glBufferData(GL_ARRAY_BUFFER,
-                   vertices.size() * sizeof(GLfloat),
-                   vertices.data(),
-                   GL_STATIC_DRAW);
+   p->BufferVertices(gl, sharedVertices);
+   if (p->sharedVertexBuffer_ == nullptr)
+   {
+      gl.glBindBuffer(GL_ARRAY_BUFFER, p->vbo_[0]);
+      gl.glBufferData(GL_ARRAY_BUFFER,
+                      vertices->size() * sizeof(GLfloat),
+                      vertices->data(),
+                      GL_STATIC_DRAW);
+   }
    timer.stop();
    logger_->debug("Vertices buffered in {}", timer.format(6, "%ws"));
 
    gl.glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 0, static_cast<void*>(0));
    gl.glEnableVertexAttribArray(0);
 
+   p->numVertices_ = vertices->size() / 2;
+
+   // Buffer raster texture
+   const GLvoid* rasterData;
+   std::size_t   rasterWidth;
+   std::size_t   rasterHeight;
+
+   std::tie(rasterData, rasterWidth, rasterHeight) =
+      radarProductView->GetRasterTextureData();
+
+   p->rasterMode_ = (rasterData != nullptr);
+
+   if (p->rasterMode_)
+   {
+      const std::vector<float>& textureCoordinates =
+         radarProductView->texture_coordinates();
+
+      gl.glBindBuffer(GL_ARRAY_BUFFER, p->vbo_[3]);
+      gl.glBufferData(GL_ARRAY_BUFFER,
+                      textureCoordinates.size() * sizeof(GLfloat),
+                      textureCoordinates.data(),
+                      GL_STATIC_DRAW);
+
+      gl.glVertexAttribPointer(
+         3, 2, GL_FLOAT, GL_FALSE, 0, static_cast<void*>(0));
+      gl.glEnableVertexAttribArray(3);
+
+      gl.glDisableVertexAttribArray(1);
+      gl.glDisableVertexAttribArray(2);
+
+      timer.start();
+      gl.glActiveTexture(GL_TEXTURE1);
+      gl.glBindTexture(GL_TEXTURE_2D, p->rasterTexture_);
+      gl.glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+      gl.glTexImage2D(GL_TEXTURE_2D,
+                      0,
+                      GL_R8UI,
+                      static_cast<GLsizei>(rasterWidth),
+                      static_cast<GLsizei>(rasterHeight),
+                      0,
+                      GL_RED_INTEGER,
+                      GL_UNSIGNED_BYTE,
+                      rasterData);
+      gl.glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+      gl.glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+      gl.glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+      gl.glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+      gl.glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+      gl.glActiveTexture(GL_TEXTURE0);
+      timer.stop();
+      logger_->debug("Raster texture buffered in {}", timer.format(6, "%ws"));
+
+      return;
+   }
+
+   gl.glDisableVertexAttribArray(3);
+
    // Buffer data moments
    const GLvoid* data;
    GLsizeiptr    dataSize;
    size_t        componentSize;
    GLenum        type;
 
-   std::tie(data, dataSize, componentSize) = radarProductView->GetMomentData();
+   std::tie(data, dataSize, componentSize) =
+      (publishedSweep != nullptr) ? publishedSweep->moment_data() :
+                                    radarProductView->GetMomentData();
 
    if (componentSize == 1)
    {
@@ -230,7 +478,8 @@ void RadarProductLayer::UpdateSweep()
    GLenum        cfpType;
 
    std::tie(cfpData, cfpDataSize, cfpComponentSize) =
-      radarProductView->GetCfpMomentData();
+      (publishedSweep != nullptr) ? publishedSweep->cfp_moment_data() :
+                                    radarProductView->GetCfpMomentData();
 
    if (cfpData != nullptr)
    {
@@ -256,8 +505,139 @@ void RadarProductLayer::UpdateSweep()
    {
       gl.glDisableVertexAttribArray(2);
    }
+}
+
+void RadarProductLayerImpl::BufferVertices(
+   gl::OpenGLFunctions&                      gl,
+   std::shared_ptr<const std::vector<float>> vertices)
+{
+   ReleaseSharedVertexBuffer(gl);
+
+   if (vertices == nullptr)
+   {
+      return;
+   }
+
+   std::unique_lock lock {sharedVertexBuffersMutex_};
+
+   std::erase_if(sharedVertexBuffers_,
+                 [](const auto& buffer) { return buffer.second.expired(); });
+
+   auto& weakBuffer = sharedVertexBuffers_[vertices.get()];
+
+   sharedVertexBuffer_ = weakBuffer.lock();
+   if (sharedVertexBuffer_ != nullptr)
+   {
+      logger_->debug("Sharing vertex buffer");
+      gl.glBindBuffer(GL_ARRAY_BUFFER, sharedVertexBuffer_->vbo_);
+      return;
+   }
+
+   sharedVertexBuffer_            = std::make_shared<SharedVertexBuffer>();
+   sharedVertexBuffer_->vertices_ = vertices;
+   weakBuffer                     = sharedVertexBuffer_;
 
-   p->numVertices_ = vertices.size() / 2;
+   gl.glGenBuffers(1, &sharedVertexBuffer_->vbo_);
+   gl.glBindBuffer(GL_ARRAY_BUFFER, sharedVertexBuffer_->vbo_);
+   gl.glBufferData(GL_ARRAY_BUFFER,
+                   vertices->size() * sizeof(GLfloat),
+                   vertices->data(),
+                   GL_STATIC_DRAW);
+}
+
+void RadarProductLayerImpl::ReleaseSharedVertexBuffer(gl::OpenGLFunctions& gl)
+{
+   std::unique_lock lock {sharedVertexBuffersMutex_};
+
+   if (sharedVertexBuffer_ != nullptr && sharedVertexBuffer_.use_count() == 1)
+   {
+      // This layer is the last to use the buffer
+      gl.glDeleteBuffers(1, &sharedVertexBuffer_->vbo_);
+   }
+
+   sharedVertexBuffer_.reset();
+}
+
+void RadarProductLayer::UpdateDisplayThreshold()
+{
+   logger_->trace("UpdateDisplayThreshold()");
+
+   std::shared_ptr<view::RadarProductView> radarProductView =
+      context()->radar_product_view();
+
+   std::unique_lock sweepLock(radarProductView->sweep_mutex(),
+                              std::defer_lock);
+   if (radarProductView->published_sweep() == nullptr &&
+       !sweepLock.try_lock())
+   {
+      logger_->trace("Sweep locked, deferring display threshold update");
+      return;
+   }
+
+   p->displayThresholdNeedsUpdate_ = false;
+
+   std::tie(p->dataThreshold_, p->rangeFoldedEnabled_) =
+      radarProductView->GetDisplayThreshold();
+}
+
+void RadarProductLayer::UpdateMomentData()
+{
+   logger_->trace("UpdateMomentData()");
+
+   gl::OpenGLFunctions& gl = context()->gl();
+
+   std::shared_ptr<view::RadarProductView> radarProductView =
+      context()->radar_product_view();
+
+   std::shared_ptr<const view::PublishedSweep> publishedSweep =
+      radarProductView->published_sweep();
+
+   std::unique_lock sweepLock(radarProductView->sweep_mutex(),
+                              std::defer_lock);
+   if (publishedSweep == nullptr && !sweepLock.try_lock())
+   {
+      logger_->trace("Sweep locked, deferring moment data update");
+      return;
+   }
+
+   p->momentDataNeedsUpdate_ = false;
+
+   if (p->rasterMode_)
+   {
+      return;
+   }
+
+   if (publishedSweep != nullptr)
+   {
+      if (publishedSweep->generation_ == p->publishedGeneration_)
+      {
+         // The moment data of this sweep is already buffered
+         return;
+      }
+
+      if (p->sharedVertexBuffer_ == nullptr ||
+          p->sharedVertexBuffer_->vertices_ != publishedSweep->vertices_)
+      {
+         // A new sweep has been published, and is buffered in full
+         UpdateSweep();
+         return;
+      }
+
+      p->publishedGeneration_ = publishedSweep->generation_;
+   }
+
+   // Only the data moments are replaced, the vertices are unchanged
+   const GLvoid* data;
+   GLsizeiptr    dataSize;
+   size_t        componentSize;
+
+   std::tie(data, dataSize, componentSize) =
+      (publishedSweep != nullptr) ? publishedSweep->moment_data() :
+                                    radarProductView->GetMomentData();
+
+   gl.glBindVertexArray(p->vao_);
+   gl.glBindBuffer(GL_ARRAY_BUFFER, p->vbo_[1]);
+   gl.glBufferData(GL_ARRAY_BUFFER, dataSize, data, GL_STATIC_DRAW);
 }
 
 void RadarProductLayer::Render(
@@ -265,8 +645,6 @@ void RadarProductLayer::Render(
 {
    gl::OpenGLFunctions& gl = context()->gl();
 
-   p->shaderProgram_->Use();
-
    // Set OpenGL blend mode for transparency
    gl.glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
 
@@ -279,6 +657,24 @@ void RadarProductLayer::Render(
    {
       UpdateSweep();
    }
+   else if (p->momentDataNeedsUpdate_)
+   {
+      UpdateMomentData();
+   }
+
+   if (p->displayThresholdNeedsUpdate_)
+   {
+      UpdateDisplayThreshold();
+   }
+
+   if (p->rasterMode_)
+   {
+      p->rasterShaderProgram_->Use();
+   }
+   else
+   {
+      p->shaderProgram_->Use();
+   }
 
    const float scale = std::pow(2.0, params.zoom) * 2.0f *
                        mbgl::util::tileSize_D / mbgl::util::DEGREES_MAX;
@@ -291,15 +687,32 @@ void RadarProductLayer::Render(
                             glm::radians<float>(params.bearing),
                             glm::vec3(0.0f, 0.0f, 1.0f));
 
-   gl.glUniform2fv(p->uMapScreenCoordLocation_,
+   const GLint uMapScreenCoordLocation = p->rasterMode_ ?
+                                            p->uRasterMapScreenCoordLocation_ :
+                                            p->uMapScreenCoordLocation_;
+   const GLint uMVPMatrixLocation =
+      p->rasterMode_ ? p->uRasterMVPMatrixLocation_ : p->uMVPMatrixLocation_;
+
+   gl.glUniform2fv(uMapScreenCoordLocation,
                    1,
                    glm::value_ptr(util::maplibre::LatLongToScreenCoordinate(
                       {params.latitude, params.longitude})));
 
    gl.glUniformMatrix4fv(
-      p->uMVPMatrixLocation_, 1, GL_FALSE, glm::value_ptr(uMVPMatrix));
+      uMVPMatrixLocation, 1, GL_FALSE, glm::value_ptr(uMVPMatrix));
 
-   gl.glUniform1i(p->uCFPEnabledLocation_, p->cfpEnabled_ ? 1 : 0);
+   if (p->rasterMode_)
+   {
+      gl.glActiveTexture(GL_TEXTURE1);
+      gl.glBindTexture(GL_TEXTURE_2D, p->rasterTexture_);
+   }
+   else
+   {
+      gl.glUniform1ui(p->uDataMomentThresholdLocation_, p->dataThreshold_);
+      gl.glUniform1i(p->uRangeFoldedEnabledLocation_,
+                     p->rangeFoldedEnabled_ ? 1 : 0);
+      gl.glUniform1i(p->uCFPEnabledLocation_, p->cfpEnabled_ ? 1 : 0);
+   }
 
    gl.glActiveTexture(GL_TEXTURE0);
    gl.glBindTexture(GL_TEXTURE_1D, p->texture_);
@@ -307,6 +720,12 @@ void RadarProductLayer::Render(
    gl.glDrawArrays(GL_TRIANGLES, 0, p->numVertices_);
 
    SCWX_GL_CHECK_ERROR();
+
+   if (!p->sweepRendered_)
+   {
+      p->sweepRendered_ = true;
+      scwx::util::Tracer::Instance().MarkRendered(p->sweepTraceTags_);
+   }
 }
 
 void RadarProductLayer::Deinitialize()
@@ -316,16 +735,25 @@ void RadarProductLayer::Deinitialize()
    gl::OpenGLFunctions& gl = context()->gl();
 
    gl.glDeleteVertexArrays(1, &p->vao_);
-   gl.glDeleteBuffers(3, p->vbo_.data());
-
-   p->uMVPMatrixLocation_        = GL_INVALID_INDEX;
-   p->uMapScreenCoordLocation_   = GL_INVALID_INDEX;
-   p->uDataMomentOffsetLocation_ = GL_INVALID_INDEX;
-   p->uDataMomentScaleLocation_  = GL_INVALID_INDEX;
-   p->uCFPEnabledLocation_       = GL_INVALID_INDEX;
-   p->vao_                       = GL_INVALID_INDEX;
-   p->vbo_                       = {GL_INVALID_INDEX};
-   p->texture_                   = GL_INVALID_INDEX;
+   gl.glDeleteBuffers(4, p->vbo_.data());
+   p->ReleaseSharedVertexBuffer(gl);
+   gl.glDeleteTextures(1, &p->rasterTexture_);
+
+   p->uMVPMatrixLocation_              = GL_INVALID_INDEX;
+   p->uMapScreenCoordLocation_         = GL_INVALID_INDEX;
+   p->uDataMomentOffsetLocation_       = GL_INVALID_INDEX;
+   p->uDataMomentScaleLocation_        = GL_INVALID_INDEX;
+   p->uDataMomentThresholdLocation_    = GL_INVALID_INDEX;
+   p->uRangeFoldedEnabledLocation_     = GL_INVALID_INDEX;
+   p->uCFPEnabledLocation_             = GL_INVALID_INDEX;
+   p->uRasterMVPMatrixLocation_        = GL_INVALID_INDEX;
+   p->uRasterMapScreenCoordLocation_   = GL_INVALID_INDEX;
+   p->uRasterDataMomentOffsetLocation_ = GL_INVALID_INDEX;
+   p->uRasterDataMomentScaleLocation_  = GL_INVALID_INDEX;
+   p->vao_                             = GL_INVALID_INDEX;
+   p->vbo_                             = {GL_INVALID_INDEX};
+   p->texture_                         = GL_INVALID_INDEX;
+   p->rasterTexture_                   = GL_INVALID_INDEX;
 }
 
 bool RadarProductLayer::RunMousePicking(
@@ -483,8 +911,14 @@ void RadarProductLayer::UpdateColorTable()
                    colorTable.data());
    gl.glGenerateMipmap(GL_TEXTURE_1D);
 
+   // Update the color table range for both the bin and raster texture shaders
+   p->shaderProgram_->Use();
    gl.glUniform1ui(p->uDataMomentOffsetLocation_, rangeMin);
    gl.glUniform1f(p->uDataMomentScaleLocation_, scale);
+
+   p->rasterShaderProgram_->Use();
+   gl.glUniform1ui(p->uRasterDataMomentOffsetLocation_, rangeMin);
+   gl.glUniform1f(p->uRasterDataMomentScaleLocation_, scale);
 }
 
 } // namespace map
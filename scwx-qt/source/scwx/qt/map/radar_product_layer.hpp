@@ -31,6 +31,8 @@ public:
 
 private:
    void UpdateColorTable();
+   void UpdateDisplayThreshold();
+   void UpdateMomentData();
    void UpdateSweep();
 
 private:
@@ -11,7 +11,9 @@
 #include <scwx/util/time.hpp>
 
 
+#include <algorithm>
 #include <format>
+#include <functional>
 
 #include <QApplication>
 #include <QFontMetrics>
@@ -31,56 +33,75 @@ static constexpr int kLastColumn =
    static_cast<int>(AlertModel::Column::Distance);
 static constexpr int kNumColumns = kLastColumn - kFirstColumn + 1;
 
+typedef std::vector<std::shared_ptr<awips::TextProductMessage>> MessageList;
+
+/**
+ * Display strings and sort keys of an alert row, computed when the alert
+ * updates rather than when the row is painted.
+ */
+struct AlertRecord
+{
+   bool                  observed_ {false};
+   awips::ThreatCategory threatCategory_ {awips::ThreatCategory::Base};
+   bool                  tornadoPossible_ {false};
+   common::Coordinate    centroid_ {};
+   double                distance_ {};
+
+   QString officeId_ {};
+   QString phenomenon_ {};
+   QString significance_ {};
+   QString threatCategoryName_ {};
+   QString state_ {};
+   QString counties_ {};
+
+   std::chrono::system_clock::time_point startTime_ {};
+   std::chrono::system_clock::time_point endTime_ {};
+   QString                               startTimeString_ {};
+   QString                               endTimeString_ {};
+};
+
 class AlertModelImpl
 {
 public:
-   explicit AlertModelImpl();
+   explicit AlertModelImpl(
+      std::shared_ptr<manager::TextEventManager> textEventManager);
    ~AlertModelImpl() = default;
 
-   bool                  GetObserved(const types::TextEventKey& key);
-   awips::ThreatCategory GetThreatCategory(const types::TextEventKey& key);
-   bool                  GetTornadoPossible(const types::TextEventKey& key);
+   void UpdateRowMap(int firstRow);
 
-   static std::string GetCounties(const types::TextEventKey& key);
-   static std::string GetState(const types::TextEventKey& key);
+   static std::string GetCounties(const types::TextEventKey& key,
+                                  const MessageList&         messageList);
+   static std::string GetState(const types::TextEventKey& key,
+                               const MessageList&         messageList);
    static std::chrono::system_clock::time_point
-                      GetStartTime(const types::TextEventKey& key);
-   static std::string GetStartTimeString(const types::TextEventKey& key);
+   GetStartTime(const types::TextEventKey& key,
+                const MessageList&         messageList);
    static std::chrono::system_clock::time_point
-                      GetEndTime(const types::TextEventKey& key);
-   static std::string GetEndTimeString(const types::TextEventKey& key);
+   GetEndTime(const types::TextEventKey& key, const MessageList& messageList);
+
+   static qlonglong GetSortKey(std::chrono::system_clock::time_point time);
 
    std::shared_ptr<manager::TextEventManager> textEventManager_;
 
+   // Alert keys and records are indexed by row
    QList<types::TextEventKey> textEventKeys_;
+   std::vector<AlertRecord>   records_;
 
-   const GeographicLib::Geodesic& geodesic_;
-
-   std::unordered_map<types::TextEventKey,
-                      bool,
-                      types::TextEventHash<types::TextEventKey>>
-      observedMap_;
-   std::unordered_map<types::TextEventKey,
-                      awips::ThreatCategory,
-                      types::TextEventHash<types::TextEventKey>>
-      threatCategoryMap_;
-   std::unordered_map<types::TextEventKey,
-                      bool,
-                      types::TextEventHash<types::TextEventKey>>
-      tornadoPossibleMap_;
-   std::unordered_map<types::TextEventKey,
-                      common::Coordinate,
-                      types::TextEventHash<types::TextEventKey>>
-      centroidMap_;
    std::unordered_map<types::TextEventKey,
-                      double,
+                      int,
                       types::TextEventHash<types::TextEventKey>>
-                              distanceMap_;
-   scwx::common::Coordinate   previousPosition_;
+      rowMap_;
+
+   const GeographicLib::Geodesic& geodesic_;
+
+   scwx::common::Coordinate previousPosition_;
 };
 
-AlertModel::AlertModel(QObject* parent) :
-    QAbstractTableModel(parent), p(std::make_unique<AlertModelImpl>())
+AlertModel::AlertModel(
+   std::shared_ptr<manager::TextEventManager> textEventManager,
+   QObject*                                   parent) :
+    QAbstractTableModel(parent),
+    p(std::make_unique<AlertModelImpl>(std::move(textEventManager)))
 {
 }
 AlertModel::~AlertModel() = default;
@@ -95,10 +116,10 @@ common::Coordinate AlertModel::centroid(const types::TextEventKey& key) const
 {
    common::Coordinate centroid {};
 
-   const auto& it = p->centroidMap_.find(key);
-   if (it != p->centroidMap_.cend())
+   const auto& it = p->rowMap_.find(key);
+   if (it != p->rowMap_.cend())
    {
-      centroid = it->second;
+      centroid = p->records_[it->second].centroid_;
    }
 
    return centroid;
@@ -123,6 +144,7 @@ QVariant AlertModel::data(const QModelIndex& index, int role) const
    }
 
    const auto& textEventKey = p->textEventKeys_.at(index.row());
+   const auto& record       = p->records_.at(index.row());
 
    if (role == Qt::ItemDataRole::DisplayRole ||
        role == types::ItemDataRole::SortRole)
@@ -133,23 +155,21 @@ QVariant AlertModel::data(const QModelIndex& index, int role) const
          return textEventKey.etn_;
 
       case static_cast<int>(Column::OfficeId):
-         return QString::fromStdString(textEventKey.officeId_);
+         return record.officeId_;
 
       case static_cast<int>(Column::Phenomenon):
-         return QString::fromStdString(
-            awips::GetPhenomenonText(textEventKey.phenomenon_));
+         return record.phenomenon_;
 
       case static_cast<int>(Column::Significance):
-         return QString::fromStdString(
-            awips::GetSignificanceText(textEventKey.significance_));
+         return record.significance_;
 
       case static_cast<int>(Column::Tornado):
          if (textEventKey.phenomenon_ == awips::Phenomenon::Tornado &&
-             p->GetObserved(textEventKey))
+             record.observed_)
          {
             return tr("Observed");
          }
-         if (p->GetTornadoPossible(textEventKey))
+         if (record.tornadoPossible_)
          {
             return tr("Possible");
          }
@@ -158,49 +178,55 @@ QVariant AlertModel::data(const QModelIndex& index, int role) const
       case static_cast<int>(Column::ThreatCategory):
          if (role == Qt::DisplayRole)
          {
-            return QString::fromStdString(awips::GetThreatCategoryName(
-               p->GetThreatCategory(textEventKey)));
+            return record.threatCategoryName_;
          }
          else
          {
-            return static_cast<int>(p->GetThreatCategory(textEventKey));
+            return static_cast<int>(record.threatCategory_);
          }
 
       case static_cast<int>(Column::State):
-         return QString::fromStdString(AlertModelImpl::GetState(textEventKey));
+         return record.state_;
 
       case static_cast<int>(Column::Counties):
-         return QString::fromStdString(
-            AlertModelImpl::GetCounties(textEventKey));
+         return record.counties_;
 
       case static_cast<int>(Column::StartTime):
-         return QString::fromStdString(
-            AlertModelImpl::GetStartTimeString(textEventKey));
+         if (role == Qt::DisplayRole)
+         {
+            return record.startTimeString_;
+         }
+         else
+         {
+            return QVariant(AlertModelImpl::GetSortKey(record.startTime_));
+         }
 
       case static_cast<int>(Column::EndTime):
-         return QString::fromStdString(
-            AlertModelImpl::GetEndTimeString(textEventKey));
+         if (role == Qt::DisplayRole)
+         {
+            return record.endTimeString_;
+         }
+         else
+         {
+            return QVariant(AlertModelImpl::GetSortKey(record.endTime_));
+         }
 
       case static_cast<int>(Column::Distance):
          if (role == Qt::DisplayRole)
          {
-            const std::string distanceUnitName =
-               settings::UnitSettings::Instance().distance_units().GetValue();
-            types::DistanceUnits distanceUnits =
-               types::GetDistanceUnitsFromName(distanceUnitName);
-            double distanceScale = types::GetDistanceUnitsScale(distanceUnits);
-            std::string abbreviation =
-               types::GetDistanceUnitsAbbreviation(distanceUnits);
+            const auto& unitSettings =
+               settings::UnitSettings::Instance().snapshot();
 
             return QString("%1 %2")
-               .arg(static_cast<uint32_t>(p->distanceMap_.at(textEventKey) *
+               .arg(static_cast<uint32_t>(record.distance_ *
                                           scwx::common::kKilometersPerMeter *
-                                          distanceScale))
-               .arg(QString::fromStdString(abbreviation));
+                                          unitSettings.distanceScale_))
+               .arg(QString::fromStdString(
+                  unitSettings.distanceAbbreviation_));
          }
          else
          {
-            return p->distanceMap_.at(textEventKey);
+            return record.distance_;
          }
 
       default:
@@ -212,10 +238,10 @@ QVariant AlertModel::data(const QModelIndex& index, int role) const
       switch (index.column())
       {
       case static_cast<int>(Column::StartTime):
-         return QVariant::fromValue(AlertModelImpl::GetStartTime(textEventKey));
+         return QVariant::fromValue(record.startTime_);
 
       case static_cast<int>(Column::EndTime):
-         return QVariant::fromValue(AlertModelImpl::GetEndTime(textEventKey));
+         return QVariant::fromValue(record.endTime_);
 
       default:
          break;
@@ -334,18 +360,34 @@ void AlertModel::HandleAlert(const types::TextEventKey& alertKey,
 {
    logger_->trace("Handle alert: {}", alertKey.ToString());
 
+   if (p->textEventManager_ == nullptr)
+   {
+      return;
+   }
+
+   UpdateAlert(alertKey,
+               p->textEventManager_->message_list(alertKey),
+               messageIndex);
+}
+
+void AlertModel::UpdateAlert(const types::TextEventKey& alertKey,
+                             const MessageList&         alertMessages,
+                             size_t                     messageIndex)
+{
    double distanceInMeters;
 
    // Get the most recent segment for the event
-   auto alertMessages = p->textEventManager_->message_list(alertKey);
    std::shared_ptr<const awips::Segment> alertSegment =
       alertMessages[messageIndex]->segments().back();
 
-   p->observedMap_.insert_or_assign(alertKey, alertSegment->observed_);
-   p->threatCategoryMap_.insert_or_assign(alertKey,
-                                          alertSegment->threatCategory_);
-   p->tornadoPossibleMap_.insert_or_assign(alertKey,
-                                           alertSegment->tornadoPossible_);
+   auto rowIt    = p->rowMap_.find(alertKey);
+   bool newAlert = (rowIt == p->rowMap_.cend());
+
+   AlertRecord record = newAlert ? AlertRecord {} : p->records_[rowIt->second];
+
+   record.observed_        = alertSegment->observed_;
+   record.threatCategory_  = alertSegment->threatCategory_;
+   record.tornadoPossible_ = alertSegment->tornadoPossible_;
 
    if (alertSegment->codedLocation_.has_value())
    {
@@ -359,27 +401,44 @@ void AlertModel::HandleAlert(const types::TextEventKey& alertKey,
                            centroid.longitude_,
                            distanceInMeters);
 
-      p->centroidMap_.insert_or_assign(alertKey, centroid);
-      p->distanceMap_.insert_or_assign(alertKey, distanceInMeters);
-   }
-   else if (!p->centroidMap_.contains(alertKey))
-   {
-      // The alert has no location, so provide a default
-      p->centroidMap_.insert_or_assign(alertKey, common::Coordinate {0.0, 0.0});
-      p->distanceMap_.insert_or_assign(alertKey, 0.0);
+      record.centroid_ = centroid;
+      record.distance_ = distanceInMeters;
    }
 
+   // Compute display strings and sort keys once for each update
+   record.officeId_   = QString::fromStdString(alertKey.officeId_);
+   record.phenomenon_ = QString::fromStdString(
+      awips::GetPhenomenonText(alertKey.phenomenon_));
+   record.significance_ = QString::fromStdString(
+      awips::GetSignificanceText(alertKey.significance_));
+   record.threatCategoryName_ = QString::fromStdString(
+      awips::GetThreatCategoryName(record.threatCategory_));
+   record.state_ =
+      QString::fromStdString(AlertModelImpl::GetState(alertKey, alertMessages));
+   record.counties_ = QString::fromStdString(
+      AlertModelImpl::GetCounties(alertKey, alertMessages));
+   record.startTime_ = AlertModelImpl::GetStartTime(alertKey, alertMessages);
+   record.endTime_   = AlertModelImpl::GetEndTime(alertKey, alertMessages);
+   record.startTimeString_ =
+      QString::fromStdString(scwx::util::TimeString(record.startTime_));
+   record.endTimeString_ =
+      QString::fromStdString(scwx::util::TimeString(record.endTime_));
+
    // Update row
-   if (!p->textEventKeys_.contains(alertKey))
+   if (newAlert)
    {
       int newIndex = p->textEventKeys_.size();
       beginInsertRows(QModelIndex(), newIndex, newIndex);
       p->textEventKeys_.push_back(alertKey);
+      p->records_.push_back(std::move(record));
+      p->rowMap_.insert_or_assign(alertKey, newIndex);
       endInsertRows();
    }
    else
    {
-      const int   row         = p->textEventKeys_.indexOf(alertKey);
+      const int row   = rowIt->second;
+      p->records_[row] = std::move(record);
+
       QModelIndex topLeft     = createIndex(row, kFirstColumn);
       QModelIndex bottomRight = createIndex(row, kLastColumn);
 
@@ -387,15 +446,83 @@ void AlertModel::HandleAlert(const types::TextEventKey& alertKey,
    }
 }
 
+void AlertModel::HandleAlertsRemoved(
+   const std::vector<types::TextEventKey>& alertKeys)
+{
+   logger_->trace("Handle alerts removed: {}", alertKeys.size());
+
+   std::vector<int> rows {};
+   rows.reserve(alertKeys.size());
+
+   for (auto& alertKey : alertKeys)
+   {
+      auto it = p->rowMap_.find(alertKey);
+      if (it != p->rowMap_.cend())
+      {
+         rows.push_back(it->second);
+         p->rowMap_.erase(it);
+      }
+   }
+
+   if (rows.empty())
+   {
+      return;
+   }
+
+   // Remove rows from last to first, one contiguous range at a time, so that
+   // views receive a single notification for each range instead of each row
+   std::sort(rows.begin(), rows.end(), std::greater<int>());
+
+   for (std::size_t i = 0; i < rows.size();)
+   {
+      const int last  = rows[i];
+      int       first = last;
+
+      while (++i < rows.size() && rows[i] == first - 1)
+      {
+         first = rows[i];
+      }
+
+      beginRemoveRows(QModelIndex(), first, last);
+      p->textEventKeys_.remove(first, last - first + 1);
+      p->records_.erase(p->records_.begin() + first,
+                        p->records_.begin() + last + 1);
+      endRemoveRows();
+   }
+
+   // Rows following the first removed row have moved
+   p->UpdateRowMap(rows.back());
+}
+
+void AlertModel::HandleAlertsTransitioned(
+   const std::vector<types::TextEventKey>& alertKeys)
+{
+   logger_->trace("Handle alerts transitioned: {}", alertKeys.size());
+
+   // Notify views that the active state of the alert has changed
+   for (auto& alertKey : alertKeys)
+   {
+      auto it = p->rowMap_.find(alertKey);
+      if (it != p->rowMap_.cend())
+      {
+         const int   row         = it->second;
+         QModelIndex topLeft     = createIndex(row, kFirstColumn);
+         QModelIndex bottomRight = createIndex(row, kLastColumn);
+
+         Q_EMIT dataChanged(topLeft, bottomRight);
+      }
+   }
+}
+
 void AlertModel::HandleMapUpdate(double latitude, double longitude)
 {
    logger_->trace("Handle map update: {}, {}", latitude, longitude);
 
    double distanceInMeters;
 
-   for (const auto& textEvent : p->textEventKeys_)
+   for (auto& record : p->records_)
    {
-      auto& centroid = p->centroidMap_.at(textEvent);
+      auto& centroid = record.centroid_;
 
       if (centroid != common::Coordinate {0.0, 0.0})
       {
@@ -404,7 +531,7 @@ void AlertModel::HandleMapUpdate(double latitude, double longitude)
                               centroid.latitude_,
                               centroid.longitude_,
                               distanceInMeters);
-         p->distanceMap_.insert_or_assign(textEvent, distanceInMeters);
+         record.distance_ = distanceInMeters;
       }
    }
 
@@ -417,59 +544,28 @@ void AlertModel::HandleMapUpdate(double latitude, double longitude)
    Q_EMIT dataChanged(topLeft, bottomRight);
 }
 
-AlertModelImpl::AlertModelImpl() :
-    textEventManager_ {manager::TextEventManager::Instance()},
+AlertModelImpl::AlertModelImpl(
+   std::shared_ptr<manager::TextEventManager> textEventManager) :
+    textEventManager_ {std::move(textEventManager)},
     textEventKeys_ {},
+    records_ {},
+    rowMap_ {},
     geodesic_(util::GeographicLib::DefaultGeodesic()),
-    distanceMap_ {},
     previousPosition_ {}
 {
 }
 
-bool AlertModelImpl::GetObserved(const types::TextEventKey& key)
-{
-   bool observed = false;
-
-   auto it = observedMap_.find(key);
-   if (it != observedMap_.cend())
-   {
-      observed = it->second;
-   }
-
-   return observed;
-}
-
-awips::ThreatCategory
-AlertModelImpl::GetThreatCategory(const types::TextEventKey& key)
-{
-   awips::ThreatCategory threatCategory = awips::ThreatCategory::Base;
-
-   auto it = threatCategoryMap_.find(key);
-   if (it != threatCategoryMap_.cend())
-   {
-      threatCategory = it->second;
-   }
-
-   return threatCategory;
-}
-
-bool AlertModelImpl::GetTornadoPossible(const types::TextEventKey& key)
+void AlertModelImpl::UpdateRowMap(int firstRow)
 {
-   bool tornadoPossible = false;
-
-   auto it = tornadoPossibleMap_.find(key);
-   if (it != tornadoPossibleMap_.cend())
+   for (int row = firstRow; row < textEventKeys_.size(); ++row)
    {
-      tornadoPossible = it->second;
+      rowMap_.insert_or_assign(textEventKeys_[row], row);
    }
-
-   return tornadoPossible;
 }
 
-std::string AlertModelImpl::GetCounties(const types::TextEventKey& key)
+std::string AlertModelImpl::GetCounties(const types::TextEventKey& key,
+                                        const MessageList& messageList)
 {
-   auto messageList = manager::TextEventManager::Instance()->message_list(key);
-
    if (messageList.size() > 0)
    {
       auto&  lastMessage  = messageList.back();
@@ -495,10 +591,9 @@ std::string AlertModelImpl::GetCounties(const types::TextEventKey& key)
    }
 }
 
-std::string AlertModelImpl::GetState(const types::TextEventKey& key)
+std::string AlertModelImpl::GetState(const types::TextEventKey& key,
+                                     const MessageList&         messageList)
 {
-   auto messageList = manager::TextEventManager::Instance()->message_list(key);
-
    if (messageList.size() > 0)
    {
       auto&  lastMessage  = messageList.back();
@@ -515,10 +610,9 @@ std::string AlertModelImpl::GetState(const types::TextEventKey& key)
 }
 
 std::chrono::system_clock::time_point
-AlertModelImpl::GetStartTime(const types::TextEventKey& key)
+AlertModelImpl::GetStartTime(const types::TextEventKey& key,
+                             const MessageList&         messageList)
 {
-   auto messageList = manager::TextEventManager::Instance()->message_list(key);
-
    if (messageList.size() > 0)
    {
       auto& firstMessage = messageList.front();
@@ -532,16 +626,10 @@ AlertModelImpl::GetStartTime(const types::TextEventKey& key)
    }
 }
 
-std::string AlertModelImpl::GetStartTimeString(const types::TextEventKey& key)
-{
-   return scwx::util::TimeString(GetStartTime(key));
-}
-
 std::chrono::system_clock::time_point
-AlertModelImpl::GetEndTime(const types::TextEventKey& key)
+AlertModelImpl::GetEndTime(const types::TextEventKey& key,
+                           const MessageList&         messageList)
 {
-   auto messageList = manager::TextEventManager::Instance()->message_list(key);
-
    if (messageList.size() > 0)
    {
       auto&  lastMessage  = messageList.back();
@@ -557,9 +645,15 @@ AlertModelImpl::GetEndTime(const types::TextEventKey& key)
    }
 }
 
-std::string AlertModelImpl::GetEndTimeString(const types::TextEventKey& key)
+qlonglong AlertModelImpl::GetSortKey(std::chrono::system_clock::time_point time)
 {
-   return scwx::util::TimeString(GetEndTime(key));
+   // Sort times as integers rather than as formatted strings. QVariant stores
+   // std::int64_t as long on LP64 platforms, which QSortFilterProxyModel does
+   // not compare numerically, so the key is a qlonglong.
+   return static_cast<qlonglong>(
+      std::chrono::duration_cast<std::chrono::seconds>(
+         time.time_since_epoch())
+         .count());
 }
 
 } // namespace model
@@ -1,9 +1,11 @@
 #pragma once
 
 #include <scwx/qt/types/text_event_key.hpp>
+#include <scwx/awips/text_product_message.hpp>
 #include <scwx/common/geographic.hpp>
 
 #include <memory>
+#include <vector>
 
 #include <QAbstractTableModel>
 
@@ -11,6 +13,13 @@ namespace scwx
 {
 namespace qt
 {
+namespace manager
+{
+
+class TextEventManager;
+
+} // namespace manager
+
 namespace model
 {
 
@@ -34,7 +43,16 @@ public:
       Distance       = 10
    };
 
-   explicit AlertModel(QObject* parent = nullptr);
+   /**
+    * Creates an alert model. If a text event manager is given, alert messages
+    * are read from it as alerts are updated.
+    *
+    * @param [in] textEventManager Text event manager, or nullptr
+    * @param [in] parent Parent object
+    */
+   explicit AlertModel(
+      std::shared_ptr<manager::TextEventManager> textEventManager = nullptr,
+      QObject*                                   parent           = nullptr);
    ~AlertModel();
 
    types::TextEventKey key(const QModelIndex& index) const;
@@ -49,8 +67,24 @@ public:
                        Qt::Orientation orientation,
                        int             role = Qt::DisplayRole) const override;
 
+   /**
+    * Adds or updates the row of an alert from the messages of its text event.
+    *
+    * @param [in] alertKey Text event key
+    * @param [in] alertMessages Messages of the text event
+    * @param [in] messageIndex Index of the updated message
+    */
+   void
+   UpdateAlert(const types::TextEventKey& alertKey,
+               const std::vector<std::shared_ptr<awips::TextProductMessage>>&
+                      alertMessages,
+               size_t messageIndex);
+
 public slots:
    void HandleAlert(const types::TextEventKey& alertKey, size_t messageIndex);
+   void HandleAlertsRemoved(const std::vector<types::TextEventKey>& alertKeys);
+   void
+   HandleAlertsTransitioned(const std::vector<types::TextEventKey>& alertKeys);
    void HandleMapUpdate(double latitude, double longitude);
 
 private:
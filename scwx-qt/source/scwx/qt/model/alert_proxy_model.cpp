@@ -1,13 +1,10 @@
 #include <scwx/qt/model/alert_proxy_model.hpp>
 #include <scwx/qt/model/alert_model.hpp>
 #include <scwx/qt/types/qt_types.hpp>
+#include <scwx/util/clock.hpp>
 #include <scwx/util/logger.hpp>
-#include <scwx/util/threads.hpp>
 
 #include <chrono>
-#include <mutex>
-
-#include <boost/asio/steady_timer.hpp>
 
 namespace scwx
 {
@@ -23,16 +20,11 @@ class AlertProxyModelImpl
 {
 public:
    explicit AlertProxyModelImpl(AlertProxyModel* self);
-   ~AlertProxyModelImpl();
-
-   void UpdateAlerts();
+   ~AlertProxyModelImpl() = default;
 
    AlertProxyModel* self_;
 
    bool alertActiveFilterEnabled_;
-
-   boost::asio::steady_timer alertUpdateTimer_;
-   std::mutex                alertMutex_ {};
 };
 
 AlertProxyModel::AlertProxyModel(QObject* parent) :
@@ -67,7 +59,7 @@ bool AlertProxyModel::filterAcceptsRow(int                sourceRow,
                         .value<std::chrono::system_clock::time_point>();
 
       // Compare end time to current
-      if (endTime < std::chrono::system_clock::now())
+      if (endTime <= scwx::util::CurrentTime())
       {
          acceptAlertActiveFilter = false;
       }
@@ -77,59 +69,11 @@ bool AlertProxyModel::filterAcceptsRow(int                sourceRow,
           QSortFilterProxyModel::filterAcceptsRow(sourceRow, sourceParent);
 }
 
+// Expired alerts are re-filtered when the alert model reports a change in
+// their active state
 AlertProxyModelImpl::AlertProxyModelImpl(AlertProxyModel* self) :
-    self_ {self},
-    alertActiveFilterEnabled_ {false},
-    alertUpdateTimer_ {scwx::util::io_context()}
-{
-   // Schedule alert update
-   UpdateAlerts();
-}
-
-AlertProxyModelImpl::~AlertProxyModelImpl()
+    self_ {self}, alertActiveFilterEnabled_ {false}
 {
-   std::unique_lock lock(alertMutex_);
-   alertUpdateTimer_.cancel();
-}
-
-void AlertProxyModelImpl::UpdateAlerts()
-{
-   logger_->trace("UpdateAlerts");
-
-   // Take a unique lock before modifying feature lists
-   std::unique_lock lock(alertMutex_);
-
-   // Re-evaluate for expired alerts
-   if (alertActiveFilterEnabled_)
-   {
-      self_->invalidateRowsFilter();
-   }
-
-   using namespace std::chrono;
-   alertUpdateTimer_.expires_after(15s);
-   alertUpdateTimer_.async_wait(
-      [this](const boost::system::error_code& e)
-      {
-         if (e == boost::asio::error::operation_aborted)
-         {
-            logger_->debug("Alert update timer cancelled");
-         }
-         else if (e != boost::system::errc::success)
-         {
-            logger_->warn("Alert update timer error: {}", e.message());
-         }
-         else
-         {
-            try
-            {
-               UpdateAlerts();
-            }
-            catch (const std::exception& ex)
-            {
-               logger_->error(ex.what());
-            }
-         }
-      });
 }
 
 } // namespace model
@@ -213,19 +213,15 @@ QVariant RadarSiteModel::data(const QModelIndex& index, int role) const
       case static_cast<int>(Column::Distance):
          if (role == Qt::DisplayRole)
          {
-            const std::string distanceUnitName =
-               settings::UnitSettings::Instance().distance_units().GetValue();
-            types::DistanceUnits distanceUnits =
-               types::GetDistanceUnitsFromName(distanceUnitName);
-            double distanceScale = types::GetDistanceUnitsScale(distanceUnits);
-            std::string abbreviation =
-               types::GetDistanceUnitsAbbreviation(distanceUnits);
+            const auto& unitSettings =
+               settings::UnitSettings::Instance().snapshot();
 
             return QString("%1 %2")
                .arg(static_cast<uint32_t>(p->distanceMap_.at(site->id()) *
                                           scwx::common::kKilometersPerMeter *
-                                          distanceScale))
-               .arg(QString::fromStdString(abbreviation));
+                                          unitSettings.distanceScale_))
+               .arg(QString::fromStdString(
+                  unitSettings.distanceAbbreviation_));
          }
          else
          {
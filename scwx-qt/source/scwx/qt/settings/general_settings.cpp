@@ -50,6 +50,7 @@ public:
       boost::to_lower(defaultPositioningPlugin);
       boost::to_lower(defaultThemeValue);
 
+      alertRetention_.SetDefault(12);
       antiAliasingEnabled_.SetDefault(true);
       clockFormat_.SetDefault(defaultClockFormatValue);
       customStyleDrawLayer_.SetDefault(".*\\.annotations\\.points");
@@ -69,6 +70,7 @@ public:
       nmeaBaudRate_.SetDefault(9600);
       nmeaSource_.SetDefault("");
       positioningPlugin_.SetDefault(defaultPositioningPlugin);
+      precomputeSweeps_.SetDefault(false);
       showMapAttribution_.SetDefault(true);
       showMapCenter_.SetDefault(false);
       showMapLogo_.SetDefault(true);
@@ -77,6 +79,8 @@ public:
       updateNotificationsEnabled_.SetDefault(true);
       warningsProvider_.SetDefault(defaultWarningsProviderValue);
 
+      alertRetention_.SetMinimum(1);
+      alertRetention_.SetMaximum(168);
       fontSizes_.SetElementMinimum(1);
       fontSizes_.SetElementMaximum(72);
       fontSizes_.SetValidator([](const std::vector<std::int64_t>& value)
@@ -136,6 +140,7 @@ public:
 
    ~Impl() {}
 
+   SettingsVariable<std::int64_t> alertRetention_ {"alert_retention"};
    SettingsVariable<bool>        antiAliasingEnabled_ {"anti_aliasing_enabled"};
    SettingsVariable<std::string> clockFormat_ {"clock_format"};
    SettingsVariable<std::string> customStyleDrawLayer_ {
@@ -157,6 +162,7 @@ public:
    SettingsVariable<std::int64_t> nmeaBaudRate_ {"nmea_baud_rate"};
    SettingsVariable<std::string>  nmeaSource_ {"nmea_source"};
    SettingsVariable<std::string>  positioningPlugin_ {"positioning_plugin"};
+   SettingsVariable<bool>         precomputeSweeps_ {"precompute_sweeps"};
    SettingsVariable<bool>         showMapAttribution_ {"show_map_attribution"};
    SettingsVariable<bool>         showMapCenter_ {"show_map_center"};
    SettingsVariable<bool>         showMapLogo_ {"show_map_logo"};
@@ -169,7 +175,8 @@ public:
 GeneralSettings::GeneralSettings() :
     SettingsCategory("general"), p(std::make_unique<Impl>())
 {
-   RegisterVariables({&p->antiAliasingEnabled_,
+   RegisterVariables({&p->alertRetention_,
+                      &p->antiAliasingEnabled_,
                       &p->clockFormat_,
                       &p->customStyleDrawLayer_,
                       &p->customStyleUrl_,
@@ -189,6 +196,7 @@ GeneralSettings::GeneralSettings() :
                       &p->nmeaBaudRate_,
                       &p->nmeaSource_,
                       &p->positioningPlugin_,
+                      &p->precomputeSweeps_,
                       &p->showMapAttribution_,
                       &p->showMapCenter_,
                       &p->showMapLogo_,
@@ -204,6 +212,11 @@ GeneralSettings::GeneralSettings(GeneralSettings&&) noexcept = default;
 GeneralSettings&
 GeneralSettings::operator=(GeneralSettings&&) noexcept = default;
 
+SettingsVariable<std::int64_t>& GeneralSettings::alert_retention() const
+{
+   return p->alertRetention_;
+}
+
 SettingsVariable<bool>& GeneralSettings::anti_aliasing_enabled() const
 {
    return p->antiAliasingEnabled_;
@@ -305,6 +318,11 @@ SettingsVariable<std::string>& GeneralSettings::positioning_plugin() const
    return p->positioningPlugin_;
 }
 
+SettingsVariable<bool>& GeneralSettings::precompute_sweeps() const
+{
+   return p->precomputeSweeps_;
+}
+
 SettingsVariable<bool>& GeneralSettings::show_map_attribution() const
 {
    return p->showMapAttribution_;
@@ -361,7 +379,8 @@ GeneralSettings& GeneralSettings::Instance()
 
 bool operator==(const GeneralSettings& lhs, const GeneralSettings& rhs)
 {
-   return (lhs.p->antiAliasingEnabled_ == rhs.p->antiAliasingEnabled_ &&
+   return (lhs.p->alertRetention_ == rhs.p->alertRetention_ &&
+           lhs.p->antiAliasingEnabled_ == rhs.p->antiAliasingEnabled_ &&
            lhs.p->clockFormat_ == rhs.p->clockFormat_ &&
            lhs.p->customStyleDrawLayer_ == rhs.p->customStyleDrawLayer_ &&
            lhs.p->customStyleUrl_ == rhs.p->customStyleUrl_ &&
@@ -381,6 +400,7 @@ bool operator==(const GeneralSettings& lhs, const GeneralSettings& rhs)
            lhs.p->nmeaBaudRate_ == rhs.p->nmeaBaudRate_ &&
            lhs.p->nmeaSource_ == rhs.p->nmeaSource_ &&
            lhs.p->positioningPlugin_ == rhs.p->positioningPlugin_ &&
+           lhs.p->precomputeSweeps_ == rhs.p->precomputeSweeps_ &&
            lhs.p->showMapAttribution_ == rhs.p->showMapAttribution_ &&
            lhs.p->showMapCenter_ == rhs.p->showMapCenter_ &&
            lhs.p->showMapLogo_ == rhs.p->showMapLogo_ &&
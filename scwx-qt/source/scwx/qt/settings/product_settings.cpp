@@ -17,18 +17,32 @@ public:
    {
       stiForecastEnabled_.SetDefault(true);
       stiPastEnabled_.SetDefault(true);
+      l2CfpFilterEnabled_.SetDefault(false);
+      l2RangeFoldedEnabled_.SetDefault(true);
+      l2ReflectivityThreshold_.SetDefault(-32.0);
+
+      l2ReflectivityThreshold_.SetMinimum(-32.0);
+      l2ReflectivityThreshold_.SetMaximum(95.0);
    }
 
    ~Impl() {}
 
-   SettingsVariable<bool> stiForecastEnabled_ {"sti_forecast_enabled"};
-   SettingsVariable<bool> stiPastEnabled_ {"sti_past_enabled"};
+   SettingsVariable<bool>   stiForecastEnabled_ {"sti_forecast_enabled"};
+   SettingsVariable<bool>   stiPastEnabled_ {"sti_past_enabled"};
+   SettingsVariable<bool>   l2CfpFilterEnabled_ {"l2_cfp_filter_enabled"};
+   SettingsVariable<bool>   l2RangeFoldedEnabled_ {"l2_range_folded_enabled"};
+   SettingsVariable<double> l2ReflectivityThreshold_ {
+      "l2_reflectivity_threshold"};
 };
 
 ProductSettings::ProductSettings() :
     SettingsCategory("product"), p(std::make_unique<Impl>())
 {
-   RegisterVariables({&p->stiForecastEnabled_, &p->stiPastEnabled_});
+   RegisterVariables({&p->stiForecastEnabled_,
+                      &p->stiPastEnabled_,
+                      &p->l2CfpFilterEnabled_,
+                      &p->l2RangeFoldedEnabled_,
+                      &p->l2ReflectivityThreshold_});
    SetDefaults();
 }
 ProductSettings::~ProductSettings() = default;
@@ -47,6 +61,21 @@ SettingsVariable<bool>& ProductSettings::sti_past_enabled() const
    return p->stiPastEnabled_;
 }
 
+SettingsVariable<bool>& ProductSettings::l2_cfp_filter_enabled() const
+{
+   return p->l2CfpFilterEnabled_;
+}
+
+SettingsVariable<bool>& ProductSettings::l2_range_folded_enabled() const
+{
+   return p->l2RangeFoldedEnabled_;
+}
+
+SettingsVariable<double>& ProductSettings::l2_reflectivity_threshold() const
+{
+   return p->l2ReflectivityThreshold_;
+}
+
 bool ProductSettings::Shutdown()
 {
    bool dataChanged = false;
@@ -54,6 +83,9 @@ bool ProductSettings::Shutdown()
    // Commit settings that are managed separate from the settings dialog
    dataChanged |= p->stiForecastEnabled_.Commit();
    dataChanged |= p->stiPastEnabled_.Commit();
+   dataChanged |= p->l2CfpFilterEnabled_.Commit();
+   dataChanged |= p->l2RangeFoldedEnabled_.Commit();
+   dataChanged |= p->l2ReflectivityThreshold_.Commit();
 
    return dataChanged;
 }
@@ -67,7 +99,10 @@ ProductSettings& ProductSettings::Instance()
 bool operator==(const ProductSettings& lhs, const ProductSettings& rhs)
 {
    return (lhs.p->stiForecastEnabled_ == rhs.p->stiForecastEnabled_ &&
-           lhs.p->stiPastEnabled_ == rhs.p->stiPastEnabled_);
+           lhs.p->stiPastEnabled_ == rhs.p->stiPastEnabled_ &&
+           lhs.p->l2CfpFilterEnabled_ == rhs.p->l2CfpFilterEnabled_ &&
+           lhs.p->l2RangeFoldedEnabled_ == rhs.p->l2RangeFoldedEnabled_ &&
+           lhs.p->l2ReflectivityThreshold_ == rhs.p->l2ReflectivityThreshold_);
 }
 
 } // namespace settings
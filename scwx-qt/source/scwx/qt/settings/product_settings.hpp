@@ -25,8 +25,11 @@ public:
    ProductSettings(ProductSettings&&) noexcept;
    ProductSettings& operator=(ProductSettings&&) noexcept;
 
-   SettingsVariable<bool>& sti_forecast_enabled() const;
-   SettingsVariable<bool>& sti_past_enabled() const;
+   SettingsVariable<bool>&   sti_forecast_enabled() const;
+   SettingsVariable<bool>&   sti_past_enabled() const;
+   SettingsVariable<bool>&   l2_cfp_filter_enabled() const;
+   SettingsVariable<bool>&   l2_range_folded_enabled() const;
+   SettingsVariable<double>& l2_reflectivity_threshold() const;
 
    static ProductSettings& Instance();
 
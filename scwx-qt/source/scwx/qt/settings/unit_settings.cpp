@@ -2,6 +2,10 @@
 #include <scwx/qt/settings/settings_definitions.hpp>
 #include <scwx/qt/types/unit_types.hpp>
 
+#include <atomic>
+#include <mutex>
+#include <vector>
+
 #include <boost/algorithm/string.hpp>
 
 namespace scwx
@@ -65,11 +69,20 @@ public:
 
    ~Impl() {}
 
+   void ConnectSettings();
+   void PublishSnapshot();
+
    SettingsVariable<std::string> accumulationUnits_ {"accumulation_units"};
    SettingsVariable<std::string> echoTopsUnits_ {"echo_tops_units"};
    SettingsVariable<std::string> otherUnits_ {"other_units"};
    SettingsVariable<std::string> speedUnits_ {"speed_units"};
    SettingsVariable<std::string> distanceUnits_ {"distance_units"};
+
+   // Published snapshots are retained, so a reader never holds a destroyed
+   // snapshot. Unit settings change rarely, so few snapshots are published.
+   std::atomic<const UnitSettingsSnapshot*>                 snapshot_ {};
+   std::vector<std::unique_ptr<const UnitSettingsSnapshot>> snapshots_ {};
+   std::mutex                                               snapshotMutex_ {};
 };
 
 UnitSettings::UnitSettings() :
@@ -80,6 +93,7 @@ UnitSettings::UnitSettings() :
                       &p->otherUnits_,
                       &p->speedUnits_,
                       &p->distanceUnits_});
+   p->ConnectSettings();
    SetDefaults();
 }
 UnitSettings::~UnitSettings() = default;
@@ -87,6 +101,45 @@ UnitSettings::~UnitSettings() = default;
 UnitSettings::UnitSettings(UnitSettings&&) noexcept            = default;
 UnitSettings& UnitSettings::operator=(UnitSettings&&) noexcept = default;
 
+void UnitSettings::Impl::ConnectSettings()
+{
+   for (auto variable : {&accumulationUnits_,
+                         &echoTopsUnits_,
+                         &otherUnits_,
+                         &speedUnits_,
+                         &distanceUnits_})
+   {
+      variable->RegisterValueChangedCallback([this](const std::string&)
+                                             { PublishSnapshot(); });
+   }
+
+   PublishSnapshot();
+}
+
+void UnitSettings::Impl::PublishSnapshot()
+{
+   std::unique_lock lock {snapshotMutex_};
+
+   auto snapshot = std::make_unique<UnitSettingsSnapshot>();
+
+   snapshot->version_ = snapshots_.size() + 1;
+   snapshot->accumulationUnits_ =
+      types::GetAccumulationUnitsFromName(accumulationUnits_.GetValue());
+   snapshot->echoTopsUnits_ =
+      types::GetEchoTopsUnitsFromName(echoTopsUnits_.GetValue());
+   snapshot->otherUnits_ = types::GetOtherUnitsFromName(otherUnits_.GetValue());
+   snapshot->speedUnits_ = types::GetSpeedUnitsFromName(speedUnits_.GetValue());
+   snapshot->distanceUnits_ =
+      types::GetDistanceUnitsFromName(distanceUnits_.GetValue());
+   snapshot->distanceScale_ =
+      types::GetDistanceUnitsScale(snapshot->distanceUnits_);
+   snapshot->distanceAbbreviation_ =
+      types::GetDistanceUnitsAbbreviation(snapshot->distanceUnits_);
+
+   snapshot_.store(snapshot.get(), std::memory_order_release);
+   snapshots_.push_back(std::move(snapshot));
+}
+
 SettingsVariable<std::string>& UnitSettings::accumulation_units() const
 {
    return p->accumulationUnits_;
@@ -112,6 +165,11 @@ SettingsVariable<std::string>& UnitSettings::distance_units() const
    return p->distanceUnits_;
 }
 
+const UnitSettingsSnapshot& UnitSettings::snapshot() const
+{
+   return *p->snapshot_.load(std::memory_order_acquire);
+}
+
 UnitSettings& UnitSettings::Instance()
 {
    static UnitSettings generalSettings_;
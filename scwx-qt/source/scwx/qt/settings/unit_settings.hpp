@@ -2,7 +2,9 @@
 
 #include <scwx/qt/settings/settings_category.hpp>
 #include <scwx/qt/settings/settings_variable.hpp>
+#include <scwx/qt/types/unit_types.hpp>
 
+#include <cstdint>
 #include <memory>
 #include <string>
 
@@ -13,6 +15,25 @@ namespace qt
 namespace settings
 {
 
+/**
+ * Immutable snapshot of the unit settings, with each unit parsed from its
+ * name. A new snapshot is published each time a unit setting changes.
+ */
+struct UnitSettingsSnapshot
+{
+   std::uint64_t version_ {};
+
+   types::AccumulationUnits accumulationUnits_ {
+      types::AccumulationUnits::Unknown};
+   types::EchoTopsUnits echoTopsUnits_ {types::EchoTopsUnits::Unknown};
+   types::OtherUnits    otherUnits_ {types::OtherUnits::Unknown};
+   types::SpeedUnits    speedUnits_ {types::SpeedUnits::Unknown};
+   types::DistanceUnits distanceUnits_ {types::DistanceUnits::Unknown};
+
+   double      distanceScale_ {1.0};
+   std::string distanceAbbreviation_ {};
+};
+
 class UnitSettings : public SettingsCategory
 {
 public:
@@ -31,6 +52,15 @@ public:
    SettingsVariable<std::string>& speed_units() const;
    SettingsVariable<std::string>& distance_units() const;
 
+   /**
+    * Gets the current snapshot of the unit settings. The snapshot is read
+    * without locking, and is safe to read from any thread. A snapshot remains
+    * valid for the lifetime of the unit settings.
+    *
+    * @return Unit settings snapshot
+    */
+   const UnitSettingsSnapshot& snapshot() const;
+
    static UnitSettings& Instance();
 
    friend bool operator==(const UnitSettings& lhs, const UnitSettings& rhs);
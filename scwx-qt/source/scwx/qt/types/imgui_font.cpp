@@ -2,7 +2,6 @@
 #define _CRT_SECURE_NO_WARNINGS
 
 #include <scwx/qt/types/imgui_font.hpp>
-#include <scwx/qt/model/imgui_context_model.hpp>
 #include <scwx/util/logger.hpp>
 
 #include <algorithm>
@@ -25,57 +24,79 @@ class ImGuiFont::Impl
 public:
    explicit Impl(const std::string&            fontName,
                  const std::vector<char>&      fontData,
-                 units::font_size::pixels<int> size) :
-       fontName_ {fontName}, size_ {size}
+                 units::font_size::pixels<int> size,
+                 int                           index) :
+       fontName_ {fontName},
+       fontData_ {fontData.data()},
+       fontDataSize_ {fontData.size()},
+       size_ {size},
+       index_ {index}
    {
-      CreateImGuiFont(fontData);
    }
 
    ~Impl() {}
 
-   void CreateImGuiFont(const std::vector<char>& fontData);
+   const std::string fontName_;
 
-   const std::string                   fontName_;
+   // The font data buffer is owned by the font manager, and is not moved
+   const char* const                   fontData_;
+   const std::size_t                   fontDataSize_;
    const units::font_size::pixels<int> size_;
-
-   ImFont* imFont_ {nullptr};
+   const int                           index_;
 };
 
 ImGuiFont::ImGuiFont(const std::string&            fontName,
                      const std::vector<char>&      fontData,
-                     units::font_size::pixels<int> size) :
-    p(std::make_unique<Impl>(fontName, fontData, size))
+                     units::font_size::pixels<int> size,
+                     int                           index) :
+    p(std::make_unique<Impl>(fontName, fontData, size, index))
 {
 }
 ImGuiFont::~ImGuiFont() = default;
 
-void ImGuiFont::Impl::CreateImGuiFont(const std::vector<char>& fontData)
+void ImGuiFont::AddToAtlas(ImFontAtlas& fontAtlas)
 {
-   logger_->debug("Creating Font: {}", fontName_);
+   logger_->debug("Adding Font: {}", p->fontName_);
+
+   if (fontAtlas.Fonts.Size != p->index_)
+   {
+      logger_->error("Font added out of order: {}", p->fontName_);
+   }
 
-   ImFontAtlas* fontAtlas = model::ImGuiContextModel::Instance().font_atlas();
    ImFontConfig fontConfig {};
 
-   const float sizePixels = static_cast<float>(size_.value());
+   const float sizePixels = static_cast<float>(p->size_.value());
 
    // Do not transfer ownership of font data to ImGui, makes const_cast safe
    fontConfig.FontDataOwnedByAtlas = false;
 
    // Assign name to font
-   strncpy(fontConfig.Name, fontName_.c_str(), sizeof(fontConfig.Name) - 1);
+   strncpy(
+      fontConfig.Name, p->fontName_.c_str(), sizeof(fontConfig.Name) - 1);
    fontConfig.Name[sizeof(fontConfig.Name) - 1] = 0;
 
-   imFont_ = fontAtlas->AddFontFromMemoryTTF(
-      const_cast<void*>(static_cast<const void*>(fontData.data())),
+   fontAtlas.AddFontFromMemoryTTF(
+      const_cast<void*>(static_cast<const void*>(p->fontData_)),
       static_cast<int>(std::clamp<std::size_t>(
-         fontData.size(), 0, std::numeric_limits<int>::max())),
+         p->fontDataSize_, 0, std::numeric_limits<int>::max())),
       sizePixels,
       &fontConfig);
 }
 
 ImFont* ImGuiFont::font()
 {
-   return p->imFont_;
+   return font(ImGui::GetIO().Fonts);
+}
+
+ImFont* ImGuiFont::font(ImFontAtlas* fontAtlas)
+{
+   // A font atlas built before the font was loaded does not contain the font
+   if (fontAtlas == nullptr || p->index_ >= fontAtlas->Fonts.Size)
+   {
+      return nullptr;
+   }
+
+   return fontAtlas->Fonts[p->index_];
 }
 
 } // namespace types
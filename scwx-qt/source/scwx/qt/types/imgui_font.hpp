@@ -7,6 +7,7 @@
 #include <scwx/qt/types/font_types.hpp>
 
 struct ImFont;
+struct ImFontAtlas;
 
 namespace scwx
 {
@@ -20,7 +21,8 @@ class ImGuiFont
 public:
    explicit ImGuiFont(const std::string&            fontName,
                       const std::vector<char>&      fontData,
-                      units::font_size::pixels<int> size);
+                      units::font_size::pixels<int> size,
+                      int                           index);
    ~ImGuiFont();
 
    ImGuiFont(const ImGuiFont&)            = delete;
@@ -29,8 +31,32 @@ public:
    ImGuiFont(ImGuiFont&&)            = delete;
    ImGuiFont& operator=(ImGuiFont&&) = delete;
 
+   /**
+    * Get the font from the font atlas of the current ImGui context.
+    *
+    * @return ImGui font, or nullptr if the font atlas does not contain the
+    * font
+    */
    ImFont* font();
 
+   /**
+    * Get the font from a font atlas.
+    *
+    * @param [in] fontAtlas Font atlas
+    *
+    * @return ImGui font, or nullptr if the font atlas does not contain the
+    * font
+    */
+   ImFont* font(ImFontAtlas* fontAtlas);
+
+   /**
+    * Add the font to a font atlas. Fonts are added to each font atlas in the
+    * same order, so the font has the same index in each font atlas.
+    *
+    * @param [in] fontAtlas Font atlas
+    */
+   void AddToAtlas(ImFontAtlas& fontAtlas);
+
 private:
    class Impl;
    std::unique_ptr<Impl> p;
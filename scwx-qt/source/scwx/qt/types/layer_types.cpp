@@ -25,6 +25,7 @@ static const std::unordered_map<LayerType, std::string> layerTypeName_ {
 static const std::unordered_map<DataLayer, std::string> dataLayerName_ {
    {DataLayer::OverlayProduct, "Overlay Product"},
    {DataLayer::RadarRange, "Radar Range"},
+   {DataLayer::RadarMosaic, "Radar Mosaic"},
    {DataLayer::Unknown, "?"}};
 
 static const std::unordered_map<InformationLayer, std::string>
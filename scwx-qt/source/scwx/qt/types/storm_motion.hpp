@@ -0,0 +1,27 @@
+#pragma once
+
+#include <units/angle.h>
+#include <units/velocity.h>
+
+namespace scwx
+{
+namespace qt
+{
+namespace types
+{
+
+/**
+ * Storm motion vector. The direction is the direction from which the storm is
+ * moving, following the convention of the Storm Tracking Information product.
+ */
+struct StormMotion
+{
+   units::angle::degrees<float>              direction_ {};
+   units::velocity::meters_per_second<float> speed_ {};
+
+   bool operator==(const StormMotion&) const = default;
+};
+
+} // namespace types
+} // namespace qt
+} // namespace scwx
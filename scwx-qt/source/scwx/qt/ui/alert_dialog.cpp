@@ -4,6 +4,8 @@
 #include <scwx/qt/manager/text_event_manager.hpp>
 #include <scwx/util/logger.hpp>
 
+#include <algorithm>
+
 #include <QPushButton>
 
 namespace scwx
@@ -82,6 +84,18 @@ void AlertDialogImpl::ConnectSignals()
          }
       },
       Qt::QueuedConnection);
+   connect(
+      textEventManager_.get(),
+      &manager::TextEventManager::AlertsRemoved,
+      this,
+      [this](const std::vector<types::TextEventKey>& keys)
+      {
+         if (std::find(keys.cbegin(), keys.cend(), key_) != keys.cend())
+         {
+            UpdateAlertInfo();
+         }
+      },
+      Qt::QueuedConnection);
    connect(goButton_,
            &QPushButton::clicked,
            this,
@@ -111,15 +125,13 @@ bool AlertDialog::SelectAlert(const types::TextEventKey& key)
 
 void AlertDialogImpl::SelectIndex(size_t newIndex)
 {
-   size_t messageCount = textEventManager_->message_count(key_);
+   auto messages = textEventManager_->message_list(key_);
 
-   if (newIndex >= messageCount)
+   if (newIndex >= messages.size())
    {
       return;
    }
 
-   auto messages = textEventManager_->message_list(key_);
-
    currentIndex_ = newIndex;
 
    self_->ui->alertText->setText(
@@ -133,6 +145,32 @@ void AlertDialogImpl::UpdateAlertInfo()
    auto   messages     = textEventManager_->message_list(key_);
    size_t messageCount = messages.size();
 
+   if (messageCount == 0u)
+   {
+      // The alert has been pruned, there is nothing left to navigate
+      currentIndex_ = 0u;
+      centroid_     = common::Coordinate {};
+
+      self_->ui->firstButton->setEnabled(false);
+      self_->ui->previousButton->setEnabled(false);
+      self_->ui->nextButton->setEnabled(false);
+      self_->ui->lastButton->setEnabled(false);
+      goButton_->setEnabled(false);
+
+      self_->ui->alertText->clear();
+      self_->ui->messageCountLabel->setText(QObject::tr("0 of 0"));
+      return;
+   }
+
+   if (currentIndex_ >= messageCount)
+   {
+      // The message list shrank, select the last remaining message
+      currentIndex_ = messageCount - 1u;
+
+      self_->ui->alertText->setText(
+         QString::fromStdString(messages[currentIndex_]->message_content()));
+   }
+
    bool firstSelected = (currentIndex_ == 0u);
    bool lastSelected  = (currentIndex_ == messageCount - 1u);
 
@@ -177,7 +215,11 @@ void AlertDialog::on_nextButton_clicked()
 
 void AlertDialog::on_lastButton_clicked()
 {
-   p->SelectIndex(p->textEventManager_->message_count(p->key_) - 1u);
+   size_t messageCount = p->textEventManager_->message_count(p->key_);
+   if (messageCount > 0u)
+   {
+      p->SelectIndex(messageCount - 1u);
+   }
 }
 
 #include "alert_dialog.moc"
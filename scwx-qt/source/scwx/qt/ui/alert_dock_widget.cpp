@@ -1,6 +1,7 @@
 #include "alert_dock_widget.hpp"
 #include "ui_alert_dock_widget.h"
 
+#include <scwx/qt/manager/alert_scheduler.hpp>
 #include <scwx/qt/manager/text_event_manager.hpp>
 #include <scwx/qt/model/alert_model.hpp>
 #include <scwx/qt/model/alert_proxy_model.hpp>
@@ -27,7 +28,8 @@ public:
    explicit AlertDockWidgetImpl(AlertDockWidget* self) :
        self_ {self},
        textEventManager_ {manager::TextEventManager::Instance()},
-       alertModel_ {std::make_unique<model::AlertModel>()},
+       alertScheduler_ {manager::AlertScheduler::Instance()},
+       alertModel_ {std::make_unique<model::AlertModel>(textEventManager_)},
        proxyModel_ {std::make_unique<model::AlertProxyModel>()},
        alertDialog_ {new AlertDialog(self)},
        mapPosition_ {},
@@ -46,6 +48,7 @@ public:
 
    AlertDockWidget*                           self_;
    std::shared_ptr<manager::TextEventManager> textEventManager_;
+   std::shared_ptr<manager::AlertScheduler>   alertScheduler_;
    std::unique_ptr<model::AlertModel>         alertModel_;
    std::unique_ptr<model::AlertProxyModel>    proxyModel_;
 
@@ -136,6 +139,16 @@ void AlertDockWidgetImpl::ConnectSignals()
            alertModel_.get(),
            &model::AlertModel::HandleAlert,
            Qt::QueuedConnection);
+   connect(textEventManager_.get(),
+           &manager::TextEventManager::AlertsRemoved,
+           alertModel_.get(),
+           &model::AlertModel::HandleAlertsRemoved,
+           Qt::QueuedConnection);
+   connect(alertScheduler_.get(),
+           &manager::AlertScheduler::AlertsTransitioned,
+           alertModel_.get(),
+           &model::AlertModel::HandleAlertsTransitioned,
+           Qt::QueuedConnection);
    connect(
       self_->ui->alertView->selectionModel(),
       &QItemSelectionModel::selectionChanged,
@@ -0,0 +1,263 @@
+#include "cross_section_dock_widget.hpp"
+
+#include <scwx/qt/view/cross_section_view.hpp>
+#include <scwx/util/logger.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+#include <QImage>
+#include <QPainter>
+
+namespace scwx
+{
+namespace qt
+{
+namespace ui
+{
+
+static const std::string logPrefix_ = "scwx::qt::ui::cross_section_dock_widget";
+static const auto        logger_    = scwx::util::Logger::Create(logPrefix_);
+
+static constexpr int    kMarginLeft_     = 48;
+static constexpr int    kMarginRight_    = 12;
+static constexpr int    kMarginTop_      = 12;
+static constexpr int    kMarginBottom_   = 32;
+static constexpr int    kTickLength_     = 4;
+static constexpr double kHeightInterval_ = 2'000.0; // meters
+static constexpr int    kDistanceTicks_  = 8;
+static constexpr double kMetersPerKm_    = 1'000.0;
+static constexpr int    kMinimumHeight_  = 160;
+
+class CrossSectionCanvas : public QWidget
+{
+public:
+   explicit CrossSectionCanvas(QWidget* parent = nullptr) : QWidget(parent)
+   {
+      setMinimumHeight(kMinimumHeight_);
+   }
+   ~CrossSectionCanvas() = default;
+
+   void set_cross_section_view(
+      const std::shared_ptr<view::CrossSectionView>& crossSectionView)
+   {
+      crossSectionView_ = crossSectionView;
+      update();
+   }
+
+protected:
+   void paintEvent(QPaintEvent*) override;
+
+private:
+   void        UpdateImage();
+   static void DrawAxes(QPainter&    painter,
+                        const QRect& plotRect,
+                        double       length,
+                        double       height);
+
+   std::shared_ptr<view::CrossSectionView> crossSectionView_ {nullptr};
+
+   QImage image_ {};
+   double length_ {0.0};
+   double height_ {0.0};
+};
+
+class CrossSectionDockWidgetImpl
+{
+public:
+   explicit CrossSectionDockWidgetImpl(CrossSectionDockWidget* self) :
+       self_ {self}, canvas_ {new CrossSectionCanvas(self)}
+   {
+   }
+   ~CrossSectionDockWidgetImpl() = default;
+
+   CrossSectionDockWidget* self_;
+   CrossSectionCanvas*     canvas_;
+
+   std::shared_ptr<view::CrossSectionView> crossSectionView_ {nullptr};
+};
+
+CrossSectionDockWidget::CrossSectionDockWidget(QWidget* parent) :
+    QDockWidget(parent), p {std::make_unique<CrossSectionDockWidgetImpl>(this)}
+{
+   setObjectName("crossSectionDockWidget");
+   setWindowTitle(tr("Cross Section"));
+   setWidget(p->canvas_);
+}
+
+CrossSectionDockWidget::~CrossSectionDockWidget() = default;
+
+void CrossSectionDockWidget::SetCrossSectionView(
+   const std::shared_ptr<view::CrossSectionView>& crossSectionView)
+{
+   if (p->crossSectionView_ == crossSectionView)
+   {
+      return;
+   }
+
+   if (p->crossSectionView_ != nullptr)
+   {
+      disconnect(p->crossSectionView_.get(), nullptr, this, nullptr);
+   }
+
+   p->crossSectionView_ = crossSectionView;
+   p->canvas_->set_cross_section_view(crossSectionView);
+
+   if (crossSectionView != nullptr)
+   {
+      connect(crossSectionView.get(),
+              &view::CrossSectionView::CrossSectionUpdated,
+              this,
+              [this]() { p->canvas_->update(); });
+   }
+}
+
+void CrossSectionCanvas::UpdateImage()
+{
+   image_  = {};
+   length_ = 0.0;
+   height_ = 0.0;
+
+   if (crossSectionView_ == nullptr)
+   {
+      return;
+   }
+
+   std::unique_lock lock {crossSectionView_->cross_section_mutex()};
+
+   auto [levels, columns, rows] = crossSectionView_->GetCrossSectionData();
+   auto [length, height]        = crossSectionView_->GetCrossSectionExtent();
+
+   const auto&         lut      = crossSectionView_->color_table_lut();
+   const std::uint16_t rangeMin = crossSectionView_->color_table_min();
+   const std::uint16_t rangeMax = crossSectionView_->color_table_max();
+
+   if (levels == nullptr || lut.empty() || rangeMax <= rangeMin)
+   {
+      return;
+   }
+
+   image_  = QImage(static_cast<int>(columns),
+                   static_cast<int>(rows),
+                   QImage::Format_RGBA8888);
+   length_ = length;
+   height_ = height;
+
+   const double lutScale =
+      static_cast<double>(lut.size()) / (rangeMax - rangeMin);
+   const std::size_t lutMax = lut.size() - 1;
+
+   for (std::size_t row = 0; row < rows; ++row)
+   {
+      auto scanLine = reinterpret_cast<std::array<std::uint8_t, 4>*>(
+         image_.scanLine(static_cast<int>(row)));
+
+      for (std::size_t column = 0; column < columns; ++column)
+      {
+         const std::uint16_t level = levels[row * columns + column];
+
+         if (level == 0u)
+         {
+            scanLine[column] = {0u, 0u, 0u, 0u};
+            continue;
+         }
+
+         // Match the color table lookup of the radar shaders
+         const double lutCoord =
+            std::max(0.0, static_cast<double>(level) - rangeMin) * lutScale;
+         const auto& pixel =
+            lut[std::min(static_cast<std::size_t>(lutCoord), lutMax)];
+
+         scanLine[column] = {pixel[0], pixel[1], pixel[2], pixel[3]};
+      }
+   }
+}
+
+void CrossSectionCanvas::paintEvent(QPaintEvent*)
+{
+   QPainter painter {this};
+   painter.fillRect(rect(), palette().window());
+
+   UpdateImage();
+
+   if (image_.isNull())
+   {
+      painter.drawText(
+         rect(),
+         static_cast<int>(Qt::AlignCenter) | Qt::TextWordWrap,
+         tr("Ctrl+drag on a Level 2 radar map to draw a cross section"));
+      return;
+   }
+
+   const QRect plotRect = rect().adjusted(
+      kMarginLeft_, kMarginTop_, -kMarginRight_, -kMarginBottom_);
+
+   if (plotRect.width() <= 0 || plotRect.height() <= 0)
+   {
+      return;
+   }
+
+   painter.fillRect(plotRect, Qt::black);
+   painter.drawImage(plotRect, image_);
+
+   DrawAxes(painter, plotRect, length_, height_);
+}
+
+void CrossSectionCanvas::DrawAxes(QPainter&    painter,
+                                  const QRect& plotRect,
+                                  double       length,
+                                  double       height)
+{
+   const QFontMetrics metrics = painter.fontMetrics();
+
+   painter.setPen(Qt::gray);
+   painter.drawRect(plotRect);
+
+   // Height axis
+   for (double h = 0.0; h <= height; h += kHeightInterval_)
+   {
+      const int y = plotRect.bottom() -
+                    static_cast<int>(h / height * plotRect.height());
+      const QString label =
+         QString("%1 km").arg(static_cast<int>(h / kMetersPerKm_));
+
+      painter.drawLine(plotRect.left() - kTickLength_, y, plotRect.left(), y);
+      painter.drawText(plotRect.left() - kTickLength_ * 2 -
+                          metrics.horizontalAdvance(label),
+                       y + metrics.ascent() / 2,
+                       label);
+   }
+
+   // Distance axis, using a 1, 2, 5 interval sequence
+   const double rawInterval = length / kMetersPerKm_ / kDistanceTicks_;
+   const double magnitude =
+      std::pow(10.0, std::floor(std::log10(std::max(rawInterval, 0.1))));
+   double interval = magnitude;
+   for (double step : {2.0, 5.0, 10.0})
+   {
+      if (interval >= rawInterval)
+      {
+         break;
+      }
+      interval = magnitude * step;
+   }
+
+   for (double d = 0.0; d <= length / kMetersPerKm_; d += interval)
+   {
+      const int x = plotRect.left() +
+                    static_cast<int>(d * kMetersPerKm_ / length *
+                                     plotRect.width());
+      const QString label = QString("%1 km").arg(d);
+
+      painter.drawLine(
+         x, plotRect.bottom(), x, plotRect.bottom() + kTickLength_);
+      painter.drawText(x - metrics.horizontalAdvance(label) / 2,
+                       plotRect.bottom() + kTickLength_ + metrics.ascent(),
+                       label);
+   }
+}
+
+} // namespace ui
+} // namespace qt
+} // namespace scwx
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <memory>
+
+#include <QDockWidget>
+
+namespace scwx
+{
+namespace qt
+{
+namespace view
+{
+
+class CrossSectionView;
+
+} // namespace view
+
+namespace ui
+{
+
+class CrossSectionDockWidgetImpl;
+
+class CrossSectionDockWidget : public QDockWidget
+{
+   Q_OBJECT
+
+public:
+   explicit CrossSectionDockWidget(QWidget* parent = nullptr);
+   ~CrossSectionDockWidget();
+
+   /**
+    * Sets the cross section view displayed by the dock widget. This is
+    * normally the cross section view of the active map.
+    *
+    * @param [in] crossSectionView Cross section view
+    */
+   void SetCrossSectionView(
+      const std::shared_ptr<view::CrossSectionView>& crossSectionView);
+
+private:
+   friend class CrossSectionDockWidgetImpl;
+   std::unique_ptr<CrossSectionDockWidgetImpl> p;
+};
+
+} // namespace ui
+} // namespace qt
+} // namespace scwx
@@ -4,6 +4,11 @@
 #include <scwx/qt/model/imgui_context_model.hpp>
 #include <scwx/qt/types/qt_types.hpp>
 #include <scwx/qt/ui/imgui_debug_widget.hpp>
+#include <scwx/util/logger.hpp>
+#include <scwx/util/trace.hpp>
+
+#include <QFileDialog>
+#include <QMessageBox>
 
 namespace scwx
 {
@@ -13,6 +18,7 @@ namespace ui
 {
 
 static const std::string logPrefix_ = "scwx::qt::ui::imgui_debug_dialog";
+static const auto        logger_    = scwx::util::Logger::Create(logPrefix_);
 
 class ImGuiDebugDialogImpl
 {
@@ -57,6 +63,42 @@ ImGuiDebugDialog::ImGuiDebugDialog(QWidget* parent) :
             p->imGuiDebugWidget_->set_current_context(contextInfo.context_);
          }
       });
+
+   connect(ui->exportTraceButton,
+           &QAbstractButton::clicked,
+           this,
+           [this]()
+           {
+              static const std::string traceFilter =
+                 "Chrome Trace (*.json)";
+
+              QFileDialog* dialog = new QFileDialog(this);
+
+              dialog->setAcceptMode(QFileDialog::AcceptSave);
+              dialog->setFileMode(QFileDialog::AnyFile);
+              dialog->setNameFilter(tr(traceFilter.c_str()));
+              dialog->setDefaultSuffix("json");
+              dialog->setAttribute(Qt::WA_DeleteOnClose);
+
+              connect(dialog,
+                      &QFileDialog::fileSelected,
+                      this,
+                      [this](const QString& file)
+                      {
+                         logger_->info("Selected: {}", file.toStdString());
+
+                         if (!scwx::util::Tracer::Instance().ExportTrace(
+                                file.toStdString()))
+                         {
+                            QMessageBox::warning(
+                               this,
+                               tr("Export Trace"),
+                               tr("Could not write trace file."));
+                         }
+                      });
+
+              dialog->open();
+           });
 }
 
 ImGuiDebugDialog::~ImGuiDebugDialog()
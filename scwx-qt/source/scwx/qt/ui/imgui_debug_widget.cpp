@@ -1,8 +1,10 @@
 #include <scwx/qt/ui/imgui_debug_widget.hpp>
 #include <scwx/qt/gl/gl.hpp>
-#include <scwx/qt/manager/font_manager.hpp>
 #include <scwx/qt/model/imgui_context_model.hpp>
+#include <scwx/qt/util/imgui.hpp>
+#include <scwx/util/trace.hpp>
 
+#include <array>
 #include <set>
 
 #include <imgui.h>
@@ -44,6 +46,7 @@ public:
       // Shutdown ImGui Context
       if (imGuiRendererInitialized_)
       {
+         util::ImGui::Instance().ReleaseFontAtlas();
          ImGui_ImplOpenGL3_Shutdown();
       }
       ImGui_ImplQt_Shutdown();
@@ -53,6 +56,7 @@ public:
    }
 
    void ImGuiCheckFonts();
+   void RenderLatencyWindow();
 
    ImGuiDebugWidget* self_;
    ImGuiContext*     context_;
@@ -62,9 +66,9 @@ public:
 
    gl::OpenGLFunctions gl_;
 
-   std::set<ImGuiContext*> renderedSet_ {};
-   bool                    imGuiRendererInitialized_ {false};
-   std::uint64_t           imGuiFontsBuildCount_ {};
+   std::set<ImGuiContext*>      renderedSet_ {};
+   bool                         imGuiRendererInitialized_ {false};
+   std::shared_ptr<ImFontAtlas> imGuiFontAtlas_ {};
 };
 
 ImGuiDebugWidget::ImGuiDebugWidget(QWidget* parent) :
@@ -112,8 +116,6 @@ void ImGuiDebugWidget::initializeGL()
    // Initialize ImGui OpenGL3 backend
    ImGui::SetCurrentContext(p->context_);
    ImGui_ImplOpenGL3_Init();
-   p->imGuiFontsBuildCount_ =
-      manager::FontManager::Instance().imgui_fonts_build_count();
    p->imGuiRendererInitialized_ = true;
 }
 
@@ -124,10 +126,6 @@ void ImGuiDebugWidget::paintGL()
 
    ImGui::SetCurrentContext(p->currentContext_);
 
-   // Lock ImGui font atlas prior to new ImGui frame
-   std::shared_lock imguiFontAtlasLock {
-      manager::FontManager::Instance().imgui_font_atlas_mutex()};
-
    ImGui_ImplQt_NewFrame(this);
    ImGui_ImplOpenGL3_NewFrame();
    p->ImGuiCheckFonts();
@@ -142,37 +140,112 @@ void ImGuiDebugWidget::paintGL()
       ImGui::Begin("Dear ImGui Demo");
       ImGui::End();
 
+      ImGui::SetNextWindowPos(ImVec2 {10.0f, 10.0f}, ImGuiCond_FirstUseEver);
+      ImGui::Begin("Latency");
+      ImGui::End();
+
       p->renderedSet_.insert(p->currentContext_);
       update();
    }
 
    ImGui::ShowDemoWindow();
+   p->RenderLatencyWindow();
 
    ImGui::Render();
    ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
-
-   // Unlock ImGui font atlas after rendering
-   imguiFontAtlasLock.unlock();
 }
 
-void ImGuiDebugWidgetImpl::ImGuiCheckFonts()
+void ImGuiDebugWidgetImpl::RenderLatencyWindow()
 {
-   // Update ImGui Fonts if required
-   std::uint64_t currentImGuiFontsBuildCount =
-      manager::FontManager::Instance().imgui_fonts_build_count();
+   using namespace std::chrono;
+
+   static const auto toMilliseconds = [](microseconds value)
+   { return duration_cast<duration<double, std::milli>>(value).count(); };
+
+   auto& tracer = scwx::util::Tracer::Instance();
 
-   if ((context_ == currentContext_ &&
-        imGuiFontsBuildCount_ != currentImGuiFontsBuildCount) ||
-       !model::ImGuiContextModel::Instance().font_atlas()->IsBuilt())
+   ImGui::Begin("Latency");
+
+   if (ImGui::Button("Reset"))
    {
-      ImGui_ImplOpenGL3_DestroyFontsTexture();
-      ImGui_ImplOpenGL3_CreateFontsTexture();
+      tracer.Reset();
    }
 
-   if (context_ == currentContext_)
+   if (ImGui::BeginTable("Stages", 7))
    {
-      imGuiFontsBuildCount_ = currentImGuiFontsBuildCount;
+      ImGui::TableSetupColumn("Stage");
+      ImGui::TableSetupColumn("Count");
+      ImGui::TableSetupColumn("Mean (ms)");
+      ImGui::TableSetupColumn("p50 (ms)");
+      ImGui::TableSetupColumn("p90 (ms)");
+      ImGui::TableSetupColumn("p99 (ms)");
+      ImGui::TableSetupColumn("Max (ms)");
+      ImGui::TableHeadersRow();
+
+      for (auto stage : scwx::util::TraceStageIterator())
+      {
+         auto statistics = tracer.GetStatistics(stage);
+         auto mean       = (statistics.count_ > 0u) ?
+                              statistics.total_ /
+                                 static_cast<std::int64_t>(statistics.count_) :
+                              microseconds {0};
+
+         ImGui::TableNextRow();
+         ImGui::TableNextColumn();
+         ImGui::TextUnformatted(
+            scwx::util::GetTraceStageName(stage).c_str());
+         ImGui::TableNextColumn();
+         ImGui::Text("%zu", statistics.count_);
+         ImGui::TableNextColumn();
+         ImGui::Text("%.3f", toMilliseconds(mean));
+         ImGui::TableNextColumn();
+         ImGui::Text("%.3f", toMilliseconds(statistics.Percentile(0.5)));
+         ImGui::TableNextColumn();
+         ImGui::Text("%.3f", toMilliseconds(statistics.Percentile(0.9)));
+         ImGui::TableNextColumn();
+         ImGui::Text("%.3f", toMilliseconds(statistics.Percentile(0.99)));
+         ImGui::TableNextColumn();
+         ImGui::Text("%.3f", toMilliseconds(statistics.max_));
+      }
+
+      ImGui::EndTable();
    }
+
+   // Histograms of log2 microsecond buckets
+   for (auto stage : scwx::util::TraceStageIterator())
+   {
+      auto statistics = tracer.GetStatistics(stage);
+      if (statistics.count_ == 0u)
+      {
+         continue;
+      }
+
+      std::array<float, scwx::util::TraceStatistics::kHistogramBuckets_>
+         values {};
+      for (std::size_t i = 0; i < values.size(); ++i)
+      {
+         values[i] = static_cast<float>(statistics.histogram_[i]);
+      }
+
+      const std::string& name = scwx::util::GetTraceStageName(stage);
+      ImGui::PlotHistogram(name.c_str(),
+                           values.data(),
+                           static_cast<int>(values.size()),
+                           0,
+                           "log2(us)",
+                           0.0f,
+                           FLT_MAX,
+                           ImVec2 {0.0f, 40.0f});
+   }
+
+   ImGui::End();
+}
+
+void ImGuiDebugWidgetImpl::ImGuiCheckFonts()
+{
+   // Switch the displayed context to the most recently built font atlas. The
+   // font atlas texture is shared with the map contexts.
+   util::ImGui::Instance().SelectFontAtlas(gl_, imGuiFontAtlas_);
 }
 
 } // namespace ui
@@ -1,14 +1,20 @@
 #include <scwx/qt/ui/level2_settings_widget.hpp>
 #include <scwx/qt/ui/flow_layout.hpp>
 #include <scwx/qt/manager/hotkey_manager.hpp>
+#include <scwx/qt/settings/product_settings.hpp>
+#include <scwx/qt/settings/settings_interface.hpp>
 #include <scwx/common/characters.hpp>
 #include <scwx/util/logger.hpp>
 
 #include <execution>
 
 #include <QCheckBox>
+#include <QDoubleSpinBox>
 #include <QEvent>
+#include <QFormLayout>
 #include <QGroupBox>
+#include <QLabel>
+#include <QSpinBox>
 #include <QToolButton>
 
 namespace scwx
@@ -52,6 +58,81 @@ public:
 
       settingsGroupBox_->setVisible(false);
 
+      // Display filters are applied when rendering, and take effect without
+      // recomputing the sweep
+      displayGroupBox_           = new QGroupBox(tr("Display"), self);
+      QFormLayout* displayLayout = new QFormLayout(displayGroupBox_);
+      layout_->addWidget(displayGroupBox_);
+
+      QCheckBox* rangeFoldedCheckBox =
+         new QCheckBox(tr("Range Folded"), displayGroupBox_);
+      displayLayout->addRow(rangeFoldedCheckBox);
+
+      cfpFilterCheckBox_ =
+         new QCheckBox(tr("Clutter Filter Power"), displayGroupBox_);
+      displayLayout->addRow(cfpFilterCheckBox_);
+
+      reflectivityThresholdSpinBox_ = new QDoubleSpinBox(displayGroupBox_);
+      reflectivityThresholdSpinBox_->setDecimals(1);
+      reflectivityThresholdSpinBox_->setSingleStep(5.0);
+      reflectivityThresholdSpinBox_->setSuffix(tr(" dBZ"));
+      reflectivityThresholdLabel_ =
+         new QLabel(tr("Threshold"), displayGroupBox_);
+      displayLayout->addRow(reflectivityThresholdLabel_,
+                            reflectivityThresholdSpinBox_);
+
+      auto& productSettings = settings::ProductSettings::Instance();
+
+      rangeFoldedEnabled_.SetSettingsVariable(
+         productSettings.l2_range_folded_enabled());
+      cfpFilterEnabled_.SetSettingsVariable(
+         productSettings.l2_cfp_filter_enabled());
+      reflectivityThreshold_.SetSettingsVariable(
+         productSettings.l2_reflectivity_threshold());
+
+      rangeFoldedEnabled_.SetEditWidget(rangeFoldedCheckBox);
+      cfpFilterEnabled_.SetEditWidget(cfpFilterCheckBox_);
+      reflectivityThreshold_.SetEditWidget(reflectivityThresholdSpinBox_);
+
+      displayGroupBox_->setVisible(false);
+
+      stormMotionGroupBox_ = new QGroupBox(tr("Storm Motion"), self);
+      QFormLayout* stormMotionLayout = new QFormLayout(stormMotionGroupBox_);
+      layout_->addWidget(stormMotionGroupBox_);
+
+      stormTrackingCheckBox_ =
+         new QCheckBox(tr("Use Storm Tracking"), stormMotionGroupBox_);
+      stormTrackingCheckBox_->setChecked(true);
+      stormMotionLayout->addRow(stormTrackingCheckBox_);
+
+      stormDirectionSpinBox_ = new QSpinBox(stormMotionGroupBox_);
+      stormDirectionSpinBox_->setRange(0, 359);
+      stormDirectionSpinBox_->setWrapping(true);
+      stormDirectionSpinBox_->setSuffix(QString() + common::Characters::DEGREE);
+      stormMotionLayout->addRow(tr("From"), stormDirectionSpinBox_);
+
+      stormSpeedSpinBox_ = new QSpinBox(stormMotionGroupBox_);
+      stormSpeedSpinBox_->setRange(0, 99);
+      stormSpeedSpinBox_->setSuffix(tr(" kts"));
+      stormMotionLayout->addRow(tr("Speed"), stormSpeedSpinBox_);
+
+      stormDirectionSpinBox_->setEnabled(false);
+      stormSpeedSpinBox_->setEnabled(false);
+      stormMotionGroupBox_->setVisible(false);
+
+      QObject::connect(stormTrackingCheckBox_,
+                       &QCheckBox::toggled,
+                       this,
+                       &Level2SettingsWidgetImpl::SelectStormMotion);
+      QObject::connect(stormDirectionSpinBox_,
+                       &QSpinBox::valueChanged,
+                       this,
+                       &Level2SettingsWidgetImpl::SelectStormMotion);
+      QObject::connect(stormSpeedSpinBox_,
+                       &QSpinBox::valueChanged,
+                       this,
+                       &Level2SettingsWidgetImpl::SelectStormMotion);
+
       QObject::connect(hotkeyManager_.get(),
                        &manager::HotkeyManager::HotkeyPressed,
                        this,
@@ -62,6 +143,7 @@ public:
    void HandleHotkeyPressed(types::Hotkey hotkey, bool isAutoRepeat);
    void NormalizeElevationButtons();
    void SelectElevation(float elevation);
+   void SelectStormMotion();
 
    Level2SettingsWidget* self_;
    QLayout*              layout_;
@@ -75,6 +157,20 @@ public:
    QGroupBox* settingsGroupBox_;
    QCheckBox* declutterCheckBox_;
 
+   QGroupBox*      displayGroupBox_ {nullptr};
+   QCheckBox*      cfpFilterCheckBox_ {nullptr};
+   QLabel*         reflectivityThresholdLabel_ {nullptr};
+   QDoubleSpinBox* reflectivityThresholdSpinBox_ {nullptr};
+
+   settings::SettingsInterface<bool>   rangeFoldedEnabled_ {};
+   settings::SettingsInterface<bool>   cfpFilterEnabled_ {};
+   settings::SettingsInterface<double> reflectivityThreshold_ {};
+
+   QGroupBox* stormMotionGroupBox_ {nullptr};
+   QCheckBox* stormTrackingCheckBox_ {nullptr};
+   QSpinBox*  stormDirectionSpinBox_ {nullptr};
+   QSpinBox*  stormSpeedSpinBox_ {nullptr};
+
    float        currentElevation_ {};
    QToolButton* currentElevationButton_ {nullptr};
 
@@ -212,6 +308,27 @@ void Level2SettingsWidgetImpl::SelectElevation(float elevation)
    Q_EMIT self_->ElevationSelected(elevation);
 }
 
+void Level2SettingsWidgetImpl::SelectStormMotion()
+{
+   const bool useStormTracking = stormTrackingCheckBox_->isChecked();
+
+   stormDirectionSpinBox_->setEnabled(!useStormTracking);
+   stormSpeedSpinBox_->setEnabled(!useStormTracking);
+
+   std::optional<types::StormMotion> stormMotion {};
+
+   if (!useStormTracking)
+   {
+      stormMotion = types::StormMotion {
+         units::angle::degrees<float> {
+            static_cast<float>(stormDirectionSpinBox_->value())},
+         units::velocity::knots<float> {
+            static_cast<float>(stormSpeedSpinBox_->value())}};
+   }
+
+   Q_EMIT self_->StormMotionSelected(stormMotion);
+}
+
 void Level2SettingsWidget::UpdateElevationSelection(float elevation)
 {
    QString buttonText {QString::number(elevation, 'f', 1) +
@@ -277,6 +394,21 @@ void Level2SettingsWidget::UpdateSettings(map::MapWidget* activeMap)
    }
 
    UpdateElevationSelection(currentElevation);
+
+   const common::Level2Product product =
+      common::GetLevel2Product(activeMap->GetRadarProductName());
+
+   // Clutter filter power and the threshold are only used by reflectivity
+   const bool reflectivity = (product == common::Level2Product::Reflectivity);
+   p->displayGroupBox_->setVisible(
+      product != common::Level2Product::ClutterFilterPowerRemoved);
+   p->cfpFilterCheckBox_->setVisible(reflectivity);
+   p->reflectivityThresholdLabel_->setVisible(reflectivity);
+   p->reflectivityThresholdSpinBox_->setVisible(reflectivity);
+
+   // Storm motion is only used by storm relative velocity
+   p->stormMotionGroupBox_->setVisible(
+      product == common::Level2Product::StormRelativeVelocity);
 }
 
 } // namespace ui
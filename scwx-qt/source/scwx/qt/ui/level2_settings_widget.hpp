@@ -1,6 +1,9 @@
 #pragma once
 
 #include <scwx/qt/map/map_widget.hpp>
+#include <scwx/qt/types/storm_motion.hpp>
+
+#include <optional>
 
 namespace scwx
 {
@@ -27,6 +30,7 @@ public:
 
 signals:
    void ElevationSelected(float elevation);
+   void StormMotionSelected(std::optional<types::StormMotion> stormMotion);
 
 private:
    std::shared_ptr<Level2SettingsWidgetImpl> p;
@@ -129,10 +129,12 @@ public:
           &nmeaBaudRate_,
           &nmeaSource_,
           &warningsProvider_,
+          &alertRetention_,
           &antiAliasingEnabled_,
           &showMapAttribution_,
           &showMapCenter_,
           &showMapLogo_,
+          &precomputeSweeps_,
           &updateNotificationsEnabled_,
           &debugEnabled_,
           &alertAudioSoundFile_,
@@ -243,10 +245,12 @@ public:
    settings::SettingsInterface<std::string>  nmeaSource_ {};
    settings::SettingsInterface<std::string>  theme_ {};
    settings::SettingsInterface<std::string>  warningsProvider_ {};
+   settings::SettingsInterface<std::int64_t> alertRetention_ {};
    settings::SettingsInterface<bool>         antiAliasingEnabled_ {};
    settings::SettingsInterface<bool>         showMapAttribution_ {};
    settings::SettingsInterface<bool>         showMapCenter_ {};
    settings::SettingsInterface<bool>         showMapLogo_ {};
+   settings::SettingsInterface<bool>         precomputeSweeps_ {};
    settings::SettingsInterface<bool>         updateNotificationsEnabled_ {};
    settings::SettingsInterface<bool>         debugEnabled_ {};
 
@@ -684,6 +688,10 @@ void SettingsDialogImpl::SetupGeneralTab()
    warningsProvider_.SetEditWidget(self_->ui->warningsProviderLineEdit);
    warningsProvider_.SetResetButton(self_->ui->resetWarningsProviderButton);
 
+   alertRetention_.SetSettingsVariable(generalSettings.alert_retention());
+   alertRetention_.SetEditWidget(self_->ui->alertRetentionSpinBox);
+   alertRetention_.SetResetButton(self_->ui->resetAlertRetentionButton);
+
    antiAliasingEnabled_.SetSettingsVariable(
       generalSettings.anti_aliasing_enabled());
    antiAliasingEnabled_.SetEditWidget(self_->ui->antiAliasingEnabledCheckBox);
@@ -698,6 +706,9 @@ void SettingsDialogImpl::SetupGeneralTab()
    showMapLogo_.SetSettingsVariable(generalSettings.show_map_logo());
    showMapLogo_.SetEditWidget(self_->ui->showMapLogoCheckBox);
 
+   precomputeSweeps_.SetSettingsVariable(generalSettings.precompute_sweeps());
+   precomputeSweeps_.SetEditWidget(self_->ui->precomputeSweepsCheckBox);
+
    updateNotificationsEnabled_.SetSettingsVariable(
       generalSettings.update_notifications_enabled());
    updateNotificationsEnabled_.SetEditWidget(
@@ -0,0 +1,155 @@
+#include <scwx/qt/util/cross_section.hpp>
+
+#include <cmath>
+#include <numbers>
+
+namespace scwx
+{
+namespace qt
+{
+namespace util
+{
+
+// Beam propagation uses the 4/3 effective earth radius model
+static constexpr double kEffectiveEarthRadius_ = 6'371'000.0 * 4.0 / 3.0;
+static constexpr double kHalfBeamWidth_        = 0.475; // degrees
+
+static constexpr double kDegreesToRadians_ = std::numbers::pi / 180.0;
+
+static constexpr std::uint16_t RANGE_FOLDED = 1u;
+
+static double BeamHeight(double theta, double elevation);
+static double BeamSlantRange(double theta, double elevation);
+
+double GetBeamHeight(double groundRange, double elevation)
+{
+   return BeamHeight(groundRange / kEffectiveEarthRadius_,
+                     elevation * kDegreesToRadians_);
+}
+
+double GetBeamSlantRange(double groundRange, double elevation)
+{
+   return BeamSlantRange(groundRange / kEffectiveEarthRadius_,
+                         elevation * kDegreesToRadians_);
+}
+
+void UpdateCrossSectionBeamTable(const std::vector<float>&  elevations,
+                                 const std::vector<double>& groundRanges,
+                                 CrossSectionBeamTable&     table)
+{
+   const std::size_t columns = groundRanges.size();
+
+   if (elevations == table.elevations_ && columns == table.columns_)
+   {
+      return;
+   }
+
+   table.elevations_ = elevations;
+   table.columns_    = columns;
+
+   const std::size_t tableSize = elevations.size() * columns;
+   table.center_.resize(tableSize);
+   table.bottom_.resize(tableSize);
+   table.top_.resize(tableSize);
+   table.slantRange_.resize(tableSize);
+
+   const double halfWidth = kHalfBeamWidth_ * kDegreesToRadians_;
+
+   for (std::size_t s = 0; s < elevations.size(); ++s)
+   {
+      const double elevation = elevations[s] * kDegreesToRadians_;
+
+      for (std::size_t column = 0; column < columns; ++column)
+      {
+         const double theta = groundRanges[column] / kEffectiveEarthRadius_;
+         const std::size_t i = s * columns + column;
+
+         table.center_[i] = static_cast<float>(BeamHeight(theta, elevation));
+         table.bottom_[i] =
+            static_cast<float>(BeamHeight(theta, elevation - halfWidth));
+         table.top_[i] =
+            static_cast<float>(BeamHeight(theta, elevation + halfWidth));
+         table.slantRange_[i] =
+            static_cast<float>(BeamSlantRange(theta, elevation));
+      }
+   }
+}
+
+void SampleCrossSectionSweep(const std::vector<CrossSectionRadial>& radials,
+                             const std::vector<std::int16_t>& radialLookup,
+                             std::span<const std::uint16_t>   azimuthBins,
+                             std::span<const float>           slantRanges,
+                             std::vector<std::uint16_t>&      levels)
+{
+   levels.assign(azimuthBins.size(), 0u);
+
+   if (radials.empty())
+   {
+      return;
+   }
+
+   for (std::size_t column = 0; column < azimuthBins.size(); ++column)
+   {
+      const std::int16_t radialIndex = radialLookup[azimuthBins[column]];
+
+      if (radialIndex < 0)
+      {
+         continue;
+      }
+
+      const CrossSectionRadial& radial = radials[radialIndex];
+
+      // Offset from the start of the first gate, checked before dividing so
+      // that ranges just short of the first gate are not truncated into it
+      const std::int32_t gateOffset =
+         static_cast<std::int32_t>(slantRanges[column]) -
+         radial.firstGateRange_;
+
+      if (gateOffset < 0)
+      {
+         continue;
+      }
+
+      const std::int32_t gate = gateOffset / radial.interval_;
+
+      if (gate >= radial.gates_)
+      {
+         continue;
+      }
+
+      std::uint16_t level;
+
+      if (radial.wordSize_ == 8)
+      {
+         level = static_cast<const std::uint8_t*>(radial.moments_)[gate];
+      }
+      else
+      {
+         level = static_cast<const std::uint16_t*>(radial.moments_)[gate];
+      }
+
+      if (level < radial.snrThreshold_ && level != RANGE_FOLDED)
+      {
+         level = 0u;
+      }
+
+      levels[column] = level;
+   }
+}
+
+static double BeamHeight(double theta, double elevation)
+{
+   // Height of the beam above the radar at the earth central angle theta
+   return kEffectiveEarthRadius_ *
+          (std::cos(elevation) / std::cos(elevation + theta) - 1.0);
+}
+
+static double BeamSlantRange(double theta, double elevation)
+{
+   return kEffectiveEarthRadius_ * std::sin(theta) /
+          std::cos(elevation + theta);
+}
+
+} // namespace util
+} // namespace qt
+} // namespace scwx
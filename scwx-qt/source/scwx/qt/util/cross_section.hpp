@@ -0,0 +1,97 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace scwx
+{
+namespace qt
+{
+namespace util
+{
+
+/**
+ * A radial of 8-bit or 16-bit data moments
+ */
+struct CrossSectionRadial
+{
+   const void*   moments_;        // Data moments, one per gate
+   std::uint8_t  wordSize_;       // Data word size (8 or 16)
+   std::int32_t  firstGateRange_; // Range to the start of the first gate (m)
+   std::int32_t  interval_;       // Gate interval (m)
+   std::int32_t  gates_;          // Number of gates
+   std::uint16_t snrThreshold_;   // Minimum displayed data level
+};
+
+/**
+ * Beam geometry of each sweep at each column of a cross section, in sweep-major
+ * order. Heights are above the radar, and ranges are in meters.
+ */
+struct CrossSectionBeamTable
+{
+   std::vector<float> elevations_ {};
+   std::size_t        columns_ {0u};
+
+   std::vector<float> center_ {};
+   std::vector<float> bottom_ {};
+   std::vector<float> top_ {};
+   std::vector<float> slantRange_ {};
+};
+
+/**
+ * Gets the height of a beam above the radar, using the 4/3 effective earth
+ * radius model.
+ *
+ * @param [in] groundRange Ground range from the radar (meters)
+ * @param [in] elevation Beam elevation (degrees)
+ *
+ * @return Beam height (meters)
+ */
+double GetBeamHeight(double groundRange, double elevation);
+
+/**
+ * Gets the slant range along a beam to a ground range, using the 4/3 effective
+ * earth radius model.
+ *
+ * @param [in] groundRange Ground range from the radar (meters)
+ * @param [in] elevation Beam elevation (degrees)
+ *
+ * @return Slant range (meters)
+ */
+double GetBeamSlantRange(double groundRange, double elevation);
+
+/**
+ * Updates the beam center, bottom, top and slant range of each sweep at each
+ * column. The table is unchanged if the elevations and number of columns are
+ * unchanged.
+ *
+ * @param [in] elevations Elevation of each sweep (degrees)
+ * @param [in] groundRanges Ground range of each column (meters)
+ * @param [in,out] table Beam table
+ */
+void UpdateCrossSectionBeamTable(const std::vector<float>&  elevations,
+                                 const std::vector<double>& groundRanges,
+                                 CrossSectionBeamTable&     table);
+
+/**
+ * Samples a sweep at each column of a cross section. Levels below the SNR
+ * threshold are set to 0, and range folded levels are kept.
+ *
+ * @param [in] radials Radials of the sweep
+ * @param [in] radialLookup Radial index of each azimuth bin, or -1 if there is
+ * no radial
+ * @param [in] azimuthBins Azimuth bin of each column
+ * @param [in] slantRanges Slant range of the sweep at each column (meters)
+ * @param [out] levels Sampled data level of each column
+ */
+void SampleCrossSectionSweep(const std::vector<CrossSectionRadial>& radials,
+                             const std::vector<std::int16_t>& radialLookup,
+                             std::span<const std::uint16_t>   azimuthBins,
+                             std::span<const float>           slantRanges,
+                             std::vector<std::uint16_t>&      levels);
+
+} // namespace util
+} // namespace qt
+} // namespace scwx
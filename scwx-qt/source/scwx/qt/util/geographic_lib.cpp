@@ -1,9 +1,12 @@
 #include <scwx/qt/util/geographic_lib.hpp>
 #include <scwx/util/logger.hpp>
 
+#include <algorithm>
+#include <execution>
 #include <numbers>
 
 #include <GeographicLib/Gnomonic.hpp>
+#include <boost/range/irange.hpp>
 #include <geos/algorithm/PointLocation.h>
 #include <geos/operation/distance/DistanceOp.h>
 #include <geos/geom/CoordinateSequence.h>
@@ -21,6 +24,27 @@ namespace GeographicLib
 static const std::string logPrefix_ = "scwx::qt::util::geographic_lib";
 static const auto        logger_    = scwx::util::Logger::Create(logPrefix_);
 
+// Spacing of the exactly solved knots along each geodesic
+static constexpr double kKnotSpacing_ = 50000.0; // meters
+
+struct GeodesicKnot
+{
+   double latitude_;
+   double longitude_;
+   double dLatitude_;  // Derivative of latitude with distance (degrees/meter)
+   double dLongitude_; // Derivative of longitude with distance (degrees/meter)
+};
+
+static GeodesicKnot GetGeodesicKnot(const ::GeographicLib::GeodesicLine& line,
+                                    double                               s12);
+template<typename T>
+static void GetCoordinatesImpl(double                 latitude,
+                               double                 longitude,
+                               std::span<const float> azimuths,
+                               std::span<const float> ranges,
+                               std::span<T>           coordinates,
+                               std::size_t            stride);
+
 const ::GeographicLib::Geodesic& DefaultGeodesic()
 {
    static const ::GeographicLib::Geodesic geodesic_ {
@@ -170,6 +194,177 @@ common::Coordinate GetCoordinate(const common::Coordinate& center,
    return {latitude, longitude};
 }
 
+void GetCoordinates(double                 latitude,
+                    double                 longitude,
+                    std::span<const float> azimuths,
+                    std::span<const float> ranges,
+                    std::span<float>       coordinates,
+                    std::size_t            stride)
+{
+   GetCoordinatesImpl(
+      latitude, longitude, azimuths, ranges, coordinates, stride);
+}
+
+void GetCoordinates(double                 latitude,
+                    double                 longitude,
+                    std::span<const float> azimuths,
+                    std::span<const float> ranges,
+                    std::span<double>      coordinates,
+                    std::size_t            stride)
+{
+   GetCoordinatesImpl(
+      latitude, longitude, azimuths, ranges, coordinates, stride);
+}
+
+template<typename T>
+static void GetCoordinatesImpl(double                 latitude,
+                               double                 longitude,
+                               std::span<const float> azimuths,
+                               std::span<const float> ranges,
+                               std::span<T>           coordinates,
+                               std::size_t            stride)
+{
+   if (azimuths.empty() || ranges.empty())
+   {
+      return;
+   }
+
+   if (stride < ranges.size() * 2 ||
+       coordinates.size() < (azimuths.size() - 1) * stride + ranges.size() * 2)
+   {
+      logger_->error("Coordinate buffer is too small");
+      return;
+   }
+
+   const double maxRange =
+      std::max(0.0f, *std::max_element(ranges.begin(), ranges.end()));
+   const std::size_t numIntervals = std::max<std::size_t>(
+      1u, static_cast<std::size_t>(std::ceil(maxRange / kKnotSpacing_)));
+
+   // Interpolation only reduces work when there are more ranges than knots
+   const bool interpolate = (numIntervals + 1 < ranges.size());
+
+   constexpr unsigned kLineCaps = ::GeographicLib::GeodesicLine::LATITUDE |
+                                  ::GeographicLib::GeodesicLine::LONGITUDE |
+                                  ::GeographicLib::GeodesicLine::AZIMUTH |
+                                  ::GeographicLib::GeodesicLine::DISTANCE_IN;
+
+   auto radials = boost::irange<std::size_t>(0u, azimuths.size());
+
+   std::for_each(
+      std::execution::par,
+      radials.begin(),
+      radials.end(),
+      [&](std::size_t radial)
+      {
+         T* const output = coordinates.data() + radial * stride;
+
+         const ::GeographicLib::GeodesicLine line = DefaultGeodesic().Line(
+            latitude, longitude, azimuths[radial], kLineCaps);
+
+         if (!interpolate)
+         {
+            for (std::size_t i = 0; i < ranges.size(); ++i)
+            {
+               double lat2;
+               double lon2;
+               line.Position(ranges[i], lat2, lon2);
+
+               output[i * 2]     = static_cast<T>(lat2);
+               output[i * 2 + 1] = static_cast<T>(lon2);
+            }
+            return;
+         }
+
+         std::vector<GeodesicKnot> knots(numIntervals + 1);
+         for (std::size_t k = 0; k <= numIntervals; ++k)
+         {
+            knots[k] = GetGeodesicKnot(line, k * kKnotSpacing_);
+         }
+
+         for (std::size_t i = 0; i < ranges.size(); ++i)
+         {
+            const double u = std::max(0.0f, ranges[i]) / kKnotSpacing_;
+            const std::size_t k =
+               std::min(static_cast<std::size_t>(u), numIntervals - 1);
+            const double t = u - static_cast<double>(k);
+
+            const GeodesicKnot& k0 = knots[k];
+            const GeodesicKnot& k1 = knots[k + 1];
+
+            // Cubic Hermite basis functions, with tangents scaled by the knot
+            // spacing
+            const double t2  = t * t;
+            const double t3  = t2 * t;
+            const double h00 = 2.0 * t3 - 3.0 * t2 + 1.0;
+            const double h10 = (t3 - 2.0 * t2 + t) * kKnotSpacing_;
+            const double h01 = -2.0 * t3 + 3.0 * t2;
+            const double h11 = (t3 - t2) * kKnotSpacing_;
+
+            const double lat2 = h00 * k0.latitude_ + h10 * k0.dLatitude_ +
+                                h01 * k1.latitude_ + h11 * k1.dLatitude_;
+            double lon2 = h00 * k0.longitude_ + h10 * k0.dLongitude_ +
+                          h01 * k1.longitude_ + h11 * k1.dLongitude_;
+
+            // Knot longitudes are unrolled, so normalize to [-180, 180]
+            if (lon2 > 180.0)
+            {
+               lon2 -= 360.0;
+            }
+            else if (lon2 < -180.0)
+            {
+               lon2 += 360.0;
+            }
+
+            output[i * 2]     = static_cast<T>(lat2);
+            output[i * 2 + 1] = static_cast<T>(lon2);
+         }
+      });
+}
+
+static GeodesicKnot GetGeodesicKnot(const ::GeographicLib::GeodesicLine& line,
+                                    double                               s12)
+{
+   constexpr double kDegreesPerRadian = 180.0 / std::numbers::pi;
+
+   double lat2;
+   double lon2;
+   double azi2;
+   double unused;
+
+   // Unroll the longitude, so it is continuous along the geodesic
+   line.GenPosition(false,
+                    s12,
+                    ::GeographicLib::GeodesicLine::LATITUDE |
+                       ::GeographicLib::GeodesicLine::LONGITUDE |
+                       ::GeographicLib::GeodesicLine::AZIMUTH |
+                       ::GeographicLib::GeodesicLine::LONG_UNROLL,
+                    lat2,
+                    lon2,
+                    azi2,
+                    unused,
+                    unused,
+                    unused,
+                    unused,
+                    unused);
+
+   // Meridional and prime vertical radii of curvature at the knot
+   const double a      = line.EquatorialRadius();
+   const double f      = line.Flattening();
+   const double e2     = f * (2.0 - f);
+   const double phi    = lat2 / kDegreesPerRadian;
+   const double alpha  = azi2 / kDegreesPerRadian;
+   const double sinPhi = std::sin(phi);
+   const double w2     = 1.0 - e2 * sinPhi * sinPhi;
+   const double n      = a / std::sqrt(w2);
+   const double m      = n * (1.0 - e2) / w2;
+
+   return {lat2,
+           lon2,
+           std::cos(alpha) / m * kDegreesPerRadian,
+           std::sin(alpha) / (n * std::cos(phi)) * kDegreesPerRadian};
+}
+
 units::length::meters<double>
 GetDistance(double lat1, double lon1, double lat2, double lon2)
 {
@@ -2,6 +2,7 @@
 
 #include <scwx/common/geographic.hpp>
 
+#include <span>
 #include <vector>
 
 #include <GeographicLib/Geodesic.hpp>
@@ -77,6 +78,53 @@ common::Coordinate GetCoordinate(const common::Coordinate& center,
                                  units::meters<double>     i,
                                  units::meters<double>     j);
 
+/**
+ * Get coordinates from polar coordinate offsets, for each combination of
+ * azimuth and range from a single center coordinate. Each geodesic is solved
+ * exactly at knots spaced 50 km apart, and interpolated between the knots
+ * with a cubic Hermite spline. The interpolation error is less than 1 cm
+ * within 500 km of the center. If there are fewer ranges than knots, each
+ * coordinate is solved exactly.
+ *
+ * @param [in] latitude Latitude of the center coordinate (degrees)
+ * @param [in] longitude Longitude of the center coordinate (degrees)
+ * @param [in] azimuths Azimuth of each geodesic (degrees)
+ * @param [in] ranges Non-negative distances along each geodesic (meters)
+ * @param [out] coordinates Interleaved latitude and longitude of each offset
+ * coordinate (degrees), with the coordinates of each azimuth beginning at a
+ * multiple of the stride
+ * @param [in] stride Offset between the coordinates of consecutive azimuths,
+ * at least twice the number of ranges
+ */
+void GetCoordinates(double                 latitude,
+                    double                 longitude,
+                    std::span<const float> azimuths,
+                    std::span<const float> ranges,
+                    std::span<float>       coordinates,
+                    std::size_t            stride);
+
+/**
+ * Get coordinates from polar coordinate offsets, for each combination of
+ * azimuth and range from a single center coordinate, in double precision.
+ * Interpolation is performed as in the single precision overload.
+ *
+ * @param [in] latitude Latitude of the center coordinate (degrees)
+ * @param [in] longitude Longitude of the center coordinate (degrees)
+ * @param [in] azimuths Azimuth of each geodesic (degrees)
+ * @param [in] ranges Non-negative distances along each geodesic (meters)
+ * @param [out] coordinates Interleaved latitude and longitude of each offset
+ * coordinate (degrees), with the coordinates of each azimuth beginning at a
+ * multiple of the stride
+ * @param [in] stride Offset between the coordinates of consecutive azimuths,
+ * at least twice the number of ranges
+ */
+void GetCoordinates(double                 latitude,
+                    double                 longitude,
+                    std::span<const float> azimuths,
+                    std::span<const float> ranges,
+                    std::span<double>      coordinates,
+                    std::size_t            stride);
+
 /**
  * Get the distance between two points.
  *
@@ -1,7 +1,12 @@
 #include <scwx/qt/util/imgui.hpp>
 #include <scwx/qt/manager/font_manager.hpp>
+#include <scwx/qt/model/imgui_context_model.hpp>
 #include <scwx/util/logger.hpp>
 
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+
 #include <imgui.h>
 
 namespace scwx
@@ -17,8 +22,22 @@ static const auto        logger_    = scwx::util::Logger::Create(logPrefix_);
 class ImGui::Impl
 {
 public:
+   struct FontAtlasTexture
+   {
+      std::weak_ptr<ImFontAtlas> fontAtlas_ {};
+      GLuint                     texture_ {GL_INVALID_INDEX};
+   };
+
    explicit Impl() {}
    ~Impl() {}
+
+   GLuint CreateFontAtlasTexture(gl::OpenGLFunctions& gl,
+                                 ImFontAtlas*         fontAtlas);
+   void   DeleteExpiredTextures(gl::OpenGLFunctions& gl);
+
+   std::unordered_map<const ImFontAtlas*, FontAtlasTexture>
+              fontAtlasTextures_ {};
+   std::mutex fontAtlasTexturesMutex_ {};
 };
 
 ImGui::ImGui() : p(std::make_unique<Impl>()) {}
@@ -41,6 +60,98 @@ void ImGui::DrawTooltip(const std::string& hoverText)
    }
 }
 
+void ImGui::SelectFontAtlas(gl::OpenGLFunctions&          gl,
+                            std::shared_ptr<ImFontAtlas>& fontAtlas)
+{
+   auto latestFontAtlas = manager::FontManager::Instance().imgui_font_atlas();
+   if (latestFontAtlas == nullptr)
+   {
+      // No font atlas has been built, continue using the initial font atlas
+      return;
+   }
+
+   std::unique_lock lock {p->fontAtlasTexturesMutex_};
+
+   // Delete expired textures first, so the address of a destroyed font atlas
+   // reused by the latest font atlas is not matched
+   p->DeleteExpiredTextures(gl);
+
+   auto it = p->fontAtlasTextures_.find(latestFontAtlas.get());
+   if (it == p->fontAtlasTextures_.end())
+   {
+      it = p->fontAtlasTextures_
+              .insert_or_assign(
+                 latestFontAtlas.get(),
+                 Impl::FontAtlasTexture {
+                    latestFontAtlas,
+                    p->CreateFontAtlasTexture(gl, latestFontAtlas.get())})
+              .first;
+   }
+
+   // The ImGui backend may assign its own texture to the font atlas, so the
+   // shared texture is assigned each frame
+   ImGuiIO& io = ::ImGui::GetIO();
+   io.Fonts    = latestFontAtlas.get();
+   io.Fonts->SetTexID((ImTextureID)(std::intptr_t)it->second.texture_);
+
+   fontAtlas = std::move(latestFontAtlas);
+}
+
+void ImGui::ReleaseFontAtlas()
+{
+   ::ImGui::GetIO().Fonts = model::ImGuiContextModel::Instance().font_atlas();
+}
+
+GLuint ImGui::Impl::CreateFontAtlasTexture(gl::OpenGLFunctions& gl,
+                                           ImFontAtlas*         fontAtlas)
+{
+   logger_->debug("Uploading font atlas texture");
+
+   // The font atlas is already built, this only gets the texture data
+   unsigned char* pixels;
+   int            width;
+   int            height;
+   fontAtlas->GetTexDataAsRGBA32(&pixels, &width, &height);
+
+   GLint lastTexture;
+   gl.glGetIntegerv(GL_TEXTURE_BINDING_2D, &lastTexture);
+
+   GLuint texture;
+   gl.glGenTextures(1, &texture);
+   gl.glBindTexture(GL_TEXTURE_2D, texture);
+   gl.glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+   gl.glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+   gl.glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+   gl.glTexImage2D(GL_TEXTURE_2D,
+                   0,
+                   GL_RGBA,
+                   width,
+                   height,
+                   0,
+                   GL_RGBA,
+                   GL_UNSIGNED_BYTE,
+                   pixels);
+
+   gl.glBindTexture(GL_TEXTURE_2D, static_cast<GLuint>(lastTexture));
+
+   return texture;
+}
+
+void ImGui::Impl::DeleteExpiredTextures(gl::OpenGLFunctions& gl)
+{
+   // OpenGL contexts share textures, so any context may delete the texture
+   std::erase_if(fontAtlasTextures_,
+                 [&gl](auto& entry)
+                 {
+                    if (entry.second.fontAtlas_.expired())
+                    {
+                       gl.glDeleteTextures(1, &entry.second.texture_);
+                       return true;
+                    }
+                    return false;
+                 });
+}
+
 ImGui& ImGui::Instance()
 {
    static ImGui instance_ {};
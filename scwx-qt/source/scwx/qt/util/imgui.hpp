@@ -1,8 +1,12 @@
 #pragma once
 
+#include <scwx/qt/gl/gl.hpp>
+
 #include <memory>
 #include <string>
 
+struct ImFontAtlas;
+
 namespace scwx
 {
 namespace qt
@@ -24,6 +28,26 @@ public:
 
    void DrawTooltip(const std::string& hoverText);
 
+   /**
+    * Selects the most recently built font atlas for the current ImGui context.
+    * The texture of each font atlas is uploaded once, and shared by each
+    * OpenGL context. Textures of font atlases no longer in use are deleted.
+    * Call with the OpenGL context current, after starting a new frame with
+    * the ImGui backend, and before ImGui::NewFrame().
+    *
+    * @param [in] gl OpenGL functions
+    * @param [in,out] fontAtlas Font atlas held for the ImGui context
+    */
+   void SelectFontAtlas(gl::OpenGLFunctions&          gl,
+                        std::shared_ptr<ImFontAtlas>& fontAtlas);
+
+   /**
+    * Restores the initial font atlas of the current ImGui context. Call before
+    * shutting down the ImGui backend, so the backend does not release the
+    * shared font atlas.
+    */
+   void ReleaseFontAtlas();
+
    static ImGui& Instance();
 
 private:
@@ -0,0 +1,382 @@
+#include <scwx/qt/util/radar_mosaic.hpp>
+#include <scwx/qt/util/geographic_lib.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <execution>
+#include <limits>
+#include <numbers>
+
+#include <boost/range/irange.hpp>
+
+namespace scwx
+{
+namespace qt
+{
+namespace util
+{
+
+// Maximum range of a radar site included in the mosaic (meters)
+static constexpr double kMaxRange_ = 460'000.0;
+
+// Finest grid resolution (degrees), and maximum grid size (cells)
+static constexpr double      kGridResolution_ = 0.01;
+static constexpr std::size_t kMaxGridSize_    = 4096u;
+
+static constexpr double kMetersPerDegree_ = 111'320.0;
+
+// Cached geometry is stored in 0.1 degree azimuth and 10 meter range units
+static constexpr std::size_t  kAzimuthBins_    = 3600u;
+static constexpr double       kAzimuthScale_   = 10.0;
+static constexpr double       kRangeScale_     = 0.1;
+static constexpr std::int32_t kRangeUnit_      = 10;
+static constexpr std::int32_t kMaxRadialWidth_ = 20;
+
+// Key offset ranking range folded bins behind valid data in nearest radar
+// compositing
+static constexpr std::uint32_t kRangeFoldedKey_ = 0x10000u;
+
+static constexpr std::uint8_t RANGE_FOLDED = 1u;
+
+// Data levels below the minimum are reserved for below threshold and range
+// folded data
+static constexpr float kMinDataLevel_ = 2.0f;
+static constexpr float kMaxDataLevel_ = 255.0f;
+
+std::int32_t LatitudeToMosaicRow(double latitude, double resolution)
+{
+   return static_cast<std::int32_t>(std::floor((90.0 - latitude) / resolution));
+}
+
+std::int32_t LongitudeToMosaicColumn(double longitude, double resolution)
+{
+   return static_cast<std::int32_t>(
+      std::floor((longitude + 180.0) / resolution));
+}
+
+static double LongitudeRadius(double latitude)
+{
+   // Longitude radius at the poleward edge of the site coverage
+   const double latitudeRadius = kMaxRange_ / kMetersPerDegree_;
+   return latitudeRadius /
+          std::cos(std::min(std::abs(latitude) + latitudeRadius, 89.0) *
+                   std::numbers::pi / 180.0);
+}
+
+MosaicGrid ComputeMosaicGrid(const std::vector<common::Coordinate>& sites)
+{
+   MosaicGrid grid {};
+
+   if (sites.empty())
+   {
+      return grid;
+   }
+
+   // Determine the extent of the mosaic in degrees
+   double north = std::numeric_limits<double>::lowest();
+   double south = std::numeric_limits<double>::max();
+   double west  = std::numeric_limits<double>::max();
+   double east  = std::numeric_limits<double>::lowest();
+
+   const double latitudeRadius = kMaxRange_ / kMetersPerDegree_;
+
+   for (auto& site : sites)
+   {
+      const double longitudeRadius = LongitudeRadius(site.latitude_);
+
+      north = std::max(north, site.latitude_ + latitudeRadius);
+      south = std::min(south, site.latitude_ - latitudeRadius);
+      west  = std::min(west, site.longitude_ - longitudeRadius);
+      east  = std::max(east, site.longitude_ + longitudeRadius);
+   }
+
+   // Coarsen the resolution until the grid fits in the maximum size. The
+   // grid is aligned to a global lattice, so cached site geometry remains
+   // valid as long as the resolution does not change.
+   double resolution = kGridResolution_;
+   while (std::max(north - south, east - west) / resolution >
+          static_cast<double>(kMaxGridSize_ - 2u))
+   {
+      resolution *= 2.0;
+   }
+
+   const std::int32_t rowOrigin    = LatitudeToMosaicRow(north, resolution);
+   const std::int32_t columnOrigin = LongitudeToMosaicColumn(west, resolution);
+
+   grid.resolution_ = resolution;
+   grid.north_      = 90.0 - rowOrigin * resolution;
+   grid.west_       = columnOrigin * resolution - 180.0;
+   grid.rows_       = static_cast<std::size_t>(
+      LatitudeToMosaicRow(south, resolution) - rowOrigin + 1);
+   grid.columns_ = static_cast<std::size_t>(
+      LongitudeToMosaicColumn(east, resolution) - columnOrigin + 1);
+
+   return grid;
+}
+
+MosaicSiteGeometry ComputeMosaicSiteGeometry(const common::Coordinate& site,
+                                             double resolution)
+{
+   MosaicSiteGeometry geometry {};
+
+   const double latitude  = site.latitude_;
+   const double longitude = site.longitude_;
+
+   const double latitudeRadius  = kMaxRange_ / kMetersPerDegree_;
+   const double longitudeRadius = LongitudeRadius(latitude);
+
+   geometry.resolution_ = resolution;
+   geometry.rowOrigin_ =
+      LatitudeToMosaicRow(latitude + latitudeRadius, resolution);
+   geometry.columnOrigin_ =
+      LongitudeToMosaicColumn(longitude - longitudeRadius, resolution);
+   geometry.rows_ = static_cast<std::size_t>(
+      LatitudeToMosaicRow(latitude - latitudeRadius, resolution) -
+      geometry.rowOrigin_ + 1);
+   geometry.columns_ = static_cast<std::size_t>(
+      LongitudeToMosaicColumn(longitude + longitudeRadius, resolution) -
+      geometry.columnOrigin_ + 1);
+
+   geometry.azimuths_.resize(geometry.rows_ * geometry.columns_);
+   geometry.ranges_.resize(geometry.rows_ * geometry.columns_);
+
+   auto rows = boost::irange<std::size_t>(0u, geometry.rows_);
+
+   std::for_each(
+      std::execution::par,
+      rows.begin(),
+      rows.end(),
+      [&](std::size_t row)
+      {
+         const double cellLatitude =
+            90.0 - (geometry.rowOrigin_ + static_cast<double>(row) + 0.5) *
+                      resolution;
+         const std::size_t rowOffset = row * geometry.columns_;
+
+         for (std::size_t column = 0; column < geometry.columns_; ++column)
+         {
+            const double cellLongitude =
+               (geometry.columnOrigin_ + static_cast<double>(column) + 0.5) *
+                  resolution -
+               180.0;
+
+            double s12;  // Distance (meters)
+            double azi1; // Azimuth (degrees)
+            double azi2; // Unused
+            GeographicLib::DefaultGeodesic().Inverse(latitude,
+                                                     longitude,
+                                                     cellLatitude,
+                                                     cellLongitude,
+                                                     s12,
+                                                     azi1,
+                                                     azi2);
+
+            if (std::isnan(azi1) || s12 >= kMaxRange_)
+            {
+               geometry.ranges_[rowOffset + column] =
+                  MosaicSiteGeometry::kInvalidRange_;
+               continue;
+            }
+
+            // Azimuth is returned as [-180, 180) from the geodesic inverse
+            if (azi1 < 0.0)
+            {
+               azi1 += 360.0;
+            }
+
+            geometry.azimuths_[rowOffset + column] = static_cast<std::uint16_t>(
+               static_cast<std::size_t>(azi1 * kAzimuthScale_) % kAzimuthBins_);
+            geometry.ranges_[rowOffset + column] =
+               static_cast<std::uint16_t>(s12 * kRangeScale_);
+         }
+      });
+
+   return geometry;
+}
+
+std::vector<std::uint8_t>
+ResampleMosaicSweep(const MosaicSiteGeometry&        geometry,
+                    const std::vector<MosaicRadial>& radials,
+                    const MosaicDataScale&           dataScale)
+{
+   std::vector<std::uint8_t> levels {};
+
+   if (radials.empty())
+   {
+      return levels;
+   }
+
+   // Build the radial lookup by azimuth. Each radial is assigned the azimuth
+   // bins from its start to the start of the next radial.
+   std::vector<std::int16_t> radialLookup(kAzimuthBins_, -1);
+
+   for (std::size_t i = 0; i < radials.size(); ++i)
+   {
+      const MosaicRadial& next = radials[(i + 1) % radials.size()];
+
+      const std::int32_t startBin =
+         static_cast<std::int32_t>(radials[i].azimuth_ * kAzimuthScale_);
+      std::int32_t endBin =
+         static_cast<std::int32_t>(next.azimuth_ * kAzimuthScale_);
+
+      if (endBin < startBin)
+      {
+         endBin += static_cast<std::int32_t>(kAzimuthBins_);
+      }
+      endBin = std::clamp(endBin, startBin + 1, startBin + kMaxRadialWidth_);
+
+      for (std::int32_t bin = startBin; bin < endBin; ++bin)
+      {
+         radialLookup[static_cast<std::size_t>(bin) % kAzimuthBins_] =
+            static_cast<std::int16_t>(i);
+      }
+   }
+
+   // Sample the sweep at each grid cell
+   levels.resize(geometry.rows_ * geometry.columns_);
+
+   auto rows = boost::irange<std::size_t>(0u, geometry.rows_);
+
+   std::for_each(
+      std::execution::par,
+      rows.begin(),
+      rows.end(),
+      [&](std::size_t row)
+      {
+         const std::size_t rowOffset = row * geometry.columns_;
+
+         for (std::size_t i = rowOffset; i < rowOffset + geometry.columns_;
+              ++i)
+         {
+            std::uint8_t level = 0u;
+
+            const std::int16_t radialIndex =
+               radialLookup[geometry.azimuths_[i]];
+
+            if (geometry.ranges_[i] != MosaicSiteGeometry::kInvalidRange_ &&
+                radialIndex >= 0)
+            {
+               const MosaicRadial& radial = radials[radialIndex];
+
+               const std::int32_t gate =
+                  (geometry.ranges_[i] * kRangeUnit_ + kRangeUnit_ / 2 -
+                   radial.firstGateRange_) /
+                  radial.interval_;
+
+               if (gate >= 0 && gate < radial.gates_)
+               {
+                  const std::uint16_t rawLevel =
+                     (radial.wordSize_ == 8) ?
+                        static_cast<const std::uint8_t*>(
+                           radial.moments_)[gate] :
+                        static_cast<const std::uint16_t*>(
+                           radial.moments_)[gate];
+
+                  if (rawLevel == RANGE_FOLDED)
+                  {
+                     level = RANGE_FOLDED;
+                  }
+                  else if (rawLevel >= radial.snrThreshold_)
+                  {
+                     // Convert the site's data level to the common data scale
+                     const float value =
+                        (rawLevel - radial.offset_) / radial.scale_;
+                     level = static_cast<std::uint8_t>(
+                        std::clamp(std::round(value * dataScale.scale_ +
+                                              dataScale.offset_),
+                                   kMinDataLevel_,
+                                   kMaxDataLevel_));
+                  }
+               }
+            }
+
+            levels[i] = level;
+         }
+      });
+
+   return levels;
+}
+
+void CompositeMosaic(const MosaicGrid&                    grid,
+                     const std::vector<MosaicSiteLevels>& sites,
+                     MosaicCompositing                    compositing,
+                     std::vector<std::uint8_t>&           levels,
+                     std::vector<std::uint32_t>&          keys)
+{
+   const std::int32_t gridRowOrigin = LatitudeToMosaicRow(
+      grid.north_ - grid.resolution_ * 0.5, grid.resolution_);
+   const std::int32_t gridColumnOrigin = LongitudeToMosaicColumn(
+      grid.west_ + grid.resolution_ * 0.5, grid.resolution_);
+
+   levels.assign(grid.rows_ * grid.columns_, 0u);
+
+   if (compositing == MosaicCompositing::NearestRadar)
+   {
+      keys.assign(grid.rows_ * grid.columns_,
+                  std::numeric_limits<std::uint32_t>::max());
+   }
+
+   for (auto& site : sites)
+   {
+      const MosaicSiteGeometry&        geometry   = *site.geometry_;
+      const std::vector<std::uint8_t>& siteLevels = *site.levels_;
+
+      if (siteLevels.empty())
+      {
+         continue;
+      }
+
+      const std::size_t rowOffset =
+         static_cast<std::size_t>(geometry.rowOrigin_ - gridRowOrigin);
+      const std::size_t columnOffset =
+         static_cast<std::size_t>(geometry.columnOrigin_ - gridColumnOrigin);
+
+      auto rows = boost::irange<std::size_t>(0u, geometry.rows_);
+
+      // Each row of the site maps to a distinct row of the grid
+      std::for_each(
+         std::execution::par,
+         rows.begin(),
+         rows.end(),
+         [&](std::size_t row)
+         {
+            const std::size_t siteOffset = row * geometry.columns_;
+            const std::size_t gridOffset =
+               (rowOffset + row) * grid.columns_ + columnOffset;
+
+            for (std::size_t column = 0; column < geometry.columns_; ++column)
+            {
+               const std::uint8_t level = siteLevels[siteOffset + column];
+
+               if (level == 0u)
+               {
+                  continue;
+               }
+
+               const std::size_t cell = gridOffset + column;
+
+               if (compositing == MosaicCompositing::Maximum)
+               {
+                  levels[cell] = std::max(levels[cell], level);
+               }
+               else
+               {
+                  // Prefer the nearest radar with valid data
+                  const std::uint32_t key =
+                     geometry.ranges_[siteOffset + column] +
+                     (level == RANGE_FOLDED ? kRangeFoldedKey_ : 0u);
+
+                  if (key < keys[cell])
+                  {
+                     keys[cell]   = key;
+                     levels[cell] = level;
+                  }
+               }
+            }
+         });
+   }
+}
+
+} // namespace util
+} // namespace qt
+} // namespace scwx
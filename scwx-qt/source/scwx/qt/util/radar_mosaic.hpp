@@ -0,0 +1,170 @@
+#pragma once
+
+#include <scwx/common/geographic.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace scwx
+{
+namespace qt
+{
+namespace util
+{
+
+enum class MosaicCompositing
+{
+   NearestRadar,
+   Maximum
+};
+
+/**
+ * Equirectangular grid. Cell (row, column) is centered at latitude north_ -
+ * (row + 0.5) * resolution_ and longitude west_ + (column + 0.5) *
+ * resolution_. Grids are aligned to a global lattice of the same resolution.
+ */
+struct MosaicGrid
+{
+   double      north_ {0.0};
+   double      west_ {0.0};
+   double      resolution_ {0.0};
+   std::size_t rows_ {0u};
+   std::size_t columns_ {0u};
+
+   bool operator==(const MosaicGrid&) const = default;
+};
+
+/**
+ * Scale and offset of mosaic data levels. A data level is converted to a data
+ * value as (level - offset_) / scale_.
+ */
+struct MosaicDataScale
+{
+   float scale_ {1.0f};
+   float offset_ {0.0f};
+
+   bool operator==(const MosaicDataScale&) const = default;
+};
+
+/**
+ * Extent of a radar site on the global grid lattice, with the azimuth and
+ * range of each cell in the extent from the radar site.
+ */
+struct MosaicSiteGeometry
+{
+   static constexpr std::uint16_t kInvalidRange_ = 0xffffu;
+
+   double       resolution_ {0.0};
+   std::int32_t rowOrigin_ {0};
+   std::int32_t columnOrigin_ {0};
+   std::size_t  rows_ {0u};
+   std::size_t  columns_ {0u};
+
+   // Azimuth of each cell in 0.1 degree units, and range of each cell in 10
+   // meter units. Cells beyond the maximum range have an invalid range.
+   std::vector<std::uint16_t> azimuths_ {};
+   std::vector<std::uint16_t> ranges_ {};
+};
+
+/**
+ * A radial of 8-bit or 16-bit data moments. The radial extends from its
+ * azimuth to the azimuth of the next radial.
+ */
+struct MosaicRadial
+{
+   float         azimuth_;        // Degrees
+   const void*   moments_;        // Data moments, one per gate
+   std::size_t   wordSize_;       // Data word size (8 or 16)
+   float         scale_;          // Data moment scale
+   float         offset_;         // Data moment offset
+   std::int32_t  firstGateRange_; // Range to the start of the first gate (m)
+   std::int32_t  interval_;       // Gate interval (m)
+   std::int32_t  gates_;          // Number of gates
+   std::uint16_t snrThreshold_;   // Minimum displayed data level
+};
+
+/**
+ * Data levels of a radar site resampled onto its extent
+ */
+struct MosaicSiteLevels
+{
+   const MosaicSiteGeometry*        geometry_;
+   const std::vector<std::uint8_t>* levels_;
+};
+
+/**
+ * Gets the row of the global grid lattice containing a latitude.
+ *
+ * @param [in] latitude Latitude (degrees)
+ * @param [in] resolution Grid resolution (degrees)
+ *
+ * @return Lattice row
+ */
+std::int32_t LatitudeToMosaicRow(double latitude, double resolution);
+
+/**
+ * Gets the column of the global grid lattice containing a longitude.
+ *
+ * @param [in] longitude Longitude (degrees)
+ * @param [in] resolution Grid resolution (degrees)
+ *
+ * @return Lattice column
+ */
+std::int32_t LongitudeToMosaicColumn(double longitude, double resolution);
+
+/**
+ * Computes a grid covering the coverage of each radar site. The resolution is
+ * coarsened until the grid fits in the maximum grid size.
+ *
+ * @param [in] sites Radar site locations
+ *
+ * @return Mosaic grid, or an empty grid if there are no sites
+ */
+MosaicGrid ComputeMosaicGrid(const std::vector<common::Coordinate>& sites);
+
+/**
+ * Computes the azimuth and range of each cell in the coverage of a radar site.
+ *
+ * @param [in] site Radar site location
+ * @param [in] resolution Grid resolution (degrees)
+ *
+ * @return Site geometry
+ */
+MosaicSiteGeometry ComputeMosaicSiteGeometry(const common::Coordinate& site,
+                                             double resolution);
+
+/**
+ * Resamples the radials of a sweep onto the extent of a radar site. Data
+ * levels are converted to a common data scale. Level 0 is below threshold,
+ * and level 1 is range folded.
+ *
+ * @param [in] geometry Site geometry
+ * @param [in] radials Radials of the sweep, ordered by azimuth
+ * @param [in] dataScale Common data scale
+ *
+ * @return Data levels of each cell, or empty if there are no radials
+ */
+std::vector<std::uint8_t>
+ResampleMosaicSweep(const MosaicSiteGeometry&        geometry,
+                    const std::vector<MosaicRadial>& radials,
+                    const MosaicDataScale&           dataScale);
+
+/**
+ * Composites the data levels of each radar site onto a grid.
+ *
+ * @param [in] grid Mosaic grid, containing the extent of each site
+ * @param [in] sites Data levels of each site
+ * @param [in] compositing Compositing method
+ * @param [out] levels Composited data levels, in row-major order
+ * @param [out] keys Working buffer for nearest radar compositing
+ */
+void CompositeMosaic(const MosaicGrid&                    grid,
+                     const std::vector<MosaicSiteLevels>& sites,
+                     MosaicCompositing                    compositing,
+                     std::vector<std::uint8_t>&           levels,
+                     std::vector<std::uint32_t>&          keys);
+
+} // namespace util
+} // namespace qt
+} // namespace scwx
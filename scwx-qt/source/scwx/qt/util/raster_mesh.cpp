@@ -0,0 +1,104 @@
+#include <scwx/qt/util/raster_mesh.hpp>
+#include <scwx/qt/util/geographic_lib.hpp>
+
+#include <algorithm>
+#include <execution>
+
+#include <boost/range/irange.hpp>
+
+namespace scwx
+{
+namespace qt
+{
+namespace util
+{
+
+static constexpr std::size_t kVerticesPerCell_ = 6u;
+static constexpr std::size_t kValuesPerVertex_ = 2u;
+
+RasterMesh GenerateRasterMesh(const common::Coordinate& center,
+                              const RasterGrid&         grid,
+                              std::size_t               meshSize)
+{
+   RasterMesh mesh {};
+
+   const std::size_t maxCells = std::max<std::size_t>(meshSize, 1u);
+
+   mesh.meshColumns_ = std::min(maxCells, grid.columns_);
+   mesh.meshRows_    = std::min(maxCells, grid.rows_);
+
+   if (mesh.meshColumns_ == 0 || mesh.meshRows_ == 0)
+   {
+      return mesh;
+   }
+
+   const std::size_t cornerColumns = mesh.meshColumns_ + 1;
+   const std::size_t numCorners    = cornerColumns * (mesh.meshRows_ + 1);
+
+   const double gridWidth =
+      grid.xResolution_ * static_cast<double>(grid.columns_);
+   const double gridHeight =
+      grid.yResolution_ * static_cast<double>(grid.rows_);
+
+   // Calculate the location of each mesh corner
+   std::vector<common::Coordinate> corners(numCorners);
+   auto cornerRange = boost::irange<std::size_t>(0u, numCorners);
+
+   std::for_each(
+      std::execution::par_unseq,
+      cornerRange.begin(),
+      cornerRange.end(),
+      [&](std::size_t index)
+      {
+         const std::size_t col = index % cornerColumns;
+         const std::size_t row = index / cornerColumns;
+
+         const double s = static_cast<double>(col) / mesh.meshColumns_;
+         const double t = static_cast<double>(row) / mesh.meshRows_;
+
+         const double i = grid.iStart_ + gridWidth * s;
+         const double j = grid.jStart_ - gridHeight * t;
+
+         corners[index] = GeographicLib::GetCoordinate(
+            center, units::meters<double> {i}, units::meters<double> {j});
+      });
+
+   // Emit two triangles per mesh cell
+   const std::size_t numVertices =
+      mesh.meshColumns_ * mesh.meshRows_ * kVerticesPerCell_;
+
+   mesh.vertices_.reserve(numVertices * kValuesPerVertex_);
+   mesh.textureCoordinates_.reserve(numVertices * kValuesPerVertex_);
+
+   auto AddVertex = [&](std::size_t col, std::size_t row)
+   {
+      const common::Coordinate& coordinate = corners[row * cornerColumns + col];
+
+      mesh.vertices_.push_back(static_cast<float>(coordinate.latitude_));
+      mesh.vertices_.push_back(static_cast<float>(coordinate.longitude_));
+      mesh.textureCoordinates_.push_back(static_cast<float>(col) /
+                                         mesh.meshColumns_);
+      mesh.textureCoordinates_.push_back(static_cast<float>(row) /
+                                         mesh.meshRows_);
+   };
+
+   for (std::size_t row = 0; row < mesh.meshRows_; ++row)
+   {
+      for (std::size_t col = 0; col < mesh.meshColumns_; ++col)
+      {
+         AddVertex(col, row);
+         AddVertex(col + 1, row);
+         AddVertex(col, row + 1);
+
+         AddVertex(col, row + 1);
+         AddVertex(col + 1, row + 1);
+         AddVertex(col + 1, row);
+      }
+   }
+
+   return mesh;
+}
+
+} // namespace util
+} // namespace qt
+} // namespace scwx
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <scwx/common/geographic.hpp>
+
+#include <cstddef>
+#include <vector>
+
+namespace scwx
+{
+namespace qt
+{
+namespace util
+{
+
+/**
+ * A regular Cartesian grid of raster bins, centered on a radar site. Bin (0, 0)
+ * is the northwest corner of the grid. Columns increase to the east, and rows
+ * increase to the south.
+ */
+struct RasterGrid
+{
+   double      iStart_ {};      // Easting of the grid's west edge (meters)
+   double      jStart_ {};      // Northing of the grid's north edge (meters)
+   double      xResolution_ {}; // Width of a bin (meters)
+   double      yResolution_ {}; // Height of a bin (meters)
+   std::size_t columns_ {};
+   std::size_t rows_ {};
+};
+
+/**
+ * A coarse triangle mesh covering a raster grid. Each mesh cell is drawn as
+ * two triangles (six vertices).
+ */
+struct RasterMesh
+{
+   std::size_t meshColumns_ {};
+   std::size_t meshRows_ {};
+
+   // Latitude and longitude of each vertex
+   std::vector<float> vertices_ {};
+
+   // Texture coordinates (s, t) of each vertex, where (0, 0) is the northwest
+   // corner of the grid and (1, 1) is the southeast corner
+   std::vector<float> textureCoordinates_ {};
+};
+
+/**
+ * Generate a coarse, geodesically corrected mesh for a raster grid. Each mesh
+ * vertex is placed at its exact geodesic location, and the raster is sampled
+ * as a texture between vertices. The mesh is no finer than the grid itself.
+ *
+ * @param [in] center Radar site location
+ * @param [in] grid Raster grid, relative to the radar site
+ * @param [in] meshSize Maximum number of mesh cells along each axis
+ *
+ * @return Raster mesh
+ */
+RasterMesh GenerateRasterMesh(const common::Coordinate& center,
+                              const RasterGrid&         grid,
+                              std::size_t               meshSize = 32u);
+
+} // namespace util
+} // namespace qt
+} // namespace scwx
@@ -0,0 +1,78 @@
+#include <scwx/qt/util/storm_relative_velocity.hpp>
+
+#include <algorithm>
+#include <execution>
+#include <limits>
+
+namespace scwx
+{
+namespace qt
+{
+namespace util
+{
+
+static constexpr std::uint16_t kBelowThreshold_ = 0u;
+static constexpr std::uint16_t kRangeFolded_    = 1u;
+
+template<typename T>
+static void ShiftDataLevelsT(const T*      source,
+                             T*            destination,
+                             std::size_t   count,
+                             std::int32_t  offset,
+                             std::uint16_t threshold)
+{
+   constexpr std::uint16_t kMaxLevel = std::numeric_limits<T>::max();
+
+   threshold = std::min(threshold, kMaxLevel);
+
+   std::transform(std::execution::unseq,
+                  source,
+                  source + count,
+                  destination,
+                  [=](T level) -> T
+                  {
+                     return static_cast<T>(
+                        ShiftDataLevel(level, offset, threshold, kMaxLevel));
+                  });
+}
+
+std::uint16_t ShiftDataLevel(std::uint16_t level,
+                             std::int32_t  offset,
+                             std::uint16_t threshold,
+                             std::uint16_t maxLevel)
+{
+   if (level == kRangeFolded_)
+   {
+      return level;
+   }
+
+   if (level < threshold)
+   {
+      return kBelowThreshold_;
+   }
+
+   return static_cast<std::uint16_t>(std::clamp<std::int32_t>(
+      level - offset, threshold, std::max(threshold, maxLevel)));
+}
+
+void ShiftDataLevels(const std::uint8_t* source,
+                     std::uint8_t*       destination,
+                     std::size_t         count,
+                     std::int32_t        offset,
+                     std::uint16_t       threshold)
+{
+   ShiftDataLevelsT(source, destination, count, offset, threshold);
+}
+
+void ShiftDataLevels(const std::uint16_t* source,
+                     std::uint16_t*       destination,
+                     std::size_t          count,
+                     std::int32_t         offset,
+                     std::uint16_t        threshold)
+{
+   ShiftDataLevelsT(source, destination, count, offset, threshold);
+}
+
+} // namespace util
+} // namespace qt
+} // namespace scwx
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace scwx
+{
+namespace qt
+{
+namespace util
+{
+
+/**
+ * Shifts a velocity data level by the component of the storm motion along the
+ * radial. Range folded levels are unchanged. Levels below the display
+ * threshold are mapped to the below threshold level, so they remain hidden
+ * after the shift. Other levels are clamped to [threshold, maxLevel], so they
+ * remain displayed.
+ *
+ * @param [in] level Velocity data level
+ * @param [in] offset Storm motion along the radial, in data level units
+ * @param [in] threshold Display threshold of the moment data (minimum of 2)
+ * @param [in] maxLevel Maximum data level of the moment data word size
+ *
+ * @return Storm relative velocity data level
+ */
+std::uint16_t ShiftDataLevel(std::uint16_t level,
+                             std::int32_t  offset,
+                             std::uint16_t threshold,
+                             std::uint16_t maxLevel);
+
+/**
+ * Shifts the velocity data levels of a radial. See ShiftDataLevel.
+ *
+ * @param [in] source Velocity data levels
+ * @param [out] destination Storm relative velocity data levels
+ * @param [in] count Number of data levels
+ * @param [in] offset Storm motion along the radial, in data level units
+ * @param [in] threshold Display threshold of the moment data (minimum of 2)
+ */
+void ShiftDataLevels(const std::uint8_t* source,
+                     std::uint8_t*       destination,
+                     std::size_t         count,
+                     std::int32_t        offset,
+                     std::uint16_t       threshold);
+void ShiftDataLevels(const std::uint16_t* source,
+                     std::uint16_t*       destination,
+                     std::size_t          count,
+                     std::int32_t         offset,
+                     std::uint16_t        threshold);
+
+} // namespace util
+} // namespace qt
+} // namespace scwx
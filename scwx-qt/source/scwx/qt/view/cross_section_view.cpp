@@ -0,0 +1,680 @@
+#include <scwx/qt/view/cross_section_view.hpp>
+#include <scwx/qt/config/radar_site.hpp>
+#include <scwx/qt/manager/radar_product_manager.hpp>
+#include <scwx/qt/util/cross_section.hpp>
+#include <scwx/qt/util/geographic_lib.hpp>
+#include <scwx/util/logger.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <execution>
+#include <unordered_map>
+
+#include <boost/asio.hpp>
+#include <boost/range/irange.hpp>
+#include <boost/timer/timer.hpp>
+
+namespace scwx
+{
+namespace qt
+{
+namespace view
+{
+
+static const std::string logPrefix_ = "scwx::qt::view::cross_section_view";
+static const auto        logger_    = scwx::util::Logger::Create(logPrefix_);
+
+// Cross section grid
+static constexpr double      kColumnSpacing_ = 250.0; // meters
+static constexpr std::size_t kMinColumns_    = 64u;
+static constexpr std::size_t kMaxColumns_    = 1024u;
+static constexpr std::size_t kRows_          = 256u;
+static constexpr double      kMaxHeight_     = 20'000.0; // meters
+
+// Azimuth lookup in 0.1 degree bins
+static constexpr std::size_t  kAzimuthBins_    = 3600u;
+static constexpr double       kAzimuthScale_   = 10.0;
+static constexpr std::int32_t kMaxRadialWidth_ = 20;
+
+static constexpr std::uint16_t RANGE_FOLDED = 1u;
+
+static const std::unordered_map<common::Level2Product,
+                                wsr88d::rda::DataBlockType>
+   blockTypes_ {
+      {common::Level2Product::Reflectivity,
+       wsr88d::rda::DataBlockType::MomentRef},
+      {common::Level2Product::Velocity, wsr88d::rda::DataBlockType::MomentVel},
+      {common::Level2Product::SpectrumWidth,
+       wsr88d::rda::DataBlockType::MomentSw},
+      {common::Level2Product::DifferentialReflectivity,
+       wsr88d::rda::DataBlockType::MomentZdr},
+      {common::Level2Product::DifferentialPhase,
+       wsr88d::rda::DataBlockType::MomentPhi},
+      {common::Level2Product::CorrelationCoefficient,
+       wsr88d::rda::DataBlockType::MomentRho},
+      {common::Level2Product::ClutterFilterPowerRemoved,
+       wsr88d::rda::DataBlockType::MomentCfp}};
+
+struct CrossSectionSweep
+{
+   float                                       elevation_ {0.0f};
+   std::shared_ptr<wsr88d::rda::ElevationScan> elevationScan_ {nullptr};
+   std::vector<util::CrossSectionRadial>       radials_ {};
+   std::vector<std::int16_t>                   radialLookup_ {};
+
+   // Sampled levels along the path
+   std::vector<std::uint16_t> levels_ {};
+};
+
+class CrossSectionView::Impl
+{
+public:
+   explicit Impl(CrossSectionView* self) : self_ {self} {}
+   ~Impl() { threadPool_.join(); }
+
+   void ConnectRadarProductManager();
+   void DisconnectRadarProductManager();
+   void UpdateCrossSection();
+   void UpdateBeamTable();
+   void UpdatePath(const common::Coordinate& radar,
+                   const common::Coordinate& start,
+                   const common::Coordinate& end);
+
+   static void BuildSweep(CrossSectionSweep&         sweep,
+                          wsr88d::rda::DataBlockType blockType);
+   void        SampleSweep(CrossSectionSweep& sweep) const;
+   void        Interpolate(bool interpolate);
+
+   CrossSectionView* self_;
+
+   boost::asio::thread_pool threadPool_ {1u};
+   std::atomic<bool>        updatePending_ {false};
+
+   // Selection, modified by the main thread and read by the update thread
+   mutable std::mutex                            selectionMutex_ {};
+   std::shared_ptr<manager::RadarProductManager> radarProductManager_ {nullptr};
+   common::Level2Product product_ {common::Level2Product::Unknown};
+   std::chrono::system_clock::time_point selectedTime_ {};
+   common::Coordinate                    start_ {};
+   common::Coordinate                    end_ {};
+
+   // Cached geometry and sweeps, only accessed by the update thread
+   common::Coordinate pathRadar_ {};
+   common::Coordinate pathStart_ {};
+   common::Coordinate pathEnd_ {};
+   double             pathLength_ {0.0};
+   std::size_t        columns_ {0u};
+
+   std::vector<double>        groundRange_ {};
+   std::vector<std::uint16_t> azimuthBin_ {};
+
+   common::Level2Product sweepProduct_ {common::Level2Product::Unknown};
+   std::vector<CrossSectionSweep> sweeps_ {};
+
+   // Beam table for each sweep and column
+   util::CrossSectionBeamTable beamTable_ {};
+
+   std::vector<std::uint16_t> workingLevels_ {};
+
+   // Published cross section and color table
+   mutable std::mutex                     crossSectionMutex_ {};
+   std::vector<std::uint16_t>             levels_ {};
+   std::size_t                            publishedColumns_ {0u};
+   double                                 publishedLength_ {0.0};
+   std::vector<boost::gil::rgba8_pixel_t> colorTableLut_ {};
+   std::uint16_t                          colorTableMin_ {0u};
+   std::uint16_t                          colorTableMax_ {0u};
+};
+
+CrossSectionView::CrossSectionView() : p(std::make_unique<Impl>(this)) {}
+CrossSectionView::~CrossSectionView() = default;
+
+std::tuple<common::Coordinate, common::Coordinate>
+CrossSectionView::endpoints() const
+{
+   std::unique_lock lock {p->selectionMutex_};
+   return {p->start_, p->end_};
+}
+
+common::Level2Product CrossSectionView::product() const
+{
+   std::unique_lock lock {p->selectionMutex_};
+   return p->product_;
+}
+
+std::shared_ptr<manager::RadarProductManager>
+CrossSectionView::radar_product_manager() const
+{
+   std::unique_lock lock {p->selectionMutex_};
+   return p->radarProductManager_;
+}
+
+std::mutex& CrossSectionView::cross_section_mutex() const
+{
+   return p->crossSectionMutex_;
+}
+
+const std::vector<boost::gil::rgba8_pixel_t>&
+CrossSectionView::color_table_lut() const
+{
+   return p->colorTableLut_;
+}
+
+std::uint16_t CrossSectionView::color_table_min() const
+{
+   return p->colorTableMin_;
+}
+
+std::uint16_t CrossSectionView::color_table_max() const
+{
+   return p->colorTableMax_;
+}
+
+std::tuple<double, double> CrossSectionView::GetCrossSectionExtent() const
+{
+   return {p->publishedLength_, kMaxHeight_};
+}
+
+std::tuple<const std::uint16_t*, std::size_t, std::size_t>
+CrossSectionView::GetCrossSectionData() const
+{
+   if (p->levels_.empty())
+   {
+      return {nullptr, 0u, 0u};
+   }
+
+   return {p->levels_.data(), p->publishedColumns_, kRows_};
+}
+
+void CrossSectionView::set_radar_product_manager(
+   const std::shared_ptr<manager::RadarProductManager>& radarProductManager)
+{
+   std::unique_lock lock {p->selectionMutex_};
+
+   if (p->radarProductManager_ != radarProductManager)
+   {
+      p->DisconnectRadarProductManager();
+      p->radarProductManager_ = radarProductManager;
+      p->ConnectRadarProductManager();
+
+      lock.unlock();
+      Update();
+   }
+}
+
+void CrossSectionView::SetColorTable(
+   const std::vector<boost::gil::rgba8_pixel_t>& lut,
+   std::uint16_t                                 rangeMin,
+   std::uint16_t                                 rangeMax)
+{
+   std::unique_lock lock {p->crossSectionMutex_};
+
+   p->colorTableLut_ = lut;
+   p->colorTableMin_ = rangeMin;
+   p->colorTableMax_ = rangeMax;
+
+   lock.unlock();
+
+   Q_EMIT CrossSectionUpdated();
+}
+
+void CrossSectionView::SetEndpoints(const common::Coordinate& start,
+                                    const common::Coordinate& end)
+{
+   std::unique_lock lock {p->selectionMutex_};
+
+   if (!(p->start_ == start) || !(p->end_ == end))
+   {
+      p->start_ = start;
+      p->end_   = end;
+
+      lock.unlock();
+
+      Q_EMIT EndpointsChanged();
+      Update();
+   }
+}
+
+void CrossSectionView::SelectProduct(common::Level2Product product)
+{
+   std::unique_lock lock {p->selectionMutex_};
+
+   if (p->product_ != product)
+   {
+      p->product_ = product;
+
+      lock.unlock();
+      Update();
+   }
+}
+
+void CrossSectionView::SelectTime(std::chrono::system_clock::time_point time)
+{
+   std::unique_lock lock {p->selectionMutex_};
+
+   if (p->selectedTime_ != time)
+   {
+      p->selectedTime_ = time;
+
+      lock.unlock();
+      Update();
+   }
+}
+
+void CrossSectionView::Update()
+{
+   // Coalesce updates requested while an update is pending, so dragging an
+   // endpoint only computes the most recent path
+   if (!p->updatePending_.exchange(true))
+   {
+      boost::asio::post(p->threadPool_,
+                        [this]()
+                        {
+                           p->updatePending_ = false;
+
+                           try
+                           {
+                              p->UpdateCrossSection();
+                           }
+                           catch (const std::exception& ex)
+                           {
+                              logger_->error(ex.what());
+                           }
+                        });
+   }
+}
+
+void CrossSectionView::Impl::ConnectRadarProductManager()
+{
+   if (radarProductManager_ == nullptr)
+   {
+      return;
+   }
+
+   connect(radarProductManager_.get(),
+           &manager::RadarProductManager::DataReloaded,
+           self_,
+           [this](std::shared_ptr<types::RadarProductRecord> record)
+           {
+              if (record->radar_product_group() ==
+                  common::RadarProductGroup::Level2)
+              {
+                 self_->Update();
+              }
+           });
+}
+
+void CrossSectionView::Impl::DisconnectRadarProductManager()
+{
+   if (radarProductManager_ != nullptr)
+   {
+      disconnect(radarProductManager_.get(), nullptr, self_, nullptr);
+   }
+}
+
+void CrossSectionView::Impl::UpdatePath(const common::Coordinate& radar,
+                                        const common::Coordinate& start,
+                                        const common::Coordinate& end)
+{
+   if (radar == pathRadar_ && start == pathStart_ && end == pathEnd_ &&
+       columns_ > 0u)
+   {
+      return;
+   }
+
+   const auto& geodesic = util::GeographicLib::DefaultGeodesic();
+
+   double length;
+   double azimuth;
+   double azi2; // Unused
+   geodesic.Inverse(start.latitude_,
+                    start.longitude_,
+                    end.latitude_,
+                    end.longitude_,
+                    length,
+                    azimuth,
+                    azi2);
+
+   pathRadar_  = radar;
+   pathStart_  = start;
+   pathEnd_    = end;
+   pathLength_ = length;
+   columns_    = std::clamp(
+      static_cast<std::size_t>(std::ceil(length / kColumnSpacing_)),
+      kMinColumns_,
+      kMaxColumns_);
+
+   groundRange_.resize(columns_);
+   azimuthBin_.resize(columns_);
+
+   // Determine the range and azimuth from the radar of each column center
+   for (std::size_t column = 0; column < columns_; ++column)
+   {
+      const double distance =
+         length * (static_cast<double>(column) + 0.5) / columns_;
+
+      double latitude;
+      double longitude;
+      geodesic.Direct(start.latitude_,
+                      start.longitude_,
+                      azimuth,
+                      distance,
+                      latitude,
+                      longitude);
+
+      double s12;
+      double azi1;
+      geodesic.Inverse(radar.latitude_,
+                       radar.longitude_,
+                       latitude,
+                       longitude,
+                       s12,
+                       azi1,
+                       azi2);
+
+      if (azi1 < 0.0)
+      {
+         azi1 += 360.0;
+      }
+
+      groundRange_[column] = s12;
+      azimuthBin_[column]  = static_cast<std::uint16_t>(
+         static_cast<std::size_t>(azi1 * kAzimuthScale_) % kAzimuthBins_);
+   }
+
+   // Invalidate the beam table
+   beamTable_.columns_ = 0u;
+}
+
+void CrossSectionView::Impl::UpdateBeamTable()
+{
+   std::vector<float> elevations {};
+   elevations.reserve(sweeps_.size());
+   for (auto& sweep : sweeps_)
+   {
+      elevations.push_back(sweep.elevation_);
+   }
+
+   util::UpdateCrossSectionBeamTable(elevations, groundRange_, beamTable_);
+}
+
+void CrossSectionView::Impl::BuildSweep(CrossSectionSweep&         sweep,
+                                        wsr88d::rda::DataBlockType blockType)
+{
+   const auto& scan = sweep.elevationScan_;
+
+   sweep.radials_.clear();
+   sweep.radialLookup_.assign(kAzimuthBins_, -1);
+
+   for (auto it = scan->cbegin(); it != scan->cend(); ++it)
+   {
+      auto next = std::next(it);
+      if (next == scan->cend())
+      {
+         next = scan->cbegin();
+      }
+
+      auto momentData = it->second->moment_data_block(blockType);
+      if (momentData == nullptr)
+      {
+         continue;
+      }
+
+      const std::int32_t interval =
+         momentData->data_moment_range_sample_interval_raw();
+      if (interval <= 0)
+      {
+         continue;
+      }
+
+      const std::int32_t intervalH = interval / 2;
+      const std::int32_t range =
+         std::max<std::int32_t>(momentData->data_moment_range_raw(), intervalH);
+
+      sweep.radials_.push_back(
+         {momentData->data_moments(),
+          momentData->data_word_size(),
+          range - intervalH,
+          interval,
+          momentData->number_of_data_moment_gates(),
+          static_cast<std::uint16_t>(
+             std::max<std::int16_t>(2, momentData->snr_threshold_raw()))});
+
+      const auto radialIndex =
+         static_cast<std::int16_t>(sweep.radials_.size() - 1);
+
+      // Assign the azimuth bins from the start of this radial to the start of
+      // the next radial
+      const std::int32_t startBin = static_cast<std::int32_t>(
+         it->second->azimuth_angle().value() * kAzimuthScale_);
+      std::int32_t endBin = static_cast<std::int32_t>(
+         next->second->azimuth_angle().value() * kAzimuthScale_);
+
+      if (endBin < startBin)
+      {
+         endBin += static_cast<std::int32_t>(kAzimuthBins_);
+      }
+      endBin = std::clamp(endBin, startBin + 1, startBin + kMaxRadialWidth_);
+
+      for (std::int32_t bin = startBin; bin < endBin; ++bin)
+      {
+         sweep.radialLookup_[static_cast<std::size_t>(bin) % kAzimuthBins_] =
+            radialIndex;
+      }
+   }
+}
+
+void CrossSectionView::Impl::SampleSweep(CrossSectionSweep& sweep) const
+{
+   const std::size_t sweepIndex = &sweep - sweeps_.data();
+   const std::size_t offset     = sweepIndex * columns_;
+
+   util::SampleCrossSectionSweep(
+      sweep.radials_,
+      sweep.radialLookup_,
+      azimuthBin_,
+      std::span {beamTable_.slantRange_}.subspan(offset, columns_),
+      sweep.levels_);
+}
+
+void CrossSectionView::Impl::Interpolate(bool interpolate)
+{
+   workingLevels_.assign(columns_ * kRows_, 0u);
+
+   const std::vector<float>& beamCenter = beamTable_.center_;
+   const std::vector<float>& beamBottom = beamTable_.bottom_;
+   const std::vector<float>& beamTop    = beamTable_.top_;
+
+   auto columns = boost::irange<std::size_t>(0u, columns_);
+
+   std::for_each(
+      std::execution::par,
+      columns.begin(),
+      columns.end(),
+      [&](std::size_t column)
+      {
+         std::size_t s = 0;
+
+         // Iterate from the bottom row, so the bracketing sweeps only move up
+         for (std::size_t row = 0; row < kRows_; ++row)
+         {
+            const float height = static_cast<float>(
+               kMaxHeight_ * (static_cast<double>(row) + 0.5) / kRows_);
+
+            // Find the first sweep whose beam center is above the height
+            while (s < sweeps_.size() &&
+                   beamCenter[s * columns_ + column] < height)
+            {
+               ++s;
+            }
+
+            std::uint16_t level = 0u;
+
+            const bool hasBelow = (s > 0);
+            const bool hasAbove = (s < sweeps_.size());
+
+            const std::size_t below = (s - 1) * columns_ + column;
+            const std::size_t above = s * columns_ + column;
+
+            const bool inBelow = hasBelow && height <= beamTop[below];
+            const bool inAbove = hasAbove && height >= beamBottom[above];
+
+            if (inBelow &&
+                (!inAbove || height - beamCenter[below] <=
+                                beamCenter[above] - height))
+            {
+               level = sweeps_[s - 1].levels_[column];
+            }
+            else if (inAbove)
+            {
+               level = sweeps_[s].levels_[column];
+            }
+            else if (interpolate && hasBelow && hasAbove)
+            {
+               // Linearly interpolate across the gap between beams when both
+               // beams contain valid data
+               const std::uint16_t levelBelow = sweeps_[s - 1].levels_[column];
+               const std::uint16_t levelAbove = sweeps_[s].levels_[column];
+
+               if (levelBelow > RANGE_FOLDED && levelAbove > RANGE_FOLDED)
+               {
+                  const float t = (height - beamCenter[below]) /
+                                  (beamCenter[above] - beamCenter[below]);
+                  level         = static_cast<std::uint16_t>(std::lround(
+                     levelBelow + t * (static_cast<float>(levelAbove) -
+                                       static_cast<float>(levelBelow))));
+               }
+            }
+
+            // The top row is stored first
+            workingLevels_[(kRows_ - 1 - row) * columns_ + column] = level;
+         }
+      });
+}
+
+void CrossSectionView::Impl::UpdateCrossSection()
+{
+   // Take a snapshot of the selection
+   std::unique_lock selectionLock {selectionMutex_};
+
+   const auto radarProductManager = radarProductManager_;
+   const auto product             = product_;
+   const auto selectedTime        = selectedTime_;
+   const auto start               = start_;
+   const auto end                 = end_;
+
+   selectionLock.unlock();
+
+   auto blockType = blockTypes_.find(product);
+
+   if (radarProductManager == nullptr || blockType == blockTypes_.cend() ||
+       start == end)
+   {
+      std::unique_lock lock {crossSectionMutex_};
+      if (!levels_.empty())
+      {
+         levels_.clear();
+         lock.unlock();
+
+         Q_EMIT self_->CrossSectionUpdated();
+      }
+      return;
+   }
+
+   boost::timer::cpu_timer timer {};
+
+   auto radarSite = radarProductManager->radar_site();
+   if (radarSite == nullptr)
+   {
+      return;
+   }
+
+   UpdatePath({radarSite->latitude(), radarSite->longitude()}, start, end);
+
+   // Get the elevation cuts of the volume
+   auto [firstScan, firstCut, elevationCuts, foundTime] =
+      radarProductManager->GetLevel2Data(
+         blockType->second, 0.0f, selectedTime);
+
+   std::sort(elevationCuts.begin(), elevationCuts.end());
+   elevationCuts.erase(std::unique(elevationCuts.begin(), elevationCuts.end()),
+                       elevationCuts.end());
+
+   if (sweepProduct_ != product)
+   {
+      sweepProduct_ = product;
+      sweeps_.clear();
+   }
+
+   std::vector<CrossSectionSweep> sweeps(elevationCuts.size());
+
+   for (std::size_t i = 0; i < elevationCuts.size(); ++i)
+   {
+      sweeps[i].elevation_ = elevationCuts[i];
+
+      // Reuse the radial lookup of unchanged sweeps
+      auto it = std::find_if(sweeps_.begin(),
+                             sweeps_.end(),
+                             [&](const CrossSectionSweep& sweep)
+                             { return sweep.elevation_ == elevationCuts[i]; });
+      if (it != sweeps_.end())
+      {
+         sweeps[i] = std::move(*it);
+      }
+   }
+
+   sweeps_.swap(sweeps);
+
+   // Build the radial lookup of each changed sweep, in parallel across sweeps
+   std::for_each(
+      std::execution::par,
+      sweeps_.begin(),
+      sweeps_.end(),
+      [&](CrossSectionSweep& sweep)
+      {
+         auto [elevationScan, elevationCut, cuts, time] =
+            radarProductManager->GetLevel2Data(
+               blockType->second, sweep.elevation_, selectedTime);
+
+         if (elevationScan == nullptr)
+         {
+            sweep.elevationScan_ = nullptr;
+            sweep.radials_.clear();
+         }
+         else if (elevationScan != sweep.elevationScan_)
+         {
+            sweep.elevationScan_ = elevationScan;
+            BuildSweep(sweep, blockType->second);
+         }
+      });
+
+   UpdateBeamTable();
+
+   // Sample the path, in parallel across sweeps
+   std::for_each(std::execution::par,
+                 sweeps_.begin(),
+                 sweeps_.end(),
+                 [this](CrossSectionSweep& sweep) { SampleSweep(sweep); });
+
+   Interpolate(product != common::Level2Product::ClutterFilterPowerRemoved);
+
+   timer.stop();
+   logger_->trace("Cross section computed in {} ({} sweeps, {} columns)",
+                  timer.format(6, "%ws"),
+                  sweeps_.size(),
+                  columns_);
+
+   // Publish the cross section
+   std::unique_lock lock {crossSectionMutex_};
+   levels_.swap(workingLevels_);
+   publishedColumns_ = columns_;
+   publishedLength_  = pathLength_;
+   lock.unlock();
+
+   Q_EMIT self_->CrossSectionUpdated();
+}
+
+} // namespace view
+} // namespace qt
+} // namespace scwx
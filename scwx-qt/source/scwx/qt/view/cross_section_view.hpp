@@ -0,0 +1,123 @@
+#pragma once
+
+#include <scwx/common/geographic.hpp>
+#include <scwx/common/products.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <tuple>
+#include <vector>
+
+#include <QObject>
+#include <boost/gil/typedefs.hpp>
+
+namespace scwx
+{
+namespace qt
+{
+namespace manager
+{
+
+class RadarProductManager;
+
+} // namespace manager
+
+namespace view
+{
+
+/**
+ * Extracts a vertical cross section (range-height slice) of a Level 2 volume
+ * along the great-circle path between two points.
+ *
+ * The path geometry and the beam height of each elevation cut along the path
+ * are cached, so that moving an endpoint only requires resampling the path.
+ */
+class CrossSectionView : public QObject
+{
+   Q_OBJECT
+
+public:
+   explicit CrossSectionView();
+   virtual ~CrossSectionView();
+
+   std::tuple<common::Coordinate, common::Coordinate> endpoints() const;
+   common::Level2Product                              product() const;
+   std::shared_ptr<manager::RadarProductManager> radar_product_manager() const;
+
+   /**
+    * Gets the mutex protecting the cross section data and color table.
+    *
+    * @return Cross section mutex
+    */
+   std::mutex& cross_section_mutex() const;
+
+   /**
+    * Gets the color table lookup, indexed from color_table_min(). The cross
+    * section mutex must be held.
+    *
+    * @return Color table lookup
+    */
+   const std::vector<boost::gil::rgba8_pixel_t>& color_table_lut() const;
+   std::uint16_t                                 color_table_min() const;
+   std::uint16_t                                 color_table_max() const;
+
+   /**
+    * Gets the length of the cross section path, and the height of the top of
+    * the cross section above the radar. The cross section mutex must be held.
+    *
+    * @return Length and height in meters
+    */
+   std::tuple<double, double> GetCrossSectionExtent() const;
+
+   /**
+    * Gets the cross section data levels, in row-major order with the top row
+    * first. Levels of 0 are not displayed. The cross section mutex must be
+    * held while the data is accessed.
+    *
+    * @return Data levels, columns and rows
+    */
+   std::tuple<const std::uint16_t*, std::size_t, std::size_t>
+   GetCrossSectionData() const;
+
+   void set_radar_product_manager(
+      const std::shared_ptr<manager::RadarProductManager>& radarProductManager);
+
+   /**
+    * Sets the color table used to display the cross section. This is normally
+    * the color table of the radar product view displaying the same product.
+    *
+    * @param [in] lut Color table lookup
+    * @param [in] rangeMin Data level of the first lookup entry
+    * @param [in] rangeMax Data level of the last lookup entry
+    */
+   void SetColorTable(const std::vector<boost::gil::rgba8_pixel_t>& lut,
+                      std::uint16_t                                 rangeMin,
+                      std::uint16_t                                 rangeMax);
+
+   /**
+    * Sets the endpoints of the cross section path.
+    *
+    * @param [in] start Start of the path
+    * @param [in] end End of the path
+    */
+   void SetEndpoints(const common::Coordinate& start,
+                     const common::Coordinate& end);
+
+   void SelectProduct(common::Level2Product product);
+   void SelectTime(std::chrono::system_clock::time_point time);
+   void Update();
+
+signals:
+   void CrossSectionUpdated();
+   void EndpointsChanged();
+
+private:
+   class Impl;
+   std::unique_ptr<Impl> p;
+};
+
+} // namespace view
+} // namespace qt
+} // namespace scwx
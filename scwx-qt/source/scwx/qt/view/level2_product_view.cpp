@@ -1,12 +1,21 @@
 #include <scwx/qt/view/level2_product_view.hpp>
+#include <scwx/qt/view/level2_sweep_registry.hpp>
+#include <scwx/qt/settings/general_settings.hpp>
+#include <scwx/qt/settings/product_settings.hpp>
 #include <scwx/qt/settings/unit_settings.hpp>
 #include <scwx/qt/types/unit_types.hpp>
 #include <scwx/qt/util/geographic_lib.hpp>
+#include <scwx/qt/util/storm_relative_velocity.hpp>
 #include <scwx/common/characters.hpp>
 #include <scwx/common/constants.hpp>
 #include <scwx/util/logger.hpp>
 #include <scwx/util/threads.hpp>
 #include <scwx/util/time.hpp>
+#include <scwx/util/trace.hpp>
+
+#include <atomic>
+#include <deque>
+#include <numbers>
 
 #include <boost/range/irange.hpp>
 #include <boost/timer/timer.hpp>
@@ -25,16 +34,27 @@ static constexpr std::uint32_t kMaxRadialGates_ =
    common::MAX_0_5_DEGREE_RADIALS * common::MAX_DATA_MOMENT_GATES;
 static constexpr std::uint32_t kMaxCoordinates_ = kMaxRadialGates_ * 2u;
 
+static constexpr uint16_t BELOW_THRESHOLD   = 0u;
 static constexpr uint16_t RANGE_FOLDED      = 1u;
 static constexpr uint32_t VERTICES_PER_BIN  = 6u;
 static constexpr uint32_t VALUES_PER_VERTEX = 2u;
 
+// Speculatively computed sweeps held by a view
+static constexpr std::size_t kMaxPrecomputedSweeps_ = 4u;
+
+// Alternate moments precomputed at the displayed elevation
+static const std::vector<wsr88d::rda::DataBlockType> kAlternateDataBlockTypes_ {
+   wsr88d::rda::DataBlockType::MomentRef,
+   wsr88d::rda::DataBlockType::MomentVel};
+
 static const std::unordered_map<common::Level2Product,
                                 wsr88d::rda::DataBlockType>
    blockTypes_ {
       {common::Level2Product::Reflectivity,
        wsr88d::rda::DataBlockType::MomentRef},
       {common::Level2Product::Velocity, wsr88d::rda::DataBlockType::MomentVel},
+      {common::Level2Product::StormRelativeVelocity,
+       wsr88d::rda::DataBlockType::MomentVel},
       {common::Level2Product::SpectrumWidth,
        wsr88d::rda::DataBlockType::MomentSw},
       {common::Level2Product::DifferentialReflectivity,
@@ -53,6 +73,33 @@ static const std::unordered_map<common::Level2Product, std::string>
                   {common::Level2Product::CorrelationCoefficient, "%"},
                   {common::Level2Product::ClutterFilterPowerRemoved, "dB"}};
 
+/**
+ * Published sweep of a Level 2 view, including the moment data block used to
+ * derive the display threshold, and the elevation scan and storm motion used
+ * to derive the level of a bin.
+ */
+struct Level2PublishedSweep : PublishedSweep
+{
+   std::shared_ptr<wsr88d::rda::ElevationScan> elevationScan_ {};
+   std::shared_ptr<wsr88d::rda::GenericRadarData::MomentDataBlock>
+                                     momentDataBlock0_ {};
+   wsr88d::rda::DataBlockType        dataBlockType_ {};
+   std::optional<types::StormMotion> stormMotion_ {};
+};
+
+template<typename T>
+static void
+SetPublishedMoments(std::shared_ptr<const void>&                  data,
+                    std::size_t&                                  dataSize,
+                    std::size_t&                                  componentSize,
+                    const std::shared_ptr<const std::vector<T>>& moments)
+{
+   // The published data shares ownership of the moments
+   data          = std::shared_ptr<const void> {moments, moments->data()};
+   dataSize      = moments->size() * sizeof(T);
+   componentSize = sizeof(T);
+}
+
 class Level2ProductViewImpl
 {
 public:
@@ -78,41 +125,49 @@ public:
        savedScale_ {0.0f},
        savedOffset_ {0.0f}
    {
-      auto& unitSettings = settings::UnitSettings::Instance();
-
-      coordinates_.resize(kMaxCoordinates_);
-
       SetProduct(product);
-
-      otherUnitsCallbackUuid_ =
-         unitSettings.other_units().RegisterValueChangedCallback(
-            [this](const std::string& value) { UpdateOtherUnits(value); });
-      speedUnitsCallbackUuid_ =
-         unitSettings.speed_units().RegisterValueChangedCallback(
-            [this](const std::string& value) { UpdateSpeedUnits(value); });
-
-      UpdateOtherUnits(unitSettings.other_units().GetValue());
-      UpdateSpeedUnits(unitSettings.speed_units().GetValue());
    }
    ~Level2ProductViewImpl()
    {
-      auto& unitSettings = settings::UnitSettings::Instance();
-
-      unitSettings.other_units().UnregisterValueChangedCallback(
-         otherUnitsCallbackUuid_);
-      unitSettings.speed_units().UnregisterValueChangedCallback(
-         speedUnitsCallbackUuid_);
-
+      CancelPrecompute();
+      precomputeThreadPool_.join();
       threadPool_.join();
-   };
-
-   void
-   ComputeCoordinates(std::shared_ptr<wsr88d::rda::ElevationScan> radarData);
+   }
 
+   std::vector<float> ComputeCoordinates(
+      const std::shared_ptr<manager::RadarProductManager>& radarProductManager,
+      const std::shared_ptr<wsr88d::rda::ElevationScan>&   radarData);
+   std::shared_ptr<Level2Sweep> ComputeVertices(
+      const std::shared_ptr<manager::RadarProductManager>& radarProductManager,
+      const std::shared_ptr<wsr88d::rda::ElevationScan>&   radarData,
+      const std::shared_ptr<wsr88d::rda::GenericRadarData::MomentDataBlock>&
+                                 momentData0,
+      wsr88d::rda::DataBlockType dataBlockType);
+
+   void CancelPrecompute();
+   void PrecomputeSweeps(
+      const std::shared_ptr<manager::RadarProductManager>& radarProductManager,
+      std::chrono::system_clock::time_point                volumeTime,
+      float                                                elevationCut,
+      const std::vector<float>&                            elevationCuts,
+      wsr88d::rda::DataBlockType                           dataBlockType,
+      std::size_t                                          generation);
+   void SchedulePrecompute(
+      const std::shared_ptr<manager::RadarProductManager>& radarProductManager,
+      std::chrono::system_clock::time_point                volumeTime);
+
+   void ApplyStormMotion();
+   void PublishSweep();
+   std::shared_ptr<const Level2PublishedSweep> published_sweep() const;
+   std::uint16_t DisplayThreshold(
+      const wsr88d::rda::GenericRadarData::MomentDataBlock& momentData) const;
+   bool RangeFoldedDisplayed() const;
    void SetProduct(const std::string& productName);
    void SetProduct(common::Level2Product product);
-   void UpdateOtherUnits(const std::string& name);
-   void UpdateSpeedUnits(const std::string& name);
+
+   static std::tuple<float, float> StormMotionComponents(
+      const std::optional<types::StormMotion>&              stormMotion,
+      const wsr88d::rda::GenericRadarData::MomentDataBlock* momentData);
 
    Level2ProductView* self_;
 
@@ -127,11 +182,22 @@ public:
    std::shared_ptr<wsr88d::rda::GenericRadarData::MomentDataBlock>
       momentDataBlock0_;
 
-   std::vector<float>    coordinates_ {};
-   std::vector<float>    vertices_ {};
-   std::vector<uint8_t>  dataMoments8_ {};
-   std::vector<uint16_t> dataMoments16_ {};
-   std::vector<uint8_t>  cfpMoments_ {};
+   // The sweep is shared with other views of the same elevation scan
+   std::shared_ptr<const Level2Sweep> sweep_ {};
+
+   // Storm relative velocity is derived from the velocity moments of the
+   // sweep, and stored separately as the storm motion is specific to the view.
+   // The derived moments are replaced rather than modified, as they may be
+   // held by a published sweep.
+   std::optional<types::StormMotion>            stormMotion_ {};
+   std::shared_ptr<const std::vector<uint8_t>>  dataMoments8_ {};
+   std::shared_ptr<const std::vector<uint16_t>> dataMoments16_ {};
+
+   // The renderer reads the published sweep without the sweep mutex. The
+   // publish mutex is only held to exchange the pointer.
+   mutable std::mutex                          publishMutex_ {};
+   std::shared_ptr<const Level2PublishedSweep> publishedSweep_ {};
+   std::uint64_t                               publishGeneration_ {0u};
 
    float                    latitude_;
    float                    longitude_;
@@ -151,10 +217,16 @@ public:
    float                               savedScale_;
    float                               savedOffset_;
 
-   boost::uuids::uuid otherUnitsCallbackUuid_ {};
-   boost::uuids::uuid speedUnitsCallbackUuid_ {};
-   types::OtherUnits  otherUnits_ {types::OtherUnits::Unknown};
-   types::SpeedUnits  speedUnits_ {types::SpeedUnits::Unknown};
+   // Sweeps of adjacent elevation cuts and alternate moments are computed at
+   // a lower priority on a separate thread pool. Holding the sweeps keeps them
+   // in the sweep registry until the view selects them, or the volume changes.
+   boost::asio::thread_pool precomputeThreadPool_ {1u};
+   std::atomic<std::size_t> precomputeGeneration_ {0u};
+
+   std::mutex                                     precomputeMutex_ {};
+   std::deque<std::shared_ptr<const Level2Sweep>> precomputedSweeps_ {};
+   std::string                                    precomputeRadarId_ {};
+   std::chrono::system_clock::time_point          precomputeVolumeTime_ {};
 };
 
 Level2ProductView::Level2ProductView(
@@ -192,6 +264,9 @@ void Level2ProductView::ConnectRadarProductManager()
 
 void Level2ProductView::DisconnectRadarProductManager()
 {
+   // Sweeps precomputed for the previous radar are no longer needed
+   p->CancelPrecompute();
+
    disconnect(radar_product_manager().get(),
               &manager::RadarProductManager::DataReloaded,
               this,
@@ -265,8 +340,10 @@ float Level2ProductView::unit_scale() const
    switch (p->product_)
    {
    case common::Level2Product::Velocity:
+   case common::Level2Product::StormRelativeVelocity:
    case common::Level2Product::SpectrumWidth:
-      return types::GetSpeedUnitsScale(p->speedUnits_);
+      return types::GetSpeedUnitsScale(
+         settings::UnitSettings::Instance().snapshot().speedUnits_);
 
    default:
       break;
@@ -277,17 +354,20 @@ float Level2ProductView::unit_scale() const
 
 std::string Level2ProductView::units() const
 {
+   const auto& unitSettings = settings::UnitSettings::Instance().snapshot();
+
    switch (p->product_)
    {
    case common::Level2Product::Velocity:
+   case common::Level2Product::StormRelativeVelocity:
    case common::Level2Product::SpectrumWidth:
-      return types::GetSpeedUnitsAbbreviation(p->speedUnits_);
+      return types::GetSpeedUnitsAbbreviation(unitSettings.speedUnits_);
 
    default:
       break;
    }
 
-   if (p->otherUnits_ == types::OtherUnits::Default)
+   if (unitSettings.otherUnits_ == types::OtherUnits::Default)
    {
       auto it = productUnits_.find(p->product_);
       if (it != productUnits_.cend())
@@ -306,7 +386,26 @@ uint16_t Level2ProductView::vcp() const
 
 const std::vector<float>& Level2ProductView::vertices() const
 {
-   return p->vertices_;
+   static const std::vector<float> kEmptyVertices_ {};
+
+   return (p->sweep_ != nullptr) ? p->sweep_->vertices_ : kEmptyVertices_;
+}
+
+std::shared_ptr<const std::vector<float>>
+Level2ProductView::shared_vertices() const
+{
+   if (p->sweep_ == nullptr)
+   {
+      return nullptr;
+   }
+
+   // The vertices share ownership of the sweep
+   return {p->sweep_, &p->sweep_->vertices_};
+}
+
+std::shared_ptr<const PublishedSweep> Level2ProductView::published_sweep() const
+{
+   return p->published_sweep();
 }
 
 common::RadarProductGroup Level2ProductView::GetRadarProductGroup() const
@@ -330,22 +429,98 @@ std::tuple<const void*, size_t, size_t> Level2ProductView::GetMomentData() const
    size_t      dataSize;
    size_t      componentSize;
 
-   if (p->dataMoments8_.size() > 0)
+   static const std::vector<uint8_t>  kEmptyDataMoments8_ {};
+   static const std::vector<uint16_t> kEmptyDataMoments16_ {};
+
+   const std::vector<uint8_t>*  dataMoments8  = &kEmptyDataMoments8_;
+   const std::vector<uint16_t>* dataMoments16 = &kEmptyDataMoments16_;
+
+   if (p->product_ == common::Level2Product::StormRelativeVelocity)
    {
-      data          = p->dataMoments8_.data();
-      dataSize      = p->dataMoments8_.size() * sizeof(uint8_t);
+      if (p->dataMoments8_ != nullptr)
+      {
+         dataMoments8 = p->dataMoments8_.get();
+      }
+      if (p->dataMoments16_ != nullptr)
+      {
+         dataMoments16 = p->dataMoments16_.get();
+      }
+   }
+   else if (p->sweep_ != nullptr)
+   {
+      dataMoments8  = &p->sweep_->dataMoments8_;
+      dataMoments16 = &p->sweep_->dataMoments16_;
+   }
+
+   if (dataMoments8->size() > 0)
+   {
+      data          = dataMoments8->data();
+      dataSize      = dataMoments8->size() * sizeof(uint8_t);
       componentSize = 1;
    }
    else
    {
-      data          = p->dataMoments16_.data();
-      dataSize      = p->dataMoments16_.size() * sizeof(uint16_t);
+      data          = dataMoments16->data();
+      dataSize      = dataMoments16->size() * sizeof(uint16_t);
       componentSize = 2;
    }
 
    return std::tie(data, dataSize, componentSize);
 }
 
+std::tuple<std::uint16_t, bool> Level2ProductView::GetDisplayThreshold() const
+{
+   // Read from the published sweep, as the renderer does not hold the sweep
+   // mutex
+   std::shared_ptr<const Level2PublishedSweep> publishedSweep =
+      p->published_sweep();
+
+   if (publishedSweep == nullptr ||
+       publishedSweep->momentDataBlock0_ == nullptr)
+   {
+      return {0u, true};
+   }
+
+   return {p->DisplayThreshold(*publishedSweep->momentDataBlock0_),
+           p->RangeFoldedDisplayed()};
+}
+
+std::uint16_t Level2ProductViewImpl::DisplayThreshold(
+   const wsr88d::rda::GenericRadarData::MomentDataBlock& momentData) const
+{
+   // Threshold at which to display an individual bin (minimum of 2)
+   std::int32_t threshold =
+      std::max<std::int32_t>(2, momentData.snr_threshold_raw());
+
+   if (product_ == common::Level2Product::Reflectivity)
+   {
+      auto& productSettings = settings::ProductSettings::Instance();
+
+      const float value = static_cast<float>(
+         productSettings.l2_reflectivity_threshold().GetStagedOrValue());
+      const float level =
+         std::ceil(value * momentData.scale() + momentData.offset());
+
+      constexpr float kMaxLevel =
+         static_cast<float>(std::numeric_limits<std::uint16_t>::max());
+
+      threshold = std::max(
+         threshold,
+         static_cast<std::int32_t>(std::clamp(level, 0.0f, kMaxLevel)));
+   }
+
+   return static_cast<std::uint16_t>(threshold);
+}
+
+bool Level2ProductViewImpl::RangeFoldedDisplayed() const
+{
+   // Clutter filter power removed uses level 1 for a data level code
+   return product_ == common::Level2Product::ClutterFilterPowerRemoved ||
+          settings::ProductSettings::Instance()
+             .l2_range_folded_enabled()
+             .GetStagedOrValue();
+}
+
 std::tuple<const void*, size_t, size_t>
 Level2ProductView::GetCfpMomentData() const
 {
@@ -353,10 +528,10 @@ Level2ProductView::GetCfpMomentData() const
    size_t      dataSize      = 0;
    size_t      componentSize = 1;
 
-   if (p->cfpMoments_.size() > 0)
+   if (p->sweep_ != nullptr && p->sweep_->cfpMoments_.size() > 0)
    {
-      data     = p->cfpMoments_.data();
-      dataSize = p->cfpMoments_.size() * sizeof(uint8_t);
+      data     = p->sweep_->cfpMoments_.data();
+      dataSize = p->sweep_->cfpMoments_.size() * sizeof(uint8_t);
    }
 
    return std::tie(data, dataSize, componentSize);
@@ -379,6 +554,184 @@ void Level2ProductView::SelectProduct(const std::string& productName)
    p->SetProduct(productName);
 }
 
+void Level2ProductView::SetStormMotion(
+   const std::optional<types::StormMotion>& stormMotion)
+{
+   // Apply the storm motion on the thread pool, after any pending sweep
+   // computation
+   boost::asio::post(
+      p->threadPool_,
+      [this, stormMotion]()
+      {
+         std::unique_lock sweepLock {sweep_mutex()};
+
+         if (p->stormMotion_ == stormMotion)
+         {
+            return;
+         }
+
+         p->stormMotion_ = stormMotion;
+
+         if (p->product_ == common::Level2Product::StormRelativeVelocity &&
+             p->sweep_ != nullptr)
+         {
+            p->ApplyStormMotion();
+            p->PublishSweep();
+
+            sweepLock.unlock();
+            Q_EMIT MomentDataUpdated();
+         }
+      });
+}
+
+std::tuple<float, float> Level2ProductViewImpl::StormMotionComponents(
+   const std::optional<types::StormMotion>&              stormMotion,
+   const wsr88d::rda::GenericRadarData::MomentDataBlock* momentData)
+{
+   if (!stormMotion.has_value() || momentData == nullptr)
+   {
+      return {0.0f, 0.0f};
+   }
+
+   constexpr float kDegreesToRadians = std::numbers::pi_v<float> / 180.0f;
+
+   // Storm motion towards the east and north, in data level units
+   const float direction =
+      (stormMotion->direction_.value() + 180.0f) * kDegreesToRadians;
+   const float speed = stormMotion->speed_.value() * momentData->scale();
+
+   return {speed * std::sin(direction), speed * std::cos(direction)};
+}
+
+void Level2ProductViewImpl::ApplyStormMotion()
+{
+   boost::timer::cpu_timer timer;
+
+   const auto [u, v] =
+      StormMotionComponents(stormMotion_, momentDataBlock0_.get());
+
+   // Bins below the display threshold are kept below it, as the renderer
+   // thresholds the shifted data levels
+   const std::uint16_t threshold =
+      (momentDataBlock0_ != nullptr) ? DisplayThreshold(*momentDataBlock0_) :
+                                       2u;
+
+   const Level2Sweep& sweep = *sweep_;
+
+   // The shifted data moments are stored by the view, and the velocity
+   // moments of the shared sweep are unmodified
+   auto dataMoments8 =
+      std::make_shared<std::vector<uint8_t>>(sweep.dataMoments8_.size());
+   auto dataMoments16 =
+      std::make_shared<std::vector<uint16_t>>(sweep.dataMoments16_.size());
+
+   auto radials = boost::irange<std::size_t>(0u, sweep.radialCosines_.size());
+
+   std::for_each(
+      std::execution::par,
+      radials.begin(),
+      radials.end(),
+      [&](std::size_t radial)
+      {
+         // Subtract the component of the storm motion along the radial
+         const std::int32_t offset = static_cast<std::int32_t>(std::lround(
+            u * sweep.radialSines_[radial] +
+            v * sweep.radialCosines_[radial]));
+         const std::size_t begin = sweep.radialMomentOffsets_[radial];
+         const std::size_t count =
+            sweep.radialMomentOffsets_[radial + 1] - begin;
+
+         if (!sweep.dataMoments8_.empty())
+         {
+            util::ShiftDataLevels(sweep.dataMoments8_.data() + begin,
+                                  dataMoments8->data() + begin,
+                                  count,
+                                  offset,
+                                  threshold);
+         }
+         else
+         {
+            util::ShiftDataLevels(sweep.dataMoments16_.data() + begin,
+                                  dataMoments16->data() + begin,
+                                  count,
+                                  offset,
+                                  threshold);
+         }
+      });
+
+   dataMoments8_  = std::move(dataMoments8);
+   dataMoments16_ = std::move(dataMoments16);
+
+   timer.stop();
+   logger_->debug("Storm motion applied in {}", timer.format(6, "%ws"));
+}
+
+void Level2ProductViewImpl::PublishSweep()
+{
+   // The sweep mutex must be held
+   auto publishedSweep = std::make_shared<Level2PublishedSweep>();
+
+   publishedSweep->generation_       = ++publishGeneration_;
+   publishedSweep->elevationScan_    = elevationScan_;
+   publishedSweep->momentDataBlock0_ = momentDataBlock0_;
+   publishedSweep->dataBlockType_    = dataBlockType_;
+   publishedSweep->stormMotion_      = stormMotion_;
+
+   if (sweep_ != nullptr)
+   {
+      // The published data shares ownership of the sweep
+      publishedSweep->vertices_ = {sweep_, &sweep_->vertices_};
+
+      std::shared_ptr<const std::vector<uint8_t>>  dataMoments8 {
+         sweep_, &sweep_->dataMoments8_};
+      std::shared_ptr<const std::vector<uint16_t>> dataMoments16 {
+         sweep_, &sweep_->dataMoments16_};
+
+      if (product_ == common::Level2Product::StormRelativeVelocity &&
+          dataMoments8_ != nullptr && dataMoments16_ != nullptr)
+      {
+         dataMoments8  = dataMoments8_;
+         dataMoments16 = dataMoments16_;
+      }
+
+      if (!dataMoments8->empty())
+      {
+         SetPublishedMoments(publishedSweep->momentData_,
+                             publishedSweep->momentDataSize_,
+                             publishedSweep->momentComponentSize_,
+                             dataMoments8);
+      }
+      else
+      {
+         SetPublishedMoments(publishedSweep->momentData_,
+                             publishedSweep->momentDataSize_,
+                             publishedSweep->momentComponentSize_,
+                             dataMoments16);
+      }
+
+      if (!sweep_->cfpMoments_.empty())
+      {
+         std::shared_ptr<const std::vector<uint8_t>> cfpMoments {
+            sweep_, &sweep_->cfpMoments_};
+
+         SetPublishedMoments(publishedSweep->cfpMomentData_,
+                             publishedSweep->cfpMomentDataSize_,
+                             publishedSweep->cfpMomentComponentSize_,
+                             cfpMoments);
+      }
+   }
+
+   std::unique_lock lock {publishMutex_};
+   publishedSweep_ = std::move(publishedSweep);
+}
+
+std::shared_ptr<const Level2PublishedSweep>
+Level2ProductViewImpl::published_sweep() const
+{
+   std::unique_lock lock {publishMutex_};
+   return publishedSweep_;
+}
+
 void Level2ProductViewImpl::SetProduct(const std::string& productName)
 {
    SetProduct(common::GetLevel2Product(productName));
@@ -401,16 +754,6 @@ void Level2ProductViewImpl::SetProduct(common::Level2Product product)
    }
 }
 
-void Level2ProductViewImpl::UpdateOtherUnits(const std::string& name)
-{
-   otherUnits_ = types::GetOtherUnitsFromName(name);
-}
-
-void Level2ProductViewImpl::UpdateSpeedUnits(const std::string& name)
-{
-   speedUnits_ = types::GetSpeedUnitsFromName(name);
-}
-
 void Level2ProductView::UpdateColorTableLut()
 {
    if (p->momentDataBlock0_ == nullptr || //
@@ -439,6 +782,7 @@ void Level2ProductView::UpdateColorTableLut()
    {
    case common::Level2Product::Reflectivity:
    case common::Level2Product::Velocity:
+   case common::Level2Product::StormRelativeVelocity:
    case common::Level2Product::SpectrumWidth:
    case common::Level2Product::CorrelationCoefficient:
    default:
@@ -501,6 +845,8 @@ void Level2ProductView::ComputeSweep()
 
    boost::timer::cpu_timer timer;
 
+   const auto traceStart = std::chrono::steady_clock::now();
+
    if (p->dataBlockType_ == wsr88d::rda::DataBlockType::Unknown)
    {
       Q_EMIT SweepNotComputed(types::NoUpdateReason::InvalidProduct);
@@ -536,12 +882,6 @@ void Level2ProductView::ComputeSweep()
       return;
    }
 
-   const size_t radials = radarData->size();
-
-   p->ComputeCoordinates(radarData);
-
-   const std::vector<float>& coordinates = p->coordinates_;
-
    auto& radarData0     = (*radarData)[0];
    auto  momentData0    = radarData0->moment_data_block(p->dataBlockType_);
    p->elevationScan_    = radarData;
@@ -567,60 +907,270 @@ void Level2ProductView::ComputeSweep()
                                          radarData0->collection_time());
    p->vcp_       = radarData0->volume_coverage_pattern_number();
 
-   // Calculate vertices
+   // Calculate vertices, unless another view has computed the same sweep
    timer.start();
 
+   p->sweep_ = Level2SweepRegistry::Instance().GetSweep(
+      radarData,
+      p->dataBlockType_,
+      [&]()
+      {
+         return p->ComputeVertices(
+            radarProductManager, radarData, momentData0, p->dataBlockType_);
+      });
+
+   if (p->product_ == common::Level2Product::StormRelativeVelocity)
+   {
+      p->ApplyStormMotion();
+   }
+
+   timer.stop();
+   logger_->debug("Vertices calculated in {}", timer.format(6, "%ws"));
+
+   UpdateColorTableLut();
+
+   // Publish the sweep for rendering
+   p->PublishSweep();
+
+   scwx::util::Tracer::Instance().Record(
+      scwx::util::TraceStage::ComputeSweep,
+      {radarProductManager->radar_id(), GetRadarProductName(), foundTime},
+      traceStart,
+      std::chrono::steady_clock::now());
+
+   p->SchedulePrecompute(radarProductManager, foundTime);
+
+   Q_EMIT SweepComputed();
+}
+
+void Level2ProductViewImpl::CancelPrecompute()
+{
+   // Pending precompute tasks of a previous generation exit without computing
+   ++precomputeGeneration_;
+}
+
+void Level2ProductViewImpl::SchedulePrecompute(
+   const std::shared_ptr<manager::RadarProductManager>& radarProductManager,
+   std::chrono::system_clock::time_point                volumeTime)
+{
+   // The sweep mutex must be held. Precomputation pending for the previous
+   // selection is cancelled.
+   CancelPrecompute();
+
+   const bool precomputeEnabled =
+      settings::GeneralSettings::Instance().precompute_sweeps().GetValue();
+   const std::string radarId = radarProductManager->radar_id();
+
+   {
+      std::unique_lock lock {precomputeMutex_};
+
+      // Release held sweeps when the volume changes, or precompute is disabled
+      if (!precomputeEnabled || radarId != precomputeRadarId_ ||
+          volumeTime != precomputeVolumeTime_)
+      {
+         precomputedSweeps_.clear();
+      }
+
+      precomputeRadarId_    = radarId;
+      precomputeVolumeTime_ = volumeTime;
+   }
+
+   if (!precomputeEnabled)
+   {
+      return;
+   }
+
+   boost::asio::post(
+      precomputeThreadPool_,
+      [=,
+       this,
+       elevationCut  = elevationCut_,
+       elevationCuts = elevationCuts_,
+       dataBlockType = dataBlockType_,
+       generation    = precomputeGeneration_.load()]()
+      {
+         try
+         {
+            PrecomputeSweeps(radarProductManager,
+                             volumeTime,
+                             elevationCut,
+                             elevationCuts,
+                             dataBlockType,
+                             generation);
+         }
+         catch (const std::exception& ex)
+         {
+            logger_->error(ex.what());
+         }
+      });
+}
+
+void Level2ProductViewImpl::PrecomputeSweeps(
+   const std::shared_ptr<manager::RadarProductManager>& radarProductManager,
+   std::chrono::system_clock::time_point                volumeTime,
+   float                                                elevationCut,
+   const std::vector<float>&                            elevationCuts,
+   wsr88d::rda::DataBlockType                           dataBlockType,
+   std::size_t                                          generation)
+{
+   std::vector<std::pair<float, wsr88d::rda::DataBlockType>> requests {};
+
+   // Adjacent elevation cuts of the displayed moment
+   auto cutIt =
+      std::find(elevationCuts.cbegin(), elevationCuts.cend(), elevationCut);
+   if (cutIt != elevationCuts.cend())
+   {
+      if (cutIt != elevationCuts.cbegin())
+      {
+         requests.emplace_back(*std::prev(cutIt), dataBlockType);
+      }
+      if (std::next(cutIt) != elevationCuts.cend())
+      {
+         requests.emplace_back(*std::next(cutIt), dataBlockType);
+      }
+   }
+
+   // Alternate moments of the displayed elevation cut
+   for (auto alternateDataBlockType : kAlternateDataBlockTypes_)
+   {
+      if (alternateDataBlockType != dataBlockType)
+      {
+         requests.emplace_back(elevationCut, alternateDataBlockType);
+      }
+   }
+
+   for (auto& request : requests)
+   {
+      if (generation != precomputeGeneration_)
+      {
+         logger_->trace("Precompute cancelled");
+         return;
+      }
+
+      const wsr88d::rda::DataBlockType requestDataBlockType = request.second;
+
+      std::shared_ptr<wsr88d::rda::ElevationScan> radarData;
+      float                                       foundCut;
+      std::vector<float>                          foundCuts;
+      std::chrono::system_clock::time_point       foundTime;
+      std::tie(radarData, foundCut, foundCuts, foundTime) =
+         radarProductManager->GetLevel2Data(
+            requestDataBlockType, request.first, volumeTime);
+
+      if (radarData == nullptr || foundTime != volumeTime)
+      {
+         continue;
+      }
+
+      auto momentData0 =
+         (*radarData)[0]->moment_data_block(requestDataBlockType);
+      if (momentData0 == nullptr)
+      {
+         continue;
+      }
+
+      logger_->debug("Precomputing sweep at {} degrees", foundCut);
+
+      std::shared_ptr<const Level2Sweep> sweep =
+         Level2SweepRegistry::Instance().GetSweep(
+            radarData,
+            requestDataBlockType,
+            [&]()
+            {
+               return ComputeVertices(radarProductManager,
+                                      radarData,
+                                      momentData0,
+                                      requestDataBlockType);
+            });
+
+      std::unique_lock lock {precomputeMutex_};
+
+      if (sweep != nullptr && generation == precomputeGeneration_)
+      {
+         precomputedSweeps_.push_back(sweep);
+
+         while (precomputedSweeps_.size() > kMaxPrecomputedSweeps_)
+         {
+            precomputedSweeps_.pop_front();
+         }
+      }
+   }
+}
+
+std::shared_ptr<Level2Sweep> Level2ProductViewImpl::ComputeVertices(
+   const std::shared_ptr<manager::RadarProductManager>& radarProductManager,
+   const std::shared_ptr<wsr88d::rda::ElevationScan>&   radarData,
+   const std::shared_ptr<wsr88d::rda::GenericRadarData::MomentDataBlock>&
+                              momentData0,
+   wsr88d::rda::DataBlockType dataBlockType)
+{
+   logger_->debug("ComputeVertices()");
+
+   // The radar product manager is passed by the caller, as the view's radar
+   // product manager may change while a sweep is precomputed
+   auto        radarSite      = radarProductManager->radar_site();
+   const float radarLatitude  = radarSite->latitude();
+   const float radarLongitude = radarSite->longitude();
+
+   const size_t   radials = radarData->size();
+   const uint32_t gates   = momentData0->number_of_data_moment_gates();
+
+   auto& radarData0 = (*radarData)[0];
+
+   const std::vector<float> coordinates =
+      ComputeCoordinates(radarProductManager, radarData);
+
+   auto sweep = std::make_shared<Level2Sweep>();
+
    // Setup vertex vector
-   std::vector<float>& vertices = p->vertices_;
+   std::vector<float>& vertices = sweep->vertices_;
    size_t              vIndex   = 0;
-   vertices.clear();
    vertices.resize(radials * gates * VERTICES_PER_BIN * VALUES_PER_VERTEX);
 
    // Setup data moment vector
-   std::vector<uint8_t>&  dataMoments8  = p->dataMoments8_;
-   std::vector<uint16_t>& dataMoments16 = p->dataMoments16_;
-   std::vector<uint8_t>&  cfpMoments    = p->cfpMoments_;
+   std::vector<uint8_t>&  dataMoments8  = sweep->dataMoments8_;
+   std::vector<uint16_t>& dataMoments16 = sweep->dataMoments16_;
+   std::vector<uint8_t>&  cfpMoments    = sweep->cfpMoments_;
    size_t                 mIndex        = 0;
 
    if (momentData0->data_word_size() == 8)
    {
-      dataMoments16.resize(0);
-      dataMoments16.shrink_to_fit();
-
       dataMoments8.resize(radials * gates * VERTICES_PER_BIN);
    }
    else
    {
-      dataMoments8.resize(0);
-      dataMoments8.shrink_to_fit();
-
       dataMoments16.resize(radials * gates * VERTICES_PER_BIN);
    }
 
-   if (p->dataBlockType_ == wsr88d::rda::DataBlockType::MomentRef &&
+   if (dataBlockType == wsr88d::rda::DataBlockType::MomentRef &&
        radarData0->moment_data_block(wsr88d::rda::DataBlockType::MomentCfp) !=
           nullptr)
    {
       cfpMoments.resize(radials * gates * VERTICES_PER_BIN);
    }
-   else
-   {
-      cfpMoments.resize(0);
-      cfpMoments.shrink_to_fit();
-   }
-
-   // Compute threshold at which to display an individual bin (minimum of 2)
-   const std::uint16_t snrThreshold =
-      std::max<std::int16_t>(2, momentData0->snr_threshold_raw());
 
    // Start radial is always 0, as coordinates are calculated for each sweep
    constexpr std::uint16_t startRadial = 0u;
 
+   // Radial offsets and directions are stored for every velocity sweep, so a
+   // sweep can be shared between velocity and storm relative velocity views
+   sweep->radialMomentOffsets_.reserve(radials + 1);
+   sweep->radialSines_.reserve(radials);
+   sweep->radialCosines_.reserve(radials);
+
    for (auto& radialPair : *radarData)
    {
       std::uint16_t radial     = radialPair.first;
       auto&         radialData = radialPair.second;
-      auto momentData = radialData->moment_data_block(p->dataBlockType_);
+      auto momentData = radialData->moment_data_block(dataBlockType);
+
+      constexpr float kDegreesToRadians = std::numbers::pi_v<float> / 180.0f;
+      const float     azimuth =
+         radialData->azimuth_angle().value() * kDegreesToRadians;
+
+      sweep->radialMomentOffsets_.push_back(mIndex);
+      sweep->radialSines_.push_back(std::sin(azimuth));
+      sweep->radialCosines_.push_back(std::cos(azimuth));
 
       if (momentData0->data_word_size() != momentData->data_word_size())
       {
@@ -686,8 +1236,10 @@ void Level2ProductView::ComputeSweep()
          // Store data moment value
          if (dataMomentsArray8 != nullptr)
          {
+            // Bins with data are thresholded when rendering, so display
+            // thresholds can change without recomputing the sweep
             std::uint8_t dataValue = dataMomentsArray8[i];
-            if (dataValue < snrThreshold && dataValue != RANGE_FOLDED)
+            if (dataValue == BELOW_THRESHOLD)
             {
                continue;
             }
@@ -705,7 +1257,7 @@ void Level2ProductView::ComputeSweep()
          else
          {
             std::uint16_t dataValue = dataMomentsArray16[i];
-            if (dataValue < snrThreshold && dataValue != RANGE_FOLDED)
+            if (dataValue == BELOW_THRESHOLD)
             {
                continue;
             }
@@ -765,8 +1317,8 @@ void Level2ProductView::ComputeSweep()
                                    baseCoord) *
                                   2;
 
-            vertices[vIndex++] = p->latitude_;
-            vertices[vIndex++] = p->longitude_;
+            vertices[vIndex++] = radarLatitude;
+            vertices[vIndex++] = radarLongitude;
 
             vertices[vIndex++] = coordinates[offset1];
             vertices[vIndex++] = coordinates[offset1 + 1];
@@ -798,93 +1350,71 @@ void Level2ProductView::ComputeSweep()
       cfpMoments.shrink_to_fit();
    }
 
-   timer.stop();
-   logger_->debug("Vertices calculated in {}", timer.format(6, "%ws"));
+   sweep->radialMomentOffsets_.push_back(mIndex);
 
-   UpdateColorTableLut();
+   return sweep;
 
-   Q_EMIT SweepComputed();
 }
 
-void Level2ProductViewImpl::ComputeCoordinates(
-   std::shared_ptr<wsr88d::rda::ElevationScan> radarData)
+std::vector<float> Level2ProductViewImpl::ComputeCoordinates(
+   const std::shared_ptr<manager::RadarProductManager>& radarProductManager,
+   const std::shared_ptr<wsr88d::rda::ElevationScan>&   radarData)
 {
    logger_->debug("ComputeCoordinates()");
 
    boost::timer::cpu_timer timer;
 
-   const GeographicLib::Geodesic& geodesic(
-      util::GeographicLib::DefaultGeodesic());
-
-   auto         radarProductManager = self_->radar_product_manager();
-   auto         radarSite           = radarProductManager->radar_site();
-   const float  gateSize            = radarProductManager->gate_size();
-   const double radarLatitude       = radarSite->latitude();
-   const double radarLongitude      = radarSite->longitude();
+   auto         radarSite      = radarProductManager->radar_site();
+   const float  gateSize       = radarProductManager->gate_size();
+   const double radarLatitude  = radarSite->latitude();
+   const double radarLongitude = radarSite->longitude();
 
    // Calculate azimuth coordinates
    timer.start();
 
-   auto& radarData0  = (*radarData)[0];
-   auto  momentData0 = radarData0->moment_data_block(dataBlockType_);
+   std::vector<float> azimuths(radarData->size());
+   std::vector<float> ranges(common::MAX_DATA_MOMENT_GATES);
 
-   const std::uint16_t numRadials =
-      static_cast<std::uint16_t>(radarData->size());
-   const std::uint16_t numRangeBins =
-      std::max(momentData0->number_of_data_moment_gates() + 1u,
-               common::MAX_DATA_MOMENT_GATES);
+   for (std::size_t radial = 0; radial < azimuths.size(); ++radial)
+   {
+      azimuths[radial] = (*radarData)[radial]->azimuth_angle().value();
+   }
+   for (std::size_t gate = 0; gate < ranges.size(); ++gate)
+   {
+      ranges[gate] = (gate + 1) * gateSize;
+   }
 
-   auto radials = boost::irange<std::uint32_t>(0u, numRadials);
-   auto gates   = boost::irange<std::uint32_t>(0u, numRangeBins);
+   std::vector<float> coordinates(kMaxCoordinates_);
+
+   util::GeographicLib::GetCoordinates(radarLatitude,
+                                       radarLongitude,
+                                       azimuths,
+                                       ranges,
+                                       coordinates,
+                                       common::MAX_DATA_MOMENT_GATES * 2);
 
-   std::for_each(std::execution::par_unseq,
-                 radials.begin(),
-                 radials.end(),
-                 [&](std::uint32_t radial)
-                 {
-                    const units::degrees<float> angle =
-                       (*radarData)[radial]->azimuth_angle();
-
-                    std::for_each(std::execution::par_unseq,
-                                  gates.begin(),
-                                  gates.end(),
-                                  [&](std::uint32_t gate)
-                                  {
-                                     const std::uint32_t radialGate =
-                                        radial * common::MAX_DATA_MOMENT_GATES +
-                                        gate;
-                                     const float range = (gate + 1) * gateSize;
-                                     const std::size_t offset = radialGate * 2;
-
-                                     double latitude;
-                                     double longitude;
-
-                                     geodesic.Direct(radarLatitude,
-                                                     radarLongitude,
-                                                     angle.value(),
-                                                     range,
-                                                     latitude,
-                                                     longitude);
-
-                                     coordinates_[offset]     = latitude;
-                                     coordinates_[offset + 1] = longitude;
-                                  });
-                 });
    timer.stop();
    logger_->debug("Coordinates calculated in {}", timer.format(6, "%ws"));
+
+   return coordinates;
 }
 
 std::optional<std::uint16_t>
 Level2ProductView::GetBinLevel(const common::Coordinate& coordinate) const
 {
-   auto radarData     = p->elevationScan_;
-   auto dataBlockType = p->dataBlockType_;
+   // Read from the published sweep, as the sweep and storm motion are updated
+   // on the thread pool
+   std::shared_ptr<const Level2PublishedSweep> publishedSweep =
+      p->published_sweep();
 
-   if (radarData == nullptr)
+   if (publishedSweep == nullptr || publishedSweep->elevationScan_ == nullptr)
    {
       return std::nullopt;
    }
 
+   const auto& radarData     = publishedSweep->elevationScan_;
+   const auto  dataBlockType = publishedSweep->dataBlockType_;
+
    auto         radarProductManager = radar_product_manager();
    auto         radarSite           = radarProductManager->radar_site();
    const double radarLatitude       = radarSite->latitude();
@@ -959,6 +1489,11 @@ Level2ProductView::GetBinLevel(const common::Coordinate& coordinate) const
 
    // Compute gate interval
    auto momentData = (*radarData)[*radial]->moment_data_block(dataBlockType);
+   if (momentData == nullptr)
+   {
+      return std::nullopt;
+   }
+
    const std::int32_t dataMomentInterval =
       momentData->data_moment_range_sample_interval_raw();
    const std::int32_t dataMomentIntervalH = dataMomentInterval / 2;
@@ -984,27 +1519,44 @@ Level2ProductView::GetBinLevel(const common::Coordinate& coordinate) const
       return std::nullopt;
    }
 
-   // Compute threshold at which to display an individual bin (minimum of 2)
-   const std::uint16_t snrThreshold =
-      std::max<std::int16_t>(2, momentData->snr_threshold_raw());
-   std::uint16_t level;
+   const std::uint16_t threshold = p->DisplayThreshold(*momentData);
+   std::uint16_t       level;
+   std::uint16_t       maxLevel;
 
    if (momentData->data_word_size() == 8)
    {
       level =
          reinterpret_cast<const uint8_t*>(momentData->data_moments())[gate];
+      maxLevel = std::numeric_limits<std::uint8_t>::max();
    }
    else
    {
       level =
          reinterpret_cast<const uint16_t*>(momentData->data_moments())[gate];
+      maxLevel = std::numeric_limits<std::uint16_t>::max();
    }
 
-   if (level < snrThreshold && level != RANGE_FOLDED)
+   if (level == RANGE_FOLDED ? !p->RangeFoldedDisplayed() : level < threshold)
    {
       return std::nullopt;
    }
 
+   if (p->product_ == common::Level2Product::StormRelativeVelocity &&
+       level != RANGE_FOLDED)
+   {
+      constexpr float kDegreesToRadians = std::numbers::pi_v<float> / 180.0f;
+
+      const auto [u, v] = Level2ProductViewImpl::StormMotionComponents(
+         publishedSweep->stormMotion_,
+         publishedSweep->momentDataBlock0_.get());
+      const float azimuth =
+         (*radarData)[*radial]->azimuth_angle().value() * kDegreesToRadians;
+      const std::int32_t offset = static_cast<std::int32_t>(
+         std::lround(u * std::sin(azimuth) + v * std::cos(azimuth)));
+
+      level = util::ShiftDataLevel(level, offset, threshold, maxLevel);
+   }
+
    return level;
 }
 
@@ -1015,6 +1567,7 @@ Level2ProductView::GetDataLevelCode(std::uint16_t level) const
    {
    case common::Level2Product::Reflectivity:
    case common::Level2Product::Velocity:
+   case common::Level2Product::StormRelativeVelocity:
    case common::Level2Product::SpectrumWidth:
    case common::Level2Product::DifferentialReflectivity:
    case common::Level2Product::DifferentialPhase:
@@ -1062,6 +1615,7 @@ std::optional<float> Level2ProductView::GetDataValue(std::uint16_t level) const
    {
    case common::Level2Product::Reflectivity:
    case common::Level2Product::Velocity:
+   case common::Level2Product::StormRelativeVelocity:
    case common::Level2Product::SpectrumWidth:
    case common::Level2Product::DifferentialReflectivity:
    case common::Level2Product::DifferentialPhase:
@@ -2,10 +2,12 @@
 
 #include <scwx/common/color_table.hpp>
 #include <scwx/common/products.hpp>
+#include <scwx/qt/types/storm_motion.hpp>
 #include <scwx/qt/view/radar_product_view.hpp>
 
 #include <chrono>
 #include <memory>
+#include <optional>
 #include <vector>
 
 namespace scwx
@@ -40,10 +42,22 @@ public:
    std::uint16_t                         vcp() const override;
    const std::vector<float>&             vertices() const override;
 
+   std::shared_ptr<const std::vector<float>> shared_vertices() const override;
+   std::shared_ptr<const PublishedSweep>     published_sweep() const override;
+
    void LoadColorTable(std::shared_ptr<common::ColorTable> colorTable) override;
    void SelectElevation(float elevation) override;
    void SelectProduct(const std::string& productName) override;
 
+   /**
+    * Sets the storm motion subtracted from the radial velocity of the storm
+    * relative velocity product. The data moments of the current sweep are
+    * updated without recomputing the sweep, and MomentDataUpdated() is emitted.
+    *
+    * @param [in] stormMotion Storm motion, or std::nullopt for no motion
+    */
+   void SetStormMotion(const std::optional<types::StormMotion>& stormMotion);
+
    common::RadarProductGroup GetRadarProductGroup() const override;
    std::string               GetRadarProductName() const override;
    std::vector<float>        GetElevationCuts() const override;
@@ -51,6 +65,7 @@ public:
    GetMomentData() const override;
    std::tuple<const void*, std::size_t, std::size_t>
    GetCfpMomentData() const override;
+   std::tuple<std::uint16_t, bool> GetDisplayThreshold() const override;
 
    std::optional<std::uint16_t>
    GetBinLevel(const common::Coordinate& coordinate) const override;
@@ -0,0 +1,112 @@
+#include <scwx/qt/view/level2_sweep_registry.hpp>
+#include <scwx/util/logger.hpp>
+
+#include <algorithm>
+#include <map>
+#include <mutex>
+
+namespace scwx
+{
+namespace qt
+{
+namespace view
+{
+
+static const std::string logPrefix_ = "scwx::qt::view::level2_sweep_registry";
+static const auto        logger_    = scwx::util::Logger::Create(logPrefix_);
+
+class Level2SweepRegistry::Impl
+{
+public:
+   struct Entry
+   {
+      std::mutex                       mutex_ {};
+      std::weak_ptr<const Level2Sweep> sweep_ {};
+   };
+
+   typedef std::pair<const wsr88d::rda::ElevationScan*,
+                     wsr88d::rda::DataBlockType>
+      Key;
+
+   explicit Impl() {}
+   ~Impl() {}
+
+   void PruneEntries();
+
+   mutable std::mutex                    entriesMutex_ {};
+   std::map<Key, std::shared_ptr<Entry>> entries_ {};
+};
+
+Level2SweepRegistry::Level2SweepRegistry() : p(std::make_unique<Impl>()) {}
+Level2SweepRegistry::~Level2SweepRegistry() = default;
+
+Level2SweepRegistry& Level2SweepRegistry::Instance()
+{
+   static Level2SweepRegistry registry_ {};
+   return registry_;
+}
+
+std::shared_ptr<const Level2Sweep> Level2SweepRegistry::GetSweep(
+   const std::shared_ptr<wsr88d::rda::ElevationScan>& elevationScan,
+   wsr88d::rda::DataBlockType                         dataBlockType,
+   const ComputeSweepFunction&                        computeSweep)
+{
+   std::unique_lock entriesLock {p->entriesMutex_};
+
+   p->PruneEntries();
+
+   auto& entry = p->entries_[{elevationScan.get(), dataBlockType}];
+   if (entry == nullptr)
+   {
+      entry = std::make_shared<Impl::Entry>();
+   }
+
+   std::shared_ptr<Impl::Entry> currentEntry = entry;
+
+   entriesLock.unlock();
+
+   // Wait for any computation of the same sweep in progress
+   std::unique_lock entryLock {currentEntry->mutex_};
+
+   std::shared_ptr<const Level2Sweep> sweep = currentEntry->sweep_.lock();
+   if (sweep != nullptr)
+   {
+      logger_->debug("Sharing computed sweep");
+      return sweep;
+   }
+
+   std::shared_ptr<Level2Sweep> newSweep = computeSweep();
+   if (newSweep != nullptr)
+   {
+      newSweep->elevationScan_ = elevationScan;
+      currentEntry->sweep_     = newSweep;
+   }
+
+   return newSweep;
+}
+
+std::size_t Level2SweepRegistry::sweep_count() const
+{
+   std::unique_lock lock {p->entriesMutex_};
+
+   return std::count_if(p->entries_.cbegin(),
+                        p->entries_.cend(),
+                        [](const auto& entry)
+                        { return !entry.second->sweep_.expired(); });
+}
+
+void Level2SweepRegistry::Impl::PruneEntries()
+{
+   // The entries mutex must be held. Entries in use by a computation are
+   // kept, so concurrent requests wait for the same computation.
+   std::erase_if(entries_,
+                 [](const auto& entry)
+                 {
+                    return entry.second.use_count() == 1 &&
+                           entry.second->sweep_.expired();
+                 });
+}
+
+} // namespace view
+} // namespace qt
+} // namespace scwx
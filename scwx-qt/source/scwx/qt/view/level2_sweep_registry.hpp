@@ -0,0 +1,88 @@
+#pragma once
+
+#include <scwx/wsr88d/rda/generic_radar_data.hpp>
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace scwx
+{
+namespace qt
+{
+namespace view
+{
+
+/**
+ * Vertices and data moments computed from a single data block type of an
+ * elevation scan. A sweep is immutable once computed, and is shared by each
+ * view displaying it.
+ */
+struct Level2Sweep
+{
+   // Holds the elevation scan, so the scan identifying the sweep stays unique
+   std::shared_ptr<wsr88d::rda::ElevationScan> elevationScan_ {};
+
+   std::vector<float>         vertices_ {};
+   std::vector<std::uint8_t>  dataMoments8_ {};
+   std::vector<std::uint16_t> dataMoments16_ {};
+   std::vector<std::uint8_t>  cfpMoments_ {};
+
+   // Data moment offset and azimuth direction of each radial, used to derive
+   // storm relative velocity from the velocity moments
+   std::vector<std::size_t> radialMomentOffsets_ {};
+   std::vector<float>       radialSines_ {};
+   std::vector<float>       radialCosines_ {};
+};
+
+/**
+ * @brief Level 2 Sweep Registry
+ *
+ * Shares computed sweeps between views displaying the same data block type of
+ * the same elevation scan, such as map panes of different zoom levels. A
+ * sweep is computed once, and released when no view holds it. Display
+ * thresholds are applied when rendering, and are not part of the sweep.
+ */
+class Level2SweepRegistry
+{
+public:
+   explicit Level2SweepRegistry();
+   ~Level2SweepRegistry();
+
+   Level2SweepRegistry(const Level2SweepRegistry&)            = delete;
+   Level2SweepRegistry& operator=(const Level2SweepRegistry&) = delete;
+
+   Level2SweepRegistry(Level2SweepRegistry&&) noexcept            = delete;
+   Level2SweepRegistry& operator=(Level2SweepRegistry&&) noexcept = delete;
+
+   typedef std::function<std::shared_ptr<Level2Sweep>()> ComputeSweepFunction;
+
+   /**
+    * Gets the sweep of an elevation scan. If no view holds the sweep, it is
+    * computed. Concurrent requests for the same sweep wait for a single
+    * computation.
+    *
+    * @param [in] elevationScan Elevation scan
+    * @param [in] dataBlockType Data block type
+    * @param [in] computeSweep Function computing the sweep
+    *
+    * @return Shared sweep, or nullptr if the sweep could not be computed
+    */
+   std::shared_ptr<const Level2Sweep>
+   GetSweep(const std::shared_ptr<wsr88d::rda::ElevationScan>& elevationScan,
+            wsr88d::rda::DataBlockType                         dataBlockType,
+            const ComputeSweepFunction&                        computeSweep);
+
+   std::size_t sweep_count() const;
+
+   static Level2SweepRegistry& Instance();
+
+private:
+   class Impl;
+   std::unique_ptr<Impl> p;
+};
+
+} // namespace view
+} // namespace qt
+} // namespace scwx
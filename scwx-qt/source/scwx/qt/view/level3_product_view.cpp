@@ -57,45 +57,8 @@ public:
        savedScale_ {0.0f},
        savedOffset_ {0.0f}
    {
-      auto& unitSettings = settings::UnitSettings::Instance();
-
-      accumulationUnitsCallbackUuid_ =
-         unitSettings.accumulation_units().RegisterValueChangedCallback(
-            [this](const std::string& value)
-            { UpdateAccumulationUnits(value); });
-      echoTopsUnitsCallbackUuid_ =
-         unitSettings.echo_tops_units().RegisterValueChangedCallback(
-            [this](const std::string& value) { UpdateEchoTopsUnits(value); });
-      otherUnitsCallbackUuid_ =
-         unitSettings.other_units().RegisterValueChangedCallback(
-            [this](const std::string& value) { UpdateOtherUnits(value); });
-      speedUnitsCallbackUuid_ =
-         unitSettings.speed_units().RegisterValueChangedCallback(
-            [this](const std::string& value) { UpdateSpeedUnits(value); });
-
-      UpdateAccumulationUnits(unitSettings.accumulation_units().GetValue());
-      UpdateEchoTopsUnits(unitSettings.echo_tops_units().GetValue());
-      UpdateOtherUnits(unitSettings.other_units().GetValue());
-      UpdateSpeedUnits(unitSettings.speed_units().GetValue());
    }
-   ~Impl()
-   {
-      auto& unitSettings = settings::UnitSettings::Instance();
-
-      unitSettings.accumulation_units().UnregisterValueChangedCallback(
-         accumulationUnitsCallbackUuid_);
-      unitSettings.echo_tops_units().UnregisterValueChangedCallback(
-         echoTopsUnitsCallbackUuid_);
-      unitSettings.other_units().UnregisterValueChangedCallback(
-         otherUnitsCallbackUuid_);
-      unitSettings.speed_units().UnregisterValueChangedCallback(
-         speedUnitsCallbackUuid_);
-   };
-
-   void UpdateAccumulationUnits(const std::string& name);
-   void UpdateEchoTopsUnits(const std::string& name);
-   void UpdateOtherUnits(const std::string& name);
-   void UpdateSpeedUnits(const std::string& name);
+   ~Impl() {}
 
    std::string                   product_;
    common::Level3ProductCategory category_;
@@ -113,16 +76,6 @@ public:
    std::uint16_t                       savedLogStart_ {20u};
    float                               savedLogScale_ {1.0f};
    float                               savedLogOffset_ {0.0f};
-
-   boost::uuids::uuid       accumulationUnitsCallbackUuid_ {};
-   boost::uuids::uuid       echoTopsUnitsCallbackUuid_ {};
-   boost::uuids::uuid       otherUnitsCallbackUuid_ {};
-   boost::uuids::uuid       speedUnitsCallbackUuid_ {};
-   types::AccumulationUnits accumulationUnits_ {
-      types::AccumulationUnits::Unknown};
-   types::EchoTopsUnits echoTopsUnits_ {types::EchoTopsUnits::Unknown};
-   types::OtherUnits    otherUnits_ {types::OtherUnits::Unknown};
-   types::SpeedUnits    speedUnits_ {types::SpeedUnits::Unknown};
 };
 
 Level3ProductView::Level3ProductView(
@@ -205,17 +158,19 @@ uint16_t Level3ProductView::color_table_max() const
 
 float Level3ProductView::unit_scale() const
 {
+   const auto& unitSettings = settings::UnitSettings::Instance().snapshot();
+
    switch (p->category_)
    {
    case common::Level3ProductCategory::Velocity:
    case common::Level3ProductCategory::SpectrumWidth:
-      return types::GetSpeedUnitsScale(p->speedUnits_);
+      return types::GetSpeedUnitsScale(unitSettings.speedUnits_);
 
    case common::Level3ProductCategory::EchoTops:
-      return types::GetEchoTopsUnitsScale(p->echoTopsUnits_);
+      return types::GetEchoTopsUnitsScale(unitSettings.echoTopsUnits_);
 
    case common::Level3ProductCategory::PrecipitationAccumulation:
-      return types::GetAccumulationUnitsScale(p->accumulationUnits_);
+      return types::GetAccumulationUnitsScale(unitSettings.accumulationUnits_);
 
    default:
       break;
@@ -226,23 +181,26 @@ float Level3ProductView::unit_scale() const
 
 std::string Level3ProductView::units() const
 {
+   const auto& unitSettings = settings::UnitSettings::Instance().snapshot();
+
    switch (p->category_)
    {
    case common::Level3ProductCategory::Velocity:
    case common::Level3ProductCategory::SpectrumWidth:
-      return types::GetSpeedUnitsAbbreviation(p->speedUnits_);
+      return types::GetSpeedUnitsAbbreviation(unitSettings.speedUnits_);
 
    case common::Level3ProductCategory::EchoTops:
-      return types::GetEchoTopsUnitsAbbreviation(p->echoTopsUnits_);
+      return types::GetEchoTopsUnitsAbbreviation(unitSettings.echoTopsUnits_);
 
    case common::Level3ProductCategory::PrecipitationAccumulation:
-      return types::GetAccumulationUnitsAbbreviation(p->accumulationUnits_);
+      return types::GetAccumulationUnitsAbbreviation(
+         unitSettings.accumulationUnits_);
 
    default:
       break;
    }
 
-   if (p->otherUnits_ == types::OtherUnits::Default)
+   if (unitSettings.otherUnits_ == types::OtherUnits::Default)
    {
       auto it = categoryUnits_.find(p->category_);
       if (it != categoryUnits_.cend())
@@ -276,26 +234,6 @@ std::string Level3ProductView::GetRadarProductName() const
    return p->product_;
 }
 
-void Level3ProductView::Impl::UpdateAccumulationUnits(const std::string& name)
-{
-   accumulationUnits_ = types::GetAccumulationUnitsFromName(name);
-}
-
-void Level3ProductView::Impl::UpdateEchoTopsUnits(const std::string& name)
-{
-   echoTopsUnits_ = types::GetEchoTopsUnitsFromName(name);
-}
-
-void Level3ProductView::Impl::UpdateOtherUnits(const std::string& name)
-{
-   otherUnits_ = types::GetOtherUnitsFromName(name);
-}
-
-void Level3ProductView::Impl::UpdateSpeedUnits(const std::string& name)
-{
-   speedUnits_ = types::GetSpeedUnitsFromName(name);
-}
-
 void Level3ProductView::SelectProduct(const std::string& productName)
 {
    p->product_  = productName;
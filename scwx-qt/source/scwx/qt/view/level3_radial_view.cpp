@@ -4,6 +4,7 @@
 #include <scwx/util/logger.hpp>
 #include <scwx/util/threads.hpp>
 #include <scwx/util/time.hpp>
+#include <scwx/util/trace.hpp>
 #include <scwx/wsr88d/rpg/digital_radial_data_array_packet.hpp>
 #include <scwx/wsr88d/rpg/radial_data_packet.hpp>
 
@@ -121,6 +122,8 @@ void Level3RadialView::ComputeSweep()
 
    boost::timer::cpu_timer timer;
 
+   const auto traceStart = std::chrono::steady_clock::now();
+
    std::scoped_lock sweepLock(sweep_mutex());
 
    std::shared_ptr<manager::RadarProductManager> radarProductManager =
@@ -425,6 +428,12 @@ void Level3RadialView::ComputeSweep()
 
    UpdateColorTableLut();
 
+   scwx::util::Tracer::Instance().Record(
+      scwx::util::TraceStage::ComputeSweep,
+      {radarProductManager->radar_id(), GetRadarProductName(), foundTime},
+      traceStart,
+      std::chrono::steady_clock::now());
+
    Q_EMIT SweepComputed();
 }
 
@@ -435,9 +444,6 @@ void Level3RadialView::Impl::ComputeCoordinates(
 
    boost::timer::cpu_timer timer;
 
-   const GeographicLib::Geodesic& geodesic(
-      util::GeographicLib::DefaultGeodesic());
-
    auto         radarProductManager = self_->radar_product_manager();
    auto         radarSite           = radarProductManager->radar_site();
    const float  gateSize            = radarProductManager->gate_size();
@@ -450,41 +456,25 @@ void Level3RadialView::Impl::ComputeCoordinates(
    const std::uint16_t numRadials   = radialData->number_of_radials();
    const std::uint16_t numRangeBins = radialData->number_of_range_bins();
 
-   auto radials = boost::irange<std::uint32_t>(0u, numRadials);
-   auto gates   = boost::irange<std::uint32_t>(0u, numRangeBins);
-
-   std::for_each(std::execution::par_unseq,
-                 radials.begin(),
-                 radials.end(),
-                 [&](std::uint32_t radial)
-                 {
-                    const float angle = radialData->start_angle(radial);
-
-                    std::for_each(std::execution::par_unseq,
-                                  gates.begin(),
-                                  gates.end(),
-                                  [&](std::uint32_t gate)
-                                  {
-                                     const std::uint32_t radialGate =
-                                        radial * common::MAX_DATA_MOMENT_GATES +
-                                        gate;
-                                     const float range = (gate + 1) * gateSize;
-                                     const std::size_t offset = radialGate * 2;
-
-                                     double latitude;
-                                     double longitude;
-
-                                     geodesic.Direct(radarLatitude,
-                                                     radarLongitude,
-                                                     angle,
-                                                     range,
-                                                     latitude,
-                                                     longitude);
-
-                                     coordinates_[offset]     = latitude;
-                                     coordinates_[offset + 1] = longitude;
-                                  });
-                 });
+   std::vector<float> azimuths(numRadials);
+   std::vector<float> ranges(numRangeBins);
+
+   for (std::uint16_t radial = 0; radial < numRadials; ++radial)
+   {
+      azimuths[radial] = radialData->start_angle(radial);
+   }
+   for (std::uint16_t gate = 0; gate < numRangeBins; ++gate)
+   {
+      ranges[gate] = (gate + 1) * gateSize;
+   }
+
+   util::GeographicLib::GetCoordinates(radarLatitude,
+                                       radarLongitude,
+                                       azimuths,
+                                       ranges,
+                                       coordinates_,
+                                       common::MAX_DATA_MOMENT_GATES * 2);
+
    timer.stop();
    logger_->debug("Coordinates calculated in {}", timer.format(6, "%ws"));
 }
@@ -1,12 +1,13 @@
 #include <scwx/qt/view/level3_raster_view.hpp>
 #include <scwx/qt/util/geographic_lib.hpp>
+#include <scwx/qt/util/raster_mesh.hpp>
 #include <scwx/common/constants.hpp>
 #include <scwx/util/logger.hpp>
 #include <scwx/util/threads.hpp>
 #include <scwx/util/time.hpp>
+#include <scwx/util/trace.hpp>
 #include <scwx/wsr88d/rpg/raster_data_packet.hpp>
 
-#include <boost/range/irange.hpp>
 #include <boost/timer/timer.hpp>
 #include <units/angle.h>
 
@@ -20,9 +21,10 @@ namespace view
 static const std::string logPrefix_ = "scwx::qt::view::level3_raster_view";
 static const auto        logger_    = scwx::util::Logger::Create(logPrefix_);
 
-static constexpr uint16_t RANGE_FOLDED      = 1u;
-static constexpr uint32_t VERTICES_PER_BIN  = 6u;
-static constexpr uint32_t VALUES_PER_VERTEX = 2u;
+static constexpr uint16_t RANGE_FOLDED = 1u;
+
+// Number of mesh cells along each axis of the raster grid
+static constexpr std::size_t kMeshSize_ = 32u;
 
 class Level3RasterViewImpl
 {
@@ -35,8 +37,10 @@ public:
 
    boost::asio::thread_pool threadPool_ {1u};
 
-   std::vector<float>   vertices_;
-   std::vector<uint8_t> dataMoments8_;
+   util::RasterMesh     mesh_ {};
+   std::vector<uint8_t> rasterTexture_ {};
+   std::size_t          rasterTextureWidth_ {};
+   std::size_t          rasterTextureHeight_ {};
 
    std::shared_ptr<wsr88d::rpg::RasterDataPacket> lastRasterData_ {};
 
@@ -81,30 +85,44 @@ uint16_t Level3RasterView::vcp() const
    return p->vcp_;
 }
 
+const std::vector<float>& Level3RasterView::texture_coordinates() const
+{
+   return p->mesh_.textureCoordinates_;
+}
+
 const std::vector<float>& Level3RasterView::vertices() const
 {
-   return p->vertices_;
+   return p->mesh_.vertices_;
 }
 
 std::tuple<const void*, size_t, size_t> Level3RasterView::GetMomentData() const
 {
-   const void* data;
-   size_t      dataSize;
-   size_t      componentSize;
-
-   data          = p->dataMoments8_.data();
-   dataSize      = p->dataMoments8_.size() * sizeof(uint8_t);
-   componentSize = 1;
+   // Data moments are provided as a raster texture, rather than per vertex
+   const void* data          = nullptr;
+   size_t      dataSize      = 0;
+   size_t      componentSize = 1;
 
    return std::tie(data, dataSize, componentSize);
 }
 
+std::tuple<const void*, size_t, size_t>
+Level3RasterView::GetRasterTextureData() const
+{
+   const void* data   = p->rasterTexture_.data();
+   size_t      width  = p->rasterTextureWidth_;
+   size_t      height = p->rasterTextureHeight_;
+
+   return std::tie(data, width, height);
+}
+
 void Level3RasterView::ComputeSweep()
 {
    logger_->debug("ComputeSweep()");
 
    boost::timer::cpu_timer timer;
 
+   const auto traceStart = std::chrono::steady_clock::now();
+
    std::scoped_lock sweepLock(sweep_mutex());
 
    std::shared_ptr<manager::RadarProductManager> radarProductManager =
@@ -226,9 +244,6 @@ void Level3RasterView::ComputeSweep()
                             descriptionBlock->volume_scan_start_time() * 1000);
    p->vcp_ = descriptionBlock->volume_coverage_pattern();
 
-   const GeographicLib::Geodesic& geodesic =
-      util::GeographicLib::DefaultGeodesic();
-
    const uint16_t xResolution = descriptionBlock->x_resolution_raw();
    const uint16_t yResolution = descriptionBlock->y_resolution_raw();
    double         iCoordinate =
@@ -236,76 +251,43 @@ void Level3RasterView::ComputeSweep()
    double jCoordinate =
       (rasterData->j_coordinate_start() + 1.0 + p->range_) * 1000.0;
 
-   size_t numCoordinates =
-      static_cast<size_t>(rows + 1) * static_cast<size_t>(maxColumns + 1);
-   auto coordinateRange =
-      boost::irange<uint32_t>(0, static_cast<uint32_t>(numCoordinates));
-
-   std::vector<float> coordinates;
-   coordinates.resize(numCoordinates * 2);
-
-   // Calculate coordinates
+   // Calculate mesh
    timer.start();
 
-   std::for_each(
-      std::execution::par_unseq,
-      coordinateRange.begin(),
-      coordinateRange.end(),
-      [&](uint32_t index)
-      {
-         // For each row or column, there is one additional coordinate. Each bin
-         // is bounded by 4 coordinates.
-         const uint32_t col = index % (rows + 1);
-         const uint32_t row = index / (rows + 1);
-
-         const double i = iCoordinate + xResolution * col;
-         const double j = jCoordinate - yResolution * row;
-
-         // Calculate polar coordinates based on i and j
-         const double angle  = std::atan2(i, j) * 180.0 / M_PI;
-         const double range  = std::sqrt(i * i + j * j);
-         const size_t offset = static_cast<size_t>(index) * 2;
+   util::RasterGrid grid {};
+   grid.iStart_      = iCoordinate;
+   grid.jStart_      = jCoordinate;
+   grid.xResolution_ = xResolution;
+   grid.yResolution_ = yResolution;
+   grid.columns_     = maxColumns;
+   grid.rows_        = rows;
 
-         double latitude;
-         double longitude;
-
-         geodesic.Direct(
-            p->latitude_, p->longitude_, angle, range, latitude, longitude);
-
-         coordinates[offset]     = latitude;
-         coordinates[offset + 1] = longitude;
-      });
+   p->mesh_ = util::GenerateRasterMesh(
+      {p->latitude_, p->longitude_}, grid, kMeshSize_);
 
    timer.stop();
-   logger_->debug("Coordinates calculated in {}", timer.format(6, "%ws"));
+   logger_->debug("Mesh calculated in {}", timer.format(6, "%ws"));
 
-   // Calculate vertices
+   // Calculate raster texture
    timer.start();
 
-   // Setup vertex vector
-   std::vector<float>& vertices = p->vertices_;
-   size_t              vIndex   = 0;
-   vertices.clear();
-   vertices.resize(rows * maxColumns * VERTICES_PER_BIN * VALUES_PER_VERTEX);
-
-   // Setup data moment vector
-   std::vector<uint8_t>& dataMoments8 = p->dataMoments8_;
-   size_t                mIndex       = 0;
-
-   dataMoments8.resize(rows * maxColumns * VERTICES_PER_BIN);
+   // Setup raster texture, with one texel per bin. Bins which are not
+   // displayed, including bins beyond the end of a shorter row, are set to 0.
+   std::vector<uint8_t>& rasterTexture = p->rasterTexture_;
+   rasterTexture.assign(rows * maxColumns, 0u);
+   p->rasterTextureWidth_  = maxColumns;
+   p->rasterTextureHeight_ = rows;
 
    // Compute threshold at which to display an individual bin
    const uint16_t snrThreshold = descriptionBlock->threshold();
 
-   for (size_t row = 0; row < rasterData->number_of_rows(); ++row)
+   for (size_t row = 0; row < rows; ++row)
    {
       const auto dataMomentsArray8 =
          rasterData->level(static_cast<uint16_t>(row));
 
       for (size_t bin = 0; bin < dataMomentsArray8.size(); ++bin)
       {
-         constexpr size_t vertexCount = 6;
-
          // Store data moment value
          uint8_t dataValue = dataMomentsArray8[bin];
          if (dataValue < snrThreshold && dataValue != RANGE_FOLDED)
@@ -313,47 +295,21 @@ void Level3RasterView::ComputeSweep()
             continue;
          }
 
-         for (size_t m = 0; m < vertexCount; m++)
-         {
-            dataMoments8[mIndex++] = dataValue;
-         }
-
-         // Store vertices
-         size_t offset1 = (row * (maxColumns + 1) + bin) * 2;
-         size_t offset2 = offset1 + 2;
-         size_t offset3 = ((row + 1) * (maxColumns + 1) + bin) * 2;
-         size_t offset4 = offset3 + 2;
-
-         vertices[vIndex++] = coordinates[offset1];
-         vertices[vIndex++] = coordinates[offset1 + 1];
-
-         vertices[vIndex++] = coordinates[offset2];
-         vertices[vIndex++] = coordinates[offset2 + 1];
-
-         vertices[vIndex++] = coordinates[offset3];
-         vertices[vIndex++] = coordinates[offset3 + 1];
-
-         vertices[vIndex++] = coordinates[offset3];
-         vertices[vIndex++] = coordinates[offset3 + 1];
-
-         vertices[vIndex++] = coordinates[offset4];
-         vertices[vIndex++] = coordinates[offset4 + 1];
-
-         vertices[vIndex++] = coordinates[offset2];
-         vertices[vIndex++] = coordinates[offset2 + 1];
+         rasterTexture[row * maxColumns + bin] = dataValue;
       }
    }
-   vertices.resize(vIndex);
-   vertices.shrink_to_fit();
-
-   dataMoments8.resize(mIndex);
-   dataMoments8.shrink_to_fit();
 
    timer.stop();
-   logger_->debug("Vertices calculated in {}", timer.format(6, "%ws"));
+   logger_->debug("Raster texture calculated in {}", timer.format(6, "%ws"));
 
    UpdateColorTableLut();
 
+   scwx::util::Tracer::Instance().Record(
+      scwx::util::TraceStage::ComputeSweep,
+      {radarProductManager->radar_id(), GetRadarProductName(), foundTime},
+      traceStart,
+      std::chrono::steady_clock::now());
+
    Q_EMIT SweepComputed();
 }
 
@@ -27,11 +27,14 @@ public:
 
    float                                 range() const override;
    std::chrono::system_clock::time_point sweep_time() const override;
+   const std::vector<float>&             texture_coordinates() const override;
    std::uint16_t                         vcp() const override;
    const std::vector<float>&             vertices() const override;
 
    std::tuple<const void*, std::size_t, std::size_t>
    GetMomentData() const override;
+   std::tuple<const void*, std::size_t, std::size_t>
+   GetRasterTextureData() const override;
 
    std::optional<std::uint16_t>
    GetBinLevel(const common::Coordinate& coordinate) const override;
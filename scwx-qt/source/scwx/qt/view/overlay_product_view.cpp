@@ -1,5 +1,6 @@
 #include <scwx/qt/view/overlay_product_view.hpp>
 #include <scwx/qt/manager/radar_product_manager.hpp>
+#include <scwx/util/clock.hpp>
 #include <scwx/util/logger.hpp>
 #include <scwx/util/time.hpp>
 
@@ -186,7 +187,7 @@ void OverlayProductView::Impl::LoadProduct(
                   header.date_of_message(), header.time_of_message() * 1000);
 
                // If the record is from the last 30 minutes
-               if (productTime + 30min >= std::chrono::system_clock::now() ||
+               if (productTime + 30min >= util::CurrentTime() ||
                    (selectedTime_ != std::chrono::system_clock::time_point {} &&
                     productTime + 30min >= selectedTime_))
                {
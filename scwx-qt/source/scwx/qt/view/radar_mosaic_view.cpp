@@ -0,0 +1,808 @@
+#include <scwx/qt/view/radar_mosaic_view.hpp>
+#include <scwx/qt/config/radar_site.hpp>
+#include <scwx/qt/manager/radar_product_manager.hpp>
+#include <scwx/qt/util/geographic_lib.hpp>
+#include <scwx/util/clock.hpp>
+#include <scwx/util/logger.hpp>
+#include <scwx/util/time.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <execution>
+#include <unordered_map>
+
+#include <boost/asio.hpp>
+#include <boost/timer/timer.hpp>
+#include <boost/uuid/random_generator.hpp>
+
+namespace scwx
+{
+namespace qt
+{
+namespace view
+{
+
+static const std::string logPrefix_ = "scwx::qt::view::radar_mosaic_view";
+static const auto        logger_    = scwx::util::Logger::Create(logPrefix_);
+
+// Maximum distance from the selected radar site to a neighboring site (meters)
+static constexpr double kMaxSiteDistance_ = 600'000.0;
+
+// Sweeps older than the selected time by more than this are not composited
+static constexpr std::chrono::minutes kMaxSweepAge_ {15};
+
+static const std::unordered_map<common::Level2Product,
+                                wsr88d::rda::DataBlockType>
+   blockTypes_ {
+      {common::Level2Product::Reflectivity,
+       wsr88d::rda::DataBlockType::MomentRef},
+      {common::Level2Product::Velocity, wsr88d::rda::DataBlockType::MomentVel},
+      {common::Level2Product::SpectrumWidth,
+       wsr88d::rda::DataBlockType::MomentSw},
+      {common::Level2Product::DifferentialReflectivity,
+       wsr88d::rda::DataBlockType::MomentZdr},
+      {common::Level2Product::DifferentialPhase,
+       wsr88d::rda::DataBlockType::MomentPhi},
+      {common::Level2Product::CorrelationCoefficient,
+       wsr88d::rda::DataBlockType::MomentRho},
+      {common::Level2Product::ClutterFilterPowerRemoved,
+       wsr88d::rda::DataBlockType::MomentCfp}};
+
+// Common 8-bit data scale of each product. Velocity is composited at 0.5 m/s
+// resolution, and 1.0 m/s resolution data beyond the range is clamped.
+// Differential phase is reduced from its 16-bit scale.
+static const std::unordered_map<common::Level2Product,
+                                RadarMosaicView::DataScale>
+   dataScales_ {
+      {common::Level2Product::Reflectivity, {2.0f, 66.0f}},
+      {common::Level2Product::Velocity, {2.0f, 129.0f}},
+      {common::Level2Product::SpectrumWidth, {2.0f, 129.0f}},
+      {common::Level2Product::DifferentialReflectivity, {16.0f, 128.0f}},
+      {common::Level2Product::DifferentialPhase, {0.7f, 2.0f}},
+      {common::Level2Product::CorrelationCoefficient, {300.0f, -60.5f}},
+      {common::Level2Product::ClutterFilterPowerRemoved, {1.0f, 8.0f}}};
+
+struct MosaicSite
+{
+   explicit MosaicSite(const std::string& radarId) :
+       radarId_ {radarId},
+       radarSite_ {config::RadarSite::Get(radarId)},
+       radarProductManager_ {manager::RadarProductManager::Instance(radarId)}
+   {
+   }
+
+   const std::string                                   radarId_;
+   const std::shared_ptr<config::RadarSite>            radarSite_;
+   const std::shared_ptr<manager::RadarProductManager> radarProductManager_;
+
+   // The following members are only accessed by the update thread
+
+   // Azimuth and range of each cell in the site extent
+   util::MosaicSiteGeometry geometry_ {};
+
+   // Resampled sweep
+   std::shared_ptr<wsr88d::rda::ElevationScan> elevationScan_ {nullptr};
+   std::size_t                                 generation_ {0u};
+   std::vector<std::uint8_t>                   levels_ {};
+
+   std::chrono::system_clock::time_point requestedTime_ {};
+};
+
+class RadarMosaicView::Impl
+{
+public:
+   explicit Impl(RadarMosaicView* self) : self_ {self} {}
+   ~Impl() { threadPool_.join(); }
+
+   void ConnectRadarProductManager(const std::shared_ptr<MosaicSite>& site);
+   void DisconnectRadarProductManager(const std::shared_ptr<MosaicSite>& site);
+   void LoadData(const std::shared_ptr<MosaicSite>&    site,
+                 std::chrono::system_clock::time_point time);
+   void Reset();
+   void UpdateAutoRefresh(const std::shared_ptr<MosaicSite>& site,
+                          bool                               enabled) const;
+   void UpdateGrid();
+   void UpdateMosaic();
+
+   void Composite(const std::vector<std::shared_ptr<MosaicSite>>& sites,
+                  const Grid&                                     grid,
+                  Compositing compositing);
+
+   static void
+   ResampleSweep(MosaicSite&                                        site,
+                 wsr88d::rda::DataBlockType                         blockType,
+                 const DataScale&                                   dataScale,
+                 const std::shared_ptr<wsr88d::rda::ElevationScan>& scan);
+
+   RadarMosaicView*   self_;
+   boost::uuids::uuid uuid_ {boost::uuids::random_generator()()};
+
+   boost::asio::thread_pool threadPool_ {1u};
+   std::atomic<bool>        updatePending_ {false};
+
+   bool autoRefreshEnabled_ {false};
+   bool autoUpdateEnabled_ {false};
+
+   // Selection, modified by the main thread and read by the update thread
+   mutable std::mutex                       selectionMutex_ {};
+   std::vector<std::shared_ptr<MosaicSite>> sites_ {};
+   Grid                                     nextGrid_ {};
+   bool                                     enabled_ {false};
+   Compositing                              compositing_ {
+      Compositing::NearestRadar};
+   common::Level2Product product_ {common::Level2Product::Unknown};
+   float                 elevation_ {0.0f};
+   std::chrono::system_clock::time_point selectedTime_ {};
+   std::size_t                           generation_ {1u};
+
+   // Working buffers, only accessed by the update thread
+   std::vector<std::uint8_t>  workingLevels_ {};
+   std::vector<std::uint32_t> workingKeys_ {};
+
+   // Published mosaic
+   mutable std::mutex        mosaicMutex_ {};
+   Grid                      grid_ {};
+   DataScale                 dataScale_ {};
+   std::vector<std::uint8_t> mosaic_ {};
+};
+
+RadarMosaicView::RadarMosaicView() : p(std::make_unique<Impl>(this)) {}
+RadarMosaicView::~RadarMosaicView()
+{
+   std::unique_lock lock {p->selectionMutex_};
+
+   for (auto& site : p->sites_)
+   {
+      p->UpdateAutoRefresh(site, false);
+   }
+}
+
+RadarMosaicView::Compositing RadarMosaicView::compositing() const
+{
+   std::unique_lock lock {p->selectionMutex_};
+   return p->compositing_;
+}
+
+bool RadarMosaicView::enabled() const
+{
+   std::unique_lock lock {p->selectionMutex_};
+   return p->enabled_;
+}
+
+std::vector<std::string> RadarMosaicView::radar_sites() const
+{
+   std::unique_lock lock {p->selectionMutex_};
+
+   std::vector<std::string> radarIds {};
+   radarIds.reserve(p->sites_.size());
+
+   for (auto& site : p->sites_)
+   {
+      radarIds.push_back(site->radarId_);
+   }
+
+   return radarIds;
+}
+
+const RadarMosaicView::Grid& RadarMosaicView::grid() const
+{
+   return p->grid_;
+}
+
+const RadarMosaicView::DataScale& RadarMosaicView::data_scale() const
+{
+   return p->dataScale_;
+}
+
+std::mutex& RadarMosaicView::mosaic_mutex() const
+{
+   return p->mosaicMutex_;
+}
+
+void RadarMosaicView::set_compositing(Compositing compositing)
+{
+   std::unique_lock lock {p->selectionMutex_};
+
+   if (p->compositing_ != compositing)
+   {
+      p->compositing_ = compositing;
+      ++p->generation_;
+
+      lock.unlock();
+      Update();
+   }
+}
+
+std::tuple<const void*, std::size_t, std::size_t>
+RadarMosaicView::GetMosaicData() const
+{
+   if (p->mosaic_.empty())
+   {
+      return {nullptr, 0u, 0u};
+   }
+
+   return {p->mosaic_.data(), p->grid_.columns_, p->grid_.rows_};
+}
+
+void RadarMosaicView::SelectElevation(float elevation)
+{
+   std::unique_lock lock {p->selectionMutex_};
+
+   if (p->elevation_ != elevation)
+   {
+      p->elevation_ = elevation;
+      ++p->generation_;
+
+      lock.unlock();
+      Update();
+   }
+}
+
+void RadarMosaicView::SelectProduct(common::Level2Product product)
+{
+   std::unique_lock lock {p->selectionMutex_};
+
+   if (p->product_ != product)
+   {
+      // Refresh is enabled per product
+      for (auto& site : p->sites_)
+      {
+         p->UpdateAutoRefresh(site, false);
+      }
+
+      p->product_ = product;
+      ++p->generation_;
+
+      for (auto& site : p->sites_)
+      {
+         p->UpdateAutoRefresh(site, p->autoRefreshEnabled_);
+      }
+
+      lock.unlock();
+      Update();
+   }
+}
+
+void RadarMosaicView::SelectTime(std::chrono::system_clock::time_point time)
+{
+   std::unique_lock lock {p->selectionMutex_};
+
+   if (p->selectedTime_ != time)
+   {
+      p->selectedTime_ = time;
+
+      lock.unlock();
+      Update();
+   }
+}
+
+void RadarMosaicView::SetAutoRefresh(bool enabled)
+{
+   std::unique_lock lock {p->selectionMutex_};
+
+   if (p->autoRefreshEnabled_ != enabled)
+   {
+      p->autoRefreshEnabled_ = enabled;
+
+      for (auto& site : p->sites_)
+      {
+         p->UpdateAutoRefresh(site, enabled);
+      }
+   }
+}
+
+void RadarMosaicView::SetAutoUpdate(bool enabled)
+{
+   p->autoUpdateEnabled_ = enabled;
+}
+
+void RadarMosaicView::SetEnabled(bool enabled)
+{
+   std::unique_lock lock {p->selectionMutex_};
+
+   if (p->enabled_ != enabled)
+   {
+      logger_->debug("SetEnabled: {}", enabled);
+
+      p->enabled_ = enabled;
+
+      for (auto& site : p->sites_)
+      {
+         p->UpdateAutoRefresh(site, p->autoRefreshEnabled_);
+      }
+
+      lock.unlock();
+
+      if (enabled)
+      {
+         Update();
+      }
+      else
+      {
+         // Release cached geometry and sweeps while disabled
+         boost::asio::post(p->threadPool_, [this]() { p->Reset(); });
+      }
+   }
+}
+
+void RadarMosaicView::SetRadarSites(const std::vector<std::string>& radarIds)
+{
+   std::unique_lock lock {p->selectionMutex_};
+
+   std::vector<std::shared_ptr<MosaicSite>> sites {};
+   sites.reserve(radarIds.size());
+
+   for (auto& radarId : radarIds)
+   {
+      // Retain existing sites
+      auto it = std::find_if(p->sites_.begin(),
+                             p->sites_.end(),
+                             [&](auto& site)
+                             { return site->radarId_ == radarId; });
+
+      if (it != p->sites_.end())
+      {
+         sites.push_back(*it);
+         p->sites_.erase(it);
+         continue;
+      }
+
+      auto site = std::make_shared<MosaicSite>(radarId);
+      if (site->radarSite_ == nullptr)
+      {
+         logger_->warn("Unknown radar site: {}", radarId);
+         continue;
+      }
+
+      p->ConnectRadarProductManager(site);
+      p->UpdateAutoRefresh(site, p->autoRefreshEnabled_);
+
+      sites.push_back(site);
+   }
+
+   // Release sites no longer in the mosaic
+   for (auto& site : p->sites_)
+   {
+      p->UpdateAutoRefresh(site, false);
+      p->DisconnectRadarProductManager(site);
+   }
+
+   p->sites_.swap(sites);
+   p->UpdateGrid();
+
+   lock.unlock();
+   Update();
+}
+
+void RadarMosaicView::Update()
+{
+   // Coalesce updates requested while an update is pending
+   if (!p->updatePending_.exchange(true))
+   {
+      boost::asio::post(p->threadPool_,
+                        [this]()
+                        {
+                           p->updatePending_ = false;
+
+                           try
+                           {
+                              p->UpdateMosaic();
+                           }
+                           catch (const std::exception& ex)
+                           {
+                              logger_->error(ex.what());
+                           }
+                        });
+   }
+}
+
+void RadarMosaicView::Impl::ConnectRadarProductManager(
+   const std::shared_ptr<MosaicSite>& site)
+{
+   connect(site->radarProductManager_.get(),
+           &manager::RadarProductManager::DataReloaded,
+           self_,
+           [this](std::shared_ptr<types::RadarProductRecord> record)
+           {
+              if (record->radar_product_group() ==
+                  common::RadarProductGroup::Level2)
+              {
+                 self_->Update();
+              }
+           });
+
+   connect(
+      site->radarProductManager_.get(),
+      &manager::RadarProductManager::NewDataAvailable,
+      self_,
+      [site, this](common::RadarProductGroup group,
+                   const std::string&,
+                   std::chrono::system_clock::time_point latestTime)
+      {
+         if (autoRefreshEnabled_ && group == common::RadarProductGroup::Level2)
+         {
+            LoadData(site, latestTime);
+         }
+      },
+      Qt::QueuedConnection);
+}
+
+void RadarMosaicView::Impl::DisconnectRadarProductManager(
+   const std::shared_ptr<MosaicSite>& site)
+{
+   disconnect(site->radarProductManager_.get(), nullptr, self_, nullptr);
+}
+
+void RadarMosaicView::Impl::LoadData(const std::shared_ptr<MosaicSite>& site,
+                                     std::chrono::system_clock::time_point time)
+{
+   logger_->debug("Load Data: {}, {}",
+                  site->radarId_,
+                  scwx::util::TimeString(time));
+
+   // Create file request
+   std::shared_ptr<request::NexradFileRequest> request =
+      std::make_shared<request::NexradFileRequest>(site->radarId_);
+
+   connect(request.get(),
+           &request::NexradFileRequest::RequestComplete,
+           self_,
+           [this](std::shared_ptr<request::NexradFileRequest> request)
+           {
+              // Update if the latest data is selected, or if the load was
+              // requested for the selected time
+              if (request->radar_product_record() != nullptr &&
+                  (autoUpdateEnabled_ ||
+                   selectedTime_ != std::chrono::system_clock::time_point {}))
+              {
+                 self_->Update();
+              }
+           });
+
+   // Load file
+   boost::asio::post(threadPool_,
+                     [=, this]()
+                     {
+                        try
+                        {
+                           site->radarProductManager_->LoadLevel2Data(
+                              time, request);
+                        }
+                        catch (const std::exception& ex)
+                        {
+                           logger_->error(ex.what());
+                        }
+                     });
+}
+
+void RadarMosaicView::Impl::Reset()
+{
+   std::unique_lock selectionLock {selectionMutex_};
+   if (enabled_)
+   {
+      // The mosaic was re-enabled before the reset was processed
+      return;
+   }
+   auto sites = sites_;
+   selectionLock.unlock();
+
+   for (auto& site : sites)
+   {
+      site->geometry_ = {};
+      site->levels_   = {};
+      site->elevationScan_.reset();
+      site->requestedTime_ = {};
+   }
+
+   workingLevels_ = {};
+   workingKeys_   = {};
+
+   std::unique_lock mosaicLock {mosaicMutex_};
+   grid_   = {};
+   mosaic_ = {};
+   mosaicLock.unlock();
+
+   Q_EMIT self_->MosaicUpdated();
+}
+
+void RadarMosaicView::Impl::UpdateAutoRefresh(
+   const std::shared_ptr<MosaicSite>& site, bool enabled) const
+{
+   if (product_ != common::Level2Product::Unknown)
+   {
+      site->radarProductManager_->EnableRefresh(
+         common::RadarProductGroup::Level2,
+         common::GetLevel2Name(product_),
+         enabled && enabled_,
+         uuid_);
+   }
+}
+
+void RadarMosaicView::Impl::UpdateGrid()
+{
+   std::vector<common::Coordinate> coordinates {};
+   coordinates.reserve(sites_.size());
+
+   for (auto& site : sites_)
+   {
+      coordinates.emplace_back(site->radarSite_->latitude(),
+                               site->radarSite_->longitude());
+   }
+
+   nextGrid_ = util::ComputeMosaicGrid(coordinates);
+}
+
+void RadarMosaicView::Impl::ResampleSweep(
+   MosaicSite&                                        site,
+   wsr88d::rda::DataBlockType                         blockType,
+   const DataScale&                                   dataScale,
+   const std::shared_ptr<wsr88d::rda::ElevationScan>& scan)
+{
+   std::vector<util::MosaicRadial> radials {};
+   radials.reserve(scan->size());
+
+   for (auto& radial : *scan)
+   {
+      auto momentData = radial.second->moment_data_block(blockType);
+      if (momentData == nullptr)
+      {
+         continue;
+      }
+
+      const std::size_t wordSize = momentData->data_word_size();
+      if ((wordSize != 8 && wordSize != 16) || momentData->scale() == 0.0f)
+      {
+         continue;
+      }
+
+      const std::int32_t interval =
+         momentData->data_moment_range_sample_interval_raw();
+      if (interval <= 0)
+      {
+         continue;
+      }
+
+      const std::int32_t intervalH = interval / 2;
+      const std::int32_t range =
+         std::max<std::int32_t>(momentData->data_moment_range_raw(), intervalH);
+
+      radials.push_back(
+         {radial.second->azimuth_angle().value(),
+          momentData->data_moments(),
+          wordSize,
+          momentData->scale(),
+          momentData->offset(),
+          range - intervalH,
+          interval,
+          momentData->number_of_data_moment_gates(),
+          static_cast<std::uint16_t>(
+             std::max<std::int16_t>(2, momentData->snr_threshold_raw()))});
+   }
+
+   site.levels_ = util::ResampleMosaicSweep(site.geometry_, radials, dataScale);
+}
+
+void RadarMosaicView::Impl::Composite(
+   const std::vector<std::shared_ptr<MosaicSite>>& sites,
+   const Grid&                                     grid,
+   Compositing                                     compositing)
+{
+   std::vector<util::MosaicSiteLevels> siteLevels {};
+   siteLevels.reserve(sites.size());
+
+   for (auto& site : sites)
+   {
+      siteLevels.push_back({&site->geometry_, &site->levels_});
+   }
+
+   util::CompositeMosaic(
+      grid, siteLevels, compositing, workingLevels_, workingKeys_);
+}
+
+void RadarMosaicView::Impl::UpdateMosaic()
+{
+   // Take a snapshot of the selection
+   std::unique_lock selectionLock {selectionMutex_};
+
+   if (!enabled_)
+   {
+      return;
+   }
+
+   const auto                  sites        = sites_;
+   const Grid                  grid         = nextGrid_;
+   Compositing                 compositing  = compositing_;
+   const common::Level2Product product      = product_;
+   const float                 elevation    = elevation_;
+   const auto                  selectedTime = selectedTime_;
+   const std::size_t           generation   = generation_;
+
+   selectionLock.unlock();
+
+   auto blockType = blockTypes_.find(product);
+   auto dataScale = dataScales_.find(product);
+
+   if (blockType == blockTypes_.cend() || dataScale == dataScales_.cend() ||
+       sites.empty())
+   {
+      std::unique_lock mosaicLock {mosaicMutex_};
+      if (mosaic_.empty())
+      {
+         return;
+      }
+      grid_   = {};
+      mosaic_ = {};
+      mosaicLock.unlock();
+
+      Q_EMIT self_->MosaicUpdated();
+      return;
+   }
+
+   if (compositing == Compositing::Maximum &&
+       product == common::Level2Product::Velocity)
+   {
+      // The maximum of signed velocities has no physical meaning
+      logger_->debug("Maximum compositing is not supported for velocity");
+      compositing = Compositing::NearestRadar;
+   }
+
+   boost::timer::cpu_timer timer {};
+
+   const auto referenceTime =
+      (selectedTime == std::chrono::system_clock::time_point {}) ?
+         scwx::util::CurrentTime() :
+         selectedTime;
+
+   std::atomic<bool>                        gridChanged {false};
+   std::atomic<std::size_t>                 sitesResampled {0u};
+   std::vector<std::shared_ptr<MosaicSite>> sitesToLoad {};
+   std::mutex                               sitesToLoadMutex {};
+
+   // Resample the sweeps which have changed
+   std::for_each(
+      std::execution::par,
+      sites.cbegin(),
+      sites.cend(),
+      [&](const std::shared_ptr<MosaicSite>& site)
+      {
+         if (site->geometry_.resolution_ != grid.resolution_)
+         {
+            site->geometry_ = util::ComputeMosaicSiteGeometry(
+               {site->radarSite_->latitude(), site->radarSite_->longitude()},
+               grid.resolution_);
+            site->elevationScan_.reset();
+            gridChanged = true;
+         }
+
+         auto [elevationScan, elevationCut, elevationCuts, foundTime] =
+            site->radarProductManager_->GetLevel2Data(
+               blockType->second, elevation, selectedTime);
+
+         // Do not composite stale sweeps
+         if (elevationScan != nullptr &&
+             foundTime + kMaxSweepAge_ < referenceTime)
+         {
+            elevationScan = nullptr;
+         }
+
+         if (elevationScan == nullptr &&
+             selectedTime != std::chrono::system_clock::time_point {} &&
+             site->requestedTime_ != selectedTime)
+         {
+            // Request data for the selected time
+            site->requestedTime_ = selectedTime;
+
+            std::unique_lock lock {sitesToLoadMutex};
+            sitesToLoad.push_back(site);
+         }
+
+         if (elevationScan == site->elevationScan_ &&
+             generation == site->generation_)
+         {
+            return;
+         }
+
+         site->elevationScan_ = elevationScan;
+         site->generation_    = generation;
+
+         if (elevationScan != nullptr)
+         {
+            ResampleSweep(
+               *site, blockType->second, dataScale->second, elevationScan);
+         }
+         else
+         {
+            site->levels_.clear();
+         }
+
+         ++sitesResampled;
+      });
+
+   for (auto& site : sitesToLoad)
+   {
+      LoadData(site, selectedTime);
+   }
+
+   if (sitesResampled == 0u && !gridChanged)
+   {
+      std::unique_lock mosaicLock {mosaicMutex_};
+      if (grid_ == grid)
+      {
+         // Nothing has changed
+         return;
+      }
+   }
+
+   Composite(sites, grid, compositing);
+
+   timer.stop();
+   logger_->debug("Mosaic updated: {} of {} sites resampled in {}",
+                  sitesResampled.load(),
+                  sites.size(),
+                  timer.format(6, "%ws"));
+
+   // Publish the mosaic
+   std::unique_lock mosaicLock {mosaicMutex_};
+   grid_      = grid;
+   dataScale_ = dataScale->second;
+   mosaic_.swap(workingLevels_);
+   mosaicLock.unlock();
+
+   Q_EMIT self_->MosaicUpdated();
+}
+
+std::vector<std::string>
+RadarMosaicView::FindNearbyRadarSites(const std::string& radarId,
+                                      std::size_t        maxSites)
+{
+   std::vector<std::string> radarIds {};
+
+   auto radarSite = config::RadarSite::Get(radarId);
+   if (radarSite == nullptr || maxSites == 0u)
+   {
+      return radarIds;
+   }
+
+   const auto&                                 geodesic =
+      util::GeographicLib::DefaultGeodesic();
+   std::vector<std::pair<double, std::string>> candidates {};
+
+   for (auto& site : config::RadarSite::GetAll())
+   {
+      if (site->id() == radarSite->id() || site->type() != radarSite->type())
+      {
+         continue;
+      }
+
+      double distance;
+      geodesic.Inverse(radarSite->latitude(),
+                       radarSite->longitude(),
+                       site->latitude(),
+                       site->longitude(),
+                       distance);
+
+      if (distance <= kMaxSiteDistance_)
+      {
+         candidates.emplace_back(distance, site->id());
+      }
+   }
+
+   std::sort(candidates.begin(), candidates.end());
+
+   radarIds.push_back(radarSite->id());
+
+   for (auto& candidate : candidates)
+   {
+      if (radarIds.size() >= maxSites)
+      {
+         break;
+      }
+      radarIds.push_back(candidate.second);
+   }
+
+   return radarIds;
+}
+
+} // namespace view
+} // namespace qt
+} // namespace scwx
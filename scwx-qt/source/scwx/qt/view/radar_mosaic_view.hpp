@@ -0,0 +1,130 @@
+#pragma once
+
+#include <scwx/common/products.hpp>
+#include <scwx/qt/util/radar_mosaic.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <QObject>
+
+namespace scwx
+{
+namespace qt
+{
+namespace view
+{
+
+/**
+ * Composites the Level 2 sweeps of multiple radar sites onto a common
+ * latitude/longitude grid.
+ *
+ * The grid geometry (range and azimuth of each grid cell from each site) is
+ * computed once per site, and only sites whose sweep has changed are
+ * resampled when new data arrives.
+ */
+class RadarMosaicView : public QObject
+{
+   Q_OBJECT
+
+public:
+   typedef util::MosaicCompositing Compositing;
+   typedef util::MosaicGrid        Grid;
+
+   /**
+    * Scale and offset of the composited data levels. Sites may encode a
+    * product with different scales, so each site's data is converted to the
+    * common scale of the product before compositing.
+    */
+   typedef util::MosaicDataScale DataScale;
+
+   explicit RadarMosaicView();
+   virtual ~RadarMosaicView();
+
+   Compositing              compositing() const;
+   bool                     enabled() const;
+   std::vector<std::string> radar_sites() const;
+
+   /**
+    * Gets the data scale of the current mosaic. The mosaic mutex must be held.
+    *
+    * @return Mosaic data scale
+    */
+   const DataScale& data_scale() const;
+
+   /**
+    * Gets the grid of the current mosaic. The mosaic mutex must be held.
+    *
+    * @return Mosaic grid
+    */
+   const Grid& grid() const;
+
+   /**
+    * Gets the mutex protecting the mosaic grid and data.
+    *
+    * @return Mosaic mutex
+    */
+   std::mutex& mosaic_mutex() const;
+
+   void set_compositing(Compositing compositing);
+
+   /**
+    * Gets the composited data levels, one byte per grid cell in row-major
+    * order. The mosaic mutex must be held while the data is accessed.
+    *
+    * @return Data levels, grid columns and grid rows
+    */
+   std::tuple<const void*, std::size_t, std::size_t> GetMosaicData() const;
+
+   void SelectElevation(float elevation);
+   void SelectProduct(common::Level2Product product);
+   void SelectTime(std::chrono::system_clock::time_point time);
+   void SetAutoRefresh(bool enabled);
+   void SetAutoUpdate(bool enabled);
+
+   /**
+    * Enables or disables the mosaic. While disabled, no data is loaded or
+    * refreshed for the mosaic sites.
+    *
+    * @param [in] enabled Enable the mosaic
+    */
+   void SetEnabled(bool enabled);
+
+   /**
+    * Sets the radar sites composited into the mosaic. Cached geometry is
+    * retained for sites which remain in the mosaic.
+    *
+    * @param [in] radarIds Radar site IDs
+    */
+   void SetRadarSites(const std::vector<std::string>& radarIds);
+
+   void Update();
+
+   /**
+    * Finds radar sites of the same type near a radar site, ordered by
+    * distance. The radar site itself is included first.
+    *
+    * @param [in] radarId Radar site ID
+    * @param [in] maxSites Maximum number of radar sites
+    *
+    * @return Radar site IDs
+    */
+   static std::vector<std::string>
+   FindNearbyRadarSites(const std::string& radarId, std::size_t maxSites = 10);
+
+signals:
+   void MosaicUpdated();
+
+private:
+   class Impl;
+   std::unique_ptr<Impl> p;
+};
+
+} // namespace view
+} // namespace qt
+} // namespace scwx
@@ -92,6 +92,23 @@ std::chrono::system_clock::time_point RadarProductView::sweep_time() const
    return {};
 }
 
+const std::vector<float>& RadarProductView::texture_coordinates() const
+{
+   static const std::vector<float> kEmptyTextureCoordinates_ {};
+   return kEmptyTextureCoordinates_;
+}
+
+std::shared_ptr<const std::vector<float>>
+RadarProductView::shared_vertices() const
+{
+   return nullptr;
+}
+
+std::shared_ptr<const PublishedSweep> RadarProductView::published_sweep() const
+{
+   return nullptr;
+}
+
 std::mutex& RadarProductView::sweep_mutex()
 {
    return p->sweepMutex_;
@@ -155,6 +172,21 @@ RadarProductView::GetCfpMomentData() const
    return std::tie(data, dataSize, componentSize);
 }
 
+std::tuple<std::uint16_t, bool> RadarProductView::GetDisplayThreshold() const
+{
+   return {0u, true};
+}
+
+std::tuple<const void*, std::size_t, std::size_t>
+RadarProductView::GetRasterTextureData() const
+{
+   const void* data   = nullptr;
+   std::size_t width  = 0;
+   std::size_t height = 0;
+
+   return std::tie(data, width, height);
+}
+
 bool RadarProductView::IgnoreUnits() const
 {
    return false;
@@ -8,9 +8,11 @@
 #include <scwx/wsr88d/wsr88d_types.hpp>
 
 #include <chrono>
+#include <cstdint>
 #include <memory>
 #include <mutex>
 #include <optional>
+#include <tuple>
 #include <vector>
 
 #include <QObject>
@@ -25,6 +27,37 @@ namespace view
 
 class RadarProductViewImpl;
 
+/**
+ * Sweep published by a view for rendering. A published sweep is immutable,
+ * and shares ownership of its data, so it can be read without the sweep mutex
+ * while the view computes the next sweep.
+ */
+struct PublishedSweep
+{
+   // Increases with each sweep published by the view
+   std::uint64_t generation_ {};
+
+   std::shared_ptr<const std::vector<float>> vertices_ {};
+
+   std::shared_ptr<const void> momentData_ {};
+   std::size_t                 momentDataSize_ {};
+   std::size_t                 momentComponentSize_ {};
+
+   std::shared_ptr<const void> cfpMomentData_ {};
+   std::size_t                 cfpMomentDataSize_ {};
+   std::size_t                 cfpMomentComponentSize_ {};
+
+   std::tuple<const void*, std::size_t, std::size_t> moment_data() const
+   {
+      return {momentData_.get(), momentDataSize_, momentComponentSize_};
+   }
+   std::tuple<const void*, std::size_t, std::size_t> cfp_moment_data() const
+   {
+      return {
+         cfpMomentData_.get(), cfpMomentDataSize_, cfpMomentComponentSize_};
+   }
+};
+
 class RadarProductView : public QObject
 {
    Q_OBJECT
@@ -42,11 +75,30 @@ public:
    virtual float                                 elevation() const;
    virtual float                                 range() const;
    virtual std::chrono::system_clock::time_point sweep_time() const;
+   virtual const std::vector<float>&             texture_coordinates() const;
    virtual float                                 unit_scale() const = 0;
    virtual std::string                           units() const      = 0;
    virtual std::uint16_t                         vcp() const        = 0;
    virtual const std::vector<float>&             vertices() const   = 0;
 
+   /**
+    * Get the vertices of the current sweep, if they are shared with other
+    * views displaying the same sweep. Shared vertices are immutable, and may
+    * be buffered once for each view displaying the sweep.
+    *
+    * @return Shared vertices, or nullptr if the vertices are not shared
+    */
+   virtual std::shared_ptr<const std::vector<float>> shared_vertices() const;
+
+   /**
+    * Get the most recently published sweep. Views which publish sweeps are
+    * rendered from the published sweep, without taking the sweep mutex.
+    *
+    * @return Published sweep, or nullptr if the view does not publish sweeps,
+    * or has not yet published a sweep
+    */
+   virtual std::shared_ptr<const PublishedSweep> published_sweep() const;
+
    std::shared_ptr<manager::RadarProductManager> radar_product_manager() const;
    std::chrono::system_clock::time_point         selected_time() const;
    std::mutex&                                   sweep_mutex();
@@ -72,6 +124,31 @@ public:
    virtual std::tuple<const void*, std::size_t, std::size_t>
    GetCfpMomentData() const;
 
+   /**
+    * Get the display threshold of the current sweep. Bins below the threshold
+    * are discarded when rendering rather than omitted from the sweep, so the
+    * threshold can change without recomputing the sweep. Range folded bins
+    * are displayed independently of the threshold. The sweep mutex must be
+    * held, unless the view publishes sweeps.
+    *
+    * @return Lowest displayed data level, and whether range folded bins are
+    * displayed
+    */
+   virtual std::tuple<std::uint16_t, bool> GetDisplayThreshold() const;
+
+   /**
+    * Get the raster texture for products drawn as a single texture on a
+    * coarse mesh, rather than as individual bins. Each texel is an 8-bit data
+    * level, and bins which are not displayed are set to 0. When a raster
+    * texture is present, vertices are mesh vertices, and texture_coordinates
+    * contains the texture coordinate of each vertex.
+    *
+    * @return Texture data, texture width and texture height. Texture data is
+    * nullptr if the product is not drawn as a texture.
+    */
+   virtual std::tuple<const void*, std::size_t, std::size_t>
+   GetRasterTextureData() const;
+
    virtual std::optional<std::uint16_t>
    GetBinLevel(const common::Coordinate& coordinate) const = 0;
    virtual std::optional<wsr88d::DataLevelCode>
@@ -94,6 +171,13 @@ protected slots:
 
 signals:
    void ColorTableLutUpdated();
+
+   /**
+    * This signal is emitted when the data moments of the current sweep are
+    * modified without recomputing the sweep. The vertices are unchanged.
+    */
+   void MomentDataUpdated();
+
    void SweepComputed();
    void SweepNotComputed(types::NoUpdateReason reason);
 
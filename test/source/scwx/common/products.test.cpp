@@ -38,6 +38,18 @@ TEST(Products, GetLevel3ProductsByCategoryTest)
              products.cend());
 }
 
+TEST(Products, GetLevel2ProductTest)
+{
+   for (Level2Product product : Level2ProductIterator())
+   {
+      EXPECT_EQ(GetLevel2Product(GetLevel2Name(product)), product);
+   }
+
+   EXPECT_EQ(GetLevel2Product("SRV"), Level2Product::StormRelativeVelocity);
+   EXPECT_EQ(GetLevel2Palette(Level2Product::StormRelativeVelocity), "SRV");
+   EXPECT_EQ(GetLevel2Product("XXX"), Level2Product::Unknown);
+}
+
 TEST_P(GetLevel3ProductByAwipsIdTest, AwipsIdTest)
 {
    auto& [awipsId, productName] = GetParam();
@@ -1,5 +1,7 @@
 #include <scwx/gr/placefile.hpp>
 
+#include <sstream>
+
 #include <gtest/gtest.h>
 
 namespace scwx
@@ -17,5 +19,59 @@ TEST(PlacefileTest, OldExample)
    EXPECT_EQ(true, true);
 }
 
+TEST(PlacefileTest, InlineStatements)
+{
+   std::istringstream is {
+      "Title: Inline Test ; comment\r\n"
+      "Color: 255 0 0\r\r\n"
+      "Text: 35.0, -97.0, 1, \"Line 1\\nLine 2\", \"Hover; text\"\n"
+      "Polygon:\n"
+      "  35.0, -97.0\n"
+      "  36.0, -97.0\n"
+      "  36.0, -96.0\n"
+      "  35.0, -97.0\n"
+      "  35.5, -96.5\n"
+      "  35.6, -96.5\n"
+      "End:\n"
+      "Line: 2, 0\n"
+      "  35.0, -97.0\n"
+      "  bad, -96.0\n"
+      "  36.0, -96.0\n"
+      "End:"};
+
+   std::shared_ptr<Placefile> placefile = Placefile::Load("inline", is);
+
+   ASSERT_NE(placefile, nullptr);
+   EXPECT_EQ(placefile->title(), "Inline Test");
+
+   auto drawItems = placefile->GetDrawItems();
+   ASSERT_EQ(drawItems.size(), 3);
+
+   ASSERT_EQ(drawItems[0]->itemType_, Placefile::ItemType::Text);
+   auto text = std::static_pointer_cast<Placefile::TextDrawItem>(drawItems[0]);
+   EXPECT_EQ(text->text_, "Line 1\nLine 2");
+   EXPECT_EQ(text->hoverText_, "Hover; text");
+   EXPECT_EQ(text->fontNumber_, 1u);
+   EXPECT_EQ(text->color_, boost::gil::rgba8_pixel_t(255, 0, 0, 255));
+
+   ASSERT_EQ(drawItems[1]->itemType_, Placefile::ItemType::Polygon);
+   auto polygon =
+      std::static_pointer_cast<Placefile::PolygonDrawItem>(drawItems[1]);
+   ASSERT_EQ(polygon->contours_.size(), 2);
+   EXPECT_EQ(polygon->contours_[0].size(), 4);
+   EXPECT_EQ(polygon->contours_[1].size(), 2);
+
+   ASSERT_EQ(drawItems[2]->itemType_, Placefile::ItemType::Line);
+   auto line = std::static_pointer_cast<Placefile::LineDrawItem>(drawItems[2]);
+   EXPECT_DOUBLE_EQ(line->width_, 2.0);
+   ASSERT_EQ(line->elements_.size(), 2);
+   EXPECT_DOUBLE_EQ(line->elements_[1].latitude_, 36.0);
+
+   // Draw items remain valid after the placefile is released
+   placefile.reset();
+   EXPECT_EQ(text->text_, "Line 1\nLine 2");
+   EXPECT_EQ(polygon->contours_[1][1].latitude_, 35.6);
+}
+
 } // namespace gr
 } // namespace scwx
@@ -0,0 +1,195 @@
+#include <scwx/provider/event_pack.hpp>
+#include <scwx/provider/event_pack_nexrad_data_provider.hpp>
+#include <scwx/provider/event_pack_warnings_provider.hpp>
+#include <scwx/provider/event_pack_writer.hpp>
+#include <scwx/wsr88d/ar2v_file.hpp>
+#include <scwx/wsr88d/level3_file.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace provider
+{
+
+static const std::string kLevel2File_ {std::string(SCWX_TEST_DATA_DIR) +
+                                       "/nexrad/level2/"
+                                       "Level2_KLSX_20210527_1757.ar2v"};
+static const std::string kLevel3File_ {std::string(SCWX_TEST_DATA_DIR) +
+                                       "/nexrad/level3/"
+                                       "KLSX_SDUS23_N2QLSX_202112110250"};
+static const std::string kWarningsFile_ {
+   std::string(SCWX_TEST_DATA_DIR) + "/warnings/warnings_20210606_22-08.txt"};
+
+static std::vector<char> ReadFile(const std::string& filename)
+{
+   std::ifstream ifs {filename, std::ios_base::in | std::ios_base::binary};
+   return {std::istreambuf_iterator<char>(ifs),
+           std::istreambuf_iterator<char>()};
+}
+
+class EventPackTest : public testing::Test
+{
+protected:
+   void SetUp() override
+   {
+      using namespace std::chrono;
+
+      constexpr sys_days level2Date {year {2021} / May / 27};
+      constexpr sys_days level3Date {year {2021} / December / 11};
+      constexpr sys_days warningsDate {year {2021} / June / 6};
+
+      level2Time_   = level2Date + 17h + 57min;
+      level3Time_   = level3Date + 2h + 50min;
+      warningsTime_ = warningsDate + 22h + 8min;
+
+      auto level2Data   = ReadFile(kLevel2File_);
+      auto level3Data   = ReadFile(kLevel3File_);
+      auto warningsData = ReadFile(kWarningsFile_);
+
+      EventPackWriter writer {};
+
+      // Add objects out of order to verify the index is sorted
+      writer.AddObject(EventPackObjectType::Level3,
+                       "KLSX",
+                       "N2Q",
+                       "LSX_N2Q_2021_12_11_02_50_00",
+                       level3Time_,
+                       level3Data);
+      writer.AddObject(EventPackObjectType::Level2,
+                       "KLSX",
+                       "",
+                       "2021/05/27/KLSX/KLSX20210527_175700_V06",
+                       level2Time_,
+                       level2Data);
+      writer.AddObject(EventPackObjectType::TextProduct,
+                       "",
+                       "",
+                       "warnings_20210606_22.txt",
+                       warningsTime_,
+                       warningsData);
+
+      filename_ = (std::filesystem::temp_directory_path() /
+                   "scwx_event_pack_test.scwxevt")
+                     .string();
+
+      ASSERT_EQ(writer.object_count(), 3u);
+      ASSERT_TRUE(writer.WriteFile(filename_));
+
+      eventPack_ = std::make_shared<EventPack>();
+      ASSERT_TRUE(eventPack_->LoadFile(filename_));
+   }
+
+   void TearDown() override
+   {
+      eventPack_.reset();
+      std::filesystem::remove(filename_);
+   }
+
+   std::string                           filename_ {};
+   std::shared_ptr<EventPack>            eventPack_ {};
+   std::chrono::system_clock::time_point level2Time_ {};
+   std::chrono::system_clock::time_point level3Time_ {};
+   std::chrono::system_clock::time_point warningsTime_ {};
+};
+
+TEST_F(EventPackTest, Index)
+{
+   auto& objects = eventPack_->objects();
+
+   ASSERT_EQ(objects.size(), 3u);
+
+   EXPECT_EQ(objects[0].type_, EventPackObjectType::Level2);
+   EXPECT_EQ(objects[0].time_, level2Time_);
+   EXPECT_EQ(objects[0].radarSite_, "KLSX");
+   EXPECT_EQ(objects[0].key_, "2021/05/27/KLSX/KLSX20210527_175700_V06");
+   EXPECT_EQ(objects[0].data_.size(), ReadFile(kLevel2File_).size());
+
+   EXPECT_EQ(objects[1].type_, EventPackObjectType::TextProduct);
+   EXPECT_EQ(objects[1].time_, warningsTime_);
+
+   EXPECT_EQ(objects[2].type_, EventPackObjectType::Level3);
+   EXPECT_EQ(objects[2].time_, level3Time_);
+   EXPECT_EQ(objects[2].product_, "N2Q");
+
+   auto products =
+      eventPack_->GetProducts(EventPackObjectType::Level3, "KLSX");
+   EXPECT_EQ(products, std::vector<std::string> {"N2Q"});
+}
+
+TEST_F(EventPackTest, Level2DataProvider)
+{
+   EventPackNexradDataProvider provider {
+      eventPack_, EventPackObjectType::Level2, "KLSX"};
+
+   EXPECT_EQ(provider.cache_size(), 1u);
+   EXPECT_EQ(provider.last_modified(), level2Time_);
+
+   auto [newObjects, totalObjects] = provider.Refresh();
+   EXPECT_EQ(newObjects, 1u);
+   EXPECT_EQ(totalObjects, 1u);
+
+   std::tie(newObjects, totalObjects) = provider.Refresh();
+   EXPECT_EQ(newObjects, 0u);
+   EXPECT_EQ(totalObjects, 1u);
+
+   EXPECT_EQ(provider.FindKey(level2Time_ - std::chrono::minutes {1}), "");
+
+   std::string key = provider.FindKey(level2Time_ + std::chrono::minutes {1});
+   EXPECT_EQ(key, "2021/05/27/KLSX/KLSX20210527_175700_V06");
+   EXPECT_EQ(provider.FindLatestKey(), key);
+   EXPECT_EQ(provider.GetTimePointByKey(key), level2Time_);
+   EXPECT_EQ(provider.GetTimePointsByDate(level2Time_).size(), 1u);
+
+   auto file = provider.LoadObjectByKey(key);
+   EXPECT_NE(std::dynamic_pointer_cast<wsr88d::Ar2vFile>(file), nullptr);
+}
+
+TEST_F(EventPackTest, Level3DataProvider)
+{
+   EventPackNexradDataProvider provider {
+      eventPack_, EventPackObjectType::Level3, "KLSX", "N2Q"};
+
+   auto [success, newObjects, totalObjects] =
+      provider.ListObjects(level3Time_);
+   EXPECT_TRUE(success);
+   EXPECT_EQ(newObjects, 1u);
+   EXPECT_EQ(totalObjects, 1u);
+
+   auto file = provider.LoadObjectByKey(provider.FindLatestKey());
+   EXPECT_NE(std::dynamic_pointer_cast<wsr88d::Level3File>(file), nullptr);
+   EXPECT_EQ(provider.GetAvailableProducts(),
+             std::vector<std::string> {"N2Q"});
+}
+
+TEST_F(EventPackTest, WarningsProvider)
+{
+   EventPackWarningsProvider provider {eventPack_};
+
+   auto [newObjects, totalObjects] = provider.ListFiles();
+   EXPECT_EQ(newObjects, 1u);
+   EXPECT_EQ(totalObjects, 1u);
+
+   auto updatedFiles = provider.LoadUpdatedFiles();
+   ASSERT_EQ(updatedFiles.size(), 1u);
+   EXPECT_GT(updatedFiles[0]->message_count(), 0u);
+
+   std::tie(newObjects, totalObjects) = provider.ListFiles();
+   EXPECT_EQ(newObjects, 0u);
+   EXPECT_EQ(totalObjects, 1u);
+   EXPECT_TRUE(provider.LoadUpdatedFiles().empty());
+}
+
+TEST(EventPack, InvalidFile)
+{
+   EventPack eventPack {};
+   EXPECT_FALSE(eventPack.LoadFile(kLevel3File_));
+   EXPECT_TRUE(eventPack.objects().empty());
+}
+
+} // namespace provider
+} // namespace scwx
@@ -0,0 +1,283 @@
+#include <scwx/qt/gl/draw/geo_tile_index.hpp>
+
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace qt
+{
+namespace gl
+{
+namespace draw
+{
+
+static constexpr double kLatitude_  = 35.0;
+static constexpr double kLongitude_ = -97.0;
+
+// At zoom 6, the 1000x800 viewport extends approximately 7 degrees of
+// longitude from its center at any bearing
+static constexpr double kZoom_ = 6.0;
+
+static QMapLibre::CustomLayerRenderParameters
+CreateParams(double latitude  = kLatitude_,
+             double longitude = kLongitude_,
+             double zoom      = kZoom_)
+{
+   QMapLibre::CustomLayerRenderParameters params {};
+   params.width     = 1000.0;
+   params.height    = 800.0;
+   params.latitude  = latitude;
+   params.longitude = longitude;
+   params.zoom      = zoom;
+   params.bearing   = 0.0;
+   params.pitch     = 0.0;
+   return params;
+}
+
+// Bounds of a 0.1 degree square centered on the given coordinate
+static GeoTileIndex::Bounds CreateBounds(double latitude, double longitude)
+{
+   GeoTileIndex::Bounds bounds {};
+   bounds.Extend(latitude - 0.05, longitude - 0.05);
+   bounds.Extend(latitude + 0.05, longitude + 0.05);
+   return bounds;
+}
+
+class GeoTileIndexTest : public testing::Test
+{
+protected:
+   void GetDrawRanges(const QMapLibre::CustomLayerRenderParameters& params,
+                      float mapDistance = 0.0f)
+   {
+      index_.GetDrawRanges(params, mapDistance, first_, count_);
+   }
+
+   GeoTileIndex index_ {};
+
+   std::vector<GLint>   first_ {};
+   std::vector<GLsizei> count_ {};
+};
+
+TEST_F(GeoTileIndexTest, EmptyIndex)
+{
+   GetDrawRanges(CreateParams());
+
+   EXPECT_TRUE(first_.empty());
+   EXPECT_TRUE(count_.empty());
+}
+
+TEST_F(GeoTileIndexTest, IgnoresEmptyRanges)
+{
+   index_.AddRange(0, 0, CreateBounds(kLatitude_, kLongitude_), 0.0f, 0);
+   index_.AddRange(0, 3, GeoTileIndex::Bounds {}, 0.0f, 0);
+
+   GetDrawRanges(CreateParams());
+
+   EXPECT_TRUE(first_.empty());
+}
+
+TEST_F(GeoTileIndexTest, DrawOrderRestored)
+{
+   // Ranges alternate between two tiles, and are merged in draw order
+   index_.AddRange(0, 3, CreateBounds(kLatitude_, kLongitude_), 0.0f, 0);
+   index_.AddRange(3, 6, CreateBounds(kLatitude_, kLongitude_ + 3.0), 0.0f, 0);
+   index_.AddRange(9, 3, CreateBounds(kLatitude_, kLongitude_), 0.0f, 0);
+   index_.AddRange(15, 3, CreateBounds(kLatitude_, kLongitude_), 0.0f, 0);
+
+   GetDrawRanges(CreateParams());
+
+   EXPECT_EQ(first_, (std::vector<GLint> {0, 15}));
+   EXPECT_EQ(count_, (std::vector<GLsizei> {12, 3}));
+}
+
+TEST_F(GeoTileIndexTest, CullsOutsideViewport)
+{
+   index_.AddRange(0, 3, CreateBounds(kLatitude_, kLongitude_), 0.0f, 0);
+   index_.AddRange(3, 3, CreateBounds(kLatitude_, kLongitude_ + 20.0), 0.0f, 0);
+   index_.AddRange(6, 3, CreateBounds(kLatitude_ - 20.0, kLongitude_), 0.0f, 0);
+
+   GetDrawRanges(CreateParams());
+
+   EXPECT_EQ(first_, (std::vector<GLint> {0}));
+   EXPECT_EQ(count_, (std::vector<GLsizei> {3}));
+
+   // Panning the map to another range culls the first
+   GetDrawRanges(CreateParams(kLatitude_, kLongitude_ + 20.0));
+
+   EXPECT_EQ(first_, (std::vector<GLint> {3}));
+   EXPECT_EQ(count_, (std::vector<GLsizei> {3}));
+}
+
+TEST_F(GeoTileIndexTest, ZoomedOut)
+{
+   index_.AddRange(0, 3, CreateBounds(kLatitude_, kLongitude_), 0.0f, 0);
+   index_.AddRange(3, 3, CreateBounds(-40.0, 150.0), 0.0f, 0);
+
+   // The whole world is in the viewport at zoom 0
+   GetDrawRanges(CreateParams(kLatitude_, kLongitude_, 0.0));
+
+   EXPECT_EQ(first_, (std::vector<GLint> {0}));
+   EXPECT_EQ(count_, (std::vector<GLsizei> {6}));
+}
+
+TEST_F(GeoTileIndexTest, ZoomedIn)
+{
+   // A large range centered in a different tile than the viewport
+   GeoTileIndex::Bounds largeBounds {};
+   largeBounds.Extend(kLatitude_ - 5.0, kLongitude_ - 1.0);
+   largeBounds.Extend(kLatitude_ + 5.0, kLongitude_ + 9.0);
+
+   index_.AddRange(0, 3, largeBounds, 0.0f, 0);
+   index_.AddRange(3, 3, CreateBounds(kLatitude_, kLongitude_ + 0.2), 0.0f, 0);
+
+   // At zoom 20, the viewport spans less than 0.01 degrees. The large range
+   // extends over the viewport, and the small range is culled.
+   GetDrawRanges(CreateParams(kLatitude_, kLongitude_, 20.0));
+
+   EXPECT_EQ(first_, (std::vector<GLint> {0}));
+   EXPECT_EQ(count_, (std::vector<GLsizei> {3}));
+}
+
+TEST_F(GeoTileIndexTest, PixelExtent)
+{
+   // Icons drawn up to 300 pixels from their location reach into the
+   // viewport from approximately 10 degrees away
+   index_.AddRange(0, 3, CreateBounds(kLatitude_, kLongitude_ + 10.0), 0.0f, 0);
+   index_.AddRange(
+      3, 3, CreateBounds(kLatitude_, kLongitude_ - 10.0), 300.0f, 0);
+
+   GetDrawRanges(CreateParams());
+
+   EXPECT_EQ(first_, (std::vector<GLint> {3}));
+   EXPECT_EQ(count_, (std::vector<GLsizei> {3}));
+
+   // The pixel extent is smaller in screen coordinates when zoomed in
+   GetDrawRanges(CreateParams(kLatitude_, kLongitude_, 8.0));
+
+   EXPECT_TRUE(first_.empty());
+}
+
+TEST_F(GeoTileIndexTest, PitchedMapNotCulled)
+{
+   index_.AddRange(0, 3, CreateBounds(kLatitude_, kLongitude_), 0.0f, 0);
+   index_.AddRange(3, 3, CreateBounds(kLatitude_, kLongitude_ + 20.0), 0.0f, 0);
+
+   auto params  = CreateParams();
+   params.pitch = 45.0;
+
+   GetDrawRanges(params);
+
+   EXPECT_EQ(first_, (std::vector<GLint> {0}));
+   EXPECT_EQ(count_, (std::vector<GLsizei> {6}));
+}
+
+TEST_F(GeoTileIndexTest, Thresholds)
+{
+   const auto bounds = CreateBounds(kLatitude_, kLongitude_);
+
+   // Ranges in separate tiles, with thresholds of 10, unset and 999
+   index_.AddRange(0, 3, bounds, 0.0f, 10);
+   index_.AddRange(3, 3, CreateBounds(kLatitude_, kLongitude_ + 3.0), 0.0f, 0);
+   index_.AddRange(
+      6, 3, CreateBounds(kLatitude_, kLongitude_ - 3.0), 0.0f, 999);
+
+   GetDrawRanges(CreateParams(), 5.0f);
+
+   EXPECT_EQ(first_, (std::vector<GLint> {0}));
+   EXPECT_EQ(count_, (std::vector<GLsizei> {9}));
+
+   GetDrawRanges(CreateParams(), 20.0f);
+
+   EXPECT_EQ(first_, (std::vector<GLint> {3}));
+   EXPECT_EQ(count_, (std::vector<GLsizei> {6}));
+
+   // Thresholding is disabled with a map distance of 0
+   GetDrawRanges(CreateParams(), 0.0f);
+
+   EXPECT_EQ(first_, (std::vector<GLint> {0}));
+   EXPECT_EQ(count_, (std::vector<GLsizei> {9}));
+}
+
+TEST_F(GeoTileIndexTest, TileThresholdIsMaximum)
+{
+   // A tile is drawn while any of its ranges is within its threshold
+   index_.AddRange(0, 3, CreateBounds(kLatitude_, kLongitude_), 0.0f, 10);
+   index_.AddRange(3, 3, CreateBounds(kLatitude_, kLongitude_), 0.0f, 50);
+
+   GetDrawRanges(CreateParams(), 20.0f);
+
+   EXPECT_EQ(first_, (std::vector<GLint> {0}));
+   EXPECT_EQ(count_, (std::vector<GLsizei> {6}));
+
+   GetDrawRanges(CreateParams(), 60.0f);
+
+   EXPECT_TRUE(first_.empty());
+}
+
+TEST_F(GeoTileIndexTest, Antimeridian)
+{
+   // A range crossing the antimeridian spans the width of the map in screen
+   // coordinates, and is drawn on either side
+   GeoTileIndex::Bounds crossingBounds {};
+   crossingBounds.Extend(-17.0, 179.5);
+   crossingBounds.Extend(-18.0, -179.5);
+
+   index_.AddRange(0, 3, crossingBounds, 0.0f, 0);
+
+   // Ranges east and west of the antimeridian, including a longitude below
+   // -180 degrees
+   index_.AddRange(3, 3, CreateBounds(-17.5, 179.0), 0.0f, 0);
+   index_.AddRange(6, 3, CreateBounds(-17.5, -180.5), 0.0f, 0);
+
+   GetDrawRanges(CreateParams(-17.5, 179.9));
+
+   EXPECT_EQ(first_, (std::vector<GLint> {0}));
+   EXPECT_EQ(count_, (std::vector<GLsizei> {6}));
+
+   // Geometry is not wrapped across the antimeridian when rendered, so ranges
+   // are culled on the opposite side
+   GetDrawRanges(CreateParams(-17.5, -179.9));
+
+   EXPECT_EQ(first_, (std::vector<GLint> {0, 6}));
+   EXPECT_EQ(count_, (std::vector<GLsizei> {3, 3}));
+}
+
+TEST_F(GeoTileIndexTest, Clear)
+{
+   index_.AddRange(0, 3, CreateBounds(kLatitude_, kLongitude_), 0.0f, 0);
+   index_.Clear();
+
+   GetDrawRanges(CreateParams());
+
+   EXPECT_TRUE(first_.empty());
+
+   // Ranges added after clearing are drawn
+   index_.AddRange(6, 3, CreateBounds(kLatitude_, kLongitude_), 0.0f, 0);
+
+   GetDrawRanges(CreateParams());
+
+   EXPECT_EQ(first_, (std::vector<GLint> {6}));
+   EXPECT_EQ(count_, (std::vector<GLsizei> {3}));
+}
+
+TEST_F(GeoTileIndexTest, Swap)
+{
+   GeoTileIndex other {};
+   other.AddRange(0, 3, CreateBounds(kLatitude_, kLongitude_), 0.0f, 0);
+
+   index_.swap(other);
+
+   GetDrawRanges(CreateParams());
+
+   EXPECT_EQ(first_, (std::vector<GLint> {0}));
+   EXPECT_EQ(count_, (std::vector<GLsizei> {3}));
+
+   other.GetDrawRanges(CreateParams(), 0.0f, first_, count_);
+
+   EXPECT_TRUE(first_.empty());
+}
+
+} // namespace draw
+} // namespace gl
+} // namespace qt
+} // namespace scwx
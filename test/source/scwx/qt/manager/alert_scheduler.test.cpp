@@ -0,0 +1,203 @@
+#include <scwx/qt/manager/alert_scheduler.hpp>
+#include <scwx/util/clock.hpp>
+
+#include <algorithm>
+#include <condition_variable>
+#include <mutex>
+
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace qt
+{
+namespace manager
+{
+
+using namespace std::chrono_literals;
+
+// The replay clock runs at 600x real time, so one minute elapses in 100 ms
+static constexpr double kClockSpeed_ = 600.0;
+
+// Generous real time limit for transitions to be reported on a loaded machine
+static constexpr std::chrono::seconds kTimeout_ {30};
+
+static constexpr std::int16_t kSentinelEtn_ = 9999;
+
+static const std::chrono::system_clock::time_point kStartTime_ =
+   std::chrono::sys_days {std::chrono::year {2021} / std::chrono::May / 27} +
+   17h;
+
+// Transitions are scheduled from 10 minutes (1 second real time) after the
+// clock starts, so they are still in the future when scheduled
+static const std::chrono::system_clock::time_point kBaseTime_ =
+   kStartTime_ + 10min;
+
+typedef std::pair<std::chrono::system_clock::time_point,
+                  std::vector<std::int16_t>>
+   TransitionRecord;
+
+static types::TextEventKey CreateKey(std::int16_t etn)
+{
+   types::TextEventKey key {};
+   key.officeId_     = "KLSX";
+   key.phenomenon_   = awips::Phenomenon::Tornado;
+   key.significance_ = awips::Significance::Warning;
+   key.etn_          = etn;
+   return key;
+}
+
+class AlertSchedulerTest : public testing::Test
+{
+protected:
+   void SetUp() override
+   {
+      scwx::util::SetClock(
+         std::make_shared<scwx::util::ReplayClock>(kStartTime_, kClockSpeed_));
+
+      scheduler_ = std::make_shared<AlertScheduler>();
+
+      // Record transitions from the scheduler thread
+      QObject::connect(
+         scheduler_.get(),
+         &AlertScheduler::AlertsTransitioned,
+         scheduler_.get(),
+         [this](const std::vector<types::TextEventKey>& keys,
+                std::chrono::system_clock::time_point   transitionTime)
+         {
+            std::vector<std::int16_t> etns {};
+            for (auto& key : keys)
+            {
+               etns.push_back(key.etn_);
+            }
+            std::sort(etns.begin(), etns.end());
+
+            std::unique_lock lock {transitionsMutex_};
+            if (etns == std::vector<std::int16_t> {kSentinelEtn_})
+            {
+               sentinelReported_ = true;
+            }
+            else
+            {
+               transitions_.emplace_back(transitionTime, etns);
+            }
+            transitionsCondition_.notify_all();
+         },
+         Qt::DirectConnection);
+   }
+
+   void TearDown() override
+   {
+      scheduler_.reset();
+      scwx::util::SetClock(nullptr);
+   }
+
+   // Schedules a sentinel transition after each transition of the test, and
+   // waits until it is reported. Transitions are reported in time order, so
+   // every earlier transition has been reported by then.
+   std::vector<TransitionRecord>
+   WaitForTransitions(std::chrono::system_clock::time_point sentinelTime)
+   {
+      scheduler_->ScheduleTransitions(CreateKey(kSentinelEtn_), {sentinelTime});
+
+      std::unique_lock lock {transitionsMutex_};
+      EXPECT_TRUE(transitionsCondition_.wait_for(
+         lock, kTimeout_, [this]() { return sentinelReported_; }));
+
+      return transitions_;
+   }
+
+   std::shared_ptr<AlertScheduler> scheduler_ {};
+
+   std::mutex                    transitionsMutex_ {};
+   std::condition_variable       transitionsCondition_ {};
+   std::vector<TransitionRecord> transitions_ {};
+   bool                          sentinelReported_ {false};
+};
+
+TEST_F(AlertSchedulerTest, TransitionOrder)
+{
+   const auto t = kBaseTime_;
+
+   // Schedule transitions out of order
+   scheduler_->ScheduleTransitions(CreateKey(3), {t + 90s});
+   scheduler_->ScheduleTransitions(CreateKey(1), {t + 120s, t + 60s});
+   scheduler_->ScheduleTransitions(CreateKey(2), {t + 30s});
+
+   auto transitions = WaitForTransitions(t + 150s);
+
+   const std::vector<TransitionRecord> expected {{t + 30s, {2}},
+                                                 {t + 60s, {1}},
+                                                 {t + 90s, {3}},
+                                                 {t + 120s, {1}}};
+
+   EXPECT_EQ(transitions, expected);
+}
+
+TEST_F(AlertSchedulerTest, SimultaneousTransitions)
+{
+   const auto t = kBaseTime_;
+
+   // Transitions at the same time are reported together, once per event
+   scheduler_->ScheduleTransitions(CreateKey(1), {t + 60s, t + 120s});
+   scheduler_->ScheduleTransitions(CreateKey(2), {t + 60s, t + 60s});
+   scheduler_->ScheduleTransitions(CreateKey(3), {t + 60s});
+
+   auto transitions = WaitForTransitions(t + 150s);
+
+   const std::vector<TransitionRecord> expected {{t + 60s, {1, 2, 3}},
+                                                 {t + 120s, {1}}};
+
+   EXPECT_EQ(transitions, expected);
+}
+
+TEST_F(AlertSchedulerTest, PastTransitionsIgnored)
+{
+   const auto t = kBaseTime_;
+
+   scheduler_->ScheduleTransitions(CreateKey(1), {kStartTime_ - 60s, t});
+   scheduler_->ScheduleTransitions(CreateKey(2), {kStartTime_ - 30s});
+
+   auto transitions = WaitForTransitions(t + 30s);
+
+   const std::vector<TransitionRecord> expected {{t, {1}}};
+
+   EXPECT_EQ(transitions, expected);
+}
+
+TEST_F(AlertSchedulerTest, CancelOnUpdate)
+{
+   const auto t = kBaseTime_;
+
+   // An updated event replaces the transitions of the previous update
+   scheduler_->ScheduleTransitions(CreateKey(1), {t + 30s, t + 120s});
+   scheduler_->ScheduleTransitions(CreateKey(2), {t + 60s});
+   scheduler_->ScheduleTransitions(CreateKey(1), {t + 90s});
+
+   auto transitions = WaitForTransitions(t + 150s);
+
+   const std::vector<TransitionRecord> expected {{t + 60s, {2}},
+                                                 {t + 90s, {1}}};
+
+   EXPECT_EQ(transitions, expected);
+}
+
+TEST_F(AlertSchedulerTest, CancelTransitions)
+{
+   const auto t = kBaseTime_;
+
+   scheduler_->ScheduleTransitions(CreateKey(1), {t + 60s, t + 120s});
+   scheduler_->ScheduleTransitions(CreateKey(2), {t + 60s, t + 90s});
+   scheduler_->CancelTransitions({CreateKey(1)});
+
+   auto transitions = WaitForTransitions(t + 150s);
+
+   const std::vector<TransitionRecord> expected {{t + 60s, {2}},
+                                                 {t + 90s, {2}}};
+
+   EXPECT_EQ(transitions, expected);
+}
+
+} // namespace manager
+} // namespace qt
+} // namespace scwx
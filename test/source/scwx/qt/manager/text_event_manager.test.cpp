@@ -0,0 +1,132 @@
+#include <scwx/qt/manager/text_event_manager.hpp>
+
+#include <sstream>
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace qt
+{
+namespace manager
+{
+
+using namespace std::chrono_literals;
+
+static const std::chrono::system_clock::time_point kEventBegin_ =
+   std::chrono::sys_days {std::chrono::year {2021} / std::chrono::May / 27} +
+   17h;
+static const std::chrono::system_clock::time_point kEventEnd_ =
+   kEventBegin_ + 30min;
+
+// Tornado warning issued at 1700Z, with the given P-VTEC action and end time
+static std::shared_ptr<awips::TextProductMessage>
+CreateMessage(const std::string& action,
+              const std::string& endTime,
+              const std::string& wmoDateTime = "271700")
+{
+   const std::string text =
+      fmt::format("WFUS53 KLSX {2}\r\r\n"
+                  "TORLSX\r\r\n"
+                  "MOC099-271730-\r\r\n"
+                  "/O.{0}.KLSX.TO.W.0001.210527T1700Z-{1}/\r\r\n"
+                  "\r\r\n"
+                  "BULLETIN - EAS ACTIVATION REQUESTED\r\r\n"
+                  "Tornado Warning\r\r\n"
+                  "National Weather Service St. Louis MO\r\r\n"
+                  "1200 PM CDT Thu May 27 2021\r\r\n"
+                  "\r\r\n"
+                  "$$\r\r\n",
+                  action,
+                  endTime,
+                  wmoDateTime);
+
+   std::istringstream is {text};
+   return awips::TextProductMessage::Create(is);
+}
+
+class TextEventExpiryTest : public testing::Test
+{
+protected:
+   void SetUp() override
+   {
+      auto message = CreateMessage("NEW", "210527T1730Z");
+      ASSERT_NE(message, nullptr);
+      ASSERT_EQ(message->segment_count(), 1u);
+      ASSERT_EQ(message->segment(0)->event_end(), kEventEnd_);
+
+      messages_.push_back(message);
+   }
+
+   std::vector<std::shared_ptr<awips::TextProductMessage>> messages_ {};
+};
+
+TEST_F(TextEventExpiryTest, ExpiresAfterEndAndUpdate)
+{
+   const auto threshold = kEventEnd_ + 1min;
+
+   EXPECT_TRUE(
+      TextEventManager::IsExpired(messages_, kEventBegin_, threshold));
+}
+
+TEST_F(TextEventExpiryTest, RetainedBeforeEnd)
+{
+   // The event has not ended before the threshold
+   EXPECT_FALSE(
+      TextEventManager::IsExpired(messages_, kEventBegin_, kEventEnd_));
+   EXPECT_FALSE(TextEventManager::IsExpired(
+      messages_, kEventBegin_, kEventEnd_ - 1min));
+}
+
+TEST_F(TextEventExpiryTest, RetainedAfterRecentUpdate)
+{
+   // An archived event that ended long ago, but was loaded recently
+   const auto threshold = kEventEnd_ + 24h;
+
+   EXPECT_FALSE(TextEventManager::IsExpired(messages_, threshold, threshold));
+   EXPECT_FALSE(
+      TextEventManager::IsExpired(messages_, threshold + 1min, threshold));
+   EXPECT_TRUE(
+      TextEventManager::IsExpired(messages_, threshold - 1min, threshold));
+}
+
+TEST_F(TextEventExpiryTest, MostRecentMessageEndTime)
+{
+   // The event was extended by a later message
+   auto message = CreateMessage("EXT", "210527T1900Z", "271725");
+   ASSERT_NE(message, nullptr);
+   messages_.push_back(message);
+
+   const auto threshold = kEventEnd_ + 1min;
+
+   EXPECT_FALSE(
+      TextEventManager::IsExpired(messages_, kEventBegin_, threshold));
+   EXPECT_TRUE(
+      TextEventManager::IsExpired(messages_, kEventBegin_, kEventBegin_ + 3h));
+}
+
+TEST_F(TextEventExpiryTest, RetainedWithoutEndTime)
+{
+   // Events without an end time are retained until they are updated
+   auto message = CreateMessage("CON", "000000T0000Z", "271725");
+   ASSERT_NE(message, nullptr);
+   ASSERT_EQ(message->segment(0)->event_end(),
+             std::chrono::system_clock::time_point {});
+   messages_.push_back(message);
+
+   EXPECT_FALSE(
+      TextEventManager::IsExpired(messages_, kEventBegin_, kEventEnd_ + 24h));
+}
+
+TEST_F(TextEventExpiryTest, EmptyMessageList)
+{
+   const auto threshold = kEventEnd_ + 1min;
+
+   EXPECT_TRUE(TextEventManager::IsExpired({}, kEventBegin_, threshold));
+   EXPECT_FALSE(TextEventManager::IsExpired({}, threshold, threshold));
+}
+
+} // namespace manager
+} // namespace qt
+} // namespace scwx
@@ -0,0 +1,183 @@
+#include <scwx/qt/model/alert_model.hpp>
+#include <scwx/qt/types/qt_types.hpp>
+
+#include <sstream>
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace qt
+{
+namespace model
+{
+
+using namespace std::chrono_literals;
+
+static constexpr std::int16_t kAlertCount_ = 6;
+
+static const std::chrono::system_clock::time_point kStartTime_ =
+   std::chrono::sys_days {std::chrono::year {2021} / std::chrono::May / 27} +
+   17h;
+
+// Tornado warning beginning at 1700Z, and ending 5 minutes per event tracking
+// number later. The polygon is a 0.1 degree square centered on the given
+// latitude and longitude (hundredths of a degree west).
+static std::shared_ptr<awips::TextProductMessage>
+CreateMessage(std::int16_t etn, int latitude, int longitude)
+{
+   const std::string text = fmt::format(
+      "WFUS53 KLSX 271700\r\r\n"
+      "TORLSX\r\r\n"
+      "MOC099-2717{0:02}-\r\r\n"
+      "/O.NEW.KLSX.TO.W.{1:04}.210527T1700Z-210527T17{0:02}Z/\r\r\n"
+      "\r\r\n"
+      "BULLETIN - EAS ACTIVATION REQUESTED\r\r\n"
+      "Tornado Warning\r\r\n"
+      "National Weather Service St. Louis MO\r\r\n"
+      "1200 PM CDT Thu May 27 2021\r\r\n"
+      "\r\r\n"
+      "LAT...LON {2} {4} {3} {4} {3} {5} {2} {5}\r\r\n"
+      "\r\r\n"
+      "$$\r\r\n",
+      etn * 5,
+      etn,
+      latitude - 5,
+      latitude + 5,
+      longitude + 5,
+      longitude - 5);
+
+   std::istringstream is {text};
+   return awips::TextProductMessage::Create(is);
+}
+
+class AlertModelTest : public testing::Test
+{
+protected:
+   void SetUp() override
+   {
+      for (std::int16_t etn = 1; etn <= kAlertCount_; ++etn)
+      {
+         auto message = CreateMessage(etn, 3800 + etn * 20, 9000 + etn * 20);
+         ASSERT_NE(message, nullptr);
+         ASSERT_EQ(message->segment_count(), 1u);
+
+         types::TextEventKey key {
+            message->segment(0)->header_->vtecString_[0].pVtec_};
+         keys_.push_back(key);
+
+         model_.UpdateAlert(key, {message}, 0);
+         centroids_.push_back(model_.centroid(key));
+      }
+
+      QObject::connect(&model_,
+                       &QAbstractItemModel::rowsAboutToBeRemoved,
+                       [this](const QModelIndex&, int first, int last)
+                       { removedRows_.emplace_back(first, last); });
+   }
+
+   // Expects the row to contain the alert with the given event tracking
+   // number
+   void ExpectRow(int row, std::int16_t etn)
+   {
+      const types::TextEventKey& key = keys_[etn - 1];
+
+      const QModelIndex etnIndex =
+         model_.index(row, static_cast<int>(AlertModel::Column::Etn));
+      const QModelIndex officeIdIndex =
+         model_.index(row, static_cast<int>(AlertModel::Column::OfficeId));
+      const QModelIndex endTimeIndex =
+         model_.index(row, static_cast<int>(AlertModel::Column::EndTime));
+
+      const std::int64_t endTime =
+         std::chrono::duration_cast<std::chrono::seconds>(
+            (kStartTime_ + etn * 5min).time_since_epoch())
+            .count();
+
+      EXPECT_EQ(model_.key(etnIndex), key);
+      EXPECT_EQ(model_.data(etnIndex).toInt(), etn);
+      EXPECT_EQ(model_.data(officeIdIndex).toString(), "KLSX");
+      // Sort keys are stored as qlonglong, which sort proxy models compare
+      // numerically
+      const QVariant endTimeSortKey =
+         model_.data(endTimeIndex, types::SortRole);
+      EXPECT_EQ(endTimeSortKey.typeId(), QMetaType::LongLong);
+      EXPECT_EQ(endTimeSortKey.toLongLong(), endTime);
+      EXPECT_EQ(model_.centroid(key), centroids_[etn - 1]);
+   }
+
+   AlertModel model_ {};
+
+   std::vector<types::TextEventKey> keys_ {};
+   std::vector<common::Coordinate>  centroids_ {};
+
+   std::vector<std::pair<int, int>> removedRows_ {};
+};
+
+TEST_F(AlertModelTest, Centroids)
+{
+   ASSERT_EQ(model_.rowCount(), kAlertCount_);
+
+   for (std::int16_t etn = 1; etn <= kAlertCount_; ++etn)
+   {
+      const common::Coordinate& centroid = centroids_[etn - 1];
+
+      EXPECT_NEAR(centroid.latitude_, 38.0 + etn * 0.2, 0.01);
+      EXPECT_NEAR(centroid.longitude_, -90.0 - etn * 0.2, 0.01);
+
+      ExpectRow(etn - 1, etn);
+   }
+}
+
+TEST_F(AlertModelTest, RemoveScatteredAlerts)
+{
+   // Remove rows 0, 2, 3 and 5 out of order, with a key that is not present
+   types::TextEventKey missingKey {keys_[0]};
+   missingKey.etn_ = 99;
+
+   model_.HandleAlertsRemoved(
+      {keys_[3], keys_[0], missingKey, keys_[5], keys_[2]});
+
+   // Contiguous rows are removed together, from last to first
+   const std::vector<std::pair<int, int>> expectedRemovedRows {
+      {5, 5}, {2, 3}, {0, 0}};
+   EXPECT_EQ(removedRows_, expectedRemovedRows);
+
+   ASSERT_EQ(model_.rowCount(), 2);
+   ExpectRow(0, 2);
+   ExpectRow(1, 5);
+
+   for (int etn : {1, 3, 4, 6})
+   {
+      EXPECT_EQ(model_.centroid(keys_[etn - 1]), common::Coordinate {});
+   }
+}
+
+TEST_F(AlertModelTest, UpdateAfterRemoval)
+{
+   model_.HandleAlertsRemoved({keys_[0], keys_[2]});
+
+   // Updating an alert after removal updates its new row
+   auto message = CreateMessage(5, 4000, 9200);
+   model_.UpdateAlert(keys_[4], {message}, 0);
+   centroids_[4] = model_.centroid(keys_[4]);
+
+   EXPECT_NEAR(centroids_[4].latitude_, 40.0, 0.01);
+   EXPECT_NEAR(centroids_[4].longitude_, -92.0, 0.01);
+
+   // A removed alert is added to the end
+   message = CreateMessage(1, 3820, 9020);
+   model_.UpdateAlert(keys_[0], {message}, 0);
+
+   ASSERT_EQ(model_.rowCount(), 5);
+   ExpectRow(0, 2);
+   ExpectRow(1, 4);
+   ExpectRow(2, 5);
+   ExpectRow(3, 6);
+   ExpectRow(4, 1);
+}
+
+} // namespace model
+} // namespace qt
+} // namespace scwx
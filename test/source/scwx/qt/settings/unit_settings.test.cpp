@@ -0,0 +1,61 @@
+#include <scwx/qt/settings/unit_settings.hpp>
+
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace qt
+{
+namespace settings
+{
+
+TEST(UnitSettingsTest, DefaultSnapshot)
+{
+   UnitSettings unitSettings {};
+
+   const auto& snapshot = unitSettings.snapshot();
+
+   EXPECT_EQ(snapshot.accumulationUnits_, types::AccumulationUnits::Inches);
+   EXPECT_EQ(snapshot.echoTopsUnits_, types::EchoTopsUnits::Kilofeet);
+   EXPECT_EQ(snapshot.otherUnits_, types::OtherUnits::Default);
+   EXPECT_EQ(snapshot.speedUnits_, types::SpeedUnits::Knots);
+   EXPECT_EQ(snapshot.distanceUnits_, types::DistanceUnits::Miles);
+   EXPECT_EQ(snapshot.distanceScale_,
+             types::GetDistanceUnitsScale(types::DistanceUnits::Miles));
+   EXPECT_EQ(snapshot.distanceAbbreviation_,
+             types::GetDistanceUnitsAbbreviation(types::DistanceUnits::Miles));
+}
+
+TEST(UnitSettingsTest, SnapshotPublishedOnChange)
+{
+   UnitSettings unitSettings {};
+
+   const auto& oldSnapshot = unitSettings.snapshot();
+
+   EXPECT_TRUE(unitSettings.distance_units().SetValue("kilometers"));
+
+   const auto& newSnapshot = unitSettings.snapshot();
+
+   EXPECT_GT(newSnapshot.version_, oldSnapshot.version_);
+   EXPECT_EQ(newSnapshot.distanceUnits_, types::DistanceUnits::Kilometers);
+   EXPECT_EQ(newSnapshot.distanceAbbreviation_, "km");
+
+   // A previously published snapshot is unchanged
+   EXPECT_EQ(oldSnapshot.distanceUnits_, types::DistanceUnits::Miles);
+}
+
+TEST(UnitSettingsTest, SnapshotPublishedOnCommit)
+{
+   UnitSettings unitSettings {};
+
+   EXPECT_TRUE(unitSettings.speed_units().StageValue("miles per hour"));
+   EXPECT_EQ(unitSettings.snapshot().speedUnits_, types::SpeedUnits::Knots);
+
+   EXPECT_TRUE(unitSettings.speed_units().Commit());
+   EXPECT_EQ(unitSettings.snapshot().speedUnits_,
+             types::SpeedUnits::MilesPerHour);
+}
+
+} // namespace settings
+} // namespace qt
+} // namespace scwx
@@ -0,0 +1,202 @@
+#include <scwx/qt/util/cross_section.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <numbers>
+
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace qt
+{
+namespace util
+{
+
+static constexpr double kEffectiveEarthRadius_ = 6'371'000.0 * 4.0 / 3.0;
+static constexpr double kHalfBeamWidth_        = 0.475; // degrees
+
+static constexpr std::size_t kAzimuthBins_ = 3600u;
+
+struct BeamParam
+{
+   double groundRange_; // meters
+   double elevation_;   // degrees
+   double height_;      // meters
+   double slantRange_;  // meters
+};
+
+class BeamTest : public testing::TestWithParam<BeamParam>
+{
+};
+
+TEST_P(BeamTest, HeightAndSlantRange)
+{
+   const BeamParam& param = GetParam();
+
+   const double height = GetBeamHeight(param.groundRange_, param.elevation_);
+   const double slantRange =
+      GetBeamSlantRange(param.groundRange_, param.elevation_);
+
+   EXPECT_NEAR(height, param.height_, 0.1);
+   EXPECT_NEAR(slantRange, param.slantRange_, 0.1);
+
+   // Recover the height and ground range from the slant range, using the
+   // standard beam propagation equations (Doviak and Zrnic)
+   const double kR        = kEffectiveEarthRadius_;
+   const double elevation = param.elevation_ * std::numbers::pi / 180.0;
+   const double h =
+      std::sqrt(slantRange * slantRange + kR * kR +
+                2.0 * slantRange * kR * std::sin(elevation)) -
+      kR;
+   const double s =
+      kR * std::asin(slantRange * std::cos(elevation) / (kR + h));
+
+   EXPECT_NEAR(h, height, 0.01);
+   EXPECT_NEAR(s, param.groundRange_, 0.01);
+}
+
+INSTANTIATE_TEST_SUITE_P(
+   CrossSection,
+   BeamTest,
+   testing::Values(BeamParam {0.0, 0.5, 0.0, 0.0},
+                   BeamParam {100'000.0, 0.0, 588.6, 100'004.6},
+                   BeamParam {100'000.0, 0.5, 1'461.5, 100'018.7},
+                   BeamParam {230'000.0, 0.5, 5'123.6, 230'119.4},
+                   BeamParam {50'000.0, 19.5, 17'890.6, 53'153.8}));
+
+TEST(CrossSectionTest, BeamTable)
+{
+   const std::vector<float>  elevations {0.5f, 1.5f};
+   const std::vector<double> groundRanges {0.0, 100'000.0, 230'000.0};
+
+   CrossSectionBeamTable table {};
+   UpdateCrossSectionBeamTable(elevations, groundRanges, table);
+
+   ASSERT_EQ(table.columns_, 3u);
+   ASSERT_EQ(table.center_.size(), 6u);
+   ASSERT_EQ(table.bottom_.size(), 6u);
+   ASSERT_EQ(table.top_.size(), 6u);
+   ASSERT_EQ(table.slantRange_.size(), 6u);
+
+   for (std::size_t s = 0; s < elevations.size(); ++s)
+   {
+      for (std::size_t column = 0; column < groundRanges.size(); ++column)
+      {
+         const std::size_t i         = s * groundRanges.size() + column;
+         const double      elevation = elevations[s];
+         const double      range     = groundRanges[column];
+
+         EXPECT_FLOAT_EQ(table.center_[i],
+                         static_cast<float>(GetBeamHeight(range, elevation)));
+         EXPECT_FLOAT_EQ(table.bottom_[i],
+                         static_cast<float>(GetBeamHeight(
+                            range, elevation - kHalfBeamWidth_)));
+         EXPECT_FLOAT_EQ(table.top_[i],
+                         static_cast<float>(GetBeamHeight(
+                            range, elevation + kHalfBeamWidth_)));
+         EXPECT_FLOAT_EQ(
+            table.slantRange_[i],
+            static_cast<float>(GetBeamSlantRange(range, elevation)));
+      }
+   }
+
+   // The beam widens with range
+   EXPECT_LT(table.top_[1] - table.bottom_[1],
+             table.top_[2] - table.bottom_[2]);
+}
+
+TEST(CrossSectionTest, BeamTableUnchanged)
+{
+   const std::vector<float>  elevations {0.5f};
+   const std::vector<double> groundRanges {100'000.0};
+
+   CrossSectionBeamTable table {};
+   UpdateCrossSectionBeamTable(elevations, groundRanges, table);
+
+   // The table is not recomputed if the elevations and columns are unchanged
+   table.center_[0] = 0.0f;
+   UpdateCrossSectionBeamTable(elevations, groundRanges, table);
+   EXPECT_EQ(table.center_[0], 0.0f);
+
+   // Invalidating the columns recomputes the table
+   table.columns_ = 0u;
+   UpdateCrossSectionBeamTable(elevations, groundRanges, table);
+   EXPECT_GT(table.center_[0], 0.0f);
+}
+
+class CrossSectionSampleTest : public testing::Test
+{
+protected:
+   void SetUp() override
+   {
+      // Radial 0 covers azimuth bins 0-9, radial 1 covers azimuth bins 10-19.
+      // Both radials have 250 m gates starting at 2 km.
+      radials_ = {{moments8_.data(), 8, 2000, 250, 8, 2u},
+                  {moments16_.data(), 16, 2000, 250, 4, 100u}};
+
+      radialLookup_.assign(kAzimuthBins_, -1);
+      std::fill_n(radialLookup_.begin(), 10, 0);
+      std::fill_n(radialLookup_.begin() + 10, 10, 1);
+   }
+
+   std::vector<std::uint8_t>  moments8_ {10u, 11u, 1u, 0u, 14u, 15u, 16u, 17u};
+   std::vector<std::uint16_t> moments16_ {500u, 501u, 50u, 1u};
+
+   std::vector<CrossSectionRadial> radials_ {};
+   std::vector<std::int16_t>       radialLookup_ {};
+};
+
+TEST_F(CrossSectionSampleTest, Indices)
+{
+   const std::vector<std::uint16_t> azimuthBins {
+      0u, 9u, 9u, 0u, 0u, 0u, 0u, 0u, 10u, 19u, 15u, 20u};
+   const std::vector<float> slantRanges {2000.0f,
+                                         2249.0f,
+                                         2250.0f,
+                                         2500.0f,
+                                         2750.0f,
+                                         1999.0f,
+                                         3999.0f,
+                                         4000.0f,
+                                         2000.0f,
+                                         2500.0f,
+                                         2750.0f,
+                                         2000.0f};
+
+   std::vector<std::uint16_t> levels {};
+   SampleCrossSectionSweep(
+      radials_, radialLookup_, azimuthBins, slantRanges, levels);
+
+   const std::vector<std::uint16_t> expected {
+      10u,  // Radial 0, gate 0
+      10u,  // Radial 0, end of gate 0
+      11u,  // Radial 0, start of gate 1
+      1u,   // Radial 0, gate 2, range folded
+      0u,   // Radial 0, gate 3, below threshold
+      0u,   // Before the first gate
+      17u,  // Radial 0, last gate
+      0u,   // Beyond the last gate
+      500u, // Radial 1 (16-bit), gate 0
+      0u,   // Radial 1, gate 2, below threshold
+      1u,   // Radial 1, gate 3, range folded
+      0u    // No radial
+   };
+
+   EXPECT_EQ(levels, expected);
+}
+
+TEST_F(CrossSectionSampleTest, NoRadials)
+{
+   const std::vector<std::uint16_t> azimuthBins {0u, 10u};
+   const std::vector<float>         slantRanges {2000.0f, 2000.0f};
+
+   std::vector<std::uint16_t> levels {1u};
+   SampleCrossSectionSweep({}, radialLookup_, azimuthBins, slantRanges, levels);
+
+   EXPECT_EQ(levels, (std::vector<std::uint16_t> {0u, 0u}));
+}
+
+} // namespace util
+} // namespace qt
+} // namespace scwx
@@ -1,6 +1,11 @@
 #include <scwx/qt/util/geographic_lib.hpp>
 
+#include <chrono>
+#include <execution>
+#include <iostream>
+
 #include <gtest/gtest.h>
+#include <boost/range/irange.hpp>
 #include <boost/iostreams/copy.hpp>
 #include <boost/iostreams/filtering_streambuf.hpp>
 
@@ -64,6 +69,171 @@ TEST(geographic_lib, area_in_range_far)
    EXPECT_EQ(value, true);
 }
 
+static constexpr std::size_t kRadials_ = 720;
+static constexpr std::size_t kGates_   = 1840;
+
+static std::vector<float> GetRadialAzimuths()
+{
+   std::vector<float> azimuths(kRadials_);
+   for (std::size_t i = 0; i < kRadials_; ++i)
+   {
+      azimuths[i] = i * 0.5f;
+   }
+   return azimuths;
+}
+
+static std::vector<float> GetGateRanges()
+{
+   std::vector<float> ranges(kGates_);
+   for (std::size_t i = 0; i < kGates_; ++i)
+   {
+      ranges[i] = (i + 1) * 250.0f;
+   }
+   return ranges;
+}
+
+TEST(geographic_lib, get_coordinates_error_bound)
+{
+   static const std::vector<common::Coordinate> centers {
+      {38.6986, -90.6828},  // KLSX
+      {64.5114, -165.2950}, // PAEC
+      {13.4559, 144.8111},  // PGUA
+      {18.1156, -66.0781},  // TJUA
+      {-45.0, 179.9}};      // Antimeridian
+
+   const std::vector<float> azimuths = GetRadialAzimuths();
+   const std::vector<float> ranges   = GetGateRanges();
+   std::vector<double>      coordinates(kRadials_ * kGates_ * 2);
+
+   const auto& geodesic = scwx::qt::util::GeographicLib::DefaultGeodesic();
+
+   for (const common::Coordinate& center : centers)
+   {
+      SCOPED_TRACE(testing::Message() << "Center: " << center.latitude_ << ", "
+                                      << center.longitude_);
+
+      scwx::qt::util::GeographicLib::GetCoordinates(center.latitude_,
+                                                    center.longitude_,
+                                                    azimuths,
+                                                    ranges,
+                                                    coordinates,
+                                                    kGates_ * 2);
+
+      double maxError = 0.0;
+
+      // Coordinates are output in double precision, so the error is only from
+      // interpolation, and not from rounding to single precision
+      for (std::size_t radial = 0; radial < kRadials_; radial += 7)
+      {
+         for (std::size_t gate = 0; gate < kGates_; gate += 3)
+         {
+            const std::size_t offset = (radial * kGates_ + gate) * 2;
+
+            double latitude;
+            double longitude;
+            double error;
+
+            geodesic.Direct(center.latitude_,
+                            center.longitude_,
+                            azimuths[radial],
+                            ranges[gate],
+                            latitude,
+                            longitude);
+            geodesic.Inverse(latitude,
+                             longitude,
+                             coordinates[offset],
+                             coordinates[offset + 1],
+                             error);
+
+            maxError = std::max(maxError, error);
+         }
+      }
+
+      EXPECT_LT(maxError, 0.05);
+   }
+}
+
+TEST(geographic_lib, get_coordinates_exact)
+{
+   const std::vector<float> azimuths = GetRadialAzimuths();
+   const std::vector<float> ranges   = {230000.0f};
+   std::vector<float>       coordinates(kRadials_ * 2);
+
+   // A single range is solved exactly
+   scwx::qt::util::GeographicLib::GetCoordinates(
+      38.6986, -90.6828, azimuths, ranges, coordinates, 2);
+
+   for (std::size_t radial = 0; radial < kRadials_; ++radial)
+   {
+      double latitude;
+      double longitude;
+
+      scwx::qt::util::GeographicLib::DefaultGeodesic().Direct(
+         38.6986, -90.6828, azimuths[radial], ranges[0], latitude, longitude);
+
+      EXPECT_EQ(coordinates[radial * 2], static_cast<float>(latitude));
+      EXPECT_EQ(coordinates[radial * 2 + 1], static_cast<float>(longitude));
+   }
+}
+
+// Benchmark, run with --gtest_also_run_disabled_tests
+TEST(geographic_lib, DISABLED_get_coordinates_throughput)
+{
+   const std::vector<float> azimuths = GetRadialAzimuths();
+   const std::vector<float> ranges   = GetGateRanges();
+   std::vector<float>       coordinates(kRadials_ * kGates_ * 2);
+
+   const auto& geodesic = scwx::qt::util::GeographicLib::DefaultGeodesic();
+
+   constexpr double latitude  = 38.6986;
+   constexpr double longitude = -90.6828;
+
+   // Solve each coordinate, as radar views did before batch solutions
+   auto radialGates = boost::irange<std::size_t>(0u, kRadials_ * kGates_);
+
+   const auto directStart = std::chrono::steady_clock::now();
+   std::for_each(std::execution::par_unseq,
+                 radialGates.begin(),
+                 radialGates.end(),
+                 [&](std::size_t radialGate)
+                 {
+                    double lat2;
+                    double lon2;
+
+                    geodesic.Direct(latitude,
+                                    longitude,
+                                    azimuths[radialGate / kGates_],
+                                    ranges[radialGate % kGates_],
+                                    lat2,
+                                    lon2);
+
+                    coordinates[radialGate * 2]     = static_cast<float>(lat2);
+                    coordinates[radialGate * 2 + 1] = static_cast<float>(lon2);
+                 });
+   const auto directTime = std::chrono::steady_clock::now() - directStart;
+
+   const auto batchStart = std::chrono::steady_clock::now();
+   scwx::qt::util::GeographicLib::GetCoordinates(
+      latitude, longitude, azimuths, ranges, coordinates, kGates_ * 2);
+   const auto batchTime = std::chrono::steady_clock::now() - batchStart;
+
+   const double speedup =
+      std::chrono::duration<double>(directTime).count() /
+      std::chrono::duration<double>(batchTime).count();
+
+   const auto directMicroseconds =
+      std::chrono::duration_cast<std::chrono::microseconds>(directTime).count();
+   const auto batchMicroseconds =
+      std::chrono::duration_cast<std::chrono::microseconds>(batchTime).count();
+
+   RecordProperty("DirectMicroseconds", std::to_string(directMicroseconds));
+   RecordProperty("BatchMicroseconds", std::to_string(batchMicroseconds));
+   RecordProperty("Speedup", std::to_string(speedup));
+
+   std::cout << "Direct: " << directMicroseconds
+             << " us, batch: " << batchMicroseconds
+             << " us, speedup: " << speedup << std::endl;
+}
 
 } // namespace util
 } // namespace scwx
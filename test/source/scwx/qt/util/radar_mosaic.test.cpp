@@ -0,0 +1,282 @@
+#include <scwx/qt/util/radar_mosaic.hpp>
+
+#include <cmath>
+
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace qt
+{
+namespace util
+{
+
+static const common::Coordinate kRadarSite_ {35.3331, -97.2778};
+
+static constexpr double kResolution_ = 0.01;
+
+static constexpr MosaicDataScale kReflectivityScale_ {2.0f, 66.0f};
+static constexpr MosaicDataScale kVelocityScale_ {2.0f, 129.0f};
+
+// Single row geometry with the given azimuth (0.1 degree) and range (10 m) of
+// each cell
+static MosaicSiteGeometry
+CreateGeometry(const std::vector<std::uint16_t>& azimuths,
+               const std::vector<std::uint16_t>& ranges)
+{
+   MosaicSiteGeometry geometry {};
+   geometry.resolution_ = 1.0;
+   geometry.rows_       = 1u;
+   geometry.columns_    = azimuths.size();
+   geometry.azimuths_   = azimuths;
+   geometry.ranges_     = ranges;
+   return geometry;
+}
+
+// Radial of 250 m gates, starting at the radar site
+static MosaicRadial CreateRadial(float                  azimuth,
+                                 const void*            moments,
+                                 std::size_t            wordSize,
+                                 const MosaicDataScale& scale,
+                                 std::int32_t           gates)
+{
+   return {azimuth, moments, wordSize, scale.scale_, scale.offset_, 0, 250,
+           gates,   2u};
+}
+
+TEST(RadarMosaicTest, GridEmpty)
+{
+   MosaicGrid grid = ComputeMosaicGrid({});
+
+   EXPECT_EQ(grid, MosaicGrid {});
+}
+
+TEST(RadarMosaicTest, GridSingleSite)
+{
+   MosaicGrid grid = ComputeMosaicGrid({kRadarSite_});
+
+   EXPECT_DOUBLE_EQ(grid.resolution_, kResolution_);
+
+   // The grid covers 460 km in each direction from the site
+   const double south = grid.north_ - grid.rows_ * grid.resolution_;
+   const double east  = grid.west_ + grid.columns_ * grid.resolution_;
+
+   EXPECT_GT(grid.north_, kRadarSite_.latitude_ + 4.1);
+   EXPECT_LT(south, kRadarSite_.latitude_ - 4.1);
+   EXPECT_LT(grid.west_, kRadarSite_.longitude_ - 5.0);
+   EXPECT_GT(east, kRadarSite_.longitude_ + 5.0);
+
+   // The grid is aligned to the global lattice
+   const double northCells = (90.0 - grid.north_) / grid.resolution_;
+   const double westCells  = (grid.west_ + 180.0) / grid.resolution_;
+
+   EXPECT_NEAR(northCells, std::round(northCells), 1e-6);
+   EXPECT_NEAR(westCells, std::round(westCells), 1e-6);
+}
+
+TEST(RadarMosaicTest, GridCoarsened)
+{
+   // Sites spanning the continental United States
+   MosaicGrid grid =
+      ComputeMosaicGrid({{47.1158, -124.1069}, {25.6111, -80.4128}});
+
+   EXPECT_GT(grid.resolution_, kResolution_);
+   EXPECT_LE(grid.rows_, 4096u);
+   EXPECT_LE(grid.columns_, 4096u);
+}
+
+TEST(RadarMosaicTest, SiteGeometry)
+{
+   MosaicSiteGeometry geometry =
+      ComputeMosaicSiteGeometry(kRadarSite_, kResolution_);
+
+   ASSERT_GT(geometry.rows_, 0u);
+   ASSERT_GT(geometry.columns_, 0u);
+   EXPECT_EQ(geometry.azimuths_.size(), geometry.rows_ * geometry.columns_);
+   EXPECT_EQ(geometry.ranges_.size(), geometry.rows_ * geometry.columns_);
+
+   const std::int32_t siteRow =
+      LatitudeToMosaicRow(kRadarSite_.latitude_, kResolution_) -
+      geometry.rowOrigin_;
+   const std::int32_t siteColumn =
+      LongitudeToMosaicColumn(kRadarSite_.longitude_, kResolution_) -
+      geometry.columnOrigin_;
+
+   // The cell containing the site is within one cell of the site
+   const std::size_t siteCell = siteRow * geometry.columns_ + siteColumn;
+   EXPECT_LT(geometry.ranges_[siteCell], 160u);
+
+   // One degree of latitude north of the site (approximately 111 km)
+   const std::size_t northCell =
+      (siteRow - 100) * geometry.columns_ + siteColumn;
+   EXPECT_NEAR(geometry.ranges_[northCell], 11'100, 150);
+   EXPECT_TRUE(geometry.azimuths_[northCell] < 10u ||
+               geometry.azimuths_[northCell] > 3590u);
+
+   // One degree of longitude east of the site
+   const std::size_t eastCell = siteRow * geometry.columns_ + siteColumn + 100;
+   EXPECT_NEAR(geometry.azimuths_[eastCell], 900, 10);
+
+   // The corners of the extent are beyond the maximum range
+   EXPECT_EQ(geometry.ranges_.front(), MosaicSiteGeometry::kInvalidRange_);
+   EXPECT_EQ(geometry.ranges_.back(), MosaicSiteGeometry::kInvalidRange_);
+}
+
+TEST(RadarMosaicTest, ResampleNoRadials)
+{
+   MosaicSiteGeometry geometry = CreateGeometry({0u}, {100u});
+
+   EXPECT_TRUE(ResampleMosaicSweep(geometry, {}, kReflectivityScale_).empty());
+}
+
+TEST(RadarMosaicTest, ResampleRadialLookup)
+{
+   // Each radial has a constant level per azimuth, and increases by gate
+   std::vector<std::vector<std::uint8_t>> moments(4);
+   for (std::size_t r = 0; r < moments.size(); ++r)
+   {
+      for (std::uint8_t g = 0; g < 20; ++g)
+      {
+         moments[r].push_back(static_cast<std::uint8_t>(100 + r * 20 + g));
+      }
+   }
+
+   std::vector<MosaicRadial> radials {};
+   for (std::size_t r = 0; r < moments.size(); ++r)
+   {
+      radials.push_back(CreateRadial(static_cast<float>(r * 90.0),
+                                     moments[r].data(),
+                                     8,
+                                     kReflectivityScale_,
+                                     20));
+   }
+
+   // Cells at 0.5, 90.5, 180.5 and 270.5 degrees, and 50 degrees, which is
+   // beyond the maximum radial width. The last cell is beyond the maximum
+   // range.
+   MosaicSiteGeometry geometry = CreateGeometry(
+      {5u, 905u, 1805u, 2705u, 500u, 5u},
+      {100u, 200u, 300u, 1000u, 100u, MosaicSiteGeometry::kInvalidRange_});
+
+   std::vector<std::uint8_t> levels =
+      ResampleMosaicSweep(geometry, radials, kReflectivityScale_);
+
+   ASSERT_EQ(levels.size(), 6u);
+   EXPECT_EQ(levels[0], 104u); // Radial 0, 1 km (gate 4)
+   EXPECT_EQ(levels[1], 128u); // Radial 1, 2 km (gate 8)
+   EXPECT_EQ(levels[2], 152u); // Radial 2, 3 km (gate 12)
+   EXPECT_EQ(levels[3], 0u);   // Radial 3, beyond the last gate
+   EXPECT_EQ(levels[4], 0u);   // No radial
+   EXPECT_EQ(levels[5], 0u);   // Beyond the maximum range
+}
+
+TEST(RadarMosaicTest, ResampleDataScale)
+{
+   // 1.0 m/s velocity: 10 m/s, 121 m/s, below threshold, range folded
+   static constexpr MosaicDataScale kCoarseVelocityScale {1.0f, 129.0f};
+   std::vector<std::uint8_t>        moments {139u, 250u, 0u, 1u};
+
+   std::vector<MosaicRadial> radials {
+      CreateRadial(0.0f, moments.data(), 8, kCoarseVelocityScale, 4)};
+
+   MosaicSiteGeometry geometry =
+      CreateGeometry({0u, 0u, 0u, 0u}, {12u, 37u, 62u, 87u});
+
+   std::vector<std::uint8_t> levels =
+      ResampleMosaicSweep(geometry, radials, kVelocityScale_);
+
+   ASSERT_EQ(levels.size(), 4u);
+   EXPECT_EQ(levels[0], 149u); // 10 m/s at 0.5 m/s resolution
+   EXPECT_EQ(levels[1], 255u); // Clamped to the maximum level
+   EXPECT_EQ(levels[2], 0u);   // Below threshold
+   EXPECT_EQ(levels[3], 1u);   // Range folded
+}
+
+TEST(RadarMosaicTest, Resample16Bit)
+{
+   // 16-bit differential reflectivity: 2 dB, -1 dB
+   static constexpr MosaicDataScale kZdr16Scale {32.0f, 128.0f};
+   static constexpr MosaicDataScale kZdr8Scale {16.0f, 128.0f};
+   std::vector<std::uint16_t>       moments {192u, 96u};
+
+   std::vector<MosaicRadial> radials {
+      CreateRadial(0.0f, moments.data(), 16, kZdr16Scale, 2)};
+
+   MosaicSiteGeometry geometry = CreateGeometry({0u, 0u}, {12u, 37u});
+
+   std::vector<std::uint8_t> levels =
+      ResampleMosaicSweep(geometry, radials, kZdr8Scale);
+
+   ASSERT_EQ(levels.size(), 2u);
+   EXPECT_EQ(levels[0], 160u);
+   EXPECT_EQ(levels[1], 112u);
+}
+
+class RadarMosaicCompositeTest : public testing::Test
+{
+protected:
+   void SetUp() override
+   {
+      // Four cells of one degree, with site A covering cells 0-2 and site B
+      // covering cells 1-3
+      grid_.north_      = 10.0;
+      grid_.west_       = 0.0;
+      grid_.resolution_ = 1.0;
+      grid_.rows_       = 1u;
+      grid_.columns_    = 4u;
+
+      geometryA_ = CreateGeometry({0u, 0u, 0u}, {100u, 300u, 500u});
+
+      geometryA_.rowOrigin_    = LatitudeToMosaicRow(9.5, 1.0);
+      geometryA_.columnOrigin_ = LongitudeToMosaicColumn(0.5, 1.0);
+      levelsA_                 = {10u, 50u, 1u};
+
+      geometryB_ = CreateGeometry({0u, 0u, 0u}, {200u, 600u, 50u});
+
+      geometryB_.rowOrigin_    = LatitudeToMosaicRow(9.5, 1.0);
+      geometryB_.columnOrigin_ = LongitudeToMosaicColumn(1.5, 1.0);
+      levelsB_                 = {20u, 30u, 40u};
+
+      sites_ = {{&geometryA_, &levelsA_}, {&geometryB_, &levelsB_}};
+   }
+
+   MosaicGrid                    grid_ {};
+   MosaicSiteGeometry            geometryA_ {};
+   MosaicSiteGeometry            geometryB_ {};
+   std::vector<std::uint8_t>     levelsA_ {};
+   std::vector<std::uint8_t>     levelsB_ {};
+   std::vector<MosaicSiteLevels> sites_ {};
+   std::vector<std::uint8_t>     levels_ {};
+   std::vector<std::uint32_t>    keys_ {};
+};
+
+TEST_F(RadarMosaicCompositeTest, NearestRadar)
+{
+   CompositeMosaic(
+      grid_, sites_, MosaicCompositing::NearestRadar, levels_, keys_);
+
+   // Cell 1: site B is nearer. Cell 2: range folded data from site A is
+   // ranked behind valid data from site B, although site B is farther.
+   EXPECT_EQ(levels_, (std::vector<std::uint8_t> {10u, 20u, 30u, 40u}));
+}
+
+TEST_F(RadarMosaicCompositeTest, Maximum)
+{
+   CompositeMosaic(grid_, sites_, MosaicCompositing::Maximum, levels_, keys_);
+
+   EXPECT_EQ(levels_, (std::vector<std::uint8_t> {10u, 50u, 30u, 40u}));
+}
+
+TEST_F(RadarMosaicCompositeTest, EmptySite)
+{
+   levelsB_.clear();
+
+   CompositeMosaic(
+      grid_, sites_, MosaicCompositing::NearestRadar, levels_, keys_);
+
+   EXPECT_EQ(levels_, (std::vector<std::uint8_t> {10u, 50u, 1u, 0u}));
+}
+
+} // namespace util
+} // namespace qt
+} // namespace scwx
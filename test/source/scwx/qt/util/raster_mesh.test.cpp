@@ -0,0 +1,135 @@
+#include <scwx/qt/util/raster_mesh.hpp>
+#include <scwx/qt/util/geographic_lib.hpp>
+
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace qt
+{
+namespace util
+{
+
+static const common::Coordinate kRadarSite_ {35.3331, -97.2778};
+
+// 464 x 464 grid of 1 km bins, centered on the radar site
+static RasterGrid CreateGrid()
+{
+   RasterGrid grid {};
+   grid.iStart_      = -232000.0;
+   grid.jStart_      = 232000.0;
+   grid.xResolution_ = 1000.0;
+   grid.yResolution_ = 1000.0;
+   grid.columns_     = 464;
+   grid.rows_        = 464;
+   return grid;
+}
+
+TEST(RasterMeshTest, MeshSize)
+{
+   RasterMesh mesh = GenerateRasterMesh(kRadarSite_, CreateGrid(), 32);
+
+   EXPECT_EQ(mesh.meshColumns_, 32);
+   EXPECT_EQ(mesh.meshRows_, 32);
+
+   // Two triangles per cell, two values per vertex
+   EXPECT_EQ(mesh.vertices_.size(), 32 * 32 * 6 * 2);
+   EXPECT_EQ(mesh.textureCoordinates_.size(), mesh.vertices_.size());
+}
+
+TEST(RasterMeshTest, MeshNoFinerThanGrid)
+{
+   RasterGrid grid = CreateGrid();
+   grid.columns_   = 8;
+   grid.rows_      = 4;
+
+   RasterMesh mesh = GenerateRasterMesh(kRadarSite_, grid, 32);
+
+   EXPECT_EQ(mesh.meshColumns_, 8);
+   EXPECT_EQ(mesh.meshRows_, 4);
+   EXPECT_EQ(mesh.vertices_.size(), 8 * 4 * 6 * 2);
+}
+
+TEST(RasterMeshTest, EmptyGrid)
+{
+   RasterGrid grid = CreateGrid();
+   grid.columns_   = 0;
+
+   RasterMesh mesh = GenerateRasterMesh(kRadarSite_, grid, 32);
+
+   EXPECT_TRUE(mesh.vertices_.empty());
+   EXPECT_TRUE(mesh.textureCoordinates_.empty());
+}
+
+TEST(RasterMeshTest, TextureCoordinates)
+{
+   RasterMesh mesh = GenerateRasterMesh(kRadarSite_, CreateGrid(), 32);
+
+   float minS = 1.0f;
+   float maxS = 0.0f;
+   float minT = 1.0f;
+   float maxT = 0.0f;
+
+   for (std::size_t i = 0; i < mesh.textureCoordinates_.size(); i += 2)
+   {
+      minS = std::min(minS, mesh.textureCoordinates_[i]);
+      maxS = std::max(maxS, mesh.textureCoordinates_[i]);
+      minT = std::min(minT, mesh.textureCoordinates_[i + 1]);
+      maxT = std::max(maxT, mesh.textureCoordinates_[i + 1]);
+   }
+
+   EXPECT_FLOAT_EQ(minS, 0.0f);
+   EXPECT_FLOAT_EQ(maxS, 1.0f);
+   EXPECT_FLOAT_EQ(minT, 0.0f);
+   EXPECT_FLOAT_EQ(maxT, 1.0f);
+
+   // The first vertex is the northwest corner of the grid
+   EXPECT_FLOAT_EQ(mesh.textureCoordinates_[0], 0.0f);
+   EXPECT_FLOAT_EQ(mesh.textureCoordinates_[1], 0.0f);
+   EXPECT_GT(mesh.vertices_[0], kRadarSite_.latitude_);
+   EXPECT_LT(mesh.vertices_[1], kRadarSite_.longitude_);
+}
+
+TEST(RasterMeshTest, GeodesicAccuracy)
+{
+   const RasterGrid grid = CreateGrid();
+   RasterMesh       mesh = GenerateRasterMesh(kRadarSite_, grid, 32);
+
+   double maxError = 0.0;
+
+   // Compare the center of each mesh cell, interpolated across the cell's
+   // corners, against its exact geodesic location
+   for (std::size_t cell = 0; cell < mesh.meshColumns_ * mesh.meshRows_;
+        ++cell)
+   {
+      // Vertices 0, 1, 2 and 4 of each cell are its four distinct corners
+      const float* v = &mesh.vertices_[cell * 6 * 2];
+      const float* t = &mesh.textureCoordinates_[cell * 6 * 2];
+
+      const double latitude  = (v[0] + v[2] + v[4] + v[8]) / 4.0;
+      const double longitude = (v[1] + v[3] + v[5] + v[9]) / 4.0;
+      const double s         = (t[0] + t[2] + t[4] + t[8]) / 4.0;
+      const double u         = (t[1] + t[3] + t[5] + t[9]) / 4.0;
+
+      const double i = grid.iStart_ + s * grid.xResolution_ * grid.columns_;
+      const double j = grid.jStart_ - u * grid.yResolution_ * grid.rows_;
+
+      common::Coordinate expected = GeographicLib::GetCoordinate(
+         kRadarSite_, units::meters<double> {i}, units::meters<double> {j});
+
+      double error = GeographicLib::GetDistance(latitude,
+                                                longitude,
+                                                expected.latitude_,
+                                                expected.longitude_)
+                        .value();
+
+      maxError = std::max(maxError, error);
+   }
+
+   // The mesh should be accurate to well under a single 1 km bin
+   EXPECT_LT(maxError, 50.0);
+}
+
+} // namespace util
+} // namespace qt
+} // namespace scwx
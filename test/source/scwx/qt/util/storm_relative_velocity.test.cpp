@@ -0,0 +1,90 @@
+#include <scwx/qt/util/storm_relative_velocity.hpp>
+
+#include <limits>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace qt
+{
+namespace util
+{
+
+static constexpr std::uint16_t kBelowThreshold_ = 0u;
+static constexpr std::uint16_t kRangeFolded_    = 1u;
+
+static constexpr std::uint16_t kThreshold_ = 20u;
+
+TEST(StormRelativeVelocity, SubThresholdBinsRemainHidden)
+{
+   // Storm motion towards and away from the radar
+   for (std::int32_t offset : {-30, -5, 5, 30})
+   {
+      SCOPED_TRACE(offset);
+
+      for (std::uint16_t level : {0u, 2u, 10u, 19u})
+      {
+         EXPECT_EQ(ShiftDataLevel(level, offset, kThreshold_, 255u),
+                   kBelowThreshold_);
+      }
+   }
+}
+
+TEST(StormRelativeVelocity, ValidBinsRemainDisplayed)
+{
+   EXPECT_EQ(ShiftDataLevel(128u, 10, kThreshold_, 255u), 118u);
+   EXPECT_EQ(ShiftDataLevel(128u, -10, kThreshold_, 255u), 138u);
+   EXPECT_EQ(ShiftDataLevel(kThreshold_, 0, kThreshold_, 255u), kThreshold_);
+
+   // Shifted levels are clamped to the displayed range
+   EXPECT_EQ(ShiftDataLevel(25u, 30, kThreshold_, 255u), kThreshold_);
+   EXPECT_EQ(ShiftDataLevel(250u, -30, kThreshold_, 255u), 255u);
+   EXPECT_EQ(ShiftDataLevel(1000u, -30, kThreshold_, 1023u), 1023u);
+}
+
+TEST(StormRelativeVelocity, RangeFoldedUnchanged)
+{
+   EXPECT_EQ(ShiftDataLevel(kRangeFolded_, 30, kThreshold_, 255u),
+             kRangeFolded_);
+   EXPECT_EQ(ShiftDataLevel(kRangeFolded_, -30, kThreshold_, 255u),
+             kRangeFolded_);
+}
+
+TEST(StormRelativeVelocity, ShiftDataLevels8)
+{
+   const std::vector<std::uint8_t> source {0u, 1u, 10u, 20u, 25u, 128u, 250u};
+   std::vector<std::uint8_t>       destination(source.size());
+
+   ShiftDataLevels(
+      source.data(), destination.data(), source.size(), -10, kThreshold_);
+
+   const std::vector<std::uint8_t> expected {0u, 1u, 0u, 30u, 35u, 138u, 255u};
+   EXPECT_EQ(destination, expected);
+
+   ShiftDataLevels(
+      source.data(), destination.data(), source.size(), 10, kThreshold_);
+
+   const std::vector<std::uint8_t> expected2 {0u, 1u, 0u, 20u, 20u, 118u, 240u};
+   EXPECT_EQ(destination, expected2);
+}
+
+TEST(StormRelativeVelocity, ShiftDataLevels16)
+{
+   constexpr std::uint16_t kMaxLevel =
+      std::numeric_limits<std::uint16_t>::max();
+
+   const std::vector<std::uint16_t> source {0u, 1u, 10u, 300u, 65530u};
+   std::vector<std::uint16_t>       destination(source.size());
+
+   ShiftDataLevels(
+      source.data(), destination.data(), source.size(), -10, kThreshold_);
+
+   const std::vector<std::uint16_t> expected {0u, 1u, 0u, 310u, kMaxLevel};
+   EXPECT_EQ(destination, expected);
+}
+
+} // namespace util
+} // namespace qt
+} // namespace scwx
@@ -0,0 +1,167 @@
+#include <scwx/qt/view/level2_sweep_registry.hpp>
+
+#include <atomic>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace qt
+{
+namespace view
+{
+
+class Level2SweepRegistryTest : public testing::Test
+{
+protected:
+   // Returns a function computing a sweep, counting computations
+   Level2SweepRegistry::ComputeSweepFunction ComputeSweep()
+   {
+      return [this]()
+      {
+         ++computeCount_;
+         return std::make_shared<Level2Sweep>();
+      };
+   }
+
+   Level2SweepRegistry registry_ {};
+
+   std::shared_ptr<wsr88d::rda::ElevationScan> elevationScan_ {
+      std::make_shared<wsr88d::rda::ElevationScan>()};
+
+   std::atomic<int> computeCount_ {0};
+};
+
+TEST_F(Level2SweepRegistryTest, SameSweepShared)
+{
+   auto sweep1 = registry_.GetSweep(
+      elevationScan_, wsr88d::rda::DataBlockType::MomentRef, ComputeSweep());
+   auto sweep2 = registry_.GetSweep(
+      elevationScan_, wsr88d::rda::DataBlockType::MomentRef, ComputeSweep());
+
+   ASSERT_NE(sweep1, nullptr);
+   EXPECT_EQ(sweep1, sweep2);
+   EXPECT_EQ(sweep1->elevationScan_, elevationScan_);
+   EXPECT_EQ(computeCount_, 1);
+   EXPECT_EQ(registry_.sweep_count(), 1u);
+}
+
+TEST_F(Level2SweepRegistryTest, DifferentBlockTypeComputed)
+{
+   auto refSweep = registry_.GetSweep(
+      elevationScan_, wsr88d::rda::DataBlockType::MomentRef, ComputeSweep());
+   auto velSweep = registry_.GetSweep(
+      elevationScan_, wsr88d::rda::DataBlockType::MomentVel, ComputeSweep());
+
+   ASSERT_NE(refSweep, nullptr);
+   ASSERT_NE(velSweep, nullptr);
+   EXPECT_NE(refSweep, velSweep);
+   EXPECT_EQ(computeCount_, 2);
+   EXPECT_EQ(registry_.sweep_count(), 2u);
+}
+
+TEST_F(Level2SweepRegistryTest, DifferentScanComputed)
+{
+   auto otherScan = std::make_shared<wsr88d::rda::ElevationScan>();
+
+   auto sweep1 = registry_.GetSweep(
+      elevationScan_, wsr88d::rda::DataBlockType::MomentRef, ComputeSweep());
+   auto sweep2 = registry_.GetSweep(
+      otherScan, wsr88d::rda::DataBlockType::MomentRef, ComputeSweep());
+
+   EXPECT_NE(sweep1, sweep2);
+   EXPECT_EQ(computeCount_, 2);
+}
+
+TEST_F(Level2SweepRegistryTest, ExpiresWithLastHolder)
+{
+   auto sweep1 = registry_.GetSweep(
+      elevationScan_, wsr88d::rda::DataBlockType::MomentRef, ComputeSweep());
+   auto sweep2 = sweep1;
+
+   sweep1.reset();
+   EXPECT_EQ(registry_.sweep_count(), 1u);
+
+   // The sweep is released once no view holds it
+   sweep2.reset();
+   EXPECT_EQ(registry_.sweep_count(), 0u);
+
+   // The sweep is recomputed when requested again
+   auto sweep3 = registry_.GetSweep(
+      elevationScan_, wsr88d::rda::DataBlockType::MomentRef, ComputeSweep());
+   ASSERT_NE(sweep3, nullptr);
+   EXPECT_EQ(computeCount_, 2);
+   EXPECT_EQ(registry_.sweep_count(), 1u);
+}
+
+TEST_F(Level2SweepRegistryTest, FailedComputationNotShared)
+{
+   auto sweep1 =
+      registry_.GetSweep(elevationScan_,
+                         wsr88d::rda::DataBlockType::MomentRef,
+                         [this]() -> std::shared_ptr<Level2Sweep>
+                         {
+                            ++computeCount_;
+                            return nullptr;
+                         });
+   EXPECT_EQ(sweep1, nullptr);
+   EXPECT_EQ(registry_.sweep_count(), 0u);
+
+   // A failed computation is retried
+   auto sweep2 = registry_.GetSweep(
+      elevationScan_, wsr88d::rda::DataBlockType::MomentRef, ComputeSweep());
+   EXPECT_NE(sweep2, nullptr);
+   EXPECT_EQ(computeCount_, 2);
+}
+
+TEST_F(Level2SweepRegistryTest, ConcurrentRequestsComputeOnce)
+{
+   constexpr std::size_t kThreadCount = 8u;
+
+   std::atomic<bool> start {false};
+
+   std::vector<std::shared_ptr<const Level2Sweep>> sweeps(kThreadCount);
+   std::vector<std::thread>                        threads {};
+
+   for (std::size_t i = 0u; i < kThreadCount; ++i)
+   {
+      threads.emplace_back(
+         [&, i]()
+         {
+            while (!start)
+            {
+               std::this_thread::yield();
+            }
+
+            sweeps[i] = registry_.GetSweep(
+               elevationScan_,
+               wsr88d::rda::DataBlockType::MomentVel,
+               [this]()
+               {
+                  // Hold the computation, so other requests wait for it
+                  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+                  ++computeCount_;
+                  return std::make_shared<Level2Sweep>();
+               });
+         });
+   }
+
+   start = true;
+
+   for (auto& thread : threads)
+   {
+      thread.join();
+   }
+
+   ASSERT_NE(sweeps[0], nullptr);
+   for (auto& sweep : sweeps)
+   {
+      EXPECT_EQ(sweep, sweeps[0]);
+   }
+   EXPECT_EQ(computeCount_, 1);
+}
+
+} // namespace view
+} // namespace qt
+} // namespace scwx
@@ -0,0 +1,54 @@
+#include <scwx/util/clock.hpp>
+
+#include <thread>
+
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace util
+{
+
+TEST(Clock, SystemClock)
+{
+   SetClock(nullptr);
+
+   auto before = std::chrono::system_clock::now();
+   auto now    = CurrentTime();
+   auto after  = std::chrono::system_clock::now();
+
+   EXPECT_FALSE(IsReplayActive());
+   EXPECT_LE(before, now);
+   EXPECT_LE(now, after);
+   EXPECT_EQ(RealDuration(std::chrono::seconds {15}),
+             std::chrono::seconds {15});
+}
+
+TEST(Clock, ReplayClock)
+{
+   using namespace std::chrono_literals;
+
+   constexpr std::chrono::sys_days startDate {std::chrono::year {2021} /
+                                              std::chrono::May / 27};
+   const std::chrono::system_clock::time_point startTime = startDate + 17h;
+
+   SetClock(std::make_shared<ReplayClock>(startTime, 10.0));
+
+   EXPECT_TRUE(IsReplayActive());
+   EXPECT_EQ(RealDuration(15s), 1500ms);
+
+   std::this_thread::sleep_for(100ms);
+
+   // The clock advances at 10x real time from the start time
+   auto elapsed = CurrentTime() - startTime;
+   EXPECT_GE(elapsed, 1s);
+   EXPECT_LT(elapsed, 1h);
+
+   SetClock(nullptr);
+
+   EXPECT_FALSE(IsReplayActive());
+   EXPECT_GT(CurrentTime(), startTime + 24h);
+}
+
+} // namespace util
+} // namespace scwx
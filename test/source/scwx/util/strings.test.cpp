@@ -87,5 +87,55 @@ TEST(StringsTest, ParseTokensText)
    EXPECT_EQ(tokens[6], "discarded");
 }
 
+TEST(StringsTest, ParseTokensView)
+{
+   static const std::string line {
+      "Text: lat, lon, fontNumber, \"string, string\", \"hover, hover\""};
+
+   static const std::size_t offset = std::string {"Text:"}.size();
+
+   std::vector<std::string_view> tokens {"stale"};
+   ParseTokens(line, {",", ",", ",", ","}, tokens, offset);
+
+   ASSERT_EQ(tokens.size(), 5);
+   EXPECT_EQ(tokens[0], "lat");
+   EXPECT_EQ(tokens[1], "lon");
+   EXPECT_EQ(tokens[2], "fontNumber");
+   EXPECT_EQ(tokens[3], "\"string, string\"");
+   EXPECT_EQ(tokens[4], "\"hover, hover\"");
+}
+
+TEST(StringsTest, ParseTokensNonAscii)
+{
+   // UTF-8 text, with bytes outside the ASCII range adjacent to delimiters
+   static const std::string line {
+      "Text: \xc3\xa9t\xc3\xa9,\xc2\xa0 caf\xc3\xa9"};
+
+   static const std::size_t offset = std::string {"Text:"}.size();
+
+   std::vector<std::string> tokens = ParseTokens(line, {","}, offset);
+
+   ASSERT_EQ(tokens.size(), 2);
+   EXPECT_EQ(tokens[0], "\xc3\xa9t\xc3\xa9");
+   EXPECT_EQ(tokens[1], "\xc2\xa0 caf\xc3\xa9");
+
+   std::vector<std::string_view> viewTokens {};
+   ParseTokens(line, {","}, viewTokens, offset);
+
+   ASSERT_EQ(viewTokens.size(), 2);
+   EXPECT_EQ(viewTokens[0], "\xc3\xa9t\xc3\xa9");
+   EXPECT_EQ(viewTokens[1], "\xc2\xa0 caf\xc3\xa9");
+}
+
+TEST(StringsTest, ParseNumeric)
+{
+   EXPECT_DOUBLE_EQ(ParseNumeric<double>(" 35.25"), 35.25);
+   EXPECT_DOUBLE_EQ(ParseNumeric<double>("-97.5 "), -97.5);
+   EXPECT_EQ(ParseNumeric<int>("+12"), 12);
+   EXPECT_EQ(ParseNumeric<std::size_t>("3.0"), 3u);
+   EXPECT_THROW(ParseNumeric<int>("abc"), std::invalid_argument);
+   EXPECT_THROW(ParseNumeric<double>(""), std::invalid_argument);
+}
+
 } // namespace util
 } // namespace scwx
@@ -0,0 +1,114 @@
+#include <scwx/util/trace.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace util
+{
+
+TEST(Trace, Statistics)
+{
+   using namespace std::chrono_literals;
+
+   Tracer& tracer = Tracer::Instance();
+   tracer.Reset();
+
+   const auto start = std::chrono::steady_clock::now();
+
+   tracer.Record(TraceStage::ObjectLoad, {}, start, start + 100us);
+   tracer.Record(TraceStage::ObjectLoad, {}, start, start + 3ms);
+   tracer.Record(TraceStage::ObjectLoad, {}, start, start + 50ms);
+
+   TraceStatistics statistics = tracer.GetStatistics(TraceStage::ObjectLoad);
+
+   EXPECT_EQ(statistics.count_, 3u);
+   EXPECT_EQ(statistics.min_, 100us);
+   EXPECT_EQ(statistics.max_, 50ms);
+   EXPECT_EQ(statistics.total_, 53100us);
+
+   // 100 us is in bucket [64, 128), 3 ms in [2048, 4096)
+   EXPECT_EQ(statistics.histogram_[6], 1u);
+   EXPECT_EQ(statistics.histogram_[11], 1u);
+   EXPECT_EQ(statistics.Percentile(0.3), 128us);
+   EXPECT_EQ(statistics.Percentile(0.5), 4096us);
+   EXPECT_EQ(statistics.Percentile(1.0), 50ms);
+
+   EXPECT_EQ(tracer.GetStatistics(TraceStage::Render).count_, 0u);
+
+   tracer.Reset();
+
+   EXPECT_EQ(tracer.GetStatistics(TraceStage::ObjectLoad).count_, 0u);
+}
+
+TEST(Trace, EndToEnd)
+{
+   Tracer& tracer = Tracer::Instance();
+   tracer.Reset();
+
+   const std::chrono::system_clock::time_point volumeTime {
+      std::chrono::sys_days {std::chrono::year {2021} / std::chrono::May / 27}};
+
+   tracer.MarkArrival("KLSX", volumeTime);
+   tracer.MarkArrival("KLSX", volumeTime);
+
+   // Rendering different data does not end the span
+   tracer.MarkRendered({"KLSX", "REF", volumeTime + std::chrono::minutes {5}});
+   tracer.MarkRendered({"KILX", "REF", volumeTime});
+   EXPECT_EQ(tracer.GetStatistics(TraceStage::EndToEnd).count_, 0u);
+
+   // Only the first rendered frame ends the span
+   tracer.MarkRendered({"KLSX", "REF", volumeTime});
+   tracer.MarkRendered({"KLSX", "VEL", volumeTime});
+   EXPECT_EQ(tracer.GetStatistics(TraceStage::EndToEnd).count_, 1u);
+
+   tracer.Reset();
+}
+
+TEST(Trace, ExportTrace)
+{
+   Tracer& tracer = Tracer::Instance();
+   tracer.Reset();
+
+   {
+      TraceSpan span {TraceStage::FileDecode};
+      span.set_tags({"KLSX", "N0B", {}});
+   }
+   {
+      TraceSpan span {TraceStage::ComputeSweep, {"KLSX", "\"REF\"", {}}};
+      span.End();
+      span.End();
+   }
+
+   EXPECT_EQ(tracer.GetStatistics(TraceStage::FileDecode).count_, 1u);
+   EXPECT_EQ(tracer.GetStatistics(TraceStage::ComputeSweep).count_, 1u);
+
+   const std::string filename =
+      (std::filesystem::temp_directory_path() / "scwx-trace.test.json")
+         .string();
+
+   ASSERT_TRUE(tracer.ExportTrace(filename));
+
+   std::ifstream     is {filename};
+   std::stringstream ss {};
+   ss << is.rdbuf();
+   is.close();
+
+   const std::string trace = ss.str();
+
+   EXPECT_EQ(trace.rfind("{\"traceEvents\":[", 0), 0u);
+   EXPECT_NE(trace.find("\"name\":\"File Decode\""), std::string::npos);
+   EXPECT_NE(trace.find("\"name\":\"Compute Sweep\""), std::string::npos);
+   EXPECT_NE(trace.find("\"product\":\"\\\"REF\\\"\""), std::string::npos);
+
+   std::filesystem::remove(filename);
+
+   tracer.Reset();
+}
+
+} // namespace util
+} // namespace scwx
@@ -34,5 +34,66 @@ INSTANTIATE_TEST_SUITE_P(
                    std::pair<std::string, std::size_t> //
                    {"/nexrad/level2/Level2_TSTL_20220213_2357.ar2v", 5763}));
 
+class Ar2vScanFileTest : public testing::TestWithParam<std::string>
+{
+};
+
+TEST_P(Ar2vScanFileTest, MatchesLoadedFile)
+{
+   const std::string filename = std::string(SCWX_TEST_DATA_DIR) + GetParam();
+
+   Ar2vFile file;
+   ASSERT_EQ(file.LoadFile(filename), true);
+
+   auto summary = Ar2vFile::ScanFile(filename);
+   ASSERT_EQ(summary.has_value(), true);
+
+   EXPECT_EQ(summary->filename_, filename);
+   EXPECT_EQ(summary->icao_, file.icao());
+   EXPECT_EQ(summary->startTime_, file.start_time());
+
+   auto vcpData = file.vcp_data();
+   if (vcpData != nullptr)
+   {
+      EXPECT_EQ(summary->vcpNumber_, vcpData->pattern_number());
+      ASSERT_EQ(summary->elevationCuts_.size(),
+                vcpData->number_of_elevation_cuts());
+
+      for (std::uint16_t e = 0; e < vcpData->number_of_elevation_cuts(); ++e)
+      {
+         EXPECT_EQ(summary->elevationCuts_[e].elevationAngle_,
+                   vcpData->elevation_angle(e));
+         EXPECT_EQ(summary->elevationCuts_[e].sailsCut_,
+                   vcpData->sails_cut(e));
+      }
+   }
+   else
+   {
+      EXPECT_EQ(summary->elevationCuts_.empty(), true);
+   }
+}
+
+INSTANTIATE_TEST_SUITE_P(
+   Ar2vFile,
+   Ar2vScanFileTest,
+   testing::Values("/nexrad/level2/KCLE20021110_221234",
+                   "/nexrad/level2/Level2_KLSX_20210527_1757.ar2v",
+                   "/nexrad/level2/Level2_TSTL_20220213_2357.ar2v"));
+
+TEST(Ar2vFile, ScanFiles)
+{
+   const std::string dataDir = std::string(SCWX_TEST_DATA_DIR);
+
+   auto summaries = Ar2vFile::ScanFiles(
+      {dataDir + "/nexrad/level2/Level2_KLSX_20210527_1757.ar2v",
+       dataDir + "/nexrad/level2/does_not_exist.ar2v",
+       dataDir + "/nexrad/level2/Level2_TSTL_20220213_2357.ar2v"});
+
+   // Files that cannot be read are omitted, and order is preserved
+   ASSERT_EQ(summaries.size(), 2u);
+   EXPECT_EQ(summaries[0].icao_, "KLSX");
+   EXPECT_EQ(summaries[1].icao_, "TSTL");
+}
+
 } // namespace wsr88d
 } // namespace scwx
@@ -19,21 +19,34 @@ set(SRC_GR_TESTS source/scwx/gr/placefile.test.cpp)
 set(SRC_NETWORK_TESTS source/scwx/network/dir_list.test.cpp)
 set(SRC_PROVIDER_TESTS source/scwx/provider/aws_level2_data_provider.test.cpp
                        source/scwx/provider/aws_level3_data_provider.test.cpp
+                       source/scwx/provider/event_pack.test.cpp
                        source/scwx/provider/warnings_provider.test.cpp)
 set(SRC_QT_CONFIG_TESTS source/scwx/qt/config/county_database.test.cpp
                         source/scwx/qt/config/radar_site.test.cpp)
-set(SRC_QT_MANAGER_TESTS source/scwx/qt/manager/settings_manager.test.cpp
+set(SRC_QT_GL_DRAW_TESTS source/scwx/qt/gl/draw/geo_tile_index.test.cpp)
+set(SRC_QT_MANAGER_TESTS source/scwx/qt/manager/alert_scheduler.test.cpp
+                         source/scwx/qt/manager/settings_manager.test.cpp
+                         source/scwx/qt/manager/text_event_manager.test.cpp
                          source/scwx/qt/manager/update_manager.test.cpp)
 set(SRC_QT_MAP_TESTS source/scwx/qt/map/map_provider.test.cpp)
-set(SRC_QT_MODEL_TESTS source/scwx/qt/model/imgui_context_model.test.cpp)
+set(SRC_QT_MODEL_TESTS source/scwx/qt/model/alert_model.test.cpp
+                       source/scwx/qt/model/imgui_context_model.test.cpp)
 set(SRC_QT_SETTINGS_TESTS source/scwx/qt/settings/settings_container.test.cpp
-                          source/scwx/qt/settings/settings_variable.test.cpp)
+                          source/scwx/qt/settings/settings_variable.test.cpp
+                          source/scwx/qt/settings/unit_settings.test.cpp)
 set(SRC_QT_UTIL_TESTS source/scwx/qt/util/q_file_input_stream.test.cpp
-                      source/scwx/qt/util/geographic_lib.test.cpp)
-set(SRC_UTIL_TESTS source/scwx/util/float.test.cpp
+                      source/scwx/qt/util/cross_section.test.cpp
+                      source/scwx/qt/util/geographic_lib.test.cpp
+                      source/scwx/qt/util/radar_mosaic.test.cpp
+                      source/scwx/qt/util/raster_mesh.test.cpp
+                      source/scwx/qt/util/storm_relative_velocity.test.cpp)
+set(SRC_QT_VIEW_TESTS source/scwx/qt/view/level2_sweep_registry.test.cpp)
+set(SRC_UTIL_TESTS source/scwx/util/clock.test.cpp
+                   source/scwx/util/float.test.cpp
                    source/scwx/util/rangebuf.test.cpp
                    source/scwx/util/streams.test.cpp
                    source/scwx/util/strings.test.cpp
+                   source/scwx/util/trace.test.cpp
                    source/scwx/util/vectorbuf.test.cpp)
 set(SRC_WSR88D_TESTS source/scwx/wsr88d/ar2v_file.test.cpp
                      source/scwx/wsr88d/level3_file.test.cpp
@@ -48,11 +61,13 @@ add_executable(wxtest ${SRC_MAIN}
                       ${SRC_NETWORK_TESTS}
                       ${SRC_PROVIDER_TESTS}
                       ${SRC_QT_CONFIG_TESTS}
+                      ${SRC_QT_GL_DRAW_TESTS}
                       ${SRC_QT_MANAGER_TESTS}
                       ${SRC_QT_MAP_TESTS}
                       ${SRC_QT_MODEL_TESTS}
                       ${SRC_QT_SETTINGS_TESTS}
                       ${SRC_QT_UTIL_TESTS}
+                      ${SRC_QT_VIEW_TESTS}
                       ${SRC_UTIL_TESTS}
                       ${SRC_WSR88D_TESTS}
                       ${CMAKE_FILES})
@@ -64,11 +79,13 @@ source_group("Source Files\\gr"           FILES ${SRC_GR_TESTS})
 source_group("Source Files\\network"      FILES ${SRC_NETWORK_TESTS})
 source_group("Source Files\\provider"     FILES ${SRC_PROVIDER_TESTS})
 source_group("Source Files\\qt\\config"   FILES ${SRC_QT_CONFIG_TESTS})
+source_group("Source Files\\qt\\gl\\draw" FILES ${SRC_QT_GL_DRAW_TESTS})
 source_group("Source Files\\qt\\manager"  FILES ${SRC_QT_MANAGER_TESTS})
 source_group("Source Files\\qt\\map"      FILES ${SRC_QT_MAP_TESTS})
 source_group("Source Files\\qt\\model"    FILES ${SRC_QT_MODEL_TESTS})
 source_group("Source Files\\qt\\settings" FILES ${SRC_QT_SETTINGS_TESTS})
 source_group("Source Files\\qt\\util"     FILES ${SRC_QT_UTIL_TESTS})
+source_group("Source Files\\qt\\view"     FILES ${SRC_QT_VIEW_TESTS})
 source_group("Source Files\\util"         FILES ${SRC_UTIL_TESTS})
 source_group("Source Files\\wsr88d"       FILES ${SRC_WSR88D_TESTS})
 
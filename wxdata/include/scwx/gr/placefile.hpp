@@ -5,6 +5,7 @@
 #include <chrono>
 #include <istream>
 #include <memory>
+#include <memory_resource>
 #include <optional>
 #include <string>
 #include <vector>
@@ -72,8 +73,15 @@ public:
       bool IsItalic() { return flags_ & 2; }
    };
 
+   /**
+    * Draw items are allocated from an arena owned by the placefile, which
+    * remains valid for as long as any draw item from the placefile is
+    * referenced. Element storage is allocated from the same arena.
+    */
    struct DrawItem
    {
+      typedef std::pmr::polymorphic_allocator<> allocator_type;
+
       ItemType                                    itemType_ {ItemType::Unknown};
       units::length::nautical_miles<double>       threshold_ {};
       std::chrono::sys_time<std::chrono::seconds> startTime_ {};
@@ -112,6 +120,10 @@ public:
    struct LineDrawItem : DrawItem
    {
       LineDrawItem() { itemType_ = ItemType::Line; }
+      explicit LineDrawItem(const allocator_type& alloc) : elements_ {alloc}
+      {
+         itemType_ = ItemType::Line;
+      }
 
       boost::gil::rgba8_pixel_t color_ {};
       double                    width_ {};
@@ -126,12 +138,17 @@ public:
          double y_ {};
       };
 
-      std::vector<Element> elements_ {};
+      std::pmr::vector<Element> elements_ {};
    };
 
    struct TrianglesDrawItem : DrawItem
    {
       TrianglesDrawItem() { itemType_ = ItemType::Triangles; }
+      explicit TrianglesDrawItem(const allocator_type& alloc) :
+          elements_ {alloc}
+      {
+         itemType_ = ItemType::Triangles;
+      }
 
       boost::gil::rgba8_pixel_t color_ {};
 
@@ -145,12 +162,16 @@ public:
          std::optional<boost::gil::rgba8_pixel_t> color_ {};
       };
 
-      std::vector<Element> elements_ {};
+      std::pmr::vector<Element> elements_ {};
    };
 
    struct ImageDrawItem : DrawItem
    {
       ImageDrawItem() { itemType_ = ItemType::Image; }
+      explicit ImageDrawItem(const allocator_type& alloc) : elements_ {alloc}
+      {
+         itemType_ = ItemType::Image;
+      }
 
       std::string imageFile_ {};
 
@@ -164,12 +185,16 @@ public:
          double tv_ {};
       };
 
-      std::vector<Element> elements_ {};
+      std::pmr::vector<Element> elements_ {};
    };
 
    struct PolygonDrawItem : DrawItem
    {
       PolygonDrawItem() { itemType_ = ItemType::Polygon; }
+      explicit PolygonDrawItem(const allocator_type& alloc) : contours_ {alloc}
+      {
+         itemType_ = ItemType::Polygon;
+      }
 
       boost::gil::rgba8_pixel_t color_ {};
 
@@ -183,8 +208,8 @@ public:
          std::optional<boost::gil::rgba8_pixel_t> color_ {};
       };
 
-      std::vector<std::vector<Element>> contours_ {};
-      scwx::common::Coordinate          center_ {};
+      std::pmr::vector<std::pmr::vector<Element>> contours_ {};
+      scwx::common::Coordinate                     center_ {};
    };
 
    bool IsValid() const;
@@ -0,0 +1,117 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace scwx
+{
+namespace provider
+{
+
+enum class EventPackObjectType : std::uint8_t
+{
+   Level2      = 1,
+   Level3      = 2,
+   TextProduct = 3
+};
+
+/**
+ * An object stored in an event pack. The strings and data reference the
+ * memory mapping of the event pack, and are valid for the lifetime of the
+ * event pack.
+ */
+struct EventPackObject
+{
+   EventPackObjectType                   type_ {};
+   std::string_view                      radarSite_ {};
+   std::string_view                      product_ {};
+   std::string_view                      key_ {};
+   std::chrono::system_clock::time_point time_ {};
+   std::span<const char>                 data_ {};
+};
+
+/**
+ * @brief Event Pack
+ *
+ * An event pack is a single file containing the raw Level 2 volumes, Level 3
+ * products and text products for a set of radar sites, products and a time
+ * window. The file is memory-mapped, and object data is served directly from
+ * the mapping.
+ *
+ * File layout (all integers little-endian):
+ * - Header: magic "SCWXEVPK", version (u32), object count (u32), index offset
+ *   (u64), string table offset (u64), string table size (u64)
+ * - Object data, each object aligned to 8 bytes
+ * - Index: one record per object, sorted by object time. Each record holds
+ *   the object time in seconds since the epoch (i64), data offset (u64), data
+ *   size (u64), string table offsets of the radar site, product and key
+ *   (3 x u32), the object type (u8) and 3 reserved bytes.
+ * - String table: NUL-terminated strings
+ */
+class EventPack
+{
+public:
+   explicit EventPack();
+   ~EventPack();
+
+   EventPack(const EventPack&)            = delete;
+   EventPack& operator=(const EventPack&) = delete;
+
+   EventPack(EventPack&&) noexcept;
+   EventPack& operator=(EventPack&&) noexcept;
+
+   static constexpr std::string_view kMagic_ {"SCWXEVPK"};
+   static constexpr std::uint32_t    kVersion_         = 1u;
+   static constexpr std::size_t      kHeaderSize_      = 40u;
+   static constexpr std::size_t      kIndexRecordSize_ = 40u;
+   static constexpr std::size_t      kAlignment_       = 8u;
+
+   const std::string& filename() const;
+
+   /**
+    * Gets the objects in the event pack, sorted by object time.
+    *
+    * @return Event pack objects
+    */
+   const std::vector<EventPackObject>& objects() const;
+
+   /**
+    * Finds the objects matching the given type, radar site and product, sorted
+    * by object time.
+    *
+    * @param [in] type Object type
+    * @param [in] radarSite Radar site
+    * @param [in] product Product, or empty to match any product
+    *
+    * @return Matching event pack objects
+    */
+   std::vector<const EventPackObject*>
+   FindObjects(EventPackObjectType type,
+               std::string_view    radarSite,
+               std::string_view    product = {}) const;
+
+   /**
+    * Gets the distinct products stored for the given type and radar site.
+    *
+    * @param [in] type Object type
+    * @param [in] radarSite Radar site
+    *
+    * @return Products
+    */
+   std::vector<std::string> GetProducts(EventPackObjectType type,
+                                        std::string_view    radarSite) const;
+
+   bool LoadFile(const std::string& filename);
+
+private:
+   class Impl;
+   std::unique_ptr<Impl> p;
+};
+
+} // namespace provider
+} // namespace scwx
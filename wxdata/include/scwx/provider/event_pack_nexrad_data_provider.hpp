@@ -0,0 +1,62 @@
+#pragma once
+
+#include <scwx/provider/event_pack.hpp>
+#include <scwx/provider/nexrad_data_provider.hpp>
+
+namespace scwx
+{
+namespace provider
+{
+
+/**
+ * @brief Event Pack NEXRAD Data Provider
+ *
+ * Serves Level 2 or Level 3 objects for a single radar site and product from
+ * an event pack. Objects are decoded directly from the event pack memory
+ * mapping.
+ */
+class EventPackNexradDataProvider : public NexradDataProvider
+{
+public:
+   explicit EventPackNexradDataProvider(
+      const std::shared_ptr<EventPack>& eventPack,
+      EventPackObjectType               type,
+      const std::string&                radarSite,
+      const std::string&                product = {});
+   virtual ~EventPackNexradDataProvider();
+
+   EventPackNexradDataProvider(const EventPackNexradDataProvider&) = delete;
+   EventPackNexradDataProvider&
+   operator=(const EventPackNexradDataProvider&) = delete;
+
+   EventPackNexradDataProvider(EventPackNexradDataProvider&&) noexcept;
+   EventPackNexradDataProvider&
+   operator=(EventPackNexradDataProvider&&) noexcept;
+
+   size_t cache_size() const override;
+
+   std::chrono::system_clock::time_point last_modified() const override;
+   std::chrono::seconds                  update_period() const override;
+
+   std::string FindKey(std::chrono::system_clock::time_point time) override;
+   std::string FindLatestKey() override;
+   std::tuple<bool, size_t, size_t>
+   ListObjects(std::chrono::system_clock::time_point date) override;
+   std::shared_ptr<wsr88d::NexradFile>
+                             LoadObjectByKey(const std::string& key) override;
+   std::pair<size_t, size_t> Refresh() override;
+
+   std::chrono::system_clock::time_point
+   GetTimePointByKey(const std::string& key) const override;
+   std::vector<std::chrono::system_clock::time_point>
+   GetTimePointsByDate(std::chrono::system_clock::time_point date) override;
+
+   std::vector<std::string> GetAvailableProducts() override;
+
+private:
+   class Impl;
+   std::unique_ptr<Impl> p;
+};
+
+} // namespace provider
+} // namespace scwx
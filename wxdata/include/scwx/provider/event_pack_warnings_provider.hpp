@@ -0,0 +1,42 @@
+#pragma once
+
+#include <scwx/provider/event_pack.hpp>
+#include <scwx/provider/warnings_provider.hpp>
+
+namespace scwx
+{
+namespace provider
+{
+
+/**
+ * @brief Event Pack Warnings Provider
+ *
+ * Serves the text products stored in an event pack in place of the warnings
+ * directory listing.
+ */
+class EventPackWarningsProvider : public WarningsProvider
+{
+public:
+   explicit EventPackWarningsProvider(
+      const std::shared_ptr<EventPack>& eventPack);
+   ~EventPackWarningsProvider();
+
+   EventPackWarningsProvider(const EventPackWarningsProvider&) = delete;
+   EventPackWarningsProvider&
+   operator=(const EventPackWarningsProvider&) = delete;
+
+   EventPackWarningsProvider(EventPackWarningsProvider&&) noexcept;
+   EventPackWarningsProvider& operator=(EventPackWarningsProvider&&) noexcept;
+
+   std::pair<size_t, size_t>
+   ListFiles(std::chrono::system_clock::time_point newerThan = {}) override;
+   std::vector<std::shared_ptr<awips::TextProductFile>> LoadUpdatedFiles(
+      std::chrono::system_clock::time_point newerThan = {}) override;
+
+private:
+   class Impl;
+   std::unique_ptr<Impl> p;
+};
+
+} // namespace provider
+} // namespace scwx
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <scwx/provider/event_pack.hpp>
+
+namespace scwx
+{
+namespace provider
+{
+
+/**
+ * @brief Event Pack Writer
+ *
+ * Collects raw objects in memory, and writes them to an event pack file.
+ */
+class EventPackWriter
+{
+public:
+   explicit EventPackWriter();
+   ~EventPackWriter();
+
+   EventPackWriter(const EventPackWriter&)            = delete;
+   EventPackWriter& operator=(const EventPackWriter&) = delete;
+
+   EventPackWriter(EventPackWriter&&) noexcept;
+   EventPackWriter& operator=(EventPackWriter&&) noexcept;
+
+   size_t object_count() const;
+
+   /**
+    * Adds a raw object to the event pack. The data is copied.
+    *
+    * @param [in] type Object type
+    * @param [in] radarSite Radar site, or the issuing office of a text product
+    * @param [in] product Level 3 product, or empty
+    * @param [in] key Object key, as used by the originating data provider
+    * @param [in] time Object time
+    * @param [in] data Raw object data
+    */
+   void AddObject(EventPackObjectType                   type,
+                  const std::string&                    radarSite,
+                  const std::string&                    product,
+                  const std::string&                    key,
+                  std::chrono::system_clock::time_point time,
+                  std::span<const char>                 data);
+
+   /**
+    * Writes the event pack, with the index sorted by object time.
+    *
+    * @param [in] filename Event pack filename
+    *
+    * @return Whether the event pack was written successfully
+    */
+   bool WriteFile(const std::string& filename) const;
+
+private:
+   class Impl;
+   std::unique_ptr<Impl> p;
+};
+
+} // namespace provider
+} // namespace scwx
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <scwx/provider/event_pack.hpp>
 #include <scwx/provider/nexrad_data_provider.hpp>
 
 #include <memory>
@@ -30,6 +31,17 @@ public:
    static std::shared_ptr<NexradDataProvider>
    CreateLevel3DataProvider(const std::string& radarSite,
                             const std::string& product);
+
+   static std::shared_ptr<EventPack> event_pack();
+
+   /**
+    * Sets the event pack from which subsequently created data providers serve
+    * data, in place of AWS. Providers that have already been created are not
+    * affected.
+    *
+    * @param [in] eventPack Event pack, or nullptr to serve data from AWS
+    */
+   static void SetEventPack(const std::shared_ptr<EventPack>& eventPack);
 };
 
 } // namespace provider
@@ -14,7 +14,7 @@ class WarningsProvider
 {
 public:
    explicit WarningsProvider(const std::string& baseUrl);
-   ~WarningsProvider();
+   virtual ~WarningsProvider();
 
    WarningsProvider(const WarningsProvider&)            = delete;
    WarningsProvider& operator=(const WarningsProvider&) = delete;
@@ -22,9 +22,9 @@ public:
    WarningsProvider(WarningsProvider&&) noexcept;
    WarningsProvider& operator=(WarningsProvider&&) noexcept;
 
-   std::pair<size_t, size_t>
+   virtual std::pair<size_t, size_t>
    ListFiles(std::chrono::system_clock::time_point newerThan = {});
-   std::vector<std::shared_ptr<awips::TextProductFile>>
+   virtual std::vector<std::shared_ptr<awips::TextProductFile>>
    LoadUpdatedFiles(std::chrono::system_clock::time_point newerThan = {});
 
 private:
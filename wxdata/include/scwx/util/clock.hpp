@@ -0,0 +1,118 @@
+#pragma once
+
+#include <chrono>
+#include <memory>
+
+namespace scwx
+{
+namespace util
+{
+
+/**
+ * @brief Clock
+ *
+ * Source of the current time for data refresh, alert and timeline logic. The
+ * system clock is used unless another clock is set, such as a replay clock
+ * running at a displaced time.
+ */
+class Clock
+{
+public:
+   explicit Clock() = default;
+   virtual ~Clock() = default;
+
+   Clock(const Clock&)            = delete;
+   Clock& operator=(const Clock&) = delete;
+
+   Clock(Clock&&) noexcept            = delete;
+   Clock& operator=(Clock&&) noexcept = delete;
+
+   /**
+    * Gets the current time of the clock.
+    *
+    * @return Current time
+    */
+   virtual std::chrono::system_clock::time_point now() const = 0;
+
+   /**
+    * Gets the rate at which the clock advances relative to real time.
+    *
+    * @return Clock speed
+    */
+   virtual double speed() const = 0;
+};
+
+class SystemClock : public Clock
+{
+public:
+   explicit SystemClock() = default;
+   ~SystemClock()         = default;
+
+   std::chrono::system_clock::time_point now() const override;
+   double                                speed() const override;
+};
+
+/**
+ * @brief Replay Clock
+ *
+ * Advances from a start time in the past at a fixed multiple of real time,
+ * beginning when the clock is created.
+ */
+class ReplayClock : public Clock
+{
+public:
+   explicit ReplayClock(std::chrono::system_clock::time_point startTime,
+                        double                                speed = 1.0);
+   ~ReplayClock() = default;
+
+   std::chrono::system_clock::time_point start_time() const;
+
+   std::chrono::system_clock::time_point now() const override;
+   double                                speed() const override;
+
+private:
+   const std::chrono::system_clock::time_point startTime_;
+   const std::chrono::steady_clock::time_point steadyStartTime_;
+   const double                                speed_;
+};
+
+/**
+ * Gets the active clock.
+ *
+ * @return Active clock
+ */
+std::shared_ptr<Clock> GetClock();
+
+/**
+ * Sets the active clock.
+ *
+ * @param [in] clock Clock, or nullptr to use the system clock
+ */
+void SetClock(const std::shared_ptr<Clock>& clock);
+
+/**
+ * Gets the current time of the active clock.
+ *
+ * @return Current time
+ */
+std::chrono::system_clock::time_point CurrentTime();
+
+/**
+ * Determines whether the active clock is displaced from the system clock.
+ *
+ * @return Whether a replay is active
+ */
+bool IsReplayActive();
+
+/**
+ * Converts a duration of the active clock to the real time duration used to
+ * schedule timers.
+ *
+ * @param [in] duration Clock duration
+ *
+ * @return Real time duration
+ */
+std::chrono::milliseconds RealDuration(std::chrono::milliseconds duration);
+
+} // namespace util
+} // namespace scwx
@@ -1,8 +1,10 @@
 #pragma once
 
 #include <cstdint>
+#include <initializer_list>
 #include <optional>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace scwx
@@ -39,8 +41,50 @@ std::vector<std::string> ParseTokens(const std::string&       s,
                                      std::vector<std::string> delimiters,
                                      std::size_t              pos = 0);
 
+/**
+ * @brief Parse a list of tokens from a string view
+ *
+ * This function applies the same tokenizing rules as ParseTokens, but does not
+ * allocate storage for each token. Each token is a view into the input string,
+ * and is only valid for the lifetime of the input. The token vector is cleared
+ * before parsing, allowing its storage to be reused between calls.
+ *
+ * @param [in] s Input string to tokenize
+ * @param [in] delimiters A list of delimiters to use for each token.
+ * @param [out] tokens Tokenized string
+ * @param [in] pos Search begin position. Default is 0.
+ */
+void ParseTokens(std::string_view                        s,
+                 std::initializer_list<std::string_view> delimiters,
+                 std::vector<std::string_view>&          tokens,
+                 std::size_t                             pos = 0);
+
+/**
+ * @brief Trim leading and trailing whitespace from a string view
+ *
+ * @param [in] s Input string
+ *
+ * @return Trimmed string view
+ */
+std::string_view TrimView(std::string_view s);
+
 std::string ToString(const std::vector<std::string>& v);
 
+/**
+ * @brief Parse a numeric value from a string view
+ *
+ * Leading whitespace and a leading plus sign are ignored. Parsing stops at the
+ * first character which is not part of the number.
+ *
+ * @param [in] str Input string
+ *
+ * @return Parsed numeric value
+ *
+ * @throws std::invalid_argument if a numeric value could not be parsed
+ */
+template<typename T>
+T ParseNumeric(std::string_view str);
+
 template<typename T>
 std::optional<T> TryParseNumeric(const std::string& str);
 
@@ -48,6 +92,9 @@ std::optional<T> TryParseNumeric(const std::string& str);
 template std::optional<std::uint16_t> TryParseNumeric(const std::string& str);
 template std::optional<std::uint32_t> TryParseNumeric(const std::string& str);
 template std::optional<float>         TryParseNumeric(const std::string& str);
+template double                       ParseNumeric(std::string_view str);
+template int                          ParseNumeric(std::string_view str);
+template std::size_t                  ParseNumeric(std::string_view str);
 #endif
 
 } // namespace util
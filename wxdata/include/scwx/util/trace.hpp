@@ -0,0 +1,161 @@
+#pragma once
+
+#include <scwx/util/iterator.hpp>
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace scwx
+{
+namespace util
+{
+
+/**
+ * Stages of the radar data pipeline, from object listing to rendering.
+ */
+enum class TraceStage
+{
+   ProviderRefresh,
+   ObjectLoad,
+   FileDecode,
+   RecordStore,
+   ComputeSweep,
+   UpdateSweep,
+   Render,
+   EndToEnd,
+   Unknown
+};
+typedef scwx::util::
+   Iterator<TraceStage, TraceStage::ProviderRefresh, TraceStage::EndToEnd>
+      TraceStageIterator;
+
+const std::string& GetTraceStageName(TraceStage stage);
+
+struct TraceTags
+{
+   std::string                           radarSite_ {};
+   std::string                           product_ {};
+   std::chrono::system_clock::time_point volumeTime_ {};
+};
+
+/**
+ * Latency statistics of a single stage. Histogram bucket i counts the spans
+ * with a duration in [2^i, 2^(i+1)) microseconds, with durations below 1 us
+ * counted in bucket 0.
+ */
+struct TraceStatistics
+{
+   static constexpr std::size_t kHistogramBuckets_ = 32u;
+
+   std::size_t               count_ {};
+   std::chrono::microseconds total_ {};
+   std::chrono::microseconds min_ {};
+   std::chrono::microseconds max_ {};
+
+   std::array<std::size_t, kHistogramBuckets_> histogram_ {};
+
+   /**
+    * Estimates a percentile from the histogram.
+    *
+    * @param [in] percentile Percentile, from 0.0 to 1.0
+    *
+    * @return Upper bound of the histogram bucket containing the percentile
+    */
+   std::chrono::microseconds Percentile(double percentile) const;
+};
+
+/**
+ * @brief Tracer
+ *
+ * Collects latency spans of the radar data pipeline, aggregates them into
+ * per-stage histograms, and keeps the most recent spans for export as a
+ * trace file.
+ */
+class Tracer
+{
+public:
+   explicit Tracer();
+   ~Tracer();
+
+   Tracer(const Tracer&)            = delete;
+   Tracer& operator=(const Tracer&) = delete;
+
+   Tracer(Tracer&&) noexcept            = delete;
+   Tracer& operator=(Tracer&&) noexcept = delete;
+
+   static Tracer& Instance();
+
+   void Record(TraceStage                            stage,
+               const TraceTags&                      tags,
+               std::chrono::steady_clock::time_point start,
+               std::chrono::steady_clock::time_point end);
+
+   /**
+    * Marks the arrival of new data, starting an end-to-end span. Repeated
+    * arrivals of the same data do not restart the span.
+    *
+    * @param [in] radarSite Radar site
+    * @param [in] volumeTime Volume time of the new data
+    */
+   void MarkArrival(const std::string&                    radarSite,
+                    std::chrono::system_clock::time_point volumeTime);
+
+   /**
+    * Marks the first rendered frame of data, ending its end-to-end span if
+    * the arrival of the data was marked.
+    *
+    * @param [in] tags Tags of the rendered data
+    */
+   void MarkRendered(const TraceTags& tags);
+
+   TraceStatistics GetStatistics(TraceStage stage) const;
+
+   /**
+    * Writes the recorded spans in the Chrome trace event format, which can be
+    * opened with chrome://tracing or Perfetto.
+    *
+    * @param [in] filename Trace filename
+    *
+    * @return Whether the trace was written successfully
+    */
+   bool ExportTrace(const std::string& filename) const;
+
+   void Reset();
+
+private:
+   class Impl;
+   std::unique_ptr<Impl> p;
+};
+
+/**
+ * Records a span from construction until End() is called or the span is
+ * destroyed.
+ */
+class TraceSpan
+{
+public:
+   explicit TraceSpan(TraceStage stage, const TraceTags& tags = {});
+   ~TraceSpan();
+
+   TraceSpan(const TraceSpan&)            = delete;
+   TraceSpan& operator=(const TraceSpan&) = delete;
+
+   TraceSpan(TraceSpan&&) noexcept            = delete;
+   TraceSpan& operator=(TraceSpan&&) noexcept = delete;
+
+   void set_tags(const TraceTags& tags);
+
+   void End();
+
+private:
+   TraceStage                            stage_;
+   TraceTags                             tags_;
+   std::chrono::steady_clock::time_point start_;
+   bool                                  ended_ {false};
+};
+
+} // namespace util
+} // namespace scwx
@@ -2,11 +2,14 @@
 
 #include <scwx/wsr88d/nexrad_file.hpp>
 #include <scwx/wsr88d/rda/generic_radar_data.hpp>
+#include <scwx/wsr88d/rda/rda_status_data.hpp>
 #include <scwx/wsr88d/rda/volume_coverage_pattern_data.hpp>
 
 #include <chrono>
 #include <memory>
+#include <optional>
 #include <string>
+#include <vector>
 
 namespace scwx
 {
@@ -15,6 +18,33 @@ namespace wsr88d
 
 class Ar2vFileImpl;
 
+struct Ar2vElevationCutSummary
+{
+   double            elevationAngle_ {};
+   rda::WaveformType waveformType_ {rda::WaveformType::Unknown};
+   bool              sailsCut_ {false};
+   bool              mrleCut_ {false};
+};
+
+/**
+ * Compact summary of an Archive II volume, read from the volume header and
+ * the metadata record without decompressing radial data.
+ */
+struct Ar2vVolumeSummary
+{
+   std::string                           filename_ {};
+   std::string                           icao_ {};
+   std::chrono::system_clock::time_point startTime_ {};
+
+   std::uint16_t vcpNumber_ {};
+   std::uint16_t sailsCuts_ {};
+   std::uint16_t mrleCuts_ {};
+   std::uint16_t rdaBuildNumber_ {};
+   std::uint16_t operationalMode_ {};
+
+   std::vector<Ar2vElevationCutSummary> elevationCuts_ {};
+};
+
 /**
  * @brief The Archive II file is specified in the Interface Control Document for
  * the Archive II/User, Document Number 2620010H, published by the WSR-88D Radar
@@ -45,6 +75,8 @@ public:
                                                          radar_data() const;
    std::shared_ptr<const rda::VolumeCoveragePatternData> vcp_data() const;
 
+   std::shared_ptr<const rda::RdaStatusData> rda_status_data() const;
+
    std::tuple<std::shared_ptr<rda::ElevationScan>, float, std::vector<float>>
    GetElevationScan(rda::DataBlockType                    dataBlockType,
                     float                                 elevation,
@@ -53,6 +85,37 @@ public:
    bool LoadFile(const std::string& filename);
    bool LoadData(std::istream& is);
 
+   /**
+    * Loads the volume header, and the VCP and RDA status messages of the
+    * metadata record. Radial data is neither decompressed nor parsed.
+    *
+    * @param [in] is Input stream
+    *
+    * @return true if the volume header was read
+    */
+   bool LoadMetadata(std::istream& is);
+
+   /**
+    * Summarizes the volume of an Archive II file, loading only its metadata.
+    *
+    * @param [in] filename Archive II filename
+    *
+    * @return Volume summary, or empty if the file could not be read
+    */
+   static std::optional<Ar2vVolumeSummary>
+   ScanFile(const std::string& filename);
+
+   /**
+    * Summarizes the volumes of Archive II files in parallel, loading only
+    * their metadata. Files that could not be read are omitted.
+    *
+    * @param [in] filenames Archive II filenames
+    *
+    * @return Volume summaries, in the order of the filenames
+    */
+   static std::vector<Ar2vVolumeSummary>
+   ScanFiles(const std::vector<std::string>& filenames);
+
 private:
    std::unique_ptr<Ar2vFileImpl> p;
 };
@@ -3,6 +3,7 @@
 #include <scwx/wsr88d/rpg/graphic_product_message.hpp>
 
 #include <optional>
+#include <vector>
 
 #include <units/angle.h>
 #include <units/length.h>
@@ -76,6 +77,7 @@ public:
 
    std::shared_ptr<const StiRecord>
    sti_record(const std::string& stormId) const;
+   std::vector<std::shared_ptr<const StiRecord>> sti_records() const;
 
    bool Parse(std::istream& is) override;
 
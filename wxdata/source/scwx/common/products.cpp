@@ -15,6 +15,7 @@ static const std::unordered_map<RadarProductGroup, std::string>
 static const std::unordered_map<Level2Product, std::string> level2Name_ {
    {Level2Product::Reflectivity, "REF"},
    {Level2Product::Velocity, "VEL"},
+   {Level2Product::StormRelativeVelocity, "SRV"},
    {Level2Product::SpectrumWidth, "SW"},
    {Level2Product::DifferentialReflectivity, "ZDR"},
    {Level2Product::DifferentialPhase, "PHI"},
@@ -25,6 +26,7 @@ static const std::unordered_map<Level2Product, std::string> level2Name_ {
 static const std::unordered_map<Level2Product, std::string> level2Description_ {
    {Level2Product::Reflectivity, "Reflectivity"},
    {Level2Product::Velocity, "Velocity"},
+   {Level2Product::StormRelativeVelocity, "Storm Relative Velocity"},
    {Level2Product::SpectrumWidth, "Spectrum Width"},
    {Level2Product::DifferentialReflectivity, "Differential Reflectivity"},
    {Level2Product::DifferentialPhase, "Differential Phase"},
@@ -35,6 +37,7 @@ static const std::unordered_map<Level2Product, std::string> level2Description_ {
 static const std::unordered_map<Level2Product, std::string> level2Palette_ {
    {Level2Product::Reflectivity, "BR"},
    {Level2Product::Velocity, "BV"},
+   {Level2Product::StormRelativeVelocity, "SRV"},
    {Level2Product::SpectrumWidth, "SW"},
    {Level2Product::DifferentialReflectivity, "ZDR"},
    {Level2Product::DifferentialPhase, "PHI2"},
@@ -11,10 +11,10 @@
 #include <scwx/gr/placefile.hpp>
 #include <scwx/gr/color.hpp>
 #include <scwx/util/logger.hpp>
-#include <scwx/util/streams.hpp>
 #include <scwx/util/strings.hpp>
 
 #include <fstream>
+#include <iterator>
 #include <sstream>
 #include <unordered_map>
 
@@ -34,6 +34,51 @@ namespace gr
 static const std::string logPrefix_ {"scwx::gr::placefile"};
 static const auto        logger_ = util::Logger::Create(logPrefix_);
 
+/**
+ * Allocator used to place draw items in the placefile arena. The allocator
+ * shares ownership of the arena, keeping it alive for as long as any draw item
+ * allocated from it is referenced.
+ */
+template<typename T>
+class ArenaAllocator
+{
+public:
+   typedef T value_type;
+
+   explicit ArenaAllocator(
+      std::shared_ptr<std::pmr::memory_resource> resource) noexcept :
+       resource_ {std::move(resource)}
+   {
+   }
+   template<typename U>
+   ArenaAllocator(const ArenaAllocator<U>& other) noexcept :
+       resource_ {other.resource_}
+   {
+   }
+
+   T* allocate(std::size_t n)
+   {
+      return static_cast<T*>(
+         resource_->allocate(n * sizeof(T), alignof(T)));
+   }
+   void deallocate(T* ptr, std::size_t n) noexcept
+   {
+      resource_->deallocate(ptr, n * sizeof(T), alignof(T));
+   }
+
+   template<typename U>
+   bool operator==(const ArenaAllocator<U>& other) const noexcept
+   {
+      return resource_ == other.resource_;
+   }
+
+private:
+   template<typename U>
+   friend class ArenaAllocator;
+
+   std::shared_ptr<std::pmr::memory_resource> resource_;
+};
+
 enum class DrawingStatement
 {
    Standard,
@@ -55,18 +100,21 @@ public:
       double y_ {};
    };
 
-   void ParseLocation(const std::string& latitudeToken,
-                      const std::string& longitudeToken,
-                      double&            latitude,
-                      double&            longitude,
-                      double&            x,
-                      double&            y);
-   void ProcessElement(const std::string& line);
+   template<typename T>
+   std::shared_ptr<T> CreateDrawItem();
+
+   void ParseLocation(std::string_view latitudeToken,
+                      std::string_view longitudeToken,
+                      double&          latitude,
+                      double&          longitude,
+                      double&          x,
+                      double&          y);
+   void ProcessElement(std::string_view line);
    void ProcessElementEnd();
-   void ProcessLine(const std::string& line);
+   void ProcessLine(std::string_view line);
 
-   static void ProcessEscapeCharacters(std::string& s);
-   static void TrimQuotes(std::string& s);
+   static std::string      ProcessEscapeCharacters(std::string_view s);
+   static std::string_view TrimQuotes(std::string_view s);
 
    std::string          name_ {};
    std::string          title_ {};
@@ -80,10 +128,16 @@ public:
    std::chrono::sys_time<std::chrono::seconds> startTime_ {};
    std::chrono::sys_time<std::chrono::seconds> endTime_ {};
 
+   // Draw item and element storage
+   std::shared_ptr<std::pmr::monotonic_buffer_resource> arena_ {
+      std::make_shared<std::pmr::monotonic_buffer_resource>()};
+
    std::vector<Object>       objectStack_ {};
    DrawingStatement          currentStatement_ {DrawingStatement::Standard};
    std::shared_ptr<DrawItem> currentDrawItem_ {nullptr};
-   std::vector<PolygonDrawItem::Element> currentPolygonContour_ {};
+   std::pmr::vector<PolygonDrawItem::Element> currentPolygonContour_ {
+      arena_.get()};
+   std::vector<std::string_view>              tokenList_ {};
 
    // References
    std::unordered_map<std::size_t, std::shared_ptr<IconFile>> iconFiles_ {};
@@ -166,9 +220,40 @@ std::shared_ptr<Placefile> Placefile::Load(const std::string& name,
 
    placefile->p->name_ = name;
 
-   std::string line;
-   while (scwx::util::getline(is, line))
+   // Read the entire placefile into a single buffer. Each line is processed
+   // as a view into this buffer.
+   const std::string buffer {std::istreambuf_iterator<char>(is),
+                             std::istreambuf_iterator<char>()};
+
+   std::size_t pos = 0;
+   while (pos < buffer.size())
    {
+      // Find the end of the line, treating any sequence of carriage returns
+      // optionally followed by a line feed as a single line ending
+      std::size_t lineEnd = buffer.find_first_of("\r\n", pos);
+      std::size_t nextPos = lineEnd;
+
+      if (lineEnd == std::string::npos)
+      {
+         lineEnd = buffer.size();
+         nextPos = buffer.size();
+      }
+      else if (buffer[lineEnd] == '\r')
+      {
+         nextPos = buffer.find_first_not_of('\r', lineEnd);
+         if (nextPos != std::string::npos && buffer[nextPos] == '\n')
+         {
+            ++nextPos;
+         }
+      }
+      else
+      {
+         ++nextPos;
+      }
+
+      std::string_view line {buffer.data() + pos, lineEnd - pos};
+      pos = (nextPos != std::string::npos) ? nextPos : buffer.size();
+
       // Find position of comment (;)
       bool inQuotes = false;
       for (std::size_t i = 0; i < line.size(); ++i)
@@ -176,7 +261,7 @@ std::shared_ptr<Placefile> Placefile::Load(const std::string& name,
          if (!inQuotes && line[i] == ';')
          {
             // Remove comment
-            line.erase(i);
+            line = line.substr(0, i);
             break;
          }
          else if (line[i] == '"')
@@ -187,7 +272,7 @@ std::shared_ptr<Placefile> Placefile::Load(const std::string& name,
       }
 
       // Remove extra spacing from line
-      boost::trim(line);
+      line = util::TrimView(line);
 
       if (line.size() >= 1)
       {
@@ -227,7 +312,24 @@ std::shared_ptr<Placefile> Placefile::Load(const std::string& name,
    return placefile;
 }
 
-void Placefile::Impl::ProcessLine(const std::string& line)
+template<typename T>
+std::shared_ptr<T> Placefile::Impl::CreateDrawItem()
+{
+   ArenaAllocator<T> allocator {arena_};
+
+   if constexpr (std::is_constructible_v<T, DrawItem::allocator_type>)
+   {
+      // Element storage is allocated from the same arena as the draw item
+      return std::allocate_shared<T>(allocator,
+                                     DrawItem::allocator_type {arena_.get()});
+   }
+   else
+   {
+      return std::allocate_shared<T>(allocator);
+   }
+}
+
+void Placefile::Impl::ProcessLine(std::string_view line)
 {
    static const std::string titleKey_ {"Title:"};
    static const std::string thresholdKey_ {"Threshold:"};
@@ -258,29 +360,26 @@ void Placefile::Impl::ProcessLine(const std::string& line)
    if (boost::istarts_with(line, titleKey_))
    {
       // Title: title
-      title_ = line.substr(titleKey_.size());
-      boost::trim(title_);
+      title_ = util::TrimView(line.substr(titleKey_.size()));
    }
    else if (boost::istarts_with(line, thresholdKey_))
    {
       // Threshold: nautical_miles
-      std::vector<std::string> tokenList =
-         util::ParseTokens(line, {" "}, thresholdKey_.size());
+      util::ParseTokens(line, {" "}, tokenList_, thresholdKey_.size());
 
-      if (tokenList.size() >= 1)
+      if (tokenList_.size() >= 1)
       {
-         threshold_ =
-            units::length::nautical_miles<double>(std::stod(tokenList[0]));
+         threshold_ = units::length::nautical_miles<double>(
+            util::ParseNumeric<double>(tokenList_[0]));
       }
    }
    else if (boost::istarts_with(line, timeRangeKey_))
    {
       // TimeRange: start_time end_time
       //   (YYYY-MM-DDThh:mm:ss)
-      std::vector<std::string> tokenList =
-         util::ParseTokens(line, {" ", " "}, timeRangeKey_.size());
+      util::ParseTokens(line, {" ", " "}, tokenList_, timeRangeKey_.size());
 
-      if (tokenList.size() >= 2)
+      if (tokenList_.size() >= 2)
       {
          using namespace std::chrono;
 
@@ -290,8 +389,8 @@ void Placefile::Impl::ProcessLine(const std::string& line)
 
          static const std::string dateTimeFormat {"%Y-%m-%dT%H:%M:%S"};
 
-         std::istringstream ssStartTime {tokenList[0]};
-         std::istringstream ssEndTime {tokenList[1]};
+         std::istringstream ssStartTime {std::string {tokenList_[0]}};
+         std::istringstream ssEndTime {std::string {tokenList_[1]}};
 
          std::chrono::sys_time<seconds> startTime;
          std::chrono::sys_time<seconds> endTime;
@@ -320,12 +419,11 @@ void Placefile::Impl::ProcessLine(const std::string& line)
    else if (boost::istarts_with(line, hsluvKey_))
    {
       // HSLuv: value
-      std::vector<std::string> tokenList =
-         util::ParseTokens(line, {" "}, hsluvKey_.size());
+      util::ParseTokens(line, {" "}, tokenList_, hsluvKey_.size());
 
-      if (tokenList.size() >= 1)
+      if (tokenList_.size() >= 1)
       {
-         if (boost::iequals(tokenList[0], "true"))
+         if (boost::iequals(tokenList_[0], "true"))
          {
             colorMode_ = ColorMode::HSLuv;
          }
@@ -338,72 +436,70 @@ void Placefile::Impl::ProcessLine(const std::string& line)
    else if (boost::istarts_with(line, colorKey_))
    {
       // Color: red green blue [alpha]
-      std::vector<std::string> tokenList =
-         util::ParseTokens(line, {" ", " ", " ", " "}, colorKey_.size());
+      util::ParseTokens(
+         line, {" ", " ", " ", " "}, tokenList_, colorKey_.size());
 
-      if (tokenList.size() >= 3)
+      if (tokenList_.size() >= 3)
       {
-         color_ = ParseColor(tokenList, 0, colorMode_);
+         color_ = ParseColor(tokenList_, 0, colorMode_);
       }
    }
    else if (boost::istarts_with(line, scwxModulateIconKey_))
    {
       // Supercell Wx Extension
       // scwx-ModulateIcon: red green blue [alpha]
-      std::vector<std::string> tokenList = util::ParseTokens(
-         line, {" ", " ", " ", " "}, scwxModulateIconKey_.size());
+      util::ParseTokens(
+         line, {" ", " ", " ", " "}, tokenList_, scwxModulateIconKey_.size());
 
-      if (tokenList.size() >= 3)
+      if (tokenList_.size() >= 3)
       {
-         iconModulate_ = ParseColor(tokenList, 0, colorMode_);
+         iconModulate_ = ParseColor(tokenList_, 0, colorMode_);
       }
    }
    else if (boost::istarts_with(line, refreshKey_))
    {
       // Refresh: minutes
-      std::vector<std::string> tokenList =
-         util::ParseTokens(line, {" "}, refreshKey_.size());
+      util::ParseTokens(line, {" "}, tokenList_, refreshKey_.size());
 
-      if (tokenList.size() >= 1)
+      if (tokenList_.size() >= 1)
       {
-         refresh_ = std::chrono::minutes {std::stoi(tokenList[0])};
+         refresh_ =
+            std::chrono::minutes {util::ParseNumeric<int>(tokenList_[0])};
       }
    }
    else if (boost::istarts_with(line, refreshSecondsKey_))
    {
       // RefreshSeconds: seconds
-      std::vector<std::string> tokenList =
-         util::ParseTokens(line, {" "}, refreshSecondsKey_.size());
+      util::ParseTokens(line, {" "}, tokenList_, refreshSecondsKey_.size());
 
-      if (tokenList.size() >= 1)
+      if (tokenList_.size() >= 1)
       {
-         refresh_ = std::chrono::seconds {std::stoi(tokenList[0])};
+         refresh_ =
+            std::chrono::seconds {util::ParseNumeric<int>(tokenList_[0])};
       }
    }
    else if (boost::istarts_with(line, placeKey_))
    {
       // Place: latitude, longitude, string with spaces
-      std::vector<std::string> tokenList =
-         util::ParseTokens(line, {",", ","}, placeKey_.size());
+      util::ParseTokens(line, {",", ","}, tokenList_, placeKey_.size());
 
-      if (tokenList.size() >= 3)
+      if (tokenList_.size() >= 3)
       {
-         std::shared_ptr<TextDrawItem> di = std::make_shared<TextDrawItem>();
+         std::shared_ptr<TextDrawItem> di = CreateDrawItem<TextDrawItem>();
 
          di->threshold_ = threshold_;
          di->color_     = color_;
          di->startTime_ = startTime_;
          di->endTime_   = endTime_;
 
-         ParseLocation(tokenList[0],
-                       tokenList[1],
+         ParseLocation(tokenList_[0],
+                       tokenList_[1],
                        di->latitude_,
                        di->longitude_,
                        di->x_,
                        di->y_);
 
-         ProcessEscapeCharacters(tokenList[2]);
-         di->text_.swap(tokenList[2]);
+         di->text_ = ProcessEscapeCharacters(tokenList_[2]);
 
          drawItems_.emplace_back(std::move(di));
       }
@@ -415,21 +511,22 @@ void Placefile::Impl::ProcessLine(const std::string& line)
    else if (boost::istarts_with(line, iconFileKey_))
    {
       // IconFile: fileNumber, iconWidth, iconHeight, hotX, hotY, fileName
-      std::vector<std::string> tokenList = util::ParseTokens(
-         line, {",", ",", ",", ",", ","}, iconFileKey_.size());
+      util::ParseTokens(
+         line, {",", ",", ",", ",", ","}, tokenList_, iconFileKey_.size());
 
-      if (tokenList.size() >= 6)
+      if (tokenList_.size() >= 6)
       {
          std::shared_ptr<IconFile> iconFile = std::make_shared<IconFile>();
 
-         iconFile->fileNumber_ = std::stoul(tokenList[0]);
-         iconFile->iconWidth_  = std::stoul(tokenList[1]);
-         iconFile->iconHeight_ = std::stoul(tokenList[2]);
-         iconFile->hotX_       = std::stoul(tokenList[3]);
-         iconFile->hotY_       = std::stoul(tokenList[4]);
+         iconFile->fileNumber_ =
+            util::ParseNumeric<std::size_t>(tokenList_[0]);
+         iconFile->iconWidth_ = util::ParseNumeric<std::size_t>(tokenList_[1]);
+         iconFile->iconHeight_ =
+            util::ParseNumeric<std::size_t>(tokenList_[2]);
+         iconFile->hotX_ = util::ParseNumeric<std::size_t>(tokenList_[3]);
+         iconFile->hotY_ = util::ParseNumeric<std::size_t>(tokenList_[4]);
 
-         TrimQuotes(tokenList[5]);
-         iconFile->filename_.swap(tokenList[5]);
+         iconFile->filename_ = TrimQuotes(tokenList_[5]);
 
          iconFiles_.insert_or_assign(iconFile->fileNumber_, iconFile);
       }
@@ -441,37 +538,36 @@ void Placefile::Impl::ProcessLine(const std::string& line)
    else if (boost::istarts_with(line, iconKey_))
    {
       // Icon: lat, lon, angle, fileNumber, iconNumber, hoverText
-      std::vector<std::string> tokenList =
-         util::ParseTokens(line, {",", ",", ",", ",", ","}, iconKey_.size());
+      util::ParseTokens(
+         line, {",", ",", ",", ",", ","}, tokenList_, iconKey_.size());
 
       std::shared_ptr<IconDrawItem> di = nullptr;
 
-      if (tokenList.size() >= 5)
+      if (tokenList_.size() >= 5)
       {
-         di = std::make_shared<IconDrawItem>();
+         di = CreateDrawItem<IconDrawItem>();
 
          di->threshold_ = threshold_;
          di->startTime_ = startTime_;
          di->endTime_   = endTime_;
          di->modulate_  = iconModulate_;
 
-         ParseLocation(tokenList[0],
-                       tokenList[1],
+         ParseLocation(tokenList_[0],
+                       tokenList_[1],
                        di->latitude_,
                        di->longitude_,
                        di->x_,
                        di->y_);
 
-         di->angle_ = units::angle::degrees<double>(std::stod(tokenList[2]));
+         di->angle_ = units::angle::degrees<double>(
+            util::ParseNumeric<double>(tokenList_[2]));
 
-         di->fileNumber_ = std::stoul(tokenList[3]);
-         di->iconNumber_ = std::stoul(tokenList[4]);
+         di->fileNumber_ = util::ParseNumeric<std::size_t>(tokenList_[3]);
+         di->iconNumber_ = util::ParseNumeric<std::size_t>(tokenList_[4]);
       }
-      if (tokenList.size() >= 6)
+      if (tokenList_.size() >= 6)
       {
-         ProcessEscapeCharacters(tokenList[5]);
-         TrimQuotes(tokenList[5]);
-         di->hoverText_.swap(tokenList[5]);
+         di->hoverText_ = ProcessEscapeCharacters(TrimQuotes(tokenList_[5]));
       }
 
       if (di != nullptr)
@@ -486,19 +582,18 @@ void Placefile::Impl::ProcessLine(const std::string& line)
    else if (boost::istarts_with(line, fontKey_))
    {
       // Font: fontNumber, pixels, flags, "face"
-      std::vector<std::string> tokenList =
-         util::ParseTokens(line, {",", ",", ",", ","}, fontKey_.size());
+      util::ParseTokens(
+         line, {",", ",", ",", ","}, tokenList_, fontKey_.size());
 
-      if (tokenList.size() >= 4)
+      if (tokenList_.size() >= 4)
       {
          std::shared_ptr<Font> font = std::make_shared<Font>();
 
-         font->fontNumber_ = std::stoul(tokenList[0]);
-         font->pixels_     = std::stoul(tokenList[1]);
-         font->flags_      = std::stoi(tokenList[2]);
+         font->fontNumber_ = util::ParseNumeric<std::size_t>(tokenList_[0]);
+         font->pixels_     = util::ParseNumeric<std::size_t>(tokenList_[1]);
+         font->flags_      = util::ParseNumeric<int>(tokenList_[2]);
 
-         TrimQuotes(tokenList[3]);
-         font->face_.swap(tokenList[3]);
+         font->face_ = TrimQuotes(tokenList_[3]);
 
          fonts_.insert_or_assign(font->fontNumber_, font);
       }
@@ -510,38 +605,34 @@ void Placefile::Impl::ProcessLine(const std::string& line)
    else if (boost::istarts_with(line, textKey_))
    {
       // Text: lat, lon, fontNumber, "string", "hover"
-      std::vector<std::string> tokenList =
-         util::ParseTokens(line, {",", ",", ",", ",", ","}, textKey_.size());
+      util::ParseTokens(
+         line, {",", ",", ",", ",", ","}, tokenList_, textKey_.size());
 
       std::shared_ptr<TextDrawItem> di = nullptr;
 
-      if (tokenList.size() >= 4)
+      if (tokenList_.size() >= 4)
       {
-         di = std::make_shared<TextDrawItem>();
+         di = CreateDrawItem<TextDrawItem>();
 
          di->threshold_ = threshold_;
          di->color_     = color_;
          di->startTime_ = startTime_;
          di->endTime_   = endTime_;
 
-         ParseLocation(tokenList[0],
-                       tokenList[1],
+         ParseLocation(tokenList_[0],
+                       tokenList_[1],
                        di->latitude_,
                        di->longitude_,
                        di->x_,
                        di->y_);
 
-         di->fontNumber_ = std::stoul(tokenList[2]);
+         di->fontNumber_ = util::ParseNumeric<std::size_t>(tokenList_[2]);
 
-         ProcessEscapeCharacters(tokenList[3]);
-         TrimQuotes(tokenList[3]);
-         di->text_.swap(tokenList[3]);
+         di->text_ = ProcessEscapeCharacters(TrimQuotes(tokenList_[3]));
       }
-      if (tokenList.size() >= 5)
+      if (tokenList_.size() >= 5)
       {
-         ProcessEscapeCharacters(tokenList[4]);
-         TrimQuotes(tokenList[4]);
-         di->hoverText_.swap(tokenList[4]);
+         di->hoverText_ = ProcessEscapeCharacters(TrimQuotes(tokenList_[4]));
       }
 
       if (di != nullptr)
@@ -558,16 +649,15 @@ void Placefile::Impl::ProcessLine(const std::string& line)
       // Object: lat, lon
       //    ...
       // End:
-      std::vector<std::string> tokenList =
-         util::ParseTokens(line, {",", ","}, objectKey_.size());
+      util::ParseTokens(line, {",", ","}, tokenList_, objectKey_.size());
 
       double latitude {};
       double longitude {};
 
-      if (tokenList.size() >= 2)
+      if (tokenList_.size() >= 2)
       {
-         latitude  = std::stod(tokenList[0]);
-         longitude = std::stod(tokenList[1]);
+         latitude  = util::ParseNumeric<double>(tokenList_[0]);
+         longitude = util::ParseNumeric<double>(tokenList_[1]);
       }
       else
       {
@@ -590,34 +680,31 @@ void Placefile::Impl::ProcessLine(const std::string& line)
       //    lat, lon
       //    ...
       // End:
-      std::vector<std::string> tokenList =
-         util::ParseTokens(line, {",", ","}, lineKey_.size());
+      util::ParseTokens(line, {",", ","}, tokenList_, lineKey_.size());
 
       currentStatement_ = DrawingStatement::Line;
 
       std::shared_ptr<LineDrawItem> di = nullptr;
 
-      if (tokenList.size() >= 2)
+      if (tokenList_.size() >= 2)
       {
-         di = std::make_shared<LineDrawItem>();
+         di = CreateDrawItem<LineDrawItem>();
 
          di->threshold_ = threshold_;
          di->color_     = color_;
          di->startTime_ = startTime_;
          di->endTime_   = endTime_;
 
-         di->width_ = std::stoul(tokenList[0]);
+         di->width_ = util::ParseNumeric<std::size_t>(tokenList_[0]);
 
-         if (!tokenList[1].empty())
+         if (!tokenList_[1].empty())
          {
-            di->flags_ = std::stoul(tokenList[1]);
+            di->flags_ = util::ParseNumeric<std::size_t>(tokenList_[1]);
          }
       }
-      if (tokenList.size() >= 3)
+      if (tokenList_.size() >= 3)
       {
-         ProcessEscapeCharacters(tokenList[2]);
-         TrimQuotes(tokenList[2]);
-         di->hoverText_.swap(tokenList[2]);
+         di->hoverText_ = ProcessEscapeCharacters(TrimQuotes(tokenList_[2]));
       }
 
       if (di != nullptr)
@@ -639,7 +726,7 @@ void Placefile::Impl::ProcessLine(const std::string& line)
       currentStatement_ = DrawingStatement::Triangles;
 
       std::shared_ptr<TrianglesDrawItem> di =
-         std::make_shared<TrianglesDrawItem>();
+         CreateDrawItem<TrianglesDrawItem>();
 
       di->threshold_ = threshold_;
       di->color_     = color_;
@@ -655,23 +742,21 @@ void Placefile::Impl::ProcessLine(const std::string& line)
       //    lat, lon, Tu [, Tv ]
       //    ...
       // End:
-      std::vector<std::string> tokenList =
-         util::ParseTokens(line, {" "}, imageKey_.size());
+      util::ParseTokens(line, {" "}, tokenList_, imageKey_.size());
 
       currentStatement_ = DrawingStatement::Image;
 
       std::shared_ptr<ImageDrawItem> di = nullptr;
 
-      if (tokenList.size() >= 1)
+      if (tokenList_.size() >= 1)
       {
-         di = std::make_shared<ImageDrawItem>();
+         di = CreateDrawItem<ImageDrawItem>();
 
          di->threshold_ = threshold_;
          di->startTime_ = startTime_;
          di->endTime_   = endTime_;
 
-         TrimQuotes(tokenList[0]);
-         di->imageFile_.swap(tokenList[0]);
+         di->imageFile_ = TrimQuotes(tokenList_[0]);
 
          currentDrawItem_ = di;
          drawItems_.emplace_back(std::move(di));
@@ -695,7 +780,7 @@ void Placefile::Impl::ProcessLine(const std::string& line)
       // End:
       currentStatement_ = DrawingStatement::Polygon;
 
-      std::shared_ptr<PolygonDrawItem> di = std::make_shared<PolygonDrawItem>();
+      std::shared_ptr<PolygonDrawItem> di = CreateDrawItem<PolygonDrawItem>();
 
       di->threshold_ = threshold_;
       di->color_     = color_;
@@ -711,7 +796,7 @@ void Placefile::Impl::ProcessLine(const std::string& line)
    }
 }
 
-void Placefile::Impl::ProcessElement(const std::string& line)
+void Placefile::Impl::ProcessElement(std::string_view line)
 {
    if (currentStatement_ == DrawingStatement::Line)
    {
@@ -719,14 +804,14 @@ void Placefile::Impl::ProcessElement(const std::string& line)
       //    lat, lon
       //    ...
       // End:
-      std::vector<std::string> tokenList = util::ParseTokens(line, {",", ","});
+      util::ParseTokens(line, {",", ","}, tokenList_);
 
-      if (tokenList.size() >= 2)
+      if (tokenList_.size() >= 2)
       {
          LineDrawItem::Element element;
 
-         ParseLocation(tokenList[0],
-                       tokenList[1],
+         ParseLocation(tokenList_[0],
+                       tokenList_[1],
                        element.latitude_,
                        element.longitude_,
                        element.x_,
@@ -746,20 +831,19 @@ void Placefile::Impl::ProcessElement(const std::string& line)
       //    lat, lon [, r, g, b [,a]]
       //    ...
       // End:
-      std::vector<std::string> tokenList =
-         util::ParseTokens(line, {",", ",", ",", ",", ",", ","});
+      util::ParseTokens(line, {",", ",", ",", ",", ",", ","}, tokenList_);
 
       TrianglesDrawItem::Element element;
 
-      if (tokenList.size() >= 5)
+      if (tokenList_.size() >= 5)
       {
-         element.color_ = ParseColor(tokenList, 2, colorMode_);
+         element.color_ = ParseColor(tokenList_, 2, colorMode_);
       }
 
-      if (tokenList.size() >= 2)
+      if (tokenList_.size() >= 2)
       {
-         ParseLocation(tokenList[0],
-                       tokenList[1],
+         ParseLocation(tokenList_[0],
+                       tokenList_[1],
                        element.latitude_,
                        element.longitude_,
                        element.x_,
@@ -779,33 +863,32 @@ void Placefile::Impl::ProcessElement(const std::string& line)
       //    lat, lon, Tu [, Tv ]
       //    ...
       // End:
-      std::vector<std::string> tokenList =
-         util::ParseTokens(line, {",", ",", ",", ","});
+      util::ParseTokens(line, {",", ",", ",", ","}, tokenList_);
 
       ImageDrawItem::Element element;
 
-      if (tokenList.size() >= 3)
+      if (tokenList_.size() >= 3)
       {
-         ParseLocation(tokenList[0],
-                       tokenList[1],
+         ParseLocation(tokenList_[0],
+                       tokenList_[1],
                        element.latitude_,
                        element.longitude_,
                        element.x_,
                        element.y_);
 
-         element.tu_ = std::stod(tokenList[2]);
+         element.tu_ = util::ParseNumeric<double>(tokenList_[2]);
       }
 
-      if (tokenList.size() >= 4)
+      if (tokenList_.size() >= 4)
       {
-         element.tv_ = std::stod(tokenList[3]);
+         element.tv_ = util::ParseNumeric<double>(tokenList_[3]);
       }
       else
       {
          element.tv_ = element.tu_;
       }
 
-      if (tokenList.size() >= 3)
+      if (tokenList_.size() >= 3)
       {
          std::static_pointer_cast<ImageDrawItem>(currentDrawItem_)
             ->elements_.emplace_back(std::move(element));
@@ -827,20 +910,19 @@ void Placefile::Impl::ProcessElement(const std::string& line)
       //    ...
       //    lat2, lon2                  ; and repeating it ends the contour
       // End:
-      std::vector<std::string> tokenList =
-         util::ParseTokens(line, {",", ",", ",", ",", ",", ","});
+      util::ParseTokens(line, {",", ",", ",", ",", ",", ","}, tokenList_);
 
       PolygonDrawItem::Element element;
 
-      if (tokenList.size() >= 5)
+      if (tokenList_.size() >= 5)
       {
-         element.color_ = ParseColor(tokenList, 2, colorMode_);
+         element.color_ = ParseColor(tokenList_, 2, colorMode_);
       }
 
-      if (tokenList.size() >= 2)
+      if (tokenList_.size() >= 2)
       {
-         ParseLocation(tokenList[0],
-                       tokenList[1],
+         ParseLocation(tokenList_[0],
+                       tokenList_[1],
                        element.latitude_,
                        element.longitude_,
                        element.x_,
@@ -863,9 +945,8 @@ void Placefile::Impl::ProcessElement(const std::string& line)
                   std::static_pointer_cast<PolygonDrawItem>(currentDrawItem_)
                      ->contours_;
 
-               auto& newContour = contours.emplace_back(
-                  std::vector<PolygonDrawItem::Element> {});
-               newContour.swap(currentPolygonContour_);
+               contours.emplace_back(std::move(currentPolygonContour_));
+               currentPolygonContour_.clear();
             }
          }
       }
@@ -887,9 +968,8 @@ void Placefile::Impl::ProcessElementEnd()
       {
          auto& contours = di->contours_;
 
-         auto& newContour =
-            contours.emplace_back(std::vector<PolygonDrawItem::Element> {});
-         newContour.swap(currentPolygonContour_);
+         contours.emplace_back(std::move(currentPolygonContour_));
+         currentPolygonContour_.clear();
       }
 
       if (!di->contours_.empty())
@@ -907,19 +987,19 @@ void Placefile::Impl::ProcessElementEnd()
    }
 }
 
-void Placefile::Impl::ParseLocation(const std::string& latitudeToken,
-                                    const std::string& longitudeToken,
-                                    double&            latitude,
-                                    double&            longitude,
-                                    double&            x,
-                                    double&            y)
+void Placefile::Impl::ParseLocation(std::string_view latitudeToken,
+                                    std::string_view longitudeToken,
+                                    double&          latitude,
+                                    double&          longitude,
+                                    double&          x,
+                                    double&          y)
 {
    if (objectStack_.empty())
    {
       // If an Object statement is not currently open, parse latitude and
       // longitude tokens as-is
-      latitude  = std::stod(latitudeToken);
-      longitude = std::stod(longitudeToken);
+      latitude  = util::ParseNumeric<double>(latitudeToken);
+      longitude = util::ParseNumeric<double>(longitudeToken);
    }
    else
    {
@@ -929,8 +1009,8 @@ void Placefile::Impl::ParseLocation(const std::string& latitudeToken,
       longitude = objectStack_[0].y_;
 
       // The latitude and longitude tokens are interpreted as x, y offsets
-      x = std::stod(latitudeToken);
-      y = std::stod(longitudeToken);
+      x = util::ParseNumeric<double>(latitudeToken);
+      y = util::ParseNumeric<double>(longitudeToken);
 
       // If there are inner Object statements open, treat these as x, y offsets
       for (std::size_t i = 1; i < objectStack_.size(); i++)
@@ -941,19 +1021,36 @@ void Placefile::Impl::ParseLocation(const std::string& latitudeToken,
    }
 }
 
-void Placefile::Impl::ProcessEscapeCharacters(std::string& s)
+std::string Placefile::Impl::ProcessEscapeCharacters(std::string_view s)
 {
-   boost::replace_all(s, "\\r", "\r");
-   boost::replace_all(s, "\\n", "\n");
+   std::string result {};
+   result.reserve(s.size());
+
+   for (std::size_t i = 0; i < s.size(); ++i)
+   {
+      if (s[i] == '\\' && i + 1 < s.size() &&
+          (s[i + 1] == 'r' || s[i + 1] == 'n'))
+      {
+         result.push_back((s[i + 1] == 'r') ? '\r' : '\n');
+         ++i;
+      }
+      else
+      {
+         result.push_back(s[i]);
+      }
+   }
+
+   return result;
 }
 
-void Placefile::Impl::TrimQuotes(std::string& s)
+std::string_view Placefile::Impl::TrimQuotes(std::string_view s)
 {
    if (s.size() >= 2 && s.front() == '"' && s.back() == '"')
    {
-      s.erase(s.size() - 1);
-      s.erase(0, 1);
+      s.remove_prefix(1);
+      s.remove_suffix(1);
    }
+   return s;
 }
 
 } // namespace gr
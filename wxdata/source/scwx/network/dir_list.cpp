@@ -87,37 +87,56 @@ std::vector<DirListRecord> DirList(const std::string& baseUrl)
 
    logger_->trace("DirList: {}", baseUrl);
 
-   cpr::Response response =
-      cpr::Get(cpr::Url {baseUrl}, kSslOptions_, kHttpVersion_);
    DirListSAXData saxData {};
 
+   // Parse the listing as it is received, rather than after the full response
+   // has been stored
+   htmlParserCtxtPtr ctxt = htmlCreatePushParserCtxt(&saxHandler_,
+                                                     &saxData,
+                                                     nullptr,
+                                                     0,
+                                                     baseUrl.c_str(),
+                                                     XML_CHAR_ENCODING_NONE);
+
+   if (ctxt == nullptr)
+   {
+      logger_->error("Unable to create parser context");
+      return {};
+   }
+
+   htmlCtxtUseOptions(ctxt, HTML_PARSE_NONET);
+
+   cpr::Response response = cpr::Get(
+      cpr::Url {baseUrl},
+      kSslOptions_,
+      kHttpVersion_,
+      cpr::WriteCallback(
+         [&](std::string data, std::intptr_t /* userdata */)
+         {
+            // Chunks received from the transfer are small, and fit in an int
+            htmlParseChunk(
+               ctxt, data.data(), static_cast<int>(data.size()), 0);
+            return true;
+         }));
+
+   // Terminate parsing
+   htmlParseChunk(ctxt, nullptr, 0, 1);
+
+   if (ctxt->myDoc != nullptr)
+   {
+      xmlFreeDoc(ctxt->myDoc);
+   }
+   htmlFreeParserCtxt(ctxt);
+
    if (response.status_code != cpr::status::HTTP_OK)
    {
       logger_->warn("Bad response from {}: {} ({})",
                     baseUrl,
                     response.error.message,
                     response.status_code);
-   }
-   else
-   {
-      htmlParserCtxtPtr ctxt = htmlNewSAXParserCtxt(&saxHandler_, &saxData);
-      htmlDocPtr        doc  = nullptr;
 
-      if (ctxt != nullptr)
-      {
-         doc = htmlCtxtReadDoc(
-            ctxt,
-            reinterpret_cast<const xmlChar*>(response.text.c_str()),
-            baseUrl.c_str(),
-            nullptr,
-            HTML_PARSE_NONET);
-         htmlFreeParserCtxt(ctxt);
-      }
-
-      if (doc != nullptr)
-      {
-         xmlFreeDoc(doc);
-      }
+      // Discard any links parsed from an error page
+      saxData.records_.clear();
    }
 
    return saxData.records_;
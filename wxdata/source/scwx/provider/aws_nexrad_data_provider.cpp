@@ -1,10 +1,12 @@
 #define _SILENCE_STDEXT_ARR_ITERS_DEPRECATION_WARNING
 
 #include <scwx/provider/aws_nexrad_data_provider.hpp>
+#include <scwx/util/clock.hpp>
 #include <scwx/util/environment.hpp>
 #include <scwx/util/logger.hpp>
 #include <scwx/util/map.hpp>
 #include <scwx/util/time.hpp>
+#include <scwx/util/trace.hpp>
 #include <scwx/wsr88d/nexrad_file_factory.hpp>
 
 #include <shared_mutex>
@@ -246,6 +248,10 @@ AwsNexradDataProvider::ListObjects(std::chrono::system_clock::time_point date)
 
       logger_->debug("Found {} objects", objects.size());
 
+      // During a replay, objects after the current time do not exist yet
+      const bool replayActive = util::IsReplayActive();
+      const auto currentTime  = util::CurrentTime();
+
       // Store objects
       std::for_each( //
          objects.cbegin(),
@@ -259,11 +265,23 @@ AwsNexradDataProvider::ListObjects(std::chrono::system_clock::time_point date)
             {
                auto time = GetTimePointByKey(key);
 
+               if (replayActive && time > currentTime)
+               {
+                  return;
+               }
+
                std::chrono::seconds lastModifiedSeconds {
                   object.GetLastModified().Seconds()};
                std::chrono::system_clock::time_point lastModified {
                   lastModifiedSeconds};
 
+               // Archived objects may have been modified long after the
+               // replay time, so use the object time instead
+               if (replayActive)
+               {
+                  lastModified = time;
+               }
+
                std::unique_lock lock(p->objectsMutex_);
 
                auto [it, inserted] = p->objects_.insert_or_assign(
@@ -297,6 +315,8 @@ AwsNexradDataProvider::ListObjects(std::chrono::system_clock::time_point date)
 std::shared_ptr<wsr88d::NexradFile>
 AwsNexradDataProvider::LoadObjectByKey(const std::string& key)
 {
+   util::TraceSpan span {util::TraceStage::ObjectLoad, {p->radarSite_}};
+
    std::shared_ptr<wsr88d::NexradFile> nexradFile = nullptr;
 
    Aws::S3::Model::GetObjectRequest request;
@@ -326,7 +346,9 @@ std::pair<size_t, size_t> AwsNexradDataProvider::Refresh()
 
    logger_->debug("Refresh()");
 
-   auto today     = floor<days>(system_clock::now());
+   util::TraceSpan span {util::TraceStage::ProviderRefresh, {p->radarSite_}};
+
+   auto today     = floor<days>(util::CurrentTime());
    auto yesterday = today - days {1};
 
    std::unique_lock lock(p->refreshMutex_);
@@ -362,7 +384,7 @@ void AwsNexradDataProvider::Impl::PruneObjects()
 {
    using namespace std::chrono;
 
-   auto today     = floor<days>(system_clock::now());
+   auto today     = floor<days>(util::CurrentTime());
    auto yesterday = today - days {1};
 
    std::unique_lock lock(objectsMutex_);
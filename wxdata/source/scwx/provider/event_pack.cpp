@@ -0,0 +1,232 @@
+#include <scwx/provider/event_pack.hpp>
+#include <scwx/util/logger.hpp>
+
+#include <algorithm>
+#include <optional>
+#include <set>
+
+#include <boost/iostreams/device/mapped_file.hpp>
+
+namespace scwx
+{
+namespace provider
+{
+
+static const std::string logPrefix_ = "scwx::provider::event_pack";
+static const auto        logger_    = util::Logger::Create(logPrefix_);
+
+template<typename T>
+static T ReadLittleEndian(const char* data)
+{
+   T value {};
+   for (std::size_t i = 0; i < sizeof(T); ++i)
+   {
+      value |= static_cast<T>(static_cast<T>(static_cast<std::uint8_t>(data[i]))
+                              << (i * 8u));
+   }
+   return value;
+}
+
+class EventPack::Impl
+{
+public:
+   explicit Impl() {}
+   ~Impl() {}
+
+   std::optional<std::string_view> GetString(std::uint32_t offset) const;
+   void                            Reset();
+
+   std::string                          filename_ {};
+   boost::iostreams::mapped_file_source file_ {};
+   std::string_view                     strings_ {};
+   std::vector<EventPackObject>         objects_ {};
+};
+
+EventPack::EventPack() : p(std::make_unique<Impl>()) {}
+EventPack::~EventPack() = default;
+
+EventPack::EventPack(EventPack&&) noexcept            = default;
+EventPack& EventPack::operator=(EventPack&&) noexcept = default;
+
+const std::string& EventPack::filename() const
+{
+   return p->filename_;
+}
+
+const std::vector<EventPackObject>& EventPack::objects() const
+{
+   return p->objects_;
+}
+
+std::vector<const EventPackObject*>
+EventPack::FindObjects(EventPackObjectType type,
+                       std::string_view    radarSite,
+                       std::string_view    product) const
+{
+   std::vector<const EventPackObject*> objects {};
+
+   for (auto& object : p->objects_)
+   {
+      if (object.type_ == type && object.radarSite_ == radarSite &&
+          (product.empty() || object.product_ == product))
+      {
+         objects.push_back(&object);
+      }
+   }
+
+   return objects;
+}
+
+std::vector<std::string>
+EventPack::GetProducts(EventPackObjectType type,
+                       std::string_view    radarSite) const
+{
+   std::set<std::string_view> products {};
+
+   for (auto& object : p->objects_)
+   {
+      if (object.type_ == type && object.radarSite_ == radarSite)
+      {
+         products.insert(object.product_);
+      }
+   }
+
+   return {products.cbegin(), products.cend()};
+}
+
+bool EventPack::LoadFile(const std::string& filename)
+{
+   using namespace std::chrono;
+
+   logger_->debug("LoadFile: {}", filename);
+
+   p->Reset();
+   p->filename_ = filename;
+
+   try
+   {
+      p->file_.open(filename);
+   }
+   catch (const std::exception& ex)
+   {
+      logger_->warn("Could not map file: {} ({})", filename, ex.what());
+      return false;
+   }
+
+   const char*       data = p->file_.data();
+   const std::size_t size = p->file_.size();
+
+   if (size < kHeaderSize_ ||
+       std::string_view(data, kMagic_.size()) != kMagic_)
+   {
+      logger_->warn("Invalid event pack: {}", filename);
+      p->Reset();
+      return false;
+   }
+
+   const auto version = ReadLittleEndian<std::uint32_t>(data + 8);
+   if (version != kVersion_)
+   {
+      logger_->warn("Unsupported event pack version: {}", version);
+      p->Reset();
+      return false;
+   }
+
+   const auto objectCount   = ReadLittleEndian<std::uint32_t>(data + 12);
+   const auto indexOffset   = ReadLittleEndian<std::uint64_t>(data + 16);
+   const auto stringsOffset = ReadLittleEndian<std::uint64_t>(data + 24);
+   const auto stringsSize   = ReadLittleEndian<std::uint64_t>(data + 32);
+
+   if (indexOffset > size ||
+       objectCount > (size - indexOffset) / kIndexRecordSize_ ||
+       stringsOffset > size || stringsSize > size - stringsOffset)
+   {
+      logger_->warn("Invalid event pack index: {}", filename);
+      p->Reset();
+      return false;
+   }
+
+   p->strings_ = std::string_view(data + stringsOffset, stringsSize);
+   p->objects_.reserve(objectCount);
+
+   for (std::size_t i = 0; i < objectCount; ++i)
+   {
+      const char* record = data + indexOffset + i * kIndexRecordSize_;
+
+      const auto time =
+         static_cast<std::int64_t>(ReadLittleEndian<std::uint64_t>(record));
+      const auto dataOffset = ReadLittleEndian<std::uint64_t>(record + 8);
+      const auto dataSize   = ReadLittleEndian<std::uint64_t>(record + 16);
+      const auto radarSite =
+         p->GetString(ReadLittleEndian<std::uint32_t>(record + 24));
+      const auto product =
+         p->GetString(ReadLittleEndian<std::uint32_t>(record + 28));
+      const auto key =
+         p->GetString(ReadLittleEndian<std::uint32_t>(record + 32));
+      const auto type = static_cast<std::uint8_t>(record[36]);
+
+      if (dataOffset > size || dataSize > size - dataOffset ||
+          !radarSite.has_value() || !product.has_value() ||
+          !key.has_value() ||
+          type < static_cast<std::uint8_t>(EventPackObjectType::Level2) ||
+          type > static_cast<std::uint8_t>(EventPackObjectType::TextProduct))
+      {
+         logger_->warn("Invalid event pack object: {}", i);
+         p->Reset();
+         return false;
+      }
+
+      p->objects_.push_back(
+         {static_cast<EventPackObjectType>(type),
+          *radarSite,
+          *product,
+          *key,
+          system_clock::time_point {seconds {time}},
+          {data + dataOffset, static_cast<std::size_t>(dataSize)}});
+   }
+
+   // The index is written in time order, but do not rely on it for lookups
+   if (!std::is_sorted(p->objects_.cbegin(),
+                       p->objects_.cend(),
+                       [](auto& a, auto& b) { return a.time_ < b.time_; }))
+   {
+      std::stable_sort(p->objects_.begin(),
+                       p->objects_.end(),
+                       [](auto& a, auto& b) { return a.time_ < b.time_; });
+   }
+
+   logger_->debug("Loaded {} objects", p->objects_.size());
+
+   return true;
+}
+
+std::optional<std::string_view>
+EventPack::Impl::GetString(std::uint32_t offset) const
+{
+   if (offset >= strings_.size())
+   {
+      return std::nullopt;
+   }
+
+   std::size_t end = strings_.find('\0', offset);
+   if (end == std::string_view::npos)
+   {
+      return std::nullopt;
+   }
+
+   return strings_.substr(offset, end - offset);
+}
+
+void EventPack::Impl::Reset()
+{
+   objects_.clear();
+   strings_ = {};
+
+   if (file_.is_open())
+   {
+      file_.close();
+   }
+}
+
+} // namespace provider
+} // namespace scwx
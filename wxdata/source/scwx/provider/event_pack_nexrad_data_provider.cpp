@@ -0,0 +1,272 @@
+#include <scwx/provider/event_pack_nexrad_data_provider.hpp>
+#include <scwx/util/clock.hpp>
+#include <scwx/util/logger.hpp>
+#include <scwx/util/time.hpp>
+#include <scwx/util/trace.hpp>
+#include <scwx/wsr88d/nexrad_file_factory.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <map>
+#include <mutex>
+#include <unordered_map>
+
+#include <boost/iostreams/device/array.hpp>
+#include <boost/iostreams/stream.hpp>
+
+namespace scwx
+{
+namespace provider
+{
+
+static const std::string logPrefix_ =
+   "scwx::provider::event_pack_nexrad_data_provider";
+static const auto logger_ = util::Logger::Create(logPrefix_);
+
+class EventPackNexradDataProvider::Impl
+{
+public:
+   explicit Impl(const std::shared_ptr<EventPack>& eventPack,
+                 EventPackObjectType               type,
+                 const std::string&                radarSite,
+                 const std::string&                product) :
+       eventPack_ {eventPack},
+       type_ {type},
+       radarSite_ {radarSite},
+       objects_ {eventPack->FindObjects(type, radarSite, product)}
+   {
+      for (auto& object : objects_)
+      {
+         objectsByKey_.insert_or_assign(object->key_, object);
+      }
+   }
+
+   ~Impl() {}
+
+   typedef std::vector<const EventPackObject*>::const_iterator
+      ObjectIterator;
+
+   ObjectIterator GetVisibleEnd() const;
+   std::pair<ObjectIterator, ObjectIterator>
+   GetObjectsByDate(std::chrono::system_clock::time_point date) const;
+
+   std::shared_ptr<EventPack> eventPack_;
+   EventPackObjectType        type_;
+   std::string                radarSite_;
+
+   // Sorted by object time
+   std::vector<const EventPackObject*> objects_;
+   std::unordered_map<std::string_view, const EventPackObject*>
+      objectsByKey_ {};
+
+   std::mutex                              listMutex_ {};
+   std::map<std::chrono::sys_days, size_t> listedObjects_ {};
+   size_t                                  refreshedObjects_ {0u};
+};
+
+EventPackNexradDataProvider::EventPackNexradDataProvider(
+   const std::shared_ptr<EventPack>& eventPack,
+   EventPackObjectType               type,
+   const std::string&                radarSite,
+   const std::string&                product) :
+    p(std::make_unique<Impl>(eventPack, type, radarSite, product))
+{
+}
+EventPackNexradDataProvider::~EventPackNexradDataProvider() = default;
+
+EventPackNexradDataProvider::EventPackNexradDataProvider(
+   EventPackNexradDataProvider&&) noexcept = default;
+EventPackNexradDataProvider& EventPackNexradDataProvider::operator=(
+   EventPackNexradDataProvider&&) noexcept = default;
+
+size_t EventPackNexradDataProvider::cache_size() const
+{
+   return static_cast<size_t>(
+      std::distance(p->objects_.cbegin(), p->GetVisibleEnd()));
+}
+
+std::chrono::system_clock::time_point
+EventPackNexradDataProvider::last_modified() const
+{
+   auto end = p->GetVisibleEnd();
+   if (end == p->objects_.cbegin())
+   {
+      return {};
+   }
+
+   return (*std::prev(end))->time_;
+}
+
+std::chrono::seconds EventPackNexradDataProvider::update_period() const
+{
+   auto end = p->GetVisibleEnd();
+   if (std::distance(p->objects_.cbegin(), end) < 2)
+   {
+      return std::chrono::seconds {0};
+   }
+
+   return std::chrono::duration_cast<std::chrono::seconds>(
+      (*std::prev(end))->time_ - (*std::prev(end, 2))->time_);
+}
+
+std::string
+EventPackNexradDataProvider::FindKey(std::chrono::system_clock::time_point time)
+{
+   logger_->debug("FindKey: {}", util::TimeString(time));
+
+   // Find the first object after the time, and step back
+   auto it = std::upper_bound(p->objects_.cbegin(),
+                              p->GetVisibleEnd(),
+                              time,
+                              [](const auto& value, const auto& object)
+                              { return value < object->time_; });
+
+   if (it == p->objects_.cbegin())
+   {
+      return {};
+   }
+
+   return std::string {(*std::prev(it))->key_};
+}
+
+std::string EventPackNexradDataProvider::FindLatestKey()
+{
+   logger_->debug("FindLatestKey()");
+
+   auto end = p->GetVisibleEnd();
+   if (end == p->objects_.cbegin())
+   {
+      return {};
+   }
+
+   return std::string {(*std::prev(end))->key_};
+}
+
+std::tuple<bool, size_t, size_t>
+EventPackNexradDataProvider::ListObjects(
+   std::chrono::system_clock::time_point date)
+{
+   logger_->debug("ListObjects: {}", util::TimeString(date));
+
+   auto [begin, end]         = p->GetObjectsByDate(date);
+   const size_t totalObjects = static_cast<size_t>(std::distance(begin, end));
+
+   std::unique_lock lock {p->listMutex_};
+
+   // Objects are new the first time they are listed for their date
+   auto& listedObjects =
+      p->listedObjects_[std::chrono::floor<std::chrono::days>(date)];
+   const size_t newObjects =
+      (totalObjects > listedObjects) ? totalObjects - listedObjects : 0u;
+   listedObjects = totalObjects;
+
+   return {true, newObjects, totalObjects};
+}
+
+std::shared_ptr<wsr88d::NexradFile>
+EventPackNexradDataProvider::LoadObjectByKey(const std::string& key)
+{
+   auto it = p->objectsByKey_.find(key);
+   if (it == p->objectsByKey_.cend())
+   {
+      logger_->warn("Object not found: {}", key);
+      return nullptr;
+   }
+
+   util::TraceSpan span {util::TraceStage::ObjectLoad,
+                         {p->radarSite_, {}, it->second->time_}};
+
+   // Decode directly from the memory mapping
+   auto& data = it->second->data_;
+   boost::iostreams::stream<boost::iostreams::array_source> is {data.data(),
+                                                                 data.size()};
+
+   return wsr88d::NexradFileFactory::Create(is);
+}
+
+std::pair<size_t, size_t> EventPackNexradDataProvider::Refresh()
+{
+   logger_->debug("Refresh()");
+
+   util::TraceSpan span {util::TraceStage::ProviderRefresh, {p->radarSite_}};
+
+   const size_t totalObjects = cache_size();
+
+   std::unique_lock lock {p->listMutex_};
+
+   // Objects become visible as the clock advances, and are new the first time
+   // they are refreshed
+   const size_t newObjects = (totalObjects > p->refreshedObjects_) ?
+                                totalObjects - p->refreshedObjects_ :
+                                0u;
+   p->refreshedObjects_    = totalObjects;
+
+   return {newObjects, totalObjects};
+}
+
+std::chrono::system_clock::time_point
+EventPackNexradDataProvider::GetTimePointByKey(const std::string& key) const
+{
+   auto it = p->objectsByKey_.find(key);
+   if (it == p->objectsByKey_.cend())
+   {
+      return {};
+   }
+
+   return it->second->time_;
+}
+
+std::vector<std::chrono::system_clock::time_point>
+EventPackNexradDataProvider::GetTimePointsByDate(
+   std::chrono::system_clock::time_point date)
+{
+   logger_->trace("GetTimePointsByDate: {}", util::TimeString(date));
+
+   auto [begin, end] = p->GetObjectsByDate(date);
+
+   std::vector<std::chrono::system_clock::time_point> timePoints {};
+   std::transform(begin,
+                  end,
+                  std::back_inserter(timePoints),
+                  [](const auto& object) { return object->time_; });
+
+   return timePoints;
+}
+
+std::vector<std::string> EventPackNexradDataProvider::GetAvailableProducts()
+{
+   return p->eventPack_->GetProducts(p->type_, p->radarSite_);
+}
+
+EventPackNexradDataProvider::Impl::ObjectIterator
+EventPackNexradDataProvider::Impl::GetVisibleEnd() const
+{
+   // Objects after the current time are hidden, so that a replay clock sees
+   // the objects as they were available at the replay time
+   return std::upper_bound(objects_.cbegin(),
+                           objects_.cend(),
+                           util::CurrentTime(),
+                           [](const auto& time, const auto& object)
+                           { return time < object->time_; });
+}
+
+std::pair<EventPackNexradDataProvider::Impl::ObjectIterator,
+          EventPackNexradDataProvider::Impl::ObjectIterator>
+EventPackNexradDataProvider::Impl::GetObjectsByDate(
+   std::chrono::system_clock::time_point date) const
+{
+   const auto day        = std::chrono::floor<std::chrono::days>(date);
+   const auto visibleEnd = GetVisibleEnd();
+
+   const auto compare = [](const auto& object, const auto& time)
+   { return object->time_ < time; };
+
+   auto begin = std::lower_bound(objects_.cbegin(), visibleEnd, day, compare);
+   auto end   = std::lower_bound(
+      begin, visibleEnd, day + std::chrono::days {1}, compare);
+
+   return {begin, end};
+}
+
+} // namespace provider
+} // namespace scwx
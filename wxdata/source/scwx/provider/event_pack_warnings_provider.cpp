@@ -0,0 +1,132 @@
+#include <scwx/provider/event_pack_warnings_provider.hpp>
+#include <scwx/util/clock.hpp>
+#include <scwx/util/logger.hpp>
+
+#include <mutex>
+#include <set>
+
+#include <boost/iostreams/device/array.hpp>
+#include <boost/iostreams/stream.hpp>
+
+namespace scwx
+{
+namespace provider
+{
+
+static const std::string logPrefix_ =
+   "scwx::provider::event_pack_warnings_provider";
+static const auto logger_ = util::Logger::Create(logPrefix_);
+
+class EventPackWarningsProvider::Impl
+{
+public:
+   explicit Impl(const std::shared_ptr<EventPack>& eventPack) :
+       eventPack_ {eventPack}
+   {
+      for (auto& object : eventPack->objects())
+      {
+         if (object.type_ == EventPackObjectType::TextProduct)
+         {
+            objects_.push_back(&object);
+         }
+      }
+   }
+
+   ~Impl() {}
+
+   std::shared_ptr<EventPack> eventPack_;
+
+   // Sorted by object time
+   std::vector<const EventPackObject*> objects_ {};
+
+   std::set<const EventPackObject*> loadedObjects_ {};
+   std::mutex                       loadedObjectsMutex_ {};
+};
+
+EventPackWarningsProvider::EventPackWarningsProvider(
+   const std::shared_ptr<EventPack>& eventPack) :
+    WarningsProvider(eventPack->filename()),
+    p(std::make_unique<Impl>(eventPack))
+{
+}
+EventPackWarningsProvider::~EventPackWarningsProvider() = default;
+
+EventPackWarningsProvider::EventPackWarningsProvider(
+   EventPackWarningsProvider&&) noexcept = default;
+EventPackWarningsProvider& EventPackWarningsProvider::operator=(
+   EventPackWarningsProvider&&) noexcept = default;
+
+std::pair<size_t, size_t> EventPackWarningsProvider::ListFiles(
+   std::chrono::system_clock::time_point newerThan)
+{
+   logger_->trace("Listing files");
+
+   size_t updatedObjects = 0;
+   size_t totalObjects   = 0;
+
+   const auto currentTime = util::CurrentTime();
+
+   std::unique_lock lock(p->loadedObjectsMutex_);
+
+   for (auto& object : p->objects_)
+   {
+      // Text products after the current time have not been issued yet
+      if (object->time_ > currentTime)
+      {
+         break;
+      }
+
+      if (newerThan < object->time_)
+      {
+         if (!p->loadedObjects_.contains(object))
+         {
+            ++updatedObjects;
+         }
+         ++totalObjects;
+      }
+   }
+
+   return std::make_pair(updatedObjects, totalObjects);
+}
+
+std::vector<std::shared_ptr<awips::TextProductFile>>
+EventPackWarningsProvider::LoadUpdatedFiles(
+   std::chrono::system_clock::time_point newerThan)
+{
+   logger_->debug("Loading updated files");
+
+   std::vector<std::shared_ptr<awips::TextProductFile>> updatedFiles;
+
+   const auto currentTime = util::CurrentTime();
+
+   std::unique_lock lock(p->loadedObjectsMutex_);
+
+   for (auto& object : p->objects_)
+   {
+      if (object->time_ > currentTime)
+      {
+         break;
+      }
+
+      if (newerThan < object->time_ && p->loadedObjects_.insert(object).second)
+      {
+         logger_->debug("Loading file: {}", object->key_);
+
+         // Parse directly from the memory mapping
+         boost::iostreams::stream<boost::iostreams::array_source> is {
+            object->data_.data(), object->data_.size()};
+
+         std::shared_ptr<awips::TextProductFile> textProductFile {
+            std::make_shared<awips::TextProductFile>()};
+         if (textProductFile->LoadData(is))
+         {
+            updatedFiles.push_back(textProductFile);
+         }
+      }
+   }
+
+   return updatedFiles;
+}
+
+} // namespace provider
+} // namespace scwx
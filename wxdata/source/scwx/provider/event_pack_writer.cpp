@@ -0,0 +1,194 @@
+#include <scwx/provider/event_pack_writer.hpp>
+#include <scwx/util/logger.hpp>
+
+#include <algorithm>
+#include <array>
+#include <fstream>
+#include <numeric>
+#include <unordered_map>
+
+namespace scwx
+{
+namespace provider
+{
+
+static const std::string logPrefix_ = "scwx::provider::event_pack_writer";
+static const auto        logger_    = util::Logger::Create(logPrefix_);
+
+template<typename T>
+static void WriteLittleEndian(std::ostream& os, T value)
+{
+   std::array<char, sizeof(T)> bytes {};
+   for (std::size_t i = 0; i < sizeof(T); ++i)
+   {
+      bytes[i] = static_cast<char>((value >> (i * 8u)) & 0xffu);
+   }
+   os.write(bytes.data(), bytes.size());
+}
+
+static std::uint64_t Align(std::uint64_t offset)
+{
+   return (offset + EventPack::kAlignment_ - 1) / EventPack::kAlignment_ *
+          EventPack::kAlignment_;
+}
+
+class EventPackWriter::Impl
+{
+public:
+   struct ObjectRecord
+   {
+      EventPackObjectType type_;
+      std::uint32_t       radarSiteOffset_;
+      std::uint32_t       productOffset_;
+      std::uint32_t       keyOffset_;
+      std::int64_t        time_;
+      std::vector<char>   data_;
+   };
+
+   explicit Impl() {}
+   ~Impl() {}
+
+   std::uint32_t AddString(const std::string& value);
+
+   std::vector<ObjectRecord>                      objects_ {};
+   std::string                                    strings_ {};
+   std::unordered_map<std::string, std::uint32_t> stringOffsets_ {};
+};
+
+EventPackWriter::EventPackWriter() : p(std::make_unique<Impl>()) {}
+EventPackWriter::~EventPackWriter() = default;
+
+EventPackWriter::EventPackWriter(EventPackWriter&&) noexcept = default;
+EventPackWriter&
+EventPackWriter::operator=(EventPackWriter&&) noexcept = default;
+
+size_t EventPackWriter::object_count() const
+{
+   return p->objects_.size();
+}
+
+void EventPackWriter::AddObject(EventPackObjectType                   type,
+                                const std::string&                    radarSite,
+                                const std::string&                    product,
+                                const std::string&                    key,
+                                std::chrono::system_clock::time_point time,
+                                std::span<const char>                 data)
+{
+   using namespace std::chrono;
+
+   p->objects_.push_back(
+      {type,
+       p->AddString(radarSite),
+       p->AddString(product),
+       p->AddString(key),
+       duration_cast<seconds>(time.time_since_epoch()).count(),
+       {data.begin(), data.end()}});
+}
+
+bool EventPackWriter::WriteFile(const std::string& filename) const
+{
+   logger_->debug("WriteFile: {}", filename);
+
+   // Order objects by time, preserving insertion order for equal times
+   std::vector<std::size_t> order(p->objects_.size());
+   std::iota(order.begin(), order.end(), 0u);
+   std::stable_sort(order.begin(),
+                    order.end(),
+                    [this](std::size_t a, std::size_t b)
+                    { return p->objects_[a].time_ < p->objects_[b].time_; });
+
+   // Determine the file layout
+   std::vector<std::uint64_t> dataOffsets {};
+   dataOffsets.reserve(order.size());
+
+   std::uint64_t offset = EventPack::kHeaderSize_;
+   for (std::size_t i : order)
+   {
+      offset = Align(offset);
+      dataOffsets.push_back(offset);
+      offset += p->objects_[i].data_.size();
+   }
+
+   const std::uint64_t indexOffset = Align(offset);
+   const std::uint64_t stringsOffset =
+      indexOffset + order.size() * EventPack::kIndexRecordSize_;
+
+   std::ofstream os {filename, std::ios_base::out | std::ios_base::binary};
+   if (!os.good())
+   {
+      logger_->warn("Could not open file for writing: {}", filename);
+      return false;
+   }
+
+   const auto pad = [&os](std::uint64_t target)
+   {
+      while (static_cast<std::uint64_t>(os.tellp()) < target)
+      {
+         os.put('\0');
+      }
+   };
+
+   // Header
+   os.write(EventPack::kMagic_.data(), EventPack::kMagic_.size());
+   WriteLittleEndian(os, EventPack::kVersion_);
+   WriteLittleEndian(os, static_cast<std::uint32_t>(order.size()));
+   WriteLittleEndian(os, indexOffset);
+   WriteLittleEndian(os, stringsOffset);
+   WriteLittleEndian(os, static_cast<std::uint64_t>(p->strings_.size()));
+
+   // Object data
+   for (std::size_t i = 0; i < order.size(); ++i)
+   {
+      auto& data = p->objects_[order[i]].data_;
+      pad(dataOffsets[i]);
+      os.write(data.data(), static_cast<std::streamsize>(data.size()));
+   }
+
+   // Index
+   pad(indexOffset);
+   for (std::size_t i = 0; i < order.size(); ++i)
+   {
+      auto& object = p->objects_[order[i]];
+      WriteLittleEndian(os, static_cast<std::uint64_t>(object.time_));
+      WriteLittleEndian(os, dataOffsets[i]);
+      WriteLittleEndian(os, static_cast<std::uint64_t>(object.data_.size()));
+      WriteLittleEndian(os, object.radarSiteOffset_);
+      WriteLittleEndian(os, object.productOffset_);
+      WriteLittleEndian(os, object.keyOffset_);
+      WriteLittleEndian(os, static_cast<std::uint8_t>(object.type_));
+      pad(indexOffset + (i + 1) * EventPack::kIndexRecordSize_);
+   }
+
+   // String table
+   os.write(p->strings_.data(),
+            static_cast<std::streamsize>(p->strings_.size()));
+
+   if (!os.good())
+   {
+      logger_->warn("Error writing file: {}", filename);
+      return false;
+   }
+
+   logger_->debug("Wrote {} objects", order.size());
+
+   return true;
+}
+
+std::uint32_t EventPackWriter::Impl::AddString(const std::string& value)
+{
+   auto it = stringOffsets_.find(value);
+   if (it != stringOffsets_.cend())
+   {
+      return it->second;
+   }
+
+   const auto offset = static_cast<std::uint32_t>(strings_.size());
+   strings_.append(value);
+   strings_.push_back('\0');
+   stringOffsets_.emplace(value, offset);
+
+   return offset;
+}
+
+} // namespace provider
+} // namespace scwx
@@ -1,6 +1,9 @@
 #include <scwx/provider/nexrad_data_provider_factory.hpp>
 #include <scwx/provider/aws_level2_data_provider.hpp>
 #include <scwx/provider/aws_level3_data_provider.hpp>
+#include <scwx/provider/event_pack_nexrad_data_provider.hpp>
+
+#include <mutex>
 
 namespace scwx
 {
@@ -10,10 +13,19 @@ namespace provider
 static const std::string logPrefix_ =
    "scwx::provider::nexrad_data_provider_factory";
 
+static std::shared_ptr<EventPack> eventPack_ {nullptr};
+static std::mutex                 eventPackMutex_ {};
+
 std::shared_ptr<NexradDataProvider>
 NexradDataProviderFactory::CreateLevel2DataProvider(
    const std::string& radarSite)
 {
+   if (auto eventPack = event_pack(); eventPack != nullptr)
+   {
+      return std::make_shared<EventPackNexradDataProvider>(
+         eventPack, EventPackObjectType::Level2, radarSite);
+   }
+
    return std::make_unique<AwsLevel2DataProvider>(radarSite);
 }
 
@@ -21,8 +33,27 @@ std::shared_ptr<NexradDataProvider>
 NexradDataProviderFactory::CreateLevel3DataProvider(
    const std::string& radarSite, const std::string& product)
 {
+   if (auto eventPack = event_pack(); eventPack != nullptr)
+   {
+      return std::make_shared<EventPackNexradDataProvider>(
+         eventPack, EventPackObjectType::Level3, radarSite, product);
+   }
+
    return std::make_unique<AwsLevel3DataProvider>(radarSite, product);
 }
 
+std::shared_ptr<EventPack> NexradDataProviderFactory::event_pack()
+{
+   std::unique_lock lock {eventPackMutex_};
+   return eventPack_;
+}
+
+void NexradDataProviderFactory::SetEventPack(
+   const std::shared_ptr<EventPack>& eventPack)
+{
+   std::unique_lock lock {eventPackMutex_};
+   eventPack_ = eventPack;
+}
+
 } // namespace provider
 } // namespace scwx
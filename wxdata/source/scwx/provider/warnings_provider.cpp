@@ -1,5 +1,7 @@
 #include <scwx/provider/warnings_provider.hpp>
+#include <scwx/network/cpr.hpp>
 #include <scwx/network/dir_list.hpp>
+#include <scwx/util/clock.hpp>
 #include <scwx/util/logger.hpp>
 
 #include <ranges>
@@ -11,6 +13,8 @@
 
 #define LIBXML_HTML_ENABLED
 #include <cpr/cpr.h>
+#include <fmt/chrono.h>
+#include <fmt/format.h>
 #include <libxml/HTMLparser.h>
 #include <re2/re2.h>
 
@@ -32,6 +36,10 @@ static const auto        logger_    = util::Logger::Create(logPrefix_);
 
 static constexpr std::chrono::seconds kUpdatePeriod_ {15};
 
+static const cpr::SslOptions  kSslOptions_ = cpr::Ssl(cpr::ssl::TLSv1_2 {});
+static const cpr::HttpVersion kHttpVersion_ {
+   cpr::HttpVersionCode::VERSION_2_0_TLS};
+
 class WarningsProvider::Impl
 {
 public:
@@ -41,6 +49,14 @@ public:
       std::chrono::system_clock::time_point lastModified_ {};
       size_t                                size_ {};
       bool                                  updated_ {};
+
+      // Whether the modified time and size are current with the directory
+      // listing. Files found or modified by a conditional request are not.
+      bool listed_ {};
+
+      // Validators of the retrieved file, used for conditional requests
+      std::string etag_ {};
+      std::string lastModifiedHeader_ {};
    };
 
    typedef std::map<std::string, FileInfoRecord> WarningFileMap;
@@ -52,10 +68,25 @@ public:
 
    ~Impl() {}
 
+   bool CheckRecentFiles(std::chrono::sys_time<std::chrono::hours> hour);
+   bool ListAllFiles(std::chrono::sys_time<std::chrono::hours> hour);
+
+   static std::string
+   GetFilename(std::chrono::sys_time<std::chrono::hours> startTime);
+   static std::string GetHeaderValue(const cpr::Header& header,
+                                     const std::string& name);
+   static bool        IsModified(const FileInfoRecord& record,
+                                 const cpr::Header&    header);
+   static void        UpdateValidators(FileInfoRecord&    record,
+                                       const cpr::Header& header);
+
    std::string baseUrl_;
 
    WarningFileMap    files_;
    std::shared_mutex filesMutex_;
+
+   // Hour of the last full directory listing
+   std::chrono::sys_time<std::chrono::hours> listingHour_ {};
 };
 
 WarningsProvider::WarningsProvider(const std::string& baseUrl) :
@@ -70,6 +101,160 @@ WarningsProvider::operator=(WarningsProvider&&) noexcept = default;
 
 std::pair<size_t, size_t>
 WarningsProvider::ListFiles(std::chrono::system_clock::time_point newerThan)
+{
+   logger_->trace("Listing files");
+
+   const auto currentHour =
+      std::chrono::floor<std::chrono::hours>(util::CurrentTime());
+
+   std::unique_lock lock(p->filesMutex_);
+   const bool       hourChanged = (currentHour != p->listingHour_);
+   lock.unlock();
+
+   // Between hour rollovers, only the files of the current and previous hour
+   // change. Check them with conditional requests, and fall back to a full
+   // directory listing on rollover or error.
+   if (hourChanged || !p->CheckRecentFiles(currentHour))
+   {
+      if (p->ListAllFiles(currentHour) && hourChanged)
+      {
+         // The listing does not compare files found or modified by conditional
+         // requests, so compare their validators
+         p->CheckRecentFiles(currentHour);
+      }
+   }
+
+   size_t updatedObjects = 0;
+   size_t totalObjects   = 0;
+
+   lock.lock();
+
+   for (auto& record : p->files_)
+   {
+      // Update object counts, but only if newer than threshold
+      if (newerThan < record.second.startTime_)
+      {
+         if (record.second.updated_)
+         {
+            ++updatedObjects;
+         }
+         ++totalObjects;
+      }
+   }
+
+   return std::make_pair(updatedObjects, totalObjects);
+}
+
+bool WarningsProvider::Impl::CheckRecentFiles(
+   std::chrono::sys_time<std::chrono::hours> hour)
+{
+   using namespace std::chrono_literals;
+
+   logger_->trace("Checking recent files");
+
+   struct Request
+   {
+      std::chrono::sys_time<std::chrono::hours> startTime_;
+      std::string                               filename_;
+      cpr::AsyncResponse                        response_;
+   };
+
+   std::vector<Request> requests {};
+
+   std::unique_lock lock(filesMutex_);
+
+   // Request the headers of the current and previous hour's files, unless
+   // unchanged since they were retrieved
+   for (auto startTime : {hour, hour - 1h})
+   {
+      std::string filename = GetFilename(startTime);
+      cpr::Header header   = network::cpr::GetHeader();
+
+      auto it = files_.find(filename);
+      if (it != files_.cend())
+      {
+         if (!it->second.etag_.empty())
+         {
+            header.insert_or_assign("If-None-Match", it->second.etag_);
+         }
+         if (!it->second.lastModifiedHeader_.empty())
+         {
+            header.insert_or_assign("If-Modified-Since",
+                                    it->second.lastModifiedHeader_);
+         }
+      }
+
+      cpr::AsyncResponse response =
+         cpr::HeadAsync(cpr::Url {baseUrl_ + "/" + filename},
+                        header,
+                        kSslOptions_,
+                        kHttpVersion_);
+
+      requests.emplace_back(startTime, filename, std::move(response));
+   }
+
+   lock.unlock();
+
+   std::vector<cpr::Response> responses {};
+   for (auto& request : requests)
+   {
+      responses.push_back(request.response_.get());
+   }
+
+   lock.lock();
+
+   for (std::size_t i = 0; i < requests.size(); ++i)
+   {
+      auto& request  = requests[i];
+      auto& response = responses[i];
+      auto  it       = files_.find(request.filename_);
+
+      if (response.status_code == cpr::status::HTTP_NOT_MODIFIED)
+      {
+         continue;
+      }
+      else if (response.status_code == cpr::status::HTTP_OK)
+      {
+         if (it == files_.end())
+         {
+            // The file was created since the last full listing. The modified
+            // time and size are populated by the next full listing.
+            logger_->debug("New file: {}", request.filename_);
+
+            FileInfoRecord record {};
+            record.startTime_ = request.startTime_;
+            record.updated_   = true;
+
+            files_.emplace(request.filename_, std::move(record));
+         }
+         else if (IsModified(it->second, response.header))
+         {
+            // The listed modified time and size no longer describe the file
+            it->second.updated_ = true;
+            it->second.listed_  = false;
+         }
+      }
+      else if (response.status_code == cpr::status::HTTP_NOT_FOUND &&
+               it == files_.end() && request.startTime_ == hour)
+      {
+         // The current hour's file has not been created yet
+         continue;
+      }
+      else
+      {
+         logger_->warn("Bad response from {}: {} ({})",
+                       request.filename_,
+                       response.error.message,
+                       response.status_code);
+         return false;
+      }
+   }
+
+   return true;
+}
+
+bool WarningsProvider::Impl::ListAllFiles(
+   std::chrono::sys_time<std::chrono::hours> hour)
 {
    using namespace std::chrono;
 
@@ -81,18 +266,16 @@ WarningsProvider::ListFiles(std::chrono::system_clock::time_point newerThan)
       "warnings_[0-9]{8}_[0-9]{2}.txt"};
    static const std::string dateTimeFormat {"warnings_%Y%m%d_%H.txt"};
 
-   logger_->trace("Listing files");
-
-   size_t updatedObjects = 0;
-   size_t totalObjects   = 0;
+   logger_->debug("Listing all files");
 
    // Perform a directory listing
-   auto records = network::DirList(p->baseUrl_);
+   auto records = network::DirList(baseUrl_);
 
-   // Sort records by filename
-   std::sort(records.begin(),
-             records.end(),
-             [](auto& a, auto& b) { return a.filename_ < b.filename_; });
+   if (records.empty())
+   {
+      // Keep the previous listing, and list again on the next refresh
+      return false;
+   }
 
    // Filter warning records
    auto warningRecords =
@@ -104,11 +287,11 @@ WarningsProvider::ListFiles(std::chrono::system_clock::time_point newerThan)
                    RE2::FullMatch(record.filename_, *reWarningsFilename);
          });
 
-   std::unique_lock lock(p->filesMutex_);
+   std::unique_lock lock(filesMutex_);
 
-   Impl::WarningFileMap warningFileMap;
+   WarningFileMap warningFileMap;
 
-   // Store records
+   // Store records, sorted by filename
    for (auto& record : warningRecords)
    {
       // Determine start time
@@ -121,39 +304,84 @@ WarningsProvider::ListFiles(std::chrono::system_clock::time_point newerThan)
       if (!ssFilename.fail())
       {
          // Determine if the record should be marked updated
-         bool updated = true;
-         auto it      = p->files_.find(record.filename_);
-         if (it != p->files_.cend())
+         bool        updated            = true;
+         std::string etag               = {};
+         std::string lastModifiedHeader = {};
+
+         auto it = files_.find(record.filename_);
+         if (it != files_.cend())
          {
             auto& existingRecord = it->second;
 
+            // Files found or modified by a conditional request have no listed
+            // modified time and size to compare, and are compared by their
+            // validators instead
             updated = existingRecord.updated_ ||
-                      record.size_ != existingRecord.size_ ||
-                      record.mtime_ != existingRecord.lastModified_;
-         }
+                      (existingRecord.listed_ &&
+                       (record.size_ != existingRecord.size_ ||
+                        record.mtime_ != existingRecord.lastModified_));
 
-         // Update object counts, but only if newer than threshold
-         if (newerThan < startTime)
-         {
-            if (updated)
-            {
-               ++updatedObjects;
-            }
-            ++totalObjects;
+            // Validators continue to describe the retrieved file
+            etag               = existingRecord.etag_;
+            lastModifiedHeader = existingRecord.lastModifiedHeader_;
          }
 
          // Store record
-         warningFileMap.emplace(
-            std::piecewise_construct,
-            std::forward_as_tuple(record.filename_),
-            std::forward_as_tuple(
-               startTime, record.mtime_, record.size_, updated));
+         auto& fileRecord = warningFileMap
+                               .emplace(std::piecewise_construct,
+                                        std::forward_as_tuple(record.filename_),
+                                        std::forward_as_tuple(startTime,
+                                                              record.mtime_,
+                                                              record.size_,
+                                                              updated))
+                               .first->second;
+
+         fileRecord.listed_             = true;
+         fileRecord.etag_               = std::move(etag);
+         fileRecord.lastModifiedHeader_ = std::move(lastModifiedHeader);
       }
    }
 
-   p->files_ = std::move(warningFileMap);
+   files_       = std::move(warningFileMap);
+   listingHour_ = hour;
 
-   return std::make_pair(updatedObjects, totalObjects);
+   return true;
+}
+
+std::string WarningsProvider::Impl::GetFilename(
+   std::chrono::sys_time<std::chrono::hours> startTime)
+{
+   return fmt::format(
+      "warnings_{:%Y%m%d_%H}.txt",
+      fmt::gmtime(std::chrono::system_clock::to_time_t(startTime)));
+}
+
+std::string WarningsProvider::Impl::GetHeaderValue(const cpr::Header& header,
+                                                   const std::string& name)
+{
+   auto it = header.find(name);
+   return (it != header.cend()) ? it->second : std::string {};
+}
+
+bool WarningsProvider::Impl::IsModified(const FileInfoRecord& record,
+                                        const cpr::Header&    header)
+{
+   // Without validators, the retrieved file cannot be compared
+   if (record.etag_.empty() && record.lastModifiedHeader_.empty())
+   {
+      return true;
+   }
+
+   // The server may ignore conditional headers, so compare the validators
+   return record.etag_ != GetHeaderValue(header, "ETag") ||
+          record.lastModifiedHeader_ != GetHeaderValue(header, "Last-Modified");
+}
+
+void WarningsProvider::Impl::UpdateValidators(FileInfoRecord&    record,
+                                              const cpr::Header& header)
+{
+   record.etag_               = GetHeaderValue(header, "ETag");
+   record.lastModifiedHeader_ = GetHeaderValue(header, "Last-Modified");
 }
 
 std::vector<std::shared_ptr<awips::TextProductFile>>
@@ -177,7 +405,9 @@ WarningsProvider::LoadUpdatedFiles(
          // Retrieve warning file
          asyncResponses.emplace_back(
             record.first,
-            cpr::GetAsync(cpr::Url {p->baseUrl_ + "/" + record.first}));
+            cpr::GetAsync(cpr::Url {p->baseUrl_ + "/" + record.first},
+                          kSslOptions_,
+                          kHttpVersion_));
 
          // Clear updated flag
          record.second.updated_ = false;
@@ -194,6 +424,15 @@ WarningsProvider::LoadUpdatedFiles(
       {
          logger_->debug("Loading file: {}", asyncResponse.first);
 
+         // Store validators of the retrieved file for conditional requests
+         lock.lock();
+         auto it = p->files_.find(asyncResponse.first);
+         if (it != p->files_.end())
+         {
+            Impl::UpdateValidators(it->second, response.header);
+         }
+         lock.unlock();
+
          // Load file
          std::shared_ptr<awips::TextProductFile> textProductFile {
             std::make_shared<awips::TextProductFile>()};
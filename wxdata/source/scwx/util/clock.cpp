@@ -0,0 +1,101 @@
+#include <scwx/util/clock.hpp>
+#include <scwx/util/logger.hpp>
+#include <scwx/util/time.hpp>
+
+#include <mutex>
+
+namespace scwx
+{
+namespace util
+{
+
+static const std::string logPrefix_ = "scwx::util::clock";
+static const auto        logger_    = Logger::Create(logPrefix_);
+
+static const std::shared_ptr<Clock> kSystemClock_ =
+   std::make_shared<SystemClock>();
+
+static std::shared_ptr<Clock> clock_ {kSystemClock_};
+static std::mutex             clockMutex_ {};
+
+std::chrono::system_clock::time_point SystemClock::now() const
+{
+   return std::chrono::system_clock::now();
+}
+
+double SystemClock::speed() const
+{
+   return 1.0;
+}
+
+ReplayClock::ReplayClock(std::chrono::system_clock::time_point startTime,
+                         double                                speed) :
+    startTime_ {startTime},
+    steadyStartTime_ {std::chrono::steady_clock::now()},
+    speed_ {speed > 0.0 ? speed : 1.0}
+{
+}
+
+std::chrono::system_clock::time_point ReplayClock::start_time() const
+{
+   return startTime_;
+}
+
+std::chrono::system_clock::time_point ReplayClock::now() const
+{
+   const std::chrono::duration<double> elapsed =
+      std::chrono::steady_clock::now() - steadyStartTime_;
+
+   return startTime_ +
+          std::chrono::duration_cast<std::chrono::system_clock::duration>(
+             elapsed * speed_);
+}
+
+double ReplayClock::speed() const
+{
+   return speed_;
+}
+
+std::shared_ptr<Clock> GetClock()
+{
+   std::unique_lock lock {clockMutex_};
+   return clock_;
+}
+
+void SetClock(const std::shared_ptr<Clock>& clock)
+{
+   std::shared_ptr<Clock> newClock = (clock != nullptr) ? clock : kSystemClock_;
+
+   logger_->info("Clock set: {} ({}x)",
+                 TimeString(newClock->now()),
+                 newClock->speed());
+
+   std::unique_lock lock {clockMutex_};
+   clock_ = std::move(newClock);
+}
+
+std::chrono::system_clock::time_point CurrentTime()
+{
+   return GetClock()->now();
+}
+
+bool IsReplayActive()
+{
+   return GetClock() != kSystemClock_;
+}
+
+std::chrono::milliseconds RealDuration(std::chrono::milliseconds duration)
+{
+   const double speed = GetClock()->speed();
+
+   if (speed == 1.0)
+   {
+      return duration;
+   }
+
+   return std::chrono::duration_cast<std::chrono::milliseconds>(
+      std::chrono::duration<double, std::milli>(duration) / speed);
+}
+
+} // namespace util
+} // namespace scwx
@@ -2,6 +2,9 @@
 
 #include <scwx/util/strings.hpp>
 
+#include <charconv>
+#include <stdexcept>
+
 #include <boost/algorithm/string/trim.hpp>
 #include <boost/lexical_cast.hpp>
 #include <fmt/format.h>
@@ -86,7 +89,8 @@ std::vector<std::string> ParseTokens(const std::string&       s,
         ++i)
    {
       // Skip leading spaces
-      while (pos < s.size() && std::isspace(s[pos]))
+      while (pos < s.size() &&
+             std::isspace(static_cast<unsigned char>(s[pos])))
       {
          ++pos;
       }
@@ -122,7 +126,10 @@ std::vector<std::string> ParseTokens(const std::string&       s,
       boost::trim(newToken);
 
       // Increment nextPos until the next non-space character
-      while (++nextPos < s.size() && std::isspace(s[nextPos])) {}
+      while (++nextPos < s.size() &&
+             std::isspace(static_cast<unsigned char>(s[nextPos])))
+      {
+      }
 
       // Store new position value
       pos = nextPos;
@@ -138,6 +145,90 @@ std::vector<std::string> ParseTokens(const std::string&       s,
    return tokens;
 }
 
+void ParseTokens(std::string_view                        s,
+                 std::initializer_list<std::string_view> delimiters,
+                 std::vector<std::string_view>&          tokens,
+                 std::size_t                             pos)
+{
+   std::size_t findPos {};
+
+   tokens.clear();
+
+   // Iterate through each delimiter
+   for (auto it = delimiters.begin();
+        it != delimiters.end() && pos != std::string_view::npos;
+        ++it)
+   {
+      // Skip leading spaces
+      while (pos < s.size() &&
+             std::isspace(static_cast<unsigned char>(s[pos])))
+      {
+         ++pos;
+      }
+
+      if (pos < s.size() && s[pos] == '"')
+      {
+         // Do not search for a delimeter within a quoted string
+         findPos = s.find('"', pos + 1);
+
+         // Increment search start to one after quotation mark
+         if (findPos != std::string_view::npos)
+         {
+            ++findPos;
+         }
+      }
+      else
+      {
+         // Search starting at the current position
+         findPos = pos;
+      }
+
+      // Search for delimiter
+      std::size_t nextPos = s.find_first_of(*it, findPos);
+
+      // If the delimiter was not found, stop processing tokens
+      if (nextPos == std::string_view::npos)
+      {
+         break;
+      }
+
+      // Add the current substring as a token
+      tokens.emplace_back(TrimView(s.substr(pos, nextPos - pos)));
+
+      // Increment nextPos until the next non-space character
+      while (++nextPos < s.size() &&
+             std::isspace(static_cast<unsigned char>(s[nextPos])))
+      {
+      }
+
+      // Store new position value
+      pos = nextPos;
+   }
+
+   // Add the remainder of the string as a token
+   if (pos < s.size())
+   {
+      tokens.emplace_back(TrimView(s.substr(pos)));
+   }
+}
+
+std::string_view TrimView(std::string_view s)
+{
+   std::size_t begin = 0;
+   std::size_t end   = s.size();
+
+   while (begin < end && std::isspace(static_cast<unsigned char>(s[begin])))
+   {
+      ++begin;
+   }
+   while (end > begin && std::isspace(static_cast<unsigned char>(s[end - 1])))
+   {
+      --end;
+   }
+
+   return s.substr(begin, end - begin);
+}
+
 std::string ToString(const std::vector<std::string>& v)
 {
    std::string value {};
@@ -172,5 +263,28 @@ std::optional<T> TryParseNumeric(const std::string& str)
    return value;
 }
 
+template<typename T>
+T ParseNumeric(std::string_view str)
+{
+   // Skip leading whitespace and plus sign, which are accepted by std::stod
+   // and std::stoi, but not by std::from_chars
+   str = TrimView(str);
+   if (!str.empty() && str.front() == '+')
+   {
+      str.remove_prefix(1);
+   }
+
+   T value {};
+
+   auto [ptr, ec] = std::from_chars(str.data(), str.data() + str.size(), value);
+
+   if (ec != std::errc {} || ptr == str.data())
+   {
+      throw std::invalid_argument("Could not parse numeric value");
+   }
+
+   return value;
+}
+
 } // namespace util
 } // namespace scwx
@@ -0,0 +1,346 @@
+#include <scwx/util/trace.hpp>
+#include <scwx/util/logger.hpp>
+#include <scwx/util/time.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <fmt/format.h>
+
+namespace scwx
+{
+namespace util
+{
+
+static const std::string logPrefix_ = "scwx::util::trace";
+static const auto        logger_    = Logger::Create(logPrefix_);
+
+// Most recent spans kept for export
+static constexpr std::size_t kMaxEvents_ = 65536u;
+
+// End-to-end spans which have not been rendered are discarded after this time
+static constexpr std::chrono::hours kMaxArrivalAge_ {1};
+
+static const std::unordered_map<TraceStage, std::string> traceStageName_ {
+   {TraceStage::ProviderRefresh, "Provider Refresh"},
+   {TraceStage::ObjectLoad, "Object Load"},
+   {TraceStage::FileDecode, "File Decode"},
+   {TraceStage::RecordStore, "Record Store"},
+   {TraceStage::ComputeSweep, "Compute Sweep"},
+   {TraceStage::UpdateSweep, "Update Sweep"},
+   {TraceStage::Render, "Render"},
+   {TraceStage::EndToEnd, "End to End"},
+   {TraceStage::Unknown, "?"}};
+
+const std::string& GetTraceStageName(TraceStage stage)
+{
+   return traceStageName_.at(stage);
+}
+
+static std::string EscapeJson(const std::string& value)
+{
+   std::string escaped {};
+   escaped.reserve(value.size());
+
+   for (char c : value)
+   {
+      if (c == '"' || c == '\\')
+      {
+         escaped.push_back('\\');
+         escaped.push_back(c);
+      }
+      else if (static_cast<unsigned char>(c) < 0x20u)
+      {
+         escaped.append(fmt::format("\\u{:04x}", static_cast<int>(c)));
+      }
+      else
+      {
+         escaped.push_back(c);
+      }
+   }
+
+   return escaped;
+}
+
+class Tracer::Impl
+{
+public:
+   struct TraceEvent
+   {
+      TraceStage                            stage_;
+      TraceTags                             tags_;
+      std::chrono::steady_clock::time_point start_;
+      std::chrono::steady_clock::duration   duration_;
+      std::size_t                           threadIndex_;
+   };
+
+   explicit Impl() {}
+   ~Impl() {}
+
+   std::size_t GetThreadIndex();
+
+   const std::chrono::steady_clock::time_point startTime_ {
+      std::chrono::steady_clock::now()};
+
+   mutable std::mutex mutex_ {};
+
+   std::vector<TraceEvent> events_ {};
+   std::size_t             nextEvent_ {0u};
+
+   std::unordered_map<TraceStage, TraceStatistics> statistics_ {};
+
+   std::map<std::pair<std::string, std::chrono::system_clock::time_point>,
+            std::chrono::steady_clock::time_point>
+      arrivals_ {};
+
+   std::unordered_map<std::thread::id, std::size_t> threadIndices_ {};
+};
+
+Tracer::Tracer() : p(std::make_unique<Impl>()) {}
+Tracer::~Tracer() = default;
+
+Tracer& Tracer::Instance()
+{
+   static Tracer tracer_ {};
+   return tracer_;
+}
+
+void Tracer::Record(TraceStage                            stage,
+                    const TraceTags&                      tags,
+                    std::chrono::steady_clock::time_point start,
+                    std::chrono::steady_clock::time_point end)
+{
+   using namespace std::chrono;
+
+   const auto duration = std::max(end - start, steady_clock::duration {0});
+   const auto durationUs = duration_cast<microseconds>(duration);
+
+   // Bucket i holds durations in [2^i, 2^(i+1)) us
+   const auto  count  = static_cast<std::uint64_t>(durationUs.count());
+   std::size_t bucket = (count > 0u) ? std::bit_width(count) - 1u : 0u;
+   bucket = std::min(bucket, TraceStatistics::kHistogramBuckets_ - 1u);
+
+   std::unique_lock lock {p->mutex_};
+
+   auto& statistics = p->statistics_[stage];
+   if (statistics.count_ == 0u || durationUs < statistics.min_)
+   {
+      statistics.min_ = durationUs;
+   }
+   statistics.max_ = std::max(statistics.max_, durationUs);
+   statistics.total_ += durationUs;
+   ++statistics.count_;
+   ++statistics.histogram_[bucket];
+
+   Impl::TraceEvent event {stage, tags, start, duration, p->GetThreadIndex()};
+
+   if (p->events_.size() < kMaxEvents_)
+   {
+      p->events_.push_back(std::move(event));
+   }
+   else
+   {
+      p->events_[p->nextEvent_] = std::move(event);
+   }
+   p->nextEvent_ = (p->nextEvent_ + 1u) % kMaxEvents_;
+}
+
+void Tracer::MarkArrival(const std::string&                    radarSite,
+                         std::chrono::system_clock::time_point volumeTime)
+{
+   const auto now = std::chrono::steady_clock::now();
+
+   std::unique_lock lock {p->mutex_};
+
+   std::erase_if(p->arrivals_,
+                 [&now](const auto& arrival)
+                 { return now - arrival.second > kMaxArrivalAge_; });
+
+   p->arrivals_.try_emplace({radarSite, volumeTime}, now);
+}
+
+void Tracer::MarkRendered(const TraceTags& tags)
+{
+   const auto now = std::chrono::steady_clock::now();
+
+   std::unique_lock lock {p->mutex_};
+
+   auto it = p->arrivals_.find({tags.radarSite_, tags.volumeTime_});
+   if (it == p->arrivals_.cend())
+   {
+      return;
+   }
+
+   const auto arrivalTime = it->second;
+   p->arrivals_.erase(it);
+
+   lock.unlock();
+
+   Record(TraceStage::EndToEnd, tags, arrivalTime, now);
+}
+
+TraceStatistics Tracer::GetStatistics(TraceStage stage) const
+{
+   std::unique_lock lock {p->mutex_};
+
+   auto it = p->statistics_.find(stage);
+   if (it == p->statistics_.cend())
+   {
+      return {};
+   }
+
+   return it->second;
+}
+
+bool Tracer::ExportTrace(const std::string& filename) const
+{
+   using namespace std::chrono;
+
+   logger_->info("Exporting trace: {}", filename);
+
+   std::unique_lock lock {p->mutex_};
+
+   // Copy the events in chronological order of recording
+   std::vector<Impl::TraceEvent> events {};
+   events.reserve(p->events_.size());
+   if (p->events_.size() == kMaxEvents_)
+   {
+      events.insert(events.end(),
+                    p->events_.cbegin() +
+                       static_cast<std::ptrdiff_t>(p->nextEvent_),
+                    p->events_.cend());
+   }
+   events.insert(events.end(),
+                 p->events_.cbegin(),
+                 p->events_.cbegin() +
+                    static_cast<std::ptrdiff_t>(
+                       std::min(p->nextEvent_, p->events_.size())));
+
+   const auto startTime = p->startTime_;
+
+   lock.unlock();
+
+   std::ofstream os {filename, std::ios_base::out | std::ios_base::trunc};
+   if (!os.good())
+   {
+      logger_->warn("Could not open file for writing: {}", filename);
+      return false;
+   }
+
+   os << "{\"traceEvents\":[";
+
+   for (std::size_t i = 0; i < events.size(); ++i)
+   {
+      const auto& event = events[i];
+
+      const auto ts =
+         duration_cast<duration<double, std::micro>>(event.start_ - startTime);
+      const auto dur = duration_cast<duration<double, std::micro>>(
+         event.duration_);
+
+      std::string volumeTime {};
+      if (event.tags_.volumeTime_ != system_clock::time_point {})
+      {
+         volumeTime = TimeString(event.tags_.volumeTime_);
+      }
+
+      os << fmt::format(
+         "{}\n{{\"name\":\"{}\",\"cat\":\"latency\",\"ph\":\"X\","
+         "\"ts\":{:.3f},\"dur\":{:.3f},\"pid\":1,\"tid\":{},"
+         "\"args\":{{\"site\":\"{}\",\"product\":\"{}\","
+         "\"volumeTime\":\"{}\"}}}}",
+         (i > 0u) ? "," : "",
+         GetTraceStageName(event.stage_),
+         ts.count(),
+         dur.count(),
+         event.threadIndex_,
+         EscapeJson(event.tags_.radarSite_),
+         EscapeJson(event.tags_.product_),
+         volumeTime);
+   }
+
+   os << "\n]}\n";
+
+   if (!os.good())
+   {
+      logger_->warn("Error writing file: {}", filename);
+      return false;
+   }
+
+   return true;
+}
+
+void Tracer::Reset()
+{
+   std::unique_lock lock {p->mutex_};
+
+   p->events_.clear();
+   p->nextEvent_ = 0u;
+   p->statistics_.clear();
+   p->arrivals_.clear();
+}
+
+std::size_t Tracer::Impl::GetThreadIndex()
+{
+   // The mutex must be held
+   auto [it, inserted] = threadIndices_.try_emplace(std::this_thread::get_id(),
+                                                    threadIndices_.size() + 1u);
+   return it->second;
+}
+
+std::chrono::microseconds TraceStatistics::Percentile(double percentile) const
+{
+   if (count_ == 0u)
+   {
+      return std::chrono::microseconds {0};
+   }
+
+   const double target = std::clamp(percentile, 0.0, 1.0) * count_;
+
+   std::size_t cumulative = 0u;
+   for (std::size_t i = 0; i < histogram_.size(); ++i)
+   {
+      cumulative += histogram_[i];
+      if (cumulative >= target && histogram_[i] > 0u)
+      {
+         return std::min(
+            std::chrono::microseconds {std::int64_t {1} << (i + 1u)}, max_);
+      }
+   }
+
+   return max_;
+}
+
+TraceSpan::TraceSpan(TraceStage stage, const TraceTags& tags) :
+    stage_ {stage}, tags_ {tags}, start_ {std::chrono::steady_clock::now()}
+{
+}
+
+TraceSpan::~TraceSpan()
+{
+   End();
+}
+
+void TraceSpan::set_tags(const TraceTags& tags)
+{
+   tags_ = tags;
+}
+
+void TraceSpan::End()
+{
+   if (!ended_)
+   {
+      ended_ = true;
+      Tracer::Instance().Record(
+         stage_, tags_, start_, std::chrono::steady_clock::now());
+   }
+}
+
+} // namespace util
+} // namespace scwx
@@ -5,9 +5,14 @@
 #include <scwx/util/logger.hpp>
 #include <scwx/util/rangebuf.hpp>
 #include <scwx/util/time.hpp>
+#include <scwx/util/vectorbuf.hpp>
 
+#include <algorithm>
+#include <execution>
 #include <fstream>
+#include <limits>
 #include <sstream>
+#include <vector>
 
 #if defined(_MSC_VER)
 #   pragma warning(push)
@@ -43,14 +48,25 @@ static const auto        logger_    = util::Logger::Create(logPrefix_);
 class Ar2vFileImpl
 {
 public:
+   struct LDMMessage
+   {
+      std::shared_ptr<rda::Level2Message> message_ {};
+
+      // Raw data of a radial to be decoded after the record is scanned
+      std::vector<char> data_ {};
+   };
+
    explicit Ar2vFileImpl() {};
    ~Ar2vFileImpl() = default;
 
-   std::size_t DecompressLDMRecords(std::istream& is);
-   void        HandleMessage(std::shared_ptr<rda::Level2Message>& message);
-   void        IndexFile();
-   void        ParseLDMRecords();
-   void        ParseLDMRecord(std::istream& is);
+   std::size_t DecompressLDMRecords(
+      std::istream& is,
+      std::size_t   maxRecords = std::numeric_limits<std::size_t>::max());
+   void HandleMessage(std::shared_ptr<rda::Level2Message>& message);
+   void IndexFile();
+   void ParseLDMRecords(bool metadataOnly = false);
+   void ParseLDMRecord(std::istream& is, bool metadataOnly = false);
+   bool ReadVolumeHeader(std::istream& is);
    void ProcessRadarData(const std::shared_ptr<rda::GenericRadarData>& message);
 
    std::string   tapeFilename_ {};
@@ -64,6 +80,8 @@ public:
    std::shared_ptr<rda::VolumeCoveragePatternData>              vcpData_ {};
    std::map<std::uint16_t, std::shared_ptr<rda::ElevationScan>> radarData_ {};
 
+   std::shared_ptr<rda::RdaStatusData> rdaStatusData_ {};
+
    std::map<rda::DataBlockType,
             std::map<std::uint16_t, std::shared_ptr<rda::ElevationScan>>>
       index_ {};
@@ -129,6 +147,11 @@ std::shared_ptr<const rda::VolumeCoveragePatternData> Ar2vFile::vcp_data() const
    return p->vcpData_;
 }
 
+std::shared_ptr<const rda::RdaStatusData> Ar2vFile::rda_status_data() const
+{
+   return p->rdaStatusData_;
+}
+
 std::tuple<std::shared_ptr<rda::ElevationScan>, float, std::vector<float>>
 Ar2vFile::GetElevationScan(rda::DataBlockType dataBlockType,
                            float              elevation,
@@ -212,40 +235,10 @@ bool Ar2vFile::LoadData(std::istream& is)
 {
    logger_->debug("Loading Data");
 
-   bool dataValid = true;
-
-   // Read Volume Header Record
-   p->tapeFilename_.resize(9, ' ');
-   p->extensionNumber_.resize(3, ' ');
-   p->icao_.resize(4, ' ');
-
-   is.read(&p->tapeFilename_[0], 9);
-   is.read(&p->extensionNumber_[0], 3);
-   is.read(reinterpret_cast<char*>(&p->julianDate_), 4);
-   is.read(reinterpret_cast<char*>(&p->milliseconds_), 4);
-   is.read(&p->icao_[0], 4);
-
-   p->julianDate_   = ntohl(p->julianDate_);
-   p->milliseconds_ = ntohl(p->milliseconds_);
-
-   if (is.eof())
-   {
-      logger_->warn("Could not read Volume Header Record");
-      dataValid = false;
-   }
-
-   // Trim spaces and null characters from the end of the ICAO
-   boost::trim_right_if(p->icao_,
-                        [](char x) { return std::isspace(x) || x == '\0'; });
+   bool dataValid = p->ReadVolumeHeader(is);
 
    if (dataValid)
    {
-      logger_->debug("Filename:  {}", p->tapeFilename_);
-      logger_->debug("Extension: {}", p->extensionNumber_);
-      logger_->debug("Date:      {}", p->julianDate_);
-      logger_->debug("Time:      {}", p->milliseconds_);
-      logger_->debug("ICAO:      {}", p->icao_);
-
       size_t decompressedRecords = p->DecompressLDMRecords(is);
       if (decompressedRecords == 0)
       {
@@ -262,13 +255,170 @@ bool Ar2vFile::LoadData(std::istream& is)
    return dataValid;
 }
 
-std::size_t Ar2vFileImpl::DecompressLDMRecords(std::istream& is)
+bool Ar2vFile::LoadMetadata(std::istream& is)
+{
+   logger_->debug("Loading Metadata");
+
+   bool dataValid = p->ReadVolumeHeader(is);
+
+   if (dataValid)
+   {
+      // The metadata record is the first LDM record
+      std::size_t decompressedRecords = p->DecompressLDMRecords(is, 1);
+      if (decompressedRecords == 0)
+      {
+         p->ParseLDMRecord(is, true);
+      }
+      else
+      {
+         p->ParseLDMRecords(true);
+      }
+   }
+
+   return dataValid;
+}
+
+std::optional<Ar2vVolumeSummary> Ar2vFile::ScanFile(const std::string& filename)
+{
+   logger_->debug("ScanFile: {}", filename);
+
+   std::ifstream f(filename, std::ios_base::in | std::ios_base::binary);
+   if (!f.good())
+   {
+      logger_->warn("Could not open file for reading: {}", filename);
+      return std::nullopt;
+   }
+
+   Ar2vFile file;
+   if (!file.LoadMetadata(f))
+   {
+      return std::nullopt;
+   }
+
+   Ar2vVolumeSummary summary {};
+   summary.filename_  = filename;
+   summary.icao_      = file.icao();
+   summary.startTime_ = file.start_time();
+
+   auto& vcpData       = file.p->vcpData_;
+   auto& rdaStatusData = file.p->rdaStatusData_;
+
+   if (rdaStatusData != nullptr)
+   {
+      summary.vcpNumber_ = rdaStatusData->volume_coverage_pattern_number();
+      summary.rdaBuildNumber_  = rdaStatusData->rda_build_number();
+      summary.operationalMode_ = rdaStatusData->operational_mode();
+   }
+
+   if (vcpData != nullptr)
+   {
+      summary.vcpNumber_ = vcpData->pattern_number();
+      summary.sailsCuts_ = vcpData->number_of_sails_cuts();
+      summary.mrleCuts_  = vcpData->number_of_mrle_cuts();
+
+      const std::uint16_t numberOfCuts = vcpData->number_of_elevation_cuts();
+      summary.elevationCuts_.reserve(numberOfCuts);
+
+      for (std::uint16_t e = 0; e < numberOfCuts; ++e)
+      {
+         summary.elevationCuts_.push_back({vcpData->elevation_angle(e),
+                                           vcpData->waveform_type(e),
+                                           vcpData->sails_cut(e),
+                                           vcpData->mrle_cut(e)});
+      }
+   }
+
+   return summary;
+}
+
+std::vector<Ar2vVolumeSummary>
+Ar2vFile::ScanFiles(const std::vector<std::string>& filenames)
+{
+   logger_->debug("ScanFiles: {} files", filenames.size());
+
+   std::vector<std::optional<Ar2vVolumeSummary>> results(filenames.size());
+
+   // Each file is read independently, and only its metadata is decompressed
+   std::transform(std::execution::par,
+                  filenames.cbegin(),
+                  filenames.cend(),
+                  results.begin(),
+                  [](const std::string& filename)
+                  {
+                     try
+                     {
+                        return ScanFile(filename);
+                     }
+                     catch (const std::exception& ex)
+                     {
+                        logger_->warn(
+                           "Error scanning {}: {}", filename, ex.what());
+                        return std::optional<Ar2vVolumeSummary> {};
+                     }
+                  });
+
+   std::vector<Ar2vVolumeSummary> summaries {};
+   summaries.reserve(results.size());
+
+   for (auto& result : results)
+   {
+      if (result.has_value())
+      {
+         summaries.push_back(std::move(*result));
+      }
+   }
+
+   return summaries;
+}
+
+bool Ar2vFileImpl::ReadVolumeHeader(std::istream& is)
+{
+   bool headerValid = true;
+
+   // Read Volume Header Record
+   tapeFilename_.resize(9, ' ');
+   extensionNumber_.resize(3, ' ');
+   icao_.resize(4, ' ');
+
+   is.read(&tapeFilename_[0], 9);
+   is.read(&extensionNumber_[0], 3);
+   is.read(reinterpret_cast<char*>(&julianDate_), 4);
+   is.read(reinterpret_cast<char*>(&milliseconds_), 4);
+   is.read(&icao_[0], 4);
+
+   julianDate_   = ntohl(julianDate_);
+   milliseconds_ = ntohl(milliseconds_);
+
+   if (is.eof())
+   {
+      logger_->warn("Could not read Volume Header Record");
+      headerValid = false;
+   }
+
+   // Trim spaces and null characters from the end of the ICAO
+   boost::trim_right_if(icao_,
+                        [](char x) { return std::isspace(x) || x == '\0'; });
+
+   if (headerValid)
+   {
+      logger_->debug("Filename:  {}", tapeFilename_);
+      logger_->debug("Extension: {}", extensionNumber_);
+      logger_->debug("Date:      {}", julianDate_);
+      logger_->debug("Time:      {}", milliseconds_);
+      logger_->debug("ICAO:      {}", icao_);
+   }
+
+   return headerValid;
+}
+
+std::size_t Ar2vFileImpl::DecompressLDMRecords(std::istream& is,
+                                               std::size_t   maxRecords)
 {
    logger_->debug("Decompressing LDM Records");
 
    std::size_t numRecords = 0;
 
-   while (is.peek() != EOF)
+   while (numRecords < maxRecords && is.peek() != EOF)
    {
       std::streampos startPosition = is.tellg();
       std::int32_t   controlWord   = 0;
@@ -317,7 +467,7 @@ std::size_t Ar2vFileImpl::DecompressLDMRecords(std::istream& is)
    return numRecords;
 }
 
-void Ar2vFileImpl::ParseLDMRecords()
+void Ar2vFileImpl::ParseLDMRecords(bool metadataOnly)
 {
    logger_->debug("Parsing LDM Records");
 
@@ -329,19 +479,24 @@ void Ar2vFileImpl::ParseLDMRecords()
 
       logger_->trace("Record {}", count++);
 
-      ParseLDMRecord(ss);
+      ParseLDMRecord(ss, metadataOnly);
    }
 
    rawRecords_.clear();
 }
 
-void Ar2vFileImpl::ParseLDMRecord(std::istream& is)
+void Ar2vFileImpl::ParseLDMRecord(std::istream& is, bool metadataOnly)
 {
    static constexpr std::size_t kDefaultSegmentSize = 2432;
    static constexpr std::size_t kCtmHeaderSize      = 12;
 
    auto ctx = rda::Level2MessageFactory::CreateContext();
 
+   std::vector<LDMMessage> messages {};
+
+   // Scan the message boundaries of the record. Single segment radials are
+   // buffered, and decoded in parallel once the scan is complete. Other
+   // messages may span multiple segments, and are decoded in sequence.
    while (!is.eof() && !is.fail())
    {
       // The communications manager inserts an extra 12 bytes at the beginning
@@ -363,6 +518,9 @@ void Ar2vFileImpl::ParseLDMRecord(std::istream& is)
       if (headerValid)
       {
          std::uint8_t messageType = messageHeader.message_type();
+         bool         singleSegment =
+            messageHeader.message_size() == 65535 ||
+            messageHeader.number_of_message_segments() == 1;
 
          // Each message requires 2432 bytes of storage, with the exception of
          // Message Types 29 and 31.
@@ -382,13 +540,41 @@ void Ar2vFileImpl::ParseLDMRecord(std::istream& is)
             }
          }
 
-         // Parse the current message
-         rda::Level2MessageInfo msgInfo =
-            rda::Level2MessageFactory::Create(is, ctx);
+         if (metadataOnly &&
+             (messageType ==
+                 static_cast<std::uint8_t>(rda::MessageId::DigitalRadarData) ||
+              messageType == static_cast<std::uint8_t>(
+                                rda::MessageId::DigitalRadarDataGeneric)))
+         {
+            // Metadata precedes radial data
+            break;
+         }
 
-         if (msgInfo.messageValid)
+         if (messageType == static_cast<std::uint8_t>(
+                               rda::MessageId::DigitalRadarDataGeneric) &&
+             singleSegment)
          {
-            HandleMessage(msgInfo.message);
+            // Buffer the radial, including its header
+            LDMMessage& message = messages.emplace_back();
+            message.data_.resize(messageSize);
+            is.read(message.data_.data(),
+                    static_cast<std::streamsize>(messageSize));
+            message.data_.resize(static_cast<std::size_t>(is.gcount()));
+         }
+         else if (!metadataOnly ||
+                  messageType ==
+                     static_cast<std::uint8_t>(rda::MessageId::RdaStatusData) ||
+                  messageType == static_cast<std::uint8_t>(
+                                    rda::MessageId::VolumeCoveragePatternData))
+         {
+            // Parse the current message
+            rda::Level2MessageInfo msgInfo =
+               rda::Level2MessageFactory::Create(is, ctx);
+
+            if (msgInfo.messageValid)
+            {
+               messages.emplace_back().message_ = msgInfo.message;
+            }
          }
       }
 
@@ -396,6 +582,46 @@ void Ar2vFileImpl::ParseLDMRecord(std::istream& is)
       is.seekg(messageStart + static_cast<std::streampos>(messageSize),
                std::ios_base::beg);
    }
+
+   // Radials are independent of each other, and are decoded in parallel
+   std::for_each(std::execution::par,
+                 messages.begin(),
+                 messages.end(),
+                 [](LDMMessage& message)
+                 {
+                    if (message.data_.empty())
+                    {
+                       return;
+                    }
+
+                    {
+                       auto radialCtx =
+                          rda::Level2MessageFactory::CreateContext();
+                       util::vectorbuf radialBuffer {message.data_};
+                       std::istream    radialStream {&radialBuffer};
+                       radialBuffer.update_read_pointers(message.data_.size());
+
+                       rda::Level2MessageInfo msgInfo =
+                          rda::Level2MessageFactory::Create(radialStream,
+                                                            radialCtx);
+
+                       if (msgInfo.messageValid)
+                       {
+                          message.message_ = msgInfo.message;
+                       }
+                    }
+
+                    std::vector<char>().swap(message.data_);
+                 });
+
+   // Handle messages in record order, so later radials replace earlier ones
+   for (auto& message : messages)
+   {
+      if (message.message_ != nullptr)
+      {
+         HandleMessage(message.message_);
+      }
+   }
 }
 
 void Ar2vFileImpl::HandleMessage(std::shared_ptr<rda::Level2Message>& message)
@@ -409,6 +635,10 @@ void Ar2vFileImpl::HandleMessage(std::shared_ptr<rda::Level2Message>& message)
          std::static_pointer_cast<rda::VolumeCoveragePatternData>(message);
       break;
 
+   case static_cast<std::uint8_t>(rda::MessageId::RdaStatusData):
+      rdaStatusData_ = std::static_pointer_cast<rda::RdaStatusData>(message);
+      break;
+
    case static_cast<std::uint8_t>(rda::MessageId::DigitalRadarData):
    case static_cast<std::uint8_t>(rda::MessageId::DigitalRadarDataGeneric):
       ProcessRadarData(
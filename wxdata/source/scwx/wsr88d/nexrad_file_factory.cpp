@@ -2,6 +2,7 @@
 #include <scwx/wsr88d/ar2v_file.hpp>
 #include <scwx/wsr88d/level3_file.hpp>
 #include <scwx/util/logger.hpp>
+#include <scwx/util/trace.hpp>
 
 #include <fstream>
 #include <sstream>
@@ -62,6 +63,8 @@ NexradFileFactory::Create(const std::string& filename)
 
 std::shared_ptr<NexradFile> NexradFileFactory::Create(std::istream& is)
 {
+   util::TraceSpan span {util::TraceStage::FileDecode};
+
    std::shared_ptr<NexradFile> message = nullptr;
 
    std::istream*     pis      = &is;
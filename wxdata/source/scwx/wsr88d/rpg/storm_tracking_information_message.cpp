@@ -182,6 +182,20 @@ StormTrackingInformationMessage::sti_record(const std::string& stormId) const
    return record;
 }
 
+std::vector<std::shared_ptr<const StormTrackingInformationMessage::StiRecord>>
+StormTrackingInformationMessage::sti_records() const
+{
+   std::vector<std::shared_ptr<const StiRecord>> records {};
+   records.reserve(p->stiRecords_.size());
+
+   for (auto& record : p->stiRecords_)
+   {
+      records.push_back(record.second);
+   }
+
+   return records;
+}
+
 std::shared_ptr<StormTrackingInformationMessage::StiRecord>&
 StormTrackingInformationMessage::Impl::GetOrCreateStiRecord(
    const std::string& stormId)
@@ -60,16 +60,25 @@ set(SRC_NETWORK source/scwx/network/cpr.cpp
 set(HDR_PROVIDER include/scwx/provider/aws_level2_data_provider.hpp
                  include/scwx/provider/aws_level3_data_provider.hpp
                  include/scwx/provider/aws_nexrad_data_provider.hpp
+                 include/scwx/provider/event_pack.hpp
+                 include/scwx/provider/event_pack_nexrad_data_provider.hpp
+                 include/scwx/provider/event_pack_warnings_provider.hpp
+                 include/scwx/provider/event_pack_writer.hpp
                  include/scwx/provider/nexrad_data_provider.hpp
                  include/scwx/provider/nexrad_data_provider_factory.hpp
                  include/scwx/provider/warnings_provider.hpp)
 set(SRC_PROVIDER source/scwx/provider/aws_level2_data_provider.cpp
                  source/scwx/provider/aws_level3_data_provider.cpp
                  source/scwx/provider/aws_nexrad_data_provider.cpp
+                 source/scwx/provider/event_pack.cpp
+                 source/scwx/provider/event_pack_nexrad_data_provider.cpp
+                 source/scwx/provider/event_pack_warnings_provider.cpp
+                 source/scwx/provider/event_pack_writer.cpp
                  source/scwx/provider/nexrad_data_provider.cpp
                  source/scwx/provider/nexrad_data_provider_factory.cpp
                  source/scwx/provider/warnings_provider.cpp)
-set(HDR_UTIL include/scwx/util/digest.hpp
+set(HDR_UTIL include/scwx/util/clock.hpp
+             include/scwx/util/digest.hpp
              include/scwx/util/enum.hpp
              include/scwx/util/environment.hpp
              include/scwx/util/float.hpp
@@ -82,8 +91,10 @@ set(HDR_UTIL include/scwx/util/digest.hpp
              include/scwx/util/strings.hpp
              include/scwx/util/threads.hpp
              include/scwx/util/time.hpp
+             include/scwx/util/trace.hpp
              include/scwx/util/vectorbuf.hpp)
-set(SRC_UTIL source/scwx/util/digest.cpp
+set(SRC_UTIL source/scwx/util/clock.cpp
+             source/scwx/util/digest.cpp
              source/scwx/util/environment.cpp
              source/scwx/util/float.cpp
              source/scwx/util/hash.cpp
@@ -93,6 +104,7 @@ set(SRC_UTIL source/scwx/util/digest.cpp
              source/scwx/util/strings.cpp
              source/scwx/util/time.cpp
              source/scwx/util/threads.cpp
+             source/scwx/util/trace.cpp
              source/scwx/util/vectorbuf.cpp)
 set(HDR_WSR88D include/scwx/wsr88d/ar2v_file.hpp
                include/scwx/wsr88d/level3_file.hpp